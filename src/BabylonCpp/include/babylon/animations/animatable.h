@@ -7,6 +7,9 @@ namespace BABYLON {
 
 class BABYLON_SHARED_EXPORT Animatable {
 
+public:
+  friend class SceneSnapshot;
+
 public:
   Animatable(Scene* scene, IAnimatable* target, int fromFrame = 0,
              int toFrame = 100, bool loopAnimation = false,
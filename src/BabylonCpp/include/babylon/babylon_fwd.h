@@ -109,7 +109,9 @@ struct UpdatePayload;
 class Worker;
 struct WorkerReply;
 // --- Core ---
+class FrameArena;
 struct Image;
+class MappedFile;
 struct NodeCache;
 // - Logging
 class LogChannel;
@@ -192,6 +194,8 @@ struct ISceneLoaderPlugin;
 struct ISceneLoaderPluginExtensions;
 class SceneLoader;
 // - Plugins / babylon
+class BabylonBinaryFile;
+struct BabylonBinaryFileLoader;
 struct BabylonFileLoader;
 // --- Materials ---
 // - Common
@@ -230,6 +234,8 @@ struct RawTexture;
 class RefractionTexture;
 class RenderTargetTexture;
 class Texture;
+class TextureStreamingManager;
+struct TextureStreamingStats;
 // - Textures / Procedurals
 class CustomProceduralTexture;
 class ProceduralTexture;
@@ -273,12 +279,15 @@ class Buffer;
 struct BufferPointer;
 class FacetParameters;
 class Geometry;
+class GeometryDeduplicator;
+class GeometryStreamingManager;
 class GroundMesh;
 struct IGetSetVerticesData;
 class InstancedMesh;
 class LinesMesh;
 class Mesh;
 class MeshBuilder;
+class MeshCodec;
 class MeshLODLevel;
 class SubMesh;
 class VertexBuffer;
@@ -344,6 +353,7 @@ class QuadraticMatrix;
 class Reference;
 class SimplificationQueue;
 class SimplificationSettings;
+struct SimplifiedGeometry;
 // --- Morph ---
 class MorphTarget;
 class MorphTargetManager;
@@ -422,12 +432,17 @@ class _AlphaState;
 class _DepthCullingState;
 class _StencilState;
 } // end of namespace Internals
-} // end of namespace BABYLON
 // --- Tools ---
+class AsyncImageLoader;
+class DerivedAssetCache;
 class EventState;
+class KhronosTextureContainer;
+class MipmapGenerator;
 class PackedRect;
+class SceneSnapshot;
 struct SerializationHelper;
 struct RectPackingMap;
+class TextureCompressor;
 // - Optimization
 class HardwareScalingOptimization;
 class LensFlaresOptimization;
@@ -440,6 +455,8 @@ struct SceneOptimizer;
 class SceneOptimizerOptions;
 class ShadowsOptimization;
 class TextureOptimization;
+} // end of namespace BABYLON
+
 namespace picojson {
 class value;
 typedef std::vector<value> array;
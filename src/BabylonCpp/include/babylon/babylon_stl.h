@@ -47,6 +47,7 @@
 #include <cmath>
 
 // Strings library
+#include <cstring>
 #include <string>
 
 // Function objects
@@ -59,6 +60,7 @@
 #include <regex>
 
 // Thread support
+#include <atomic>
 #include <future>
 #include <mutex>
 #include <thread>
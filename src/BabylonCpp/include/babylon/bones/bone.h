@@ -51,6 +51,7 @@ public:
   void _updateDifferenceMatrix();
   void _updateDifferenceMatrix(Matrix& rootMatrix);
   void markAsDirty(unsigned int property = 0) override;
+  bool markTargetAsDirty() const override;
   bool copyAnimationRange(Bone* source, const std::string& rangeName,
                           int frameOffset, bool rescaleAsRequired = false,
                           const Vector3& skelDimensionsRatio = Vector3(),
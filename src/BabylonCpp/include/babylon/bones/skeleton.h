@@ -79,7 +79,13 @@ public:
   Json::object serialize() const;
 
   // Statics
-  static Skeleton* Parse(const Json::value& parsedSkeleton, Scene* scene);
+  /**
+   * @brief Parses a skeleton. The animations of the bones can be decoded
+   * beforehand into boneAnimations, by bone index, the null entries being
+   * parsed here.
+   */
+  static Skeleton* Parse(const Json::value& parsedSkeleton, Scene* scene,
+                         const std::vector<Animation*>& boneAnimations = {});
 
   void computeAbsoluteTransforms(bool forceUpdate = false);
   Matrix* getPoseMatrix() const;
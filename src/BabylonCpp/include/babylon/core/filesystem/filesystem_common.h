@@ -164,6 +164,41 @@ inline bool writeFileContents(const char* filename, const std::string& contents)
   return writtentoFile;
 }
 
+/**
+ * @brief Writes binary data to a file through a temporary file renamed once
+ * written, so that a partially written file is never read. The temporary file
+ * is unique to the writer, so that writers of the same file, from other
+ * threads or processes, never write into each other's temporary file.
+ * @param path The path of the file to write to.
+ * @param data The data to write to the file.
+ * @param size The size of the data in bytes.
+ * @return Whether or not the file was written.
+ */
+inline bool writeFileAtomically(const std::string& path, const void* data,
+                                size_t size)
+{
+  static std::atomic<uint64_t> tmpCount{0};
+  std::ostringstream tmpPath;
+  tmpPath << path << "." << std::this_thread::get_id() << "."
+          << std::chrono::steady_clock::now().time_since_epoch().count() << "."
+          << tmpCount++ << ".tmp";
+  {
+    std::ofstream out(tmpPath.str(), std::ios::out | std::ios::binary);
+    out.write(static_cast<const char*>(data),
+              static_cast<std::streamsize>(size));
+    if (!out) {
+      out.close();
+      std::remove(tmpPath.str().c_str());
+      return false;
+    }
+  }
+  if (std::rename(tmpPath.str().c_str(), path.c_str()) != 0) {
+    std::remove(tmpPath.str().c_str());
+    return false;
+  }
+  return true;
+}
+
 /**
  * @brief Writes the given vector of strings to a file.
  * @param filename The path of the file to read from.
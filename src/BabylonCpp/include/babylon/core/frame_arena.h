@@ -0,0 +1,149 @@
+#ifndef BABYLON_CORE_FRAME_ARENA_H
+#define BABYLON_CORE_FRAME_ARENA_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Linear (bump) allocator for short-lived, per-frame temporaries.
+ *
+ * Allocations are served sequentially from large blocks and are never freed
+ * individually; the whole arena is recycled at once with reset(). When a
+ * frame needed more than one block, the blocks are merged into a single block
+ * on reset so that steady state rendering runs from one contiguous block.
+ */
+class BABYLON_SHARED_EXPORT FrameArena {
+
+public:
+  static constexpr size_t DefaultBlockSize = 64 * 1024;
+
+public:
+  FrameArena(size_t blockSize = DefaultBlockSize);
+  ~FrameArena();
+
+  FrameArena(const FrameArena&) = delete;
+  FrameArena& operator=(const FrameArena&) = delete;
+
+  /**
+   * @brief Allocates size bytes aligned on the given alignment.
+   */
+  void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+  /**
+   * @brief Releases memory. This is a no-op unless ptr is the most recent
+   * allocation, in which case the space is handed back to the arena (this
+   * makes in-place growth of the last allocated container cheap).
+   */
+  void deallocate(void* ptr, size_t size);
+
+  /**
+   * @brief Recycles all the memory handed out since the last reset.
+   */
+  void reset();
+
+  /**
+   * @brief Returns the number of allocations since the last reset.
+   */
+  size_t allocationCount() const;
+
+  /**
+   * @brief Returns the number of bytes handed out since the last reset.
+   */
+  size_t bytesAllocated() const;
+
+  /**
+   * @brief Returns the total size of the blocks owned by the arena.
+   */
+  size_t capacity() const;
+
+private:
+  struct Block {
+    std::unique_ptr<byte[]> data;
+    size_t size;
+  };
+
+  void _addBlock(size_t minSize);
+
+private:
+  size_t _blockSize;
+  std::vector<Block> _blocks;
+  size_t _currentBlock;
+  size_t _offset;
+  size_t _allocationCount;
+  size_t _bytesAllocated;
+
+}; // end of class FrameArena
+
+/**
+ * @brief STL compatible allocator backed by a FrameArena. A default
+ * constructed allocator (no arena) falls back to the global heap.
+ */
+template <class T>
+class FrameArenaAllocator {
+
+public:
+  using value_type = T;
+
+  FrameArenaAllocator() noexcept : _arena{nullptr}
+  {
+  }
+
+  explicit FrameArenaAllocator(FrameArena* arena) noexcept : _arena{arena}
+  {
+  }
+
+  template <class U>
+  FrameArenaAllocator(const FrameArenaAllocator<U>& other) noexcept
+      : _arena{other.arena()}
+  {
+  }
+
+  T* allocate(std::size_t n)
+  {
+    if (!_arena) {
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    return static_cast<T*>(_arena->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* ptr, std::size_t n) noexcept
+  {
+    if (!_arena) {
+      ::operator delete(ptr);
+      return;
+    }
+    _arena->deallocate(ptr, n * sizeof(T));
+  }
+
+  FrameArena* arena() const noexcept
+  {
+    return _arena;
+  }
+
+private:
+  FrameArena* _arena;
+
+}; // end of class FrameArenaAllocator
+
+template <class T, class U>
+bool operator==(const FrameArenaAllocator<T>& lhs,
+                const FrameArenaAllocator<U>& rhs) noexcept
+{
+  return lhs.arena() == rhs.arena();
+}
+
+template <class T, class U>
+bool operator!=(const FrameArenaAllocator<T>& lhs,
+                const FrameArenaAllocator<U>& rhs) noexcept
+{
+  return !(lhs == rhs);
+}
+
+// Containers allocating from a frame arena
+template <class T>
+using arena_vector = std::vector<T, FrameArenaAllocator<T>>;
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_FRAME_ARENA_H
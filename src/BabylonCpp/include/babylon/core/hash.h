@@ -41,6 +41,12 @@ HashValue Hash(const char* str, size_t len);
 HashValue Hash(string_view str);
 HashValue HashCaseInsensitive(const char* str, size_t len);
 
+// 64 bits hash of a binary buffer, e.g. vertex data, using the xxHash64
+// algorithm: https://github.com/Cyan4973/xxHash
+// The input is consumed in 32 bytes stripes by four independent accumulators,
+// which keeps the multipliers of the four lanes in flight in parallel.
+uint64_t Hash64(const void* data, size_t len, uint64_t seed = 0);
+
 namespace detail {
 
 // Helper function for performing the recursion for the compile time hash.
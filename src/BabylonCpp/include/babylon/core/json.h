@@ -7,9 +7,16 @@
 namespace BABYLON {
 namespace Json {
 
-inline std::string Parse(Json::value parsedData, const char* data)
+/**
+ * @brief Parses a JSON document with JsonReader.
+ * @returns The error message, empty on success.
+ */
+BABYLON_SHARED_EXPORT std::string Parse(Json::value& parsedData,
+                                        const char* data, size_t size);
+
+inline std::string Parse(Json::value& parsedData, const char* data)
 {
-  return picojson::parse(parsedData, data, data + strlen(data));
+  return Parse(parsedData, data, strlen(data));
 }
 
 template <class T,
@@ -97,23 +104,24 @@ inline std::string GetString(const picojson::value& v, const std::string& key,
   }
 }
 
-inline Json::array GetArray(const picojson::value& v, const std::string& key)
+inline const Json::array& GetArray(const picojson::value& v,
+                                   const std::string& key)
 {
+  static const Json::array emptyArray;
   if (v.contains(key) && v.get(key).is<Json::array>()) {
     return v.get(key).get<Json::array>();
   }
-  return Json::array();
+  return emptyArray;
 }
 
 template <typename T>
 inline std::vector<T> ToArray(const picojson::value& v, const std::string& key)
 {
   std::vector<T> array;
-  if (v.contains(key) && (v.get(key).is<picojson::array>())) {
-    array.reserve(v.get(key).get<picojson::array>().size());
-    for (auto& element : v.get(key).get<picojson::array>()) {
-      array.emplace_back(static_cast<T>(element.get<double>()));
-    }
+  const auto& elements = GetArray(v, key);
+  array.reserve(elements.size());
+  for (auto& element : elements) {
+    array.emplace_back(static_cast<T>(element.get<double>()));
   }
   return array;
 }
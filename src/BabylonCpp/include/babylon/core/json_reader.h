@@ -0,0 +1,135 @@
+#ifndef BABYLON_CORE_JSON_READER_H
+#define BABYLON_CORE_JSON_READER_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/core/json.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Single pass JSON parser calling a handler for each parsed token.
+ *
+ * The reader works in place on a buffer of known size: strings and whitespace
+ * are scanned 16 bytes at a time when SSE2 is available, and numbers are
+ * converted without going through an intermediate string. Arrays of numbers
+ * can be parsed straight into a float or uint32 buffer provided by the
+ * handler, instead of one callback per element.
+ */
+class BABYLON_SHARED_EXPORT JsonReader {
+
+public:
+  /**
+   * @brief Receives the parsed tokens, returning false stops the parsing.
+   */
+  class BABYLON_SHARED_EXPORT Handler {
+
+  public:
+    virtual ~Handler();
+
+    virtual bool null()                     = 0;
+    virtual bool boolean(bool value)        = 0;
+    virtual bool number(double value)       = 0;
+    virtual bool string(std::string& value) = 0;
+    virtual bool startObject()              = 0;
+    virtual bool key(std::string& key)      = 0;
+    virtual bool endObject()                = 0;
+    virtual bool startArray()               = 0;
+    virtual bool endArray()                 = 0;
+
+    /**
+     * @brief Called when an array starts, before startArray. When a buffer is
+     * returned the elements are parsed straight into it and no other callback
+     * is made for the array. The buffer is left empty and the array is parsed
+     * with the other callbacks when it holds anything else than numbers.
+     */
+    virtual Float32Array* floatArray();
+    virtual Uint32Array* uint32Array();
+
+  }; // end of class Handler
+
+public:
+  JsonReader(const char* data, size_t size);
+  ~JsonReader();
+
+  /**
+   * @brief Parses the first value of the data, the content following it is
+   * ignored.
+   * @returns The error message, empty on success.
+   */
+  std::string parse(Handler& handler);
+
+private:
+  bool _parseValue(Handler& handler, size_t depth);
+  bool _parseObject(Handler& handler, size_t depth);
+  bool _parseArray(Handler& handler, size_t depth);
+  template <typename T>
+  bool _parseNumbers(std::vector<T>& array);
+  bool _parseString(std::string& value);
+  bool _parseCodepoint(std::string& value);
+  bool _parseNumber(double& value);
+  bool _match(const char* literal, size_t length);
+  void _skipWhitespace();
+  bool _expect(char c);
+
+public:
+  // Maximum nesting of arrays and objects
+  static constexpr size_t MaxDepth = 512;
+
+private:
+  const char* _begin;
+  const char* _cur;
+  const char* _end;
+  // Strings and keys are parsed into this buffer, which handlers may swap
+  std::string _buffer;
+
+}; // end of class JsonReader
+
+/**
+ * @brief Builds the parsed tokens into a Json::value.
+ */
+class BABYLON_SHARED_EXPORT JsonDomBuilder : public JsonReader::Handler {
+
+public:
+  JsonDomBuilder(Json::value& root);
+  ~JsonDomBuilder();
+
+  bool null() override;
+  bool boolean(bool value) override;
+  bool number(double value) override;
+  bool string(std::string& value) override;
+  bool startObject() override;
+  bool key(std::string& key) override;
+  bool endObject() override;
+  bool startArray() override;
+  bool endArray() override;
+
+protected:
+  /**
+   * @brief Returns the number of arrays and objects being parsed.
+   */
+  size_t depth() const;
+
+  /**
+   * @brief Returns the array or object being parsed at the given depth,
+   * starting from 0 for the root.
+   */
+  const Json::value& container(size_t index) const;
+
+  /**
+   * @brief Returns the key of the value being parsed in the innermost object.
+   */
+  const std::string& currentKey() const;
+
+private:
+  Json::value* _add(Json::value&& value);
+
+private:
+  Json::value& _root;
+  std::vector<Json::value*> _containers;
+  std::string _key;
+
+}; // end of class JsonDomBuilder
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_JSON_READER_H
@@ -0,0 +1,49 @@
+#ifndef BABYLON_CORE_MAPPED_FILE_H
+#define BABYLON_CORE_MAPPED_FILE_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Read-only view of the content of a file.
+ *
+ * On unix systems the file is memory mapped, so that its pages are only read
+ * from disk when accessed. On other systems the file is read into memory.
+ */
+class BABYLON_SHARED_EXPORT MappedFile {
+
+public:
+  MappedFile();
+  MappedFile(const std::string& path);
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile(MappedFile&& other);
+  MappedFile& operator=(MappedFile&& other);
+
+  /**
+   * @brief Opens the file, closing the previously opened file.
+   * @returns Whether the file could be opened.
+   */
+  bool open(const std::string& path);
+  void close();
+
+  bool isOpen() const;
+  const uint8_t* data() const;
+  size_t size() const;
+
+private:
+  bool _isOpen;
+  const uint8_t* _data;
+  size_t _size;
+#ifndef __unix__
+  std::vector<uint8_t> _buffer;
+#endif
+
+}; // end of class MappedFile
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_MAPPED_FILE_H
@@ -0,0 +1,132 @@
+#ifndef BABYLON_CORE_SPAN_H
+#define BABYLON_CORE_SPAN_H
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace BABYLON {
+
+// A span is a non-owning view over a contiguous sequence of elements, e.g. the
+// data of a vertex buffer. It additionally carries the stride of the data, the
+// number of elements per vertex, so that vertex data can be walked without
+// looking up the kind of the buffer.
+
+// This class implements a subset of C++20's std::span. The view is only valid
+// as long as the underlying storage is neither resized nor destroyed.
+template <typename T>
+class span {
+public:
+  using element_type    = T;
+  using value_type      = typename std::remove_cv<T>::type;
+  using pointer         = T*;
+  using reference       = T&;
+  using iterator        = T*;
+  using const_iterator  = const T*;
+  using size_type       = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  span() : _data{nullptr}, _size{0}, _stride{1}
+  {
+  }
+
+  span(T* data, size_type size, size_type stride = 1)
+      : _data{data}, _size{size}, _stride{stride ? stride : 1}
+  {
+  }
+
+  // Views a std::vector, a const span can be created from a const vector.
+  template <typename U,
+            typename = typename std::enable_if<
+              std::is_same<typename std::remove_const<T>::type, U>::value>::type>
+  span(std::vector<U>& vector, size_type stride = 1)
+      : span(vector.data(), vector.size(), stride)
+  {
+  }
+
+  template <typename U,
+            typename = typename std::enable_if<
+              std::is_same<typename std::remove_const<T>::type, U>::value
+              && std::is_const<T>::value>::type>
+  span(const std::vector<U>& vector, size_type stride = 1)
+      : span(vector.data(), vector.size(), stride)
+  {
+  }
+
+  // Converts a mutable span into a read-only span.
+  template <typename U,
+            typename = typename std::enable_if<
+              std::is_same<const U, T>::value>::type>
+  span(const span<U>& other)
+      : span(other.data(), other.size(), other.stride())
+  {
+  }
+
+  span(const span& other) = default;
+  span& operator=(const span& other) = default;
+
+  pointer data() const
+  {
+    return _data;
+  }
+
+  // Returns the number of elements in the span.
+  size_type size() const
+  {
+    return _size;
+  }
+
+  bool empty() const
+  {
+    return _size == 0;
+  }
+
+  // Returns the number of elements per vertex.
+  size_type stride() const
+  {
+    return _stride;
+  }
+
+  // Returns the number of complete vertices in the span.
+  size_type vertexCount() const
+  {
+    return _size / _stride;
+  }
+
+  reference operator[](size_type index) const
+  {
+    return _data[index];
+  }
+
+  // Returns the component of a vertex.
+  reference at(size_type vertex, size_type component) const
+  {
+    return _data[vertex * _stride + component];
+  }
+
+  iterator begin() const
+  {
+    return _data;
+  }
+
+  iterator end() const
+  {
+    return _data + _size;
+  }
+
+  // Returns a copy of the viewed elements.
+  std::vector<value_type> toVector() const
+  {
+    return std::vector<value_type>(begin(), end());
+  }
+
+private:
+  T* _data;
+  size_type _size;
+  size_type _stride;
+
+}; // end of class span
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_SPAN_H
@@ -0,0 +1,117 @@
+#ifndef BABYLON_CORE_WORKER_POOL_H
+#define BABYLON_CORE_WORKER_POOL_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/core/shared_queue.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Pool of worker threads taking their tasks from a single queue.
+ *
+ * The loaders, texture tools and mesh tools of a program send their work to
+ * the shared pool, which has one thread less than the number of hardware
+ * threads, so that they do not oversubscribe the processor when they run at
+ * the same time. A pool of its own can still be created for a given number
+ * of threads.
+ */
+class BABYLON_SHARED_EXPORT WorkerPool {
+
+public:
+  using Task      = std::function<void()>;
+  using RangeTask = std::function<void(size_t first, size_t last)>;
+
+public:
+  /**
+   * @brief Returns the pool shared by the whole program, its threads are
+   * started on first use.
+   */
+  static std::shared_ptr<WorkerPool> Shared();
+
+  /**
+   * @brief Returns a new pool of the given number of threads, or the shared
+   * pool when the number of threads is 0.
+   */
+  static std::shared_ptr<WorkerPool> Create(size_t workerCount);
+
+  /**
+   * @brief Returns one thread less than the number of hardware threads, at
+   * least one thread.
+   */
+  static size_t DefaultWorkerCount();
+
+  WorkerPool(size_t workerCount);
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  /**
+   * @brief Queues a task, run by the first idle worker.
+   */
+  void send(Task task);
+
+  /**
+   * @brief Calls func on consecutive ranges of itemsPerTask items covering
+   * [0, count), from the calling thread and the workers, and returns once
+   * all the ranges are processed. The calling thread only waits for the
+   * ranges being processed by the workers, so that it can be a worker of the
+   * pool itself.
+   */
+  void parallelFor(size_t count, size_t itemsPerTask, const RangeTask& func);
+
+  /**
+   * @brief Runs the tasks as parallelFor() does, the calling thread and the
+   * workers taking the next task until all the tasks are taken, so that a
+   * few long tasks do not hold up the others.
+   */
+  void run(const std::vector<Task>& tasks);
+
+  size_t workerCount() const;
+
+private:
+  void _run();
+
+private:
+  SharedQueue<Task> _tasks;
+  std::vector<std::thread> _workers;
+
+}; // end of class WorkerPool
+
+/**
+ * @brief Tasks sent to a worker pool on behalf of an object, which waits for
+ * them before it is destroyed.
+ */
+class BABYLON_SHARED_EXPORT WorkerTaskGroup {
+
+public:
+  WorkerTaskGroup(std::shared_ptr<WorkerPool> pool);
+  ~WorkerTaskGroup();
+
+  WorkerTaskGroup(const WorkerTaskGroup&) = delete;
+  WorkerTaskGroup& operator=(const WorkerTaskGroup&) = delete;
+
+  /**
+   * @brief Queues a task to the pool of the group.
+   */
+  void send(WorkerPool::Task task);
+
+  /**
+   * @brief Returns once all the tasks sent to the group are run.
+   */
+  void wait();
+
+  WorkerPool& pool();
+  size_t workerCount() const;
+
+private:
+  std::shared_ptr<WorkerPool> _pool;
+  std::mutex _mutex;
+  std::condition_variable _idle;
+  size_t _taskCount;
+
+}; // end of class WorkerTaskGroup
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_WORKER_POOL_H
@@ -8,10 +8,14 @@
 #include <babylon/engine/engine_constants.h>
 #include <babylon/engine/engine_options.h>
 #include <babylon/interfaces/idisposable.h>
+#include <babylon/materials/textures/texture_cache.h>
 #include <babylon/materials/textures/texture_constants.h>
+#include <babylon/materials/textures/texture_streaming_manager.h>
 #include <babylon/math/size.h>
 #include <babylon/math/viewport.h>
 #include <babylon/mesh/buffer_pointer.h>
+#include <babylon/tools/memory_tracker.h>
+#include <babylon/tools/mipmap_generator.h>
 #include <babylon/tools/observable.h>
 #include <babylon/tools/perf_counter.h>
 
@@ -81,6 +85,32 @@ public:
   size_t drawCalls() const;
   PerfCounter& drawCallsPerfCounter();
 
+  /** Memory accounting **/
+
+  /**
+   * @brief Returns the tracker holding the number of bytes used by the GL
+   * resources created by this engine and by the CPU side vertex data copies.
+   */
+  MemoryTracker& memoryTracker();
+
+  /**
+   * @brief Returns the manager streaming the mip levels of the loaded textures
+   * according to their size on screen, disabled by default.
+   */
+  TextureStreamingManager& textureStreaming();
+
+  /**
+   * @brief Refreshes the memory usage of the categories which are measured by
+   * walking their owner (textures, render targets and effects).
+   */
+  void _updateMemoryStats();
+
+  /**
+   * @brief Returns the estimated GPU memory size of a texture in bytes,
+   * including its mip chain, cube faces and render target attachments.
+   */
+  static size_t GetTextureMemorySize(const GL::IGLTexture* texture);
+
   /** Methods **/
   void backupGLState();
   void restoreGLState();
@@ -191,11 +221,23 @@ public:
 
   /** VBOs **/
   GLBufferPtr createVertexBuffer(const Float32Array& vertices);
+  /**
+   * @brief Creates a static vertex buffer from packed (quantized) data.
+   */
+  GLBufferPtr createVertexBuffer(const Uint32Array& vertices);
   GLBufferPtr createDynamicVertexBuffer(const Float32Array& vertices);
   void updateDynamicVertexBuffer(const GLBufferPtr& vertexBuffer,
                                  const Float32Array& vertices, int offset = -1,
                                  int count = -1);
+  /**
+   * @brief Creates an index buffer, the indices are uploaded as 16 bits
+   * indices when none of them exceeds 65535.
+   */
   GLBufferPtr createIndexBuffer(const IndicesArray& indices);
+  /**
+   * @brief Creates an index buffer from indices already narrowed to 16 bits.
+   */
+  GLBufferPtr createIndexBuffer(const Uint16Array& indices);
   void bindArrayBuffer(GL::IGLBuffer* buffer);
   void bindUniformBuffer(GL::IGLBuffer* buffer);
   void bindUniformBufferBase(GL::IGLBuffer* buffer, unsigned int location);
@@ -333,6 +375,11 @@ public:
    */
   std::string&
   setTextureFormatToUse(const std::vector<std::string>& formatsAvailable);
+  /**
+   * @brief Returns whether block compressed data of the given GL internal
+   * format can be uploaded as is, according to the engine capabilities.
+   */
+  bool isCompressedTextureFormatSupported(unsigned int internalFormat) const;
   GL::IGLTexture* createTexture(const std::vector<std::string>& list,
                                 bool noMipmap, bool invertY, Scene* scene,
                                 unsigned int samplingMode
@@ -348,6 +395,38 @@ public:
                 const std::function<void()>& onError = nullptr,
                 Buffer* buffer = nullptr, GL::IGLTexture* fallBack = nullptr,
                 unsigned int format = EngineConstants::TEXTUREFORMAT_RGBA);
+  /**
+   * @brief Returns the loader decoding the images of the textures when
+   * asyncTextureLoading is enabled.
+   */
+  AsyncImageLoader& imageLoader();
+
+  /**
+   * @brief Returns the compressor of the textures loaded from image files when
+   * compressTexturesOnLoad is enabled.
+   */
+  TextureCompressor& textureCompressor();
+
+  /**
+   * @brief Returns the generator of the mip chains built on the CPU when
+   * cpuMipmapGeneration is enabled.
+   */
+  MipmapGenerator& mipmapGenerator();
+
+  /**
+   * @brief Uploads the images decoded since the last frame, within the
+   * textureUploadBudget.
+   */
+  void _processImageLoads();
+
+  /**
+   * @brief Returns the texture loaded from the url with the same settings and
+   * adds a reference to it, or nullptr if the texture was not loaded yet. A
+   * sampling mode of 0 matches any sampling mode.
+   */
+  GL::IGLTexture* _getTextureFromCache(const std::string& url, bool noMipmap,
+                                       unsigned int samplingMode,
+                                       bool invertY);
   void updateRawTexture(GL::IGLTexture* texture, const Uint8Array& data,
                         unsigned int format, bool invertY = true,
                         const std::string& compression = "");
@@ -490,6 +569,21 @@ private:
   void setProgram(GL::IGLProgram* program);
   void activateTexture(unsigned int texture);
   GL::GLenum _getInternalFormat(unsigned int format) const;
+  /** Textures cache **/
+  GL::IGLTexture* _getTextureFromContentCache(GL::IGLTexture* texture,
+                                              const Image& img);
+  void _prepareTextureFromImage(GL::IGLTexture* texture, Scene* scene,
+                                const Image& img, bool noMipmap, bool invertY,
+                                unsigned int samplingMode);
+  void _uploadMipmaps(const Image& img, GL::GLenum format,
+                      const MipmapOptions& options);
+  bool _prepareCompressedTexture(GL::IGLTexture* texture, Scene* scene,
+                                 const Uint8Array& data, bool isKTX,
+                                 bool noMipmap, bool invertY,
+                                 unsigned int samplingMode,
+                                 std::string& error);
+  void _queueTextureOnLoad(GL::IGLTexture* texture,
+                           const std::function<void()>& onLoad);
   GLRenderBufferPtr
   _setupFramebufferDepthAttachments(bool generateStencilBuffer,
                                     bool generateDepthBuffer, int width,
@@ -498,6 +592,9 @@ private:
                                                int width, int height,
                                                unsigned int textureType);
   /** VBOs **/
+  void _trackBuffer(GL::IGLBuffer* buffer, GL::GLenum target,
+                    size_t byteLength);
+  void _untrackBuffer(GL::IGLBuffer* buffer);
   void _resetVertexBufferBinding();
   void _resetIndexBufferBinding();
   /** FPS **/
@@ -518,6 +615,22 @@ public:
   bool preventCacheWipeBetweenFrames;
   // To enable/disable IDB support and avoid XHR on .manifest
   bool enableOfflineSupport;
+  // Decode the images of the textures on worker threads
+  bool asyncTextureLoading;
+  // Bytes of decoded images uploaded per frame when loading asynchronously,
+  // 0 uploads all the decoded images
+  size_t textureUploadBudget;
+  // Compress the textures loaded from image files to BC formats, cached on
+  // disk by textureCompressor(), when the hardware supports S3TC. An image is
+  // compressed on the worker pool and loaded uncompressed until then
+  bool compressTexturesOnLoad;
+  // Compress to BC7 instead of BC1 / BC3 when the hardware supports BPTC
+  bool highQualityTextureCompression;
+  // Build the mip chains of the textures with data on the CPU instead of the
+  // driver, off by default as the levels are then filtered when the textures
+  // are uploaded
+  bool cpuMipmapGeneration;
+  MipmapOptions mipmapOptions;
   std::vector<Scene*> scenes;
   // Observables
   /**
@@ -589,6 +702,8 @@ private:
 
   // Cache
   std::vector<GLTexturePtr> _loadedTexturesCache;
+  // Loaded textures indexed by url and by hash of their decoded content
+  TextureCache _textureCache;
   unsigned int _maxTextureChannels;
   unsigned int _activeTexture;
   std::unordered_map<unsigned int, GL::IGLTexture*> _activeTexturesCache;
@@ -617,6 +732,18 @@ private:
   // Hardware supported Compressed Textures
   std::vector<std::string> _texturesSupported;
   std::string _textureFormatInUse;
+  // Memory accounting
+  MemoryTracker _memoryTracker;
+  // Texture streaming
+  TextureStreamingManager _textureStreaming;
+  // Asynchronous image loading
+  std::unique_ptr<AsyncImageLoader> _imageLoader;
+  std::unordered_map<GL::IGLTexture*, size_t> _pendingImageLoads;
+  size_t _imageLoadCounter;
+  // Texture compression
+  std::unique_ptr<TextureCompressor> _textureCompressor;
+  // Mipmap generation
+  std::unique_ptr<MipmapGenerator> _mipmapGenerator;
 
 }; // end of class Engine
 
@@ -31,12 +31,15 @@ struct BABYLON_SHARED_EXPORT EngineCapabilities {
   int maxVertexUniformVectors;
   int maxFragmentUniformVectors;
   bool standardDerivatives;
-  GL::any s3tc;
-  GL::any pvrtc; // WEBGL_compressed_texture_pvrtc;
-  GL::any etc1;  // WEBGL_compressed_texture_etc1;
-  GL::any etc2;  // WEBGL_compressed_texture_etc;
-  GL::any astc;  // WEBGL_compressed_texture_astc;
-  GL::any atc;   // WEBGL_compressed_texture_atc;
+  bool s3tc;  // GL_EXT_texture_compression_s3tc
+  bool rgtc;  // GL_ARB_texture_compression_rgtc
+  bool bptc;  // GL_ARB_texture_compression_bptc
+  bool pvrtc; // GL_IMG_texture_compression_pvrtc
+  bool etc1;  // GL_OES_compressed_ETC1_RGB8_texture
+  bool etc2;  // GL_ARB_ES3_compatibility
+  bool astc;  // GL_KHR_texture_compression_astc_ldr
+  bool atc;   // GL_AMD_compressed_ATC_texture
+  bool textureSRGB;
   bool textureFloat;
   bool vertexArrayObject;
   bool textureAnisotropicFilterExtension;
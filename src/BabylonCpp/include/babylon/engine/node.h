@@ -50,11 +50,11 @@ public:
   /**
    * Is this node enabled.
    * If the node has a parent and is enabled, the parent will be inspected as
-   * well.
+   * well, unless checkAncestors is false.
    * @return {boolean} whether this node (and its parent) is enabled.
    * @see setEnabled
    */
-  bool isEnabled();
+  bool isEnabled(bool checkAncestors = true);
   /**
    * Set the enabled state of this node.
    * @param {boolean} value - the new enabled state
@@ -3,6 +3,7 @@
 
 #include <babylon/animations/ianimatable.h>
 #include <babylon/babylon_global.h>
+#include <babylon/core/frame_arena.h>
 #include <babylon/core/structs.h>
 #include <babylon/culling/octrees/octree.h>
 #include <babylon/engine/pointer_info.h>
@@ -12,6 +13,7 @@
 #include <babylon/math/matrix.h>
 #include <babylon/math/plane.h>
 #include <babylon/tools/observable.h>
+#include <babylon/tools/memory_tracker.h>
 #include <babylon/tools/observer.h>
 #include <babylon/tools/perf_counter.h>
 
@@ -22,6 +24,9 @@ namespace BABYLON {
  */
 class BABYLON_SHARED_EXPORT Scene : public IAnimatable, public IDisposable {
 
+public:
+  friend class SceneSnapshot;
+
 public:
   // Statics
   static constexpr unsigned int FOGMODE_NONE   = 0;
@@ -135,6 +140,18 @@ public:
   BoundingBoxRenderer* getBoundingBoxRenderer();
   OutlineRenderer* getOutlineRenderer();
   Engine* getEngine();
+
+  /**
+   * @brief Returns the manager loading the vertex data of the delay loaded
+   * geometries and meshes, created on first use.
+   */
+  GeometryStreamingManager& geometryStreaming();
+
+  /**
+   * @brief Returns the queue simplifying the meshes, created on first use.
+   */
+  SimplificationQueue& getSimplificationQueue();
+
   size_t getTotalVertices() const;
   PerfCounter& totalVerticesPerfCounter();
   size_t getActiveIndices() const;
@@ -156,6 +173,35 @@ public:
   PerfCounter& particlesDurationPerfCounter();
   microsecond_t getSpritesDuration() const;
   PerfCounter& spriteDuractionPerfCounter();
+  size_t getFrameAllocations() const;
+  PerfCounter& frameAllocationsPerfCounter();
+
+  /**
+   * @brief Returns the arena used for per-frame temporaries. The arena is
+   * reset at the beginning of each call to render(), memory obtained from it
+   * must not be kept across frames.
+   */
+  FrameArena& frameArena();
+
+  /** Memory accounting **/
+
+  /**
+   * @brief Returns the memory tracker of the engine, use it to set soft
+   * budgets and to observe when they are exceeded.
+   */
+  MemoryTracker& memoryTracker();
+
+  /**
+   * @brief Returns the current memory usage per category, including the
+   * physics of this scene and the resident set size of the process.
+   */
+  MemorySnapshot getMemoryStats();
+
+  /**
+   * @brief Returns the memory usage of the last frame, captured on the first
+   * call after the frame was rendered.
+   */
+  const MemorySnapshot& getLastFrameMemorySnapshot();
   float getAnimationRatio() const;
   int getRenderId() const;
   void incrementRenderId();
@@ -180,9 +226,18 @@ public:
   void registerAfterRender(const std::function<void()>& func);
   void unregisterAfterRender(const std::function<void()>& func);
   void _addPendingData(Mesh* mesh);
+  void _addPendingData(Geometry* geometry);
   void _addPendingData(GL::IGLTexture* texure);
+  void _removePendingData(Mesh* mesh);
+  void _removePendingData(Geometry* geometry);
   void _removePendingData(GL::IGLTexture* texture);
-  void getWaitingItemsCount();
+
+  /**
+   * @brief Returns the projected diameter in pixels of the bounding sphere of a
+   * mesh seen from the active camera.
+   */
+  float _getScreenSize(AbstractMesh* mesh);
+  size_t getWaitingItemsCount() const;
 
   /**
    * @brief Registers a function to be executed when the scene is ready.
@@ -353,6 +408,12 @@ public:
    */
   Geometry* getGeometryByID(const std::string& id);
 
+  /**
+   * @brief Makes getGeometryByID() return the passed geometry for the passed
+   * id, used when a geometry is merged into an identical one at load time.
+   */
+  void addGeometryAlias(const std::string& id, Geometry* geometry);
+
   /**
    * @brief Add a new geometry to this scene.
    * @param {BABYLON.Geometry} geometry - the geometry to be added to the scene.
@@ -629,10 +690,12 @@ private:
   void _evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh);
   void _evaluateActiveMeshes();
   void _activeMesh(AbstractMesh* mesh);
+  void _requestTextureLevels(AbstractMesh* mesh, Material* material);
   void _renderForCamera(Camera* camera);
   void _processSubCameras(Camera* camera);
   void _checkIntersections();
   void _updateAudioParameters();
+  MemorySnapshot _captureMemorySnapshot();
   /** Pointers handling **/
   void _onPointerMoveEvent(PointerEvent&& evt);
   void _onPointerDownEvent(PointerEvent&& evt);
@@ -858,7 +921,7 @@ public:
   // Sound Tracks
   std::unique_ptr<SoundTrack> mainSoundTrack;
   std::vector<SoundTrack*> soundTracks;
-  // Simplification Queue
+  // Simplification Queue, null until a mesh is simplified
   std::unique_ptr<SimplificationQueue> simplificationQueue;
   // Performance counters
   PerfCounter _activeIndices;
@@ -946,6 +1009,8 @@ private:
   bool _lightsEnabled;
   // Geometries
   std::vector<std::unique_ptr<Geometry>> _geometries;
+  std::unordered_map<std::string, std::string> _geometryAliases;
+  std::unique_ptr<GeometryStreamingManager> _geometryStreaming;
   // Materials
   Material* _defaultMaterial;
   // Textures
@@ -975,6 +1040,13 @@ private:
   PerfCounter _evaluateActiveMeshesDuration;
   PerfCounter _renderTargetsDuration;
   PerfCounter _renderDuration;
+  PerfCounter _frameAllocations;
+  // Per-frame temporaries
+  FrameArena _frameArena;
+  // Memory accounting
+  MemorySnapshot _lastFrameMemorySnapshot;
+  // Texture streaming, textures of the material of the current mesh
+  std::vector<BaseTexture*> _activeTextures;
   float _animationRatio;
   bool _animationTimeLastSet;
   high_res_time_point_t _animationTimeLast;
@@ -985,7 +1057,8 @@ private:
   bool _intermediateRendering;
   int _viewUpdateFlag;
   int _projectionUpdateFlag;
-  std::vector<std::string> _pendingData;
+  // Textures, meshes and geometries being loaded
+  std::vector<void*> _pendingData;
   std::vector<Mesh*> _activeMeshes;
   std::vector<Material*> _processedMaterials;
   std::vector<RenderTargetTexture*> _renderTargets;
@@ -172,13 +172,15 @@ enum GLEnums : GLenum {
   /* HintTarget */
   GENERATE_MIPMAP_HINT = 0x8192,
   /* DataType */
-  BYTE           = 0x1400,
-  UNSIGNED_BYTE  = 0x1401,
-  SHORT          = 0x1402,
-  UNSIGNED_SHORT = 0x1403,
-  INT            = 0x1404,
-  UNSIGNED_INT   = 0x1405,
-  FLOAT          = 0x1406,
+  BYTE               = 0x1400,
+  UNSIGNED_BYTE      = 0x1401,
+  SHORT              = 0x1402,
+  UNSIGNED_SHORT     = 0x1403,
+  INT                = 0x1404,
+  UNSIGNED_INT       = 0x1405,
+  FLOAT              = 0x1406,
+  HALF_FLOAT         = 0x140B,
+  INT_2_10_10_10_REV = 0x8D9F,
   /* PixelFormat */
   DEPTH_COMPONENT = 0x1902,
   ALPHA           = 0x1906,
@@ -246,6 +248,8 @@ enum GLEnums : GLenum {
   TEXTURE_MIN_FILTER = 0x2801,
   TEXTURE_WRAP_S     = 0x2802,
   TEXTURE_WRAP_T     = 0x2803,
+  TEXTURE_BASE_LEVEL = 0x813C,
+  TEXTURE_MAX_LEVEL  = 0x813D,
   /* TextureTarget */
   TEXTURE_2D                  = 0x0DE1,
   TEXTURE                     = 0x1702,
@@ -377,6 +381,48 @@ enum GLEnums : GLenum {
   CONTEXT_LOST_WEBGL                 = 0x9242,
   UNPACK_COLORSPACE_CONVERSION_WEBGL = 0x9243,
   BROWSER_DEFAULT_WEBGL              = 0x9244,
+  /* Compressed texture formats */
+  // GL_EXT_texture_compression_s3tc
+  COMPRESSED_RGB_S3TC_DXT1_EXT  = 0x83F0,
+  COMPRESSED_RGBA_S3TC_DXT1_EXT = 0x83F1,
+  COMPRESSED_RGBA_S3TC_DXT3_EXT = 0x83F2,
+  COMPRESSED_RGBA_S3TC_DXT5_EXT = 0x83F3,
+  // GL_EXT_texture_sRGB
+  COMPRESSED_SRGB_S3TC_DXT1_EXT       = 0x8C4C,
+  COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT = 0x8C4D,
+  COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT = 0x8C4E,
+  COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT = 0x8C4F,
+  // GL_ARB_texture_compression_rgtc
+  COMPRESSED_RED_RGTC1        = 0x8DBB,
+  COMPRESSED_SIGNED_RED_RGTC1 = 0x8DBC,
+  COMPRESSED_RG_RGTC2         = 0x8DBD,
+  COMPRESSED_SIGNED_RG_RGTC2  = 0x8DBE,
+  // GL_ARB_texture_compression_bptc
+  COMPRESSED_RGBA_BPTC_UNORM       = 0x8E8C,
+  COMPRESSED_SRGB_ALPHA_BPTC_UNORM = 0x8E8D,
+  // GL_OES_compressed_ETC1_RGB8_texture
+  ETC1_RGB8_OES = 0x8D64,
+  // GL_ARB_ES3_compatibility
+  COMPRESSED_RGB8_ETC2                      = 0x9274,
+  COMPRESSED_SRGB8_ETC2                     = 0x9275,
+  COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2  = 0x9276,
+  COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2 = 0x9277,
+  COMPRESSED_RGBA8_ETC2_EAC                 = 0x9278,
+  COMPRESSED_SRGB8_ALPHA8_ETC2_EAC          = 0x9279,
+  // GL_KHR_texture_compression_astc_ldr, first and last block sizes
+  COMPRESSED_RGBA_ASTC_4x4_KHR           = 0x93B0,
+  COMPRESSED_RGBA_ASTC_12x12_KHR         = 0x93BD,
+  COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR   = 0x93D0,
+  COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR = 0x93DD,
+  // GL_IMG_texture_compression_pvrtc
+  COMPRESSED_RGB_PVRTC_4BPPV1_IMG  = 0x8C00,
+  COMPRESSED_RGB_PVRTC_2BPPV1_IMG  = 0x8C01,
+  COMPRESSED_RGBA_PVRTC_4BPPV1_IMG = 0x8C02,
+  COMPRESSED_RGBA_PVRTC_2BPPV1_IMG = 0x8C03,
+  // GL_AMD_compressed_ATC_texture
+  ATC_RGB_AMD                     = 0x8C92,
+  ATC_RGBA_EXPLICIT_ALPHA_AMD     = 0x8C93,
+  ATC_RGBA_INTERPOLATED_ALPHA_AMD = 0x87EE,
   // IGL_EXT_texture_filter_anisotropic
   TEXTURE_MAX_ANISOTROPY_EXT     = 0x84FE,
   MAX_TEXTURE_MAX_ANISOTROPY_EXT = 0x84FF
@@ -386,7 +432,12 @@ class BABYLON_SHARED_EXPORT IGLBuffer {
 
 public:
   IGLBuffer(GLuint _value)
-      : references{1}, is32Bits{true}, capacity{1}, value{_value}
+      : references{1}
+      , is32Bits{true}
+      , capacity{1}
+      , value{_value}
+      , target{0}
+      , byteLength{0}
   {
   }
 
@@ -395,6 +446,9 @@ public:
   bool is32Bits;
   unsigned int capacity;
   GLuint value;
+  // Memory accounting
+  GLenum target;
+  size_t byteLength;
 
 }; // end of class IGLBuffer
 
@@ -413,12 +467,14 @@ public:
 class BABYLON_SHARED_EXPORT IGLProgram {
 
 public:
-  IGLProgram(GLuint _value) : value{_value}
+  IGLProgram(GLuint _value) : value{_value}, byteLength{0}
   {
   }
 
 public:
   GLuint value;
+  // Memory accounting (size of the shader sources)
+  size_t byteLength;
 
 }; // end of class IGLProgram
 
@@ -472,12 +528,16 @@ public:
       , isReady{false}
       , generateMipMaps{false}
       , noMipmap{false}
+      , invertY{false}
       , type{0}
       , _cachedWrapU{0}
       , _cachedWrapV{0}
       , _cachedCoordinatesMode{0}
       , _generateDepthBuffer{false}
       , _generateStencilBuffer{false}
+      , _residentMipLevel{0}
+      , _contentHash{0}
+      , _compressedByteLength{0}
       , url{""}
       , _framebuffer{nullptr}
       , _depthBuffer{nullptr}
@@ -498,12 +558,19 @@ public:
   bool isReady;
   bool generateMipMaps;
   bool noMipmap;
+  bool invertY;
   unsigned int type;
   unsigned int _cachedWrapU;
   unsigned int _cachedWrapV;
   unsigned int _cachedCoordinatesMode;
   bool _generateDepthBuffer;
   bool _generateStencilBuffer;
+  // Finest mip level uploaded when the texture is streamed, 0 otherwise
+  unsigned int _residentMipLevel;
+  // Hash of the decoded image data, 0 if not loaded from a file
+  uint64_t _contentHash;
+  // Size of the uploaded block compressed levels, 0 if not compressed
+  size_t _compressedByteLength;
   std::string url;
   std::unique_ptr<IGLFramebuffer> _framebuffer;
   std::unique_ptr<IGLFramebuffer> _MSAAFramebuffer;
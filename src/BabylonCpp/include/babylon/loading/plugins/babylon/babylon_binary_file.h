@@ -0,0 +1,122 @@
+#ifndef BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_BINARY_FILE_H
+#define BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_BINARY_FILE_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Types of the blobs of a binary scene file.
+ */
+enum class BinaryBlobType : uint32_t {
+  FLOAT32 = 0,
+  UINT32  = 1,
+  // Vertex attributes and indices encoded by the MeshCodec, the number of
+  // elements of these blobs is their size in bytes
+  ENCODED_FLOAT32 = 2,
+  ENCODED_UINT32  = 3
+}; // end of enum class BinaryBlobType
+
+/**
+ * @brief Read only view of a binary scene file (.babylonbin).
+ *
+ * A binary scene file holds the scene graph of a .babylon file as compact
+ * JSON, without the vertex data, and the vertex attributes and indices of its
+ * geometries as raw little endian blobs:
+ * - a 32 bytes header: the magic "BJSB", the version, the length of the scene
+ *   graph, the number of blobs, the offset of the blob table and the file size
+ * - the scene graph
+ * - the blob table: the offset, number of elements and type of each blob
+ * - the blobs, aligned on 16 bytes so that they can be read in place from a
+ *   mapped file
+ * The geometries reference their blobs by index in a "blobs" object keyed by
+ * attribute name, e.g. "blobs": {"positions": 0, "indices": 1}. The inline
+ * geometries of the meshes are converted to shared vertex data geometries.
+ * The delay loading files of incremental scenes are converted the same way,
+ * the "blobs" object then being at the root of the scene graph.
+ * The blobs can be encoded by the MeshCodec, they are then decoded when the
+ * vertex data is read instead of being copied.
+ */
+class BABYLON_SHARED_EXPORT BabylonBinaryFile {
+
+public:
+  static constexpr uint32_t Version     = 1;
+  static constexpr size_t Alignment     = 16;
+  static constexpr size_t HeaderSize    = 32;
+  static constexpr size_t BlobEntrySize = 24;
+
+public:
+  /**
+   * @brief Constructor, the data is not copied and must outlive the view.
+   */
+  BabylonBinaryFile(const uint8_t* data, size_t size);
+  BabylonBinaryFile(const std::string& data);
+  ~BabylonBinaryFile();
+
+  /**
+   * @brief Returns whether the header and the blob table are consistent with
+   * the size of the data.
+   */
+  bool isValid() const;
+
+  /**
+   * @brief Returns the scene graph, in the .babylon JSON format.
+   */
+  std::string sceneGraph() const;
+
+  size_t blobCount() const;
+
+  /**
+   * @brief Returns the elements of a blob, nullptr when the blob does not
+   * exist or does not have the given type.
+   */
+  const uint8_t* blobData(size_t index, BinaryBlobType type,
+                          size_t& count) const;
+
+  /**
+   * @brief Copies or decodes the elements of a blob.
+   * @returns Whether the blob exists, has the expected type and is valid.
+   */
+  bool getFloats(size_t index, Float32Array& array) const;
+  bool getIndices(size_t index, IndicesArray& array) const;
+
+  /**
+   * @brief Returns the vertex data referenced by the "blobs" object of a
+   * parsed geometry, nullptr when a blob is missing.
+   */
+  std::unique_ptr<VertexData>
+  getVertexData(const Json::value& parsedVertexData) const;
+
+  /**
+   * @brief Returns whether the data starts with the magic of binary scene
+   * files.
+   */
+  static bool IsBinaryFile(const uint8_t* data, size_t size);
+
+  /**
+   * @brief Converts the content of a .babylon file to a binary scene file.
+   * @param encodeBlobs Whether the blobs are encoded by the MeshCodec.
+   * @return The binary scene file, empty when the JSON is not valid
+   */
+  static std::string FromBabylon(const std::string& json,
+                                 bool encodeBlobs = false);
+
+  /**
+   * @brief Converts a .babylon file to a binary scene file.
+   */
+  static bool ConvertFile(const std::string& babylonFile,
+                          const std::string& binaryFile,
+                          bool encodeBlobs = false);
+
+private:
+  const uint8_t* _data;
+  size_t _size;
+  bool _isValid;
+  size_t _blobCount;
+  uint64_t _blobTableOffset;
+
+}; // end of class BabylonBinaryFile
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_BINARY_FILE_H
@@ -0,0 +1,43 @@
+#ifndef BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_BINARY_FILE_LOADER_H
+#define BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_BINARY_FILE_LOADER_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/loading/plugins/babylon/babylon_file_loader.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Loader of binary scene files (.babylonbin).
+ *
+ * The scene graph is parsed as a .babylon file, while the vertex data of the
+ * geometries is copied from the blobs of the file, without number parsing.
+ */
+struct BABYLON_SHARED_EXPORT BabylonBinaryFileLoader
+    : public BabylonFileLoader {
+
+  BabylonBinaryFileLoader(size_t workerCount = 0);
+  virtual ~BabylonBinaryFileLoader();
+
+  bool importMesh(const std::vector<std::string>& meshesNames, Scene* scene,
+                  const std::string& data, const std::string& rootUrl,
+                  std::vector<AbstractMesh*>& meshes,
+                  std::vector<ParticleSystem*>& particleSystems,
+                  std::vector<Skeleton*>& skeletons) override;
+  bool load(Scene* scene, const std::string& data,
+            const std::string& rootUrl) override;
+
+protected:
+  void decodeVertexData(const Json::value& parsedVertexData,
+                        std::unique_ptr<VertexData>& vertexData) const override;
+  Geometry* parseGeometry(const Json::value& parsedVertexData, Scene* scene,
+                          const std::string& rootUrl) override;
+
+private:
+  // The file being loaded
+  const BabylonBinaryFile* _file;
+
+}; // end of struct BabylonBinaryFileLoader
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_PLUGINS_BABYLON_BABYLON_BINARY_FILE_LOADER_H
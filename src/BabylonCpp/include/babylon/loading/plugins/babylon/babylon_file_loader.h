@@ -6,13 +6,34 @@
 
 namespace BABYLON {
 
+class WorkerPool;
+
+/**
+ * @brief Loader of .babylon files.
+ *
+ * Loading runs in two phases: the vertex data of the geometries and the
+ * animations of the scene and of the skeletons are first decoded from the
+ * parsed file on the shared worker pool, then the scene objects and their
+ * GL resources are created on the calling thread.
+ */
 struct BABYLON_SHARED_EXPORT BabylonFileLoader : public ISceneLoaderPlugin {
 
-  BabylonFileLoader();
+  /**
+   * @brief Constructor.
+   * @param workerCount The number of worker threads of a pool of its own
+   * decoding the parsed file, 0 uses the shared worker pool.
+   */
+  BabylonFileLoader(size_t workerCount = 0);
   virtual ~BabylonFileLoader();
 
-  Material* parseMaterialById(const std::string& id,
-                              const Json::value& parsedData, Scene* scene,
+  BabylonFileLoader(const BabylonFileLoader&) = delete;
+  BabylonFileLoader& operator=(const BabylonFileLoader&) = delete;
+
+  /**
+   * @brief Parses the material with the given id of the file being loaded.
+   * @returns The material, nullptr when the file has no such material.
+   */
+  Material* parseMaterialById(const std::string& id, Scene* scene,
                               const std::string& rootUrl) const;
   bool isDescendantOf(const Json::value& mesh,
                       const std::vector<std::string>& names,
@@ -29,6 +50,75 @@ struct BABYLON_SHARED_EXPORT BabylonFileLoader : public ISceneLoaderPlugin {
   bool load(Scene* scene, const std::string& data,
             const std::string& rootUrl) override;
 
+  size_t workerCount() const;
+
+protected:
+  /**
+   * @brief Decodes the vertex data of a parsed geometry into vertexData, which
+   * holds the arrays already parsed from the file if any, and is reset when
+   * the vertex data cannot be decoded. Called from the worker threads, so it
+   * must neither touch the engine nor the scene.
+   */
+  virtual void decodeVertexData(const Json::value& parsedVertexData,
+                                std::unique_ptr<VertexData>& vertexData) const;
+
+  /**
+   * @brief Creates the vertex data geometry of a parsed geometry, returns
+   * nullptr when the geometry already exists.
+   */
+  virtual Geometry* parseGeometry(const Json::value& parsedVertexData,
+                                  Scene* scene, const std::string& rootUrl);
+
+  /**
+   * @brief Returns the vertex data decoded for the geometry with the given
+   * id, nullptr when it was not decoded.
+   */
+  std::unique_ptr<VertexData> takeVertexData(const std::string& id);
+
+private:
+  /**
+   * @brief Parses the content of a .babylon file, the arrays of the vertex
+   * data geometries being parsed straight into vertex data objects, and
+   * indexes its materials, geometries and skeletons by id.
+   * @returns The error message, empty on success.
+   */
+  std::string _parse(const std::string& data, Json::value& parsedData);
+
+  /**
+   * @brief Decodes, on the worker threads, the vertex data of the given
+   * geometries, the animations of the given skeletons and, when
+   * withAnimations is true, the animations of the scene.
+   */
+  void _decode(const Json::value& parsedData,
+               const std::vector<const Json::value*>& geometries,
+               const std::vector<const Json::value*>& skeletons,
+               bool withAnimations);
+
+  /**
+   * @brief Parses a skeleton with the animations of its bones decoded by
+   * _decode.
+   */
+  Skeleton* _parseSkeleton(const Json::value& parsedSkeleton, Scene* scene);
+
+  void _clear();
+
+private:
+  std::shared_ptr<WorkerPool> _pool;
+  // Per load state, vertex data parsed by _parse or decoded by _decode, by
+  // geometry id
+  std::unordered_map<std::string, std::unique_ptr<VertexData>> _vertexDatas;
+  // Parsed materials, multi materials and skeletons by id
+  std::unordered_map<std::string, const Json::value*> _materials;
+  std::unordered_map<std::string, const Json::value*> _multiMaterials;
+  std::unordered_map<std::string, const Json::value*> _skeletons;
+  // Parsed geometries by id, with their geometry type
+  std::unordered_map<std::string, std::pair<std::string, const Json::value*>>
+    _geometries;
+  // Decoded animations of the scene, and of the bones by skeleton
+  std::vector<Animation*> _animations;
+  std::unordered_map<const Json::value*, std::vector<Animation*>>
+    _boneAnimations;
+
 }; // end of struct BabylonFileLoader
 
 } // end of namespace BABYLON
@@ -18,6 +18,10 @@ public:
   static bool ForceFullSceneLoadingForIncremental;
   static bool ShowLoadingScreen;
   static unsigned int LoggingLevel;
+  // Merge the geometries with identical vertex data and indices
+  static bool DeduplicateGeometries;
+  // Replace the meshes sharing a merged geometry with instances
+  static bool ConvertDuplicatesToInstances;
 
 private:
   // Members
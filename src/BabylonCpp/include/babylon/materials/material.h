@@ -83,6 +83,12 @@ public:
   virtual bool needAlphaBlending();
   virtual bool needAlphaTesting();
   virtual BaseTexture* getAlphaTestTexture();
+  /**
+   * @brief Appends the 2D textures sampled by this material, used to request
+   * the mip levels to stream in for the meshes rendered with it. The vector is
+   * not cleared, so that the caller can reuse it from frame to frame.
+   */
+  virtual void getActiveTextures(std::vector<BaseTexture*>& textures);
   virtual void trackCreation(
     const std::function<void(const Effect* effect)>& onCompiled,
     const std::function<void(const Effect* effect, const std::string& errors)>&
@@ -33,6 +33,7 @@ public:
   /** Methods **/
   bool isReady(AbstractMesh* mesh = nullptr,
                bool useInstances  = false) override;
+  void getActiveTextures(std::vector<BaseTexture*>& textures) override;
   Material* clone(const std::string& _name,
                   bool cloneChildren = false) const override;
   Json::object serialize() const;
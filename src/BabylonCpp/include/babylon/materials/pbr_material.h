@@ -63,6 +63,7 @@ public:
   void bindOnlyWorldMatrix(Matrix& world) override;
   void bind(Matrix* world, Mesh* mesh) override;
   std::vector<IAnimatable*> getAnimatables();
+  void getActiveTextures(std::vector<BaseTexture*>& textures) override;
   virtual void dispose(bool forceDisposeEffect   = false,
                        bool forceDisposeTextures = false) override;
   Material* clone(const std::string& name,
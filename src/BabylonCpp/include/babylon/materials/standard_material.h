@@ -66,6 +66,7 @@ public:
   void unbind() override;
   void bindForSubMesh(Matrix* world, Mesh* mesh, SubMesh* subMesh) override;
   std::vector<IAnimatable*> getAnimatables();
+  void getActiveTextures(std::vector<BaseTexture*>& textures) override;
   virtual void dispose(bool forceDisposeEffect   = false,
                        bool forceDisposeTextures = false) override;
   Material* clone(const std::string& name,
@@ -44,7 +44,8 @@ public:
   bool canRescale();
   void _removeFromCache(const std::string& url, bool noMipmap);
   GL::IGLTexture* _getFromCache(const std::string& url, bool noMipmap,
-                                unsigned int sampling = 0);
+                                unsigned int sampling = 0,
+                                bool invertY          = false);
   virtual void delayLoad();
   std::vector<Animation*> getAnimations() override;
   std::unique_ptr<BaseTexture> clone() const;
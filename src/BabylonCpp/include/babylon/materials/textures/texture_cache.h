@@ -0,0 +1,55 @@
+#ifndef BABYLON_MATERIALS_TEXTURES_TEXTURE_CACHE_H
+#define BABYLON_MATERIALS_TEXTURES_TEXTURE_CACHE_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Loaded textures indexed by url and by hash of their decoded content.
+ *
+ * A texture shared by files with the same content is registered under the url
+ * of each of them. The urls of each texture are kept as well, so that removing
+ * a texture only looks up its own entries.
+ */
+class BABYLON_SHARED_EXPORT TextureCache {
+
+public:
+  TextureCache();
+  ~TextureCache();
+
+  /**
+   * @brief Returns a texture loaded from the url with the same mipmap and
+   * orientation settings and the same sampling mode, any sampling mode when
+   * samplingMode is 0. Returns nullptr when there is none.
+   */
+  GL::IGLTexture* getByUrl(const std::string& url, bool noMipmap,
+                           unsigned int samplingMode, bool invertY) const;
+
+  /**
+   * @brief Registers the texture under the url.
+   */
+  void addUrl(const std::string& url, GL::IGLTexture* texture);
+
+  /**
+   * @brief Returns a texture with the same content hash and settings as the
+   * passed texture. When there is none, the passed texture is registered under
+   * its content hash and nullptr is returned.
+   */
+  GL::IGLTexture* getOrAddContent(GL::IGLTexture* texture);
+
+  /**
+   * @brief Removes the texture from the cache, under all its urls.
+   */
+  void remove(GL::IGLTexture* texture);
+
+private:
+  std::unordered_multimap<std::string, GL::IGLTexture*> _texturesByUrl;
+  std::unordered_multimap<GL::IGLTexture*, std::string> _urlsByTexture;
+  std::unordered_multimap<uint64_t, GL::IGLTexture*> _texturesByContent;
+
+}; // end of class TextureCache
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATERIALS_TEXTURES_TEXTURE_CACHE_H
@@ -0,0 +1,125 @@
+#ifndef BABYLON_MATERIALS_TEXTURES_TEXTURE_STREAMING_MANAGER_H
+#define BABYLON_MATERIALS_TEXTURES_TEXTURE_STREAMING_MANAGER_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/core/structs.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Residency statistics of the streamed textures, refreshed by
+ * TextureStreamingManager::update().
+ */
+struct BABYLON_SHARED_EXPORT TextureStreamingStats {
+  size_t registeredTextures = 0;
+  // Number of textures with their finest mip level resident
+  size_t fullyResidentTextures = 0;
+  // GPU memory used by the resident mip levels
+  size_t residentBytes = 0;
+  // GPU memory needed by the mip levels required by the last frame
+  size_t requestedBytes = 0;
+  size_t budget         = 0;
+  // Number of finer mip levels streamed in during the last frame
+  size_t uploads = 0;
+  // Number of textures dropped to a coarser mip level during the last frame
+  size_t evictions = 0;
+}; // end of struct TextureStreamingStats
+
+/**
+ * @brief Streams the mip levels of the textures loaded by the engine according
+ * to their size on screen.
+ *
+ * A registered texture keeps its decoded mip chain in CPU memory and only has
+ * its coarse mip levels uploaded at first. Each frame, the scene requests the
+ * screen size of the meshes sampling the texture, the finest mip level needed
+ * at that size is then streamed in one level at a time. When the resident mip
+ * levels exceed the budget, the textures not seen for the longest time and the
+ * smallest ones on screen are dropped to coarser mip levels first.
+ *
+ * A mip level is made resident by uploading the mip chain starting at that
+ * level, so the texture object stays complete without requiring base level
+ * support from the rendering context.
+ */
+class BABYLON_SHARED_EXPORT TextureStreamingManager {
+
+public:
+  TextureStreamingManager(Engine* engine);
+  ~TextureStreamingManager();
+
+  TextureStreamingManager(const TextureStreamingManager&) = delete;
+  TextureStreamingManager& operator=(const TextureStreamingManager&) = delete;
+
+  /**
+   * @brief Sets the GPU memory budget of the streamed textures in bytes, 0
+   * disables the budget.
+   */
+  void setBudget(size_t bytes);
+  size_t budget() const;
+
+  /**
+   * @brief Builds the mip chain of the image with the mipmap generator of the
+   * engine and uploads its coarse mip levels to the texture, which must be
+   * bound to TEXTURE_2D.
+   */
+  void registerTexture(GL::IGLTexture* texture, const Image& image,
+                       bool invertY);
+  void unregisterTexture(GL::IGLTexture* texture);
+  bool isStreamed(GL::IGLTexture* texture) const;
+
+  /**
+   * @brief Requests the mip levels needed to display the texture over the
+   * given number of pixels during the current frame.
+   */
+  void requestScreenSize(GL::IGLTexture* texture, float screenSize);
+
+  /**
+   * @brief Streams in and evicts mip levels according to the requests of the
+   * frame, then clears the requests.
+   */
+  void update(int renderId);
+
+  const TextureStreamingStats& stats() const;
+
+  /**
+   * @brief Returns the finest mip level needed to display a texture over the
+   * given number of pixels.
+   */
+  static unsigned int GetRequiredMipLevel(int width, int height,
+                                          float screenSize,
+                                          unsigned int levelCount);
+
+private:
+  struct StreamedTexture {
+    GL::IGLTexture* texture;
+    std::vector<Image> mips;
+    // Number of bytes of the mip chain starting at each level
+    std::vector<size_t> chainSizes;
+    unsigned int coarsestLevel;
+    unsigned int targetLevel;
+    bool invertY;
+    float screenSize;
+    int lastRequestedRenderId;
+  }; // end of struct StreamedTexture
+
+  void _upload(StreamedTexture& entry, unsigned int level);
+  void _updateStats();
+
+public:
+  // Enables the streaming of the textures loaded afterwards
+  bool enabled;
+  // Maximum size of the coarse mip levels uploaded at load time
+  int initialMaxSize;
+  // Maximum number of finer mip levels streamed in per frame
+  unsigned int maxUploadsPerFrame;
+
+private:
+  Engine* _engine;
+  size_t _budget;
+  std::unordered_map<GL::IGLTexture*, StreamedTexture> _textures;
+  TextureStreamingStats _stats;
+
+}; // end of class TextureStreamingManager
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATERIALS_TEXTURES_TEXTURE_STREAMING_MANAGER_H
@@ -20,6 +20,17 @@ struct BABYLON_SHARED_EXPORT Scalar {
   static float Hermite(float value1, float tangent1, float value2,
                        float tangent2, float amount);
 
+  /**
+   * @brief Converts a float to an IEEE 754 half precision float, rounding to
+   * the nearest representable value.
+   */
+  static uint16_t ToHalfFloat(float value);
+
+  /**
+   * @brief Converts an IEEE 754 half precision float to a float.
+   */
+  static float FromHalfFloat(uint16_t value);
+
 }; // end of struct Scalar
 
 } // end of namespace BABYLON
@@ -256,6 +256,12 @@ public:
    */
   static Vector2 FromArray(const Float32Array& array, unsigned int offset = 0);
 
+  /**
+   * @brief Returns a new Vector2 set from the passed index element of the
+   * passed float buffer, e.g. a vertex data view.
+   */
+  static Vector2 FromArray(const float* array, unsigned int offset = 0);
+
   /**
    * @brief Sets "result" from the passed index element of the passed array or
    * Float32Array.
@@ -289,6 +289,12 @@ public:
    */
   static Vector3 FromArray(const Float32Array& array, unsigned int offset = 0);
 
+  /**
+   * @brief Returns a new Vector3 set from the index "offset" of the passed
+   * float buffer, e.g. a vertex data view.
+   */
+  static Vector3 FromArray(const float* array, unsigned int offset = 0);
+
   /**
    * @brief Sets the passed vector "result" with the element values from the
    * index "offset" of the passed array or Float32Array.
@@ -13,6 +13,7 @@
 #include <babylon/math/matrix.h>
 #include <babylon/mesh/facet_parameters.h>
 #include <babylon/mesh/iget_set_vertices_data.h>
+#include <babylon/mesh/indices_view.h>
 #include <babylon/physics/iphysics_enabled_object.h>
 #include <babylon/tools/observable.h>
 #include <babylon/tools/observer.h>
@@ -256,6 +257,18 @@ public:
                                        bool copyWhenShared = false,
                                        bool forceCopy      = false) override;
 
+  /**
+   * @brief Returns a read-only view of the requested vertex data kind, without
+   * copying it. Used by the class Mesh. Returns an empty view here.
+   */
+  virtual span<const float> getVerticesDataView(unsigned int kind);
+
+  /**
+   * @brief Returns a read-only view of the indices, without copying them. Used
+   * by the class Mesh. Returns an empty view here.
+   */
+  virtual IndicesView getIndicesView();
+
   /**
    * @brief Sets the vertex data of the mesh geometry for the requested `kind`.
    * If the mesh has no geometry, a new Geometry object is set to the mesh and
@@ -16,6 +16,14 @@ public:
          bool postponeInternalCreation = false, bool instanced = false);
   Buffer(Mesh* mesh, const Float32Array& data, bool updatable, int stride,
          bool postponeInternalCreation = false, bool instanced = false);
+  /**
+   * @brief Creates a static buffer whose GPU data is the packed (quantized)
+   * data. The float data is kept on the CPU side for picking and bounding.
+   * @param stride The number of floats per vertex in the float data.
+   * @param byteStride The number of bytes per vertex in the packed data.
+   */
+  Buffer(Engine* engine, const Float32Array& data,
+         const Uint32Array& packedData, int stride, int byteStride);
   virtual ~Buffer();
 
   std::unique_ptr<VertexBuffer> createVertexBuffer(unsigned int kind,
@@ -28,6 +36,7 @@ public:
   Float32Array& getData();
   GL::IGLBuffer* getBuffer();
   int getStrideSize() const;
+  int getByteStride() const;
   bool getIsInstanced() const;
 
   // Methods
@@ -39,13 +48,21 @@ public:
                                 size_t vertexCount);
   void dispose(bool doNotRecurse = false) override;
 
+private:
+  void _updateMemoryStats();
+  void _releaseMemoryStats();
+
 private:
   Engine* _engine;
   std::unique_ptr<GL::IGLBuffer> _buffer;
   Float32Array _data;
+  Uint32Array _packedData;
   bool _updatable;
   int _strideSize;
+  int _byteStride;
   bool _instanced;
+  // Size of the CPU side copy reported to the memory tracker
+  size_t _trackedDataSize;
 
 }; // end of class Buffer
 
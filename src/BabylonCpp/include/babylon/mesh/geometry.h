@@ -4,6 +4,7 @@
 #include <babylon/babylon_global.h>
 #include <babylon/core/structs.h>
 #include <babylon/interfaces/idisposable.h>
+#include <babylon/mesh/indices_view.h>
 #include <babylon/mesh/iget_set_vertices_data.h>
 
 namespace BABYLON {
@@ -63,18 +64,113 @@ public:
   size_t getTotalVertices() const;
   Float32Array getVerticesData(unsigned int kind, bool copyWhenShared = false,
                                bool forceCopy = false) override;
+  /**
+   * @brief Returns a read-only view of the vertex data of the given kind,
+   * without copying it. The view is invalidated when the data of the kind is
+   * replaced.
+   */
+  span<const float> getVerticesDataView(unsigned int kind) const;
+  /**
+   * @brief Returns a mutable view of the vertex data of the given kind. The
+   * data is shared by all the meshes using this geometry, use
+   * Mesh::getMutableVerticesDataView to modify the data of a single mesh.
+   */
+  span<float> getMutableVerticesDataView(unsigned int kind);
   VertexBuffer* getVertexBuffer(unsigned int kind) const;
-  std::unordered_map<std::string, VertexBuffer*> getVertexBuffers();
+  /**
+   * @brief Returns the vertex buffers keyed by kind name. The map is cached
+   * and only rebuilt when a vertex buffer is added or removed.
+   */
+  const std::unordered_map<std::string, VertexBuffer*>&
+  getVertexBuffers() const;
   bool isVerticesDataPresent(unsigned int kind) override;
   Uint32Array getVerticesDataKinds();
+  /**
+   * @brief Sets the indices, they are stored as 16 bits indices when the
+   * geometry has less than 65536 vertices.
+   */
   Mesh* setIndices(const IndicesArray& indices,
                    size_t totalVertices = 0) override;
+  Mesh* setIndices(const Uint16Array& indices, size_t totalVertices = 0);
   size_t getTotalIndices();
+  /**
+   * @brief Returns whether the indices are stored as 16 bits indices.
+   */
+  bool is16BitIndices() const;
   IndicesArray getIndices(bool copyWhenShared = false) override;
+  /**
+   * @brief Returns a read-only view of the indices, without copying them.
+   */
+  IndicesView getIndicesView() const;
+  /**
+   * @brief Returns the number of meshes using this geometry.
+   */
+  size_t getMeshCount() const;
+  /**
+   * @brief Returns a hash of the vertex data, of the vertex buffer layouts
+   * and of the indices, identical geometries have the same hash.
+   */
+  uint64_t getContentHash() const;
+  /**
+   * @brief Returns whether the geometry has the same vertex data and indices
+   * as the other geometry, stored in vertex buffers with the same layout and
+   * update mode.
+   */
+  bool hasSameContent(const Geometry& other) const;
   GL::IGLBuffer* getIndexBuffer();
+
+  /**
+   * @brief Replaces the static vertex buffers with quantized ones: positions as
+   * normalized shorts, normals and tangents as normalized 10:10:10:2 values,
+   * uvs as half floats and colors as normalized unsigned shorts. The float data
+   * is kept on the CPU side.
+   * @param quantizePositions Positions are dequantized through the world
+   * matrix, which is not compatible with skinning and morph targets.
+   * @returns The number of quantized vertex buffers.
+   */
+  size_t quantize(bool quantizePositions = true);
+
+  /**
+   * @brief Returns the matrix transforming the quantized positions back to
+   * object space, nullptr if the positions are not quantized.
+   */
+  Matrix* positionDequantization();
+
+  /**
+   * @brief Packs the static vertex buffers into a single interleaved buffer,
+   * keeping the data type of each kind (float or quantized). Updatable kinds
+   * keep their own buffer. The float data of each kind is kept on the CPU
+   * side.
+   * @returns The number of interleaved vertex buffers, 0 if there was nothing
+   * to interleave.
+   */
+  size_t interleave();
+
+  /**
+   * @brief Moves the vertices of the vertex buffers to their new index, see
+   * IndexOptimizer::OptimizeVertexFetch. Each kind keeps its data type, the
+   * quantized kinds being packed again from their float data. Vertex buffers
+   * shared with other kinds are left unchanged.
+   */
+  void remapVertices(const Uint32Array& remap);
+
+  /**
+   * @brief Returns whether the static vertex buffers are interleaved.
+   */
+  bool isInterleaved() const;
   void _releaseVertexArrayObject(Effect* effect);
   void releaseForMesh(Mesh* mesh, bool shouldDispose = true);
   void applyToMesh(Mesh* mesh);
+
+  /**
+   * @brief Returns the meshes using the geometry.
+   */
+  const std::vector<Mesh*>& meshes() const;
+
+  /**
+   * @brief Loads the vertex data of a delay loaded geometry on the worker
+   * threads of the scene geometry streaming manager.
+   */
   void load(Scene* scene, const std::function<void()>& onLoaded = nullptr);
 
   /**
@@ -97,8 +193,14 @@ public:
   static Geometry* ExtractFromMesh(Mesh* mesh, const std::string& id);
   static std::string RandomId();
   static void ImportGeometry(const Json::value& parsedGeometry, Mesh* mesh);
+  /**
+   * @brief Parses a vertex data geometry.
+   * @param vertexData The arrays of the geometry already parsed from the file,
+   * if any.
+   */
   static Geometry* Parse(const Json::value& parsedVertexData, Scene* scene,
-                         const std::string& rootUrl);
+                         const std::string& rootUrl,
+                         VertexData* vertexData = nullptr);
 
 protected:
   Geometry(const std::string& id, Scene* scene,
@@ -112,6 +214,9 @@ private:
   void notifyUpdate(unsigned int kind = 1);
   void _queueLoad(Scene* scene, const std::function<void()>& onLoaded);
   void _disposeVertexArrayObjects();
+  void _createIndexBuffer();
+  void _releaseUnusedInterleavedBuffers();
+  void _updateVertexBuffersCache();
 
 public:
   std::string id;
@@ -134,15 +239,19 @@ private:
   std::vector<Mesh*> _meshes;
   size_t _totalVertices;
   IndicesArray _indices;
+  Uint16Array _indices16;
+  bool _is16BitIndices;
   std::unordered_map<unsigned int, std::unique_ptr<VertexBuffer>>
     _vertexBuffers;
+  std::unordered_map<std::string, VertexBuffer*> _vertexBuffersCache;
   bool _isDisposed;
   bool _extendSet;
   MinMax _extend;
   bool _hasBoundingBias;
   Vector2 _boundingBias;
-  Uint32Array _delayInfo;
   std::unique_ptr<GL::IGLBuffer> _indexBuffer;
+  std::unique_ptr<Matrix> _positionDequantization;
+  std::vector<std::unique_ptr<Buffer>> _interleavedBuffers;
 
 }; // end of class Geometry
 
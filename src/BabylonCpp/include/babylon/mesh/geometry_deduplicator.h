@@ -0,0 +1,85 @@
+#ifndef BABYLON_MESH_GEOMETRY_DEDUPLICATOR_H
+#define BABYLON_MESH_GEOMETRY_DEDUPLICATOR_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Geometry, material, sub meshes and render settings that an instance
+ * takes from its source mesh. Meshes with equal keys can be drawn as
+ * instances of one another.
+ */
+struct BABYLON_SHARED_EXPORT InstanceRenderingKey {
+  const Geometry* geometry = nullptr;
+  const Material* material = nullptr;
+  // Material index, index start and count, vertices start and count
+  std::vector<std::array<size_t, 5>> subMeshes;
+  bool receiveShadows        = false;
+  bool hasVertexAlpha        = false;
+  bool applyFog              = true;
+  unsigned int billboardMode = 0;
+  float visibility           = 1.f;
+  int alphaIndex             = 0;
+  unsigned int layerMask     = 0x0FFFFFFF;
+  bool renderOverlay         = false;
+  bool infiniteDistance      = false;
+
+  static InstanceRenderingKey FromMesh(Mesh* mesh);
+  bool operator==(const InstanceRenderingKey& other) const;
+}; // end of struct InstanceRenderingKey
+
+/**
+ * @brief Merges geometries with identical vertex data and indices while a
+ * scene is loaded.
+ *
+ * Each added geometry is hashed, a geometry with the same content as a
+ * previously added one is disposed and its id is registered as an alias of the
+ * kept geometry, so that the meshes referencing it share the kept geometry.
+ */
+class BABYLON_SHARED_EXPORT GeometryDeduplicator {
+
+public:
+  GeometryDeduplicator(Scene* scene);
+  ~GeometryDeduplicator();
+
+  /**
+   * @brief Returns the previously added geometry with the same content as the
+   * passed geometry, the passed geometry is then disposed. Returns the passed
+   * geometry when it is unique.
+   */
+  Geometry* deduplicate(Geometry* geometry);
+
+  /**
+   * @brief Returns the number of geometries merged so far.
+   */
+  size_t mergedCount() const;
+
+  /**
+   * @brief Replaces the meshes sharing a geometry and a material with
+   * instances of the first of them. Meshes with skeletons, morph targets,
+   * animations, actions or their own instances are left untouched.
+   * @returns The number of meshes replaced by an instance.
+   */
+  static size_t ConvertToInstances(const std::vector<Mesh*>& meshes);
+
+  /**
+   * @brief Returns for each key the index of the first equal key, whose mesh
+   * becomes the source of its instance, or -1 when the mesh is kept.
+   */
+  static std::vector<int>
+  FindInstanceSources(const std::vector<InstanceRenderingKey>& keys);
+
+private:
+  static bool _canBeInstanced(Mesh* mesh);
+
+private:
+  Scene* _scene;
+  std::unordered_map<uint64_t, std::vector<Geometry*>> _geometries;
+  size_t _mergedCount;
+
+}; // end of class GeometryDeduplicator
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESH_GEOMETRY_DEDUPLICATOR_H
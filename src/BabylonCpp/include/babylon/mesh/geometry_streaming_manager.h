@@ -0,0 +1,131 @@
+#ifndef BABYLON_MESH_GEOMETRY_STREAMING_MANAGER_H
+#define BABYLON_MESH_GEOMETRY_STREAMING_MANAGER_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/core/json.h>
+#include <babylon/core/shared_queue.h>
+
+namespace BABYLON {
+
+class WorkerTaskGroup;
+
+/**
+ * @brief Loads the vertex data of delay loaded geometries and meshes on worker
+ * threads.
+ *
+ * Incremental scenes are loaded with the bounds of their geometries only, the
+ * vertex data of a geometry or mesh is requested when it first passes the
+ * frustum culling. The delay loading files are read and parsed on the worker
+ * pool, the files with the largest meshes on screen, then the closest ones,
+ * being started first. The loaded vertex data is handed to the geometries and
+ * meshes by update(), called by the scene on the rendering thread.
+ *
+ * The delay loading files are either JSON files, as exported for incremental
+ * scenes, or binary scene files whose scene graph is the delay loaded object,
+ * the vertex data then being copied from the blobs of the file.
+ */
+class BABYLON_SHARED_EXPORT GeometryStreamingManager {
+
+public:
+  using OnLoad  = std::function<void(const Json::value& parsedData,
+                                    VertexData* vertexData)>;
+  using OnError = std::function<void(const std::string& msg)>;
+
+public:
+  /**
+   * @brief Constructor.
+   * @param workerCount The number of worker threads of a pool of its own, 0
+   * uses the shared worker pool.
+   */
+  GeometryStreamingManager(Scene* scene, size_t workerCount = 0);
+  ~GeometryStreamingManager();
+
+  GeometryStreamingManager(const GeometryStreamingManager&) = delete;
+  GeometryStreamingManager& operator=(const GeometryStreamingManager&)
+    = delete;
+
+  /**
+   * @brief Queues the loading of the delay loading file of a geometry, its
+   * priority is the one of the meshes using it. The vertex data is null when
+   * the file is a JSON file.
+   */
+  void queueLoad(Geometry* geometry, const OnLoad& onLoad,
+                 const OnError& onError);
+  void queueLoad(Mesh* mesh, const OnLoad& onLoad, const OnError& onError);
+
+  /**
+   * @brief Drops the pending load of a disposed geometry or mesh, its
+   * callbacks are not run.
+   */
+  void cancelLoad(Geometry* geometry);
+  void cancelLoad(Mesh* mesh);
+
+  /**
+   * @brief Hands the loaded vertex data to the geometries and meshes, then
+   * starts the loading of the queued files with the highest priority.
+   */
+  void update();
+
+  /**
+   * @brief Returns the number of files queued or loading.
+   */
+  size_t pendingCount() const;
+
+  size_t workerCount() const;
+
+  /**
+   * @brief Reads and parses a delay loading file, this function is thread
+   * safe.
+   * @returns Whether the file could be read, error is set otherwise.
+   */
+  static bool ReadFile(const std::string& url, Json::value& parsedData,
+                       std::unique_ptr<VertexData>& vertexData,
+                       std::string& error);
+
+private:
+  struct Request {
+    Geometry* geometry;
+    Mesh* mesh;
+    std::string url;
+    OnLoad onLoad;
+    OnError onError;
+    bool loading;
+    // Screen size in pixels and distance to the camera of the closest mesh
+    float screenSize;
+    float distance;
+  }; // end of struct Request
+
+  struct LoadResult {
+    size_t requestId;
+    // Allocated by the worker, the default JSON value not being moved
+    std::unique_ptr<Json::value> parsedData;
+    std::unique_ptr<VertexData> vertexData;
+    std::string error;
+  }; // end of struct LoadResult
+
+  void _queueLoad(Geometry* geometry, Mesh* mesh, const std::string& url,
+                  const OnLoad& onLoad, const OnError& onError);
+  void _cancelLoad(const std::function<bool(const Request& request)>& match);
+  void _updatePriority(Request& request) const;
+
+public:
+  // Maximum number of files read at the same time
+  size_t maxConcurrentLoads;
+  // Maximum number of loaded files handed to the geometries per frame, 0
+  // hands all of them
+  size_t maxLoadsPerFrame;
+
+private:
+  Scene* _scene;
+  size_t _nextRequestId;
+  size_t _loadingCount;
+  std::unordered_map<size_t, Request> _requests;
+  // Declared before the tasks, which push into it until they are run
+  SharedQueue<LoadResult> _completed;
+  std::unique_ptr<WorkerTaskGroup> _tasks;
+
+}; // end of class GeometryStreamingManager
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESH_GEOMETRY_STREAMING_MANAGER_H
@@ -0,0 +1,85 @@
+#ifndef BABYLON_MESH_INDEX_OPTIMIZER_H
+#define BABYLON_MESH_INDEX_OPTIMIZER_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Reorders the triangles and the vertices of the geometries for the
+ * caches of the GPU.
+ *
+ * The triangles of a range of indices are ordered for the post transform
+ * vertex cache by Tipsify (Sander, Nehab and Barczak 2007), fanning around the
+ * vertex staying the longest in a FIFO cache. The cache optimized triangles
+ * can then be grouped into clusters sorted from the outside of the mesh to its
+ * inside, so that the outer triangles are drawn first and hide the inner ones,
+ * trading a bit of vertex cache efficiency for less overdraw. Finally, the
+ * vertices are ordered by first use for the vertex fetch cache.
+ *
+ * The efficiency of the vertex cache is measured by the average cache miss
+ * ratio (ACMR), the number of transformed vertices per triangle, between 0.5
+ * and 3, and by the average transform to vertex ratio (ATVR), the number of
+ * transformed vertices per vertex, 1 being optimal.
+ */
+class BABYLON_SHARED_EXPORT IndexOptimizer {
+
+public:
+  /**
+   * @brief Efficiency of the vertex cache for a range of indices.
+   */
+  struct VertexCacheStatistics {
+    size_t transformedVertices;
+    float acmr;
+    float atvr;
+  }; // end of struct VertexCacheStatistics
+
+  static constexpr size_t DefaultCacheSize = 16;
+
+public:
+  /**
+   * @brief Simulates a FIFO vertex cache of the given size drawing a range of
+   * indices.
+   */
+  static VertexCacheStatistics
+  AnalyzeVertexCache(const IndicesArray& indices, size_t indexStart,
+                     size_t indexCount, size_t cacheSize = DefaultCacheSize);
+
+  /**
+   * @brief Reorders the triangles of a range of indices for a vertex cache of
+   * the given size. The triangles keep their winding.
+   */
+  static void OptimizeVertexCache(IndicesArray& indices, size_t indexStart,
+                                  size_t indexCount,
+                                  size_t cacheSize = DefaultCacheSize);
+
+  /**
+   * @brief Reorders the clusters of the cache optimized triangles of a range
+   * of indices from the outside of the mesh to its inside. The ACMR of the
+   * range grows by the given threshold at most.
+   */
+  static void OptimizeOverdraw(IndicesArray& indices, size_t indexStart,
+                               size_t indexCount, const Float32Array& positions,
+                               float threshold = 1.05f,
+                               size_t cacheSize = DefaultCacheSize);
+
+  /**
+   * @brief Renumbers the vertices by first use in the indices, the vertices
+   * not used being kept after the used ones.
+   * @returns The new index of each vertex.
+   */
+  static Uint32Array OptimizeVertexFetch(IndicesArray& indices,
+                                         size_t vertexCount);
+
+  /**
+   * @brief Moves the vertices of a vertex buffer with the given number of
+   * components per vertex to their new index.
+   */
+  static void RemapVertexBuffer(Float32Array& vertices, size_t stride,
+                                const Uint32Array& remap);
+
+}; // end of class IndexOptimizer
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESH_INDEX_OPTIMIZER_H
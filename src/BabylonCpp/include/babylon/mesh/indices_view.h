@@ -0,0 +1,87 @@
+#ifndef BABYLON_MESH_INDICES_VIEW_H
+#define BABYLON_MESH_INDICES_VIEW_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/core/span.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Read-only view of the indices of a geometry, which are stored either
+ * as 16 bits or as 32 bits indices. The view is only valid until the indices of
+ * the geometry are changed.
+ */
+class BABYLON_SHARED_EXPORT IndicesView {
+
+public:
+  IndicesView() : _data16{nullptr}, _data32{nullptr}, _size{0}
+  {
+  }
+
+  IndicesView(span<const uint16_t> indices)
+      : _data16{indices.data()}, _data32{nullptr}, _size{indices.size()}
+  {
+  }
+
+  IndicesView(span<const uint32_t> indices)
+      : _data16{nullptr}, _data32{indices.data()}, _size{indices.size()}
+  {
+  }
+
+  size_t size() const
+  {
+    return _size;
+  }
+
+  bool empty() const
+  {
+    return _size == 0;
+  }
+
+  bool is16Bits() const
+  {
+    return _data16 != nullptr;
+  }
+
+  uint32_t operator[](size_t index) const
+  {
+    return _data16 ? _data16[index] : _data32[index];
+  }
+
+  /**
+   * @brief Returns the first byte of the indices.
+   */
+  const void* data() const
+  {
+    return _data16 ? static_cast<const void*>(_data16) : _data32;
+  }
+
+  /**
+   * @brief Returns the size in bytes of the indices.
+   */
+  size_t byteSize() const
+  {
+    return _size * (_data16 ? sizeof(uint16_t) : sizeof(uint32_t));
+  }
+
+  /**
+   * @brief Returns a copy of the indices as 32 bits indices.
+   */
+  IndicesArray toArray() const
+  {
+    if (_data16) {
+      return IndicesArray(_data16, _data16 + _size);
+    }
+    return IndicesArray(_data32, _data32 + _size);
+  }
+
+private:
+  const uint16_t* _data16;
+  const uint32_t* _data32;
+  size_t _size;
+
+}; // end of class IndicesView
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESH_INDICES_VIEW_H
@@ -50,6 +50,11 @@ public:
   Float32Array getVerticesData(unsigned int kind, bool copyWhenShared = false,
                                bool forceCopy = false) override;
 
+  /**
+   * @brief Returns a read-only view of the source mesh vertex data.
+   */
+  span<const float> getVerticesDataView(unsigned int kind) override;
+
   /**
    * @brief Sets the vertex data of the mesh geometry for the requested `kind`.
    * If the mesh has no geometry, a new Geometry object is set to the mesh and
@@ -138,6 +143,11 @@ public:
    */
   IndicesArray getIndices(bool copyWhenShared = false) override;
 
+  /**
+   * @brief Returns a read-only view of the source mesh indices.
+   */
+  IndicesView getIndicesView() override;
+
   std::vector<Vector3>& _positions() override;
 
   /**
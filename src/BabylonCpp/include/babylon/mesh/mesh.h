@@ -189,6 +189,30 @@ public:
   Float32Array getVerticesData(unsigned int kind, bool copyWhenShared = false,
                                bool forceCopy = false) override;
 
+  /**
+   * @brief Returns a read-only view of the requested vertex data kind without
+   * copying it. The view is invalidated when the data of the kind is replaced.
+   * @returns An empty view if the mesh has no geometry.
+   */
+  span<const float> getVerticesDataView(unsigned int kind) override;
+
+  /**
+   * @brief Returns a mutable view of the requested vertex data kind. If the
+   * geometry is shared among some other meshes, it is first copied so that
+   * only this mesh is modified (copy-on-write). Call
+   * markVerticesDataAsUpdated() once the data has been modified.
+   * @returns An empty view if the mesh has no geometry.
+   */
+  span<float> getMutableVerticesDataView(unsigned int kind);
+
+  /**
+   * @brief Uploads the vertex data of the requested kind after it has been
+   * modified through a mutable view. The kind must be updatable.
+   * @returns The Mesh.
+   */
+  Mesh& markVerticesDataAsUpdated(unsigned int kind,
+                                  bool updateExtends = false);
+
   /**
    * @brief Returns the mesh VertexBuffer object from the requested `kind` :
    * positions, indices, normals, etc.
@@ -262,6 +286,12 @@ public:
    */
   IndicesArray getIndices(bool copyWhenShared = false) override;
 
+  /**
+   * @brief Returns a read-only view of the mesh indices without copying them.
+   * @returns An empty view if the mesh has no geometry.
+   */
+  IndicesView getIndicesView() override;
+
   bool isBlocked();
 
   /**
@@ -425,6 +455,24 @@ public:
    */
   Mesh& makeGeometryUnique();
 
+  /**
+   * @brief Quantizes the static vertex data of the mesh geometry to reduce the
+   * GPU memory used by the vertex buffers. Positions are only quantized when
+   * the mesh has no skeleton and no morph targets, their dequantization matrix
+   * is folded into the world matrix when rendering. Meshes sampling a cube
+   * texture with their object space positions (skyboxes) should keep float
+   * positions.
+   * @returns The Mesh.
+   */
+  Mesh& quantizeVertexData(bool quantizePositions = true);
+
+  /**
+   * @brief Packs the static vertex data of the mesh geometry into a single
+   * interleaved buffer, updatable kinds keep their own buffer.
+   * @returns The Mesh.
+   */
+  Mesh& interleaveVertexData();
+
   /**
    * @brief Sets the mesh indices.
    * Expects an IndicesArray.
@@ -435,6 +483,11 @@ public:
   Mesh* setIndices(const IndicesArray& indices,
                    size_t totalVertices = 0) override;
 
+  /**
+   * @brief Sets the mesh indices from 16 bits indices.
+   */
+  Mesh* setIndices(const Uint16Array& indices, size_t totalVertices = 0);
+
   /**
    * @brief Invert the geometry to move from a right handed system to a left
    * handed one.
@@ -697,30 +750,42 @@ public:
 
   /**
    * @brief Simplify the mesh according to the given array of settings.
-   * Function will return immediately and will simplify async.
+   * Function will return immediately and will simplify async, the levels of
+   * detail being simplified on worker threads and added to the mesh by the
+   * simplification queue of the scene.
    * @param settings a collection of simplification settings.
    * @param parallelProcessing should all levels calculate parallel or one after
    * the other.
    * @param type the type of simplification to run.
-   * @param successCallback optional success callback to be called after the
-   * simplification finished processing all settings.
-   */
-  /*void
-  simplify(const std::vector<ISimplificationSettings*>& settings,
-           std::function<void(Mesh* mesh, int submeshIndex)>& successCallback,
-           bool parallelProcessing = true, SimplificationType simplificationType
-                                           = SimplificationType::QUADRATIC);*/
-
-  /**
-   * @brief Optimization of the mesh's indices, in case a mesh has duplicated
-   * vertices. The function will only reorder the indices and will not remove
-   * unused vertices to avoid problems with submeshes.
-   * This should be used together with the simplification to avoid disappearing
-   * triangles.
+   * @param successCallback optional success callback to be called for each
+   * submesh, with its index, after the simplification finished processing all
+   * settings.
+   */
+  Mesh& simplify(const std::vector<ISimplificationSettings>& settings,
+                 bool parallelProcessing = true,
+                 SimplificationType simplificationType
+                 = SimplificationType::QUADRATIC,
+                 const std::function<void(Mesh* mesh, int submeshIndex)>&
+                   successCallback
+                 = nullptr);
+
+  /**
+   * @brief Optimization of the mesh's indices for the caches of the GPU. The
+   * triangles of each submesh are reordered for the vertex cache, then
+   * optionally sorted from the outside of the mesh to its inside to reduce
+   * overdraw. The vertices are then renumbered by first use when the geometry
+   * has no morph targets nor interleaved vertex buffers, the quantized vertex
+   * buffers staying quantized. No vertex is removed to avoid problems with
+   * submeshes. The vertex cache efficiency of each
+   * submesh before and after the optimization is logged at the debug level.
    * @param successCallback an optional success callback to be called after the
    * optimization finished.
+   * @param optimizeOverdraw whether the triangles are sorted to reduce
+   * overdraw, at the expense of a slightly less efficient vertex cache.
    */
-  void optimizeIndices(const std::function<void(Mesh* mesh)>& successCallback);
+  void optimizeIndices(
+    const std::function<void(Mesh* mesh)>& successCallback = nullptr,
+    bool optimizeOverdraw = false);
 
   void _syncGeometryWithMorphTargetManager();
 
@@ -1449,6 +1514,7 @@ protected:
 
 private:
   void _sortLODLevels();
+  Matrix _applyPositionDequantization(const Matrix& world);
   Mesh& _onBeforeDraw(bool isInstance, Matrix& world,
                       Material* effectiveMaterial);
   Mesh& _queueLoad(Mesh* mesh, Scene* scene);
@@ -1473,7 +1539,6 @@ private:
   std::vector<Vector3> _emptyPositions;
   // Morph
   MorphTargetManager* _morphTargetManager;
-  std::vector<VertexBuffer*> _delayInfo;
   Int32Array _renderIdForInstances;
   std::unique_ptr<_InstancesBatch> _batchCache;
   unsigned int _instancesBufferSize;
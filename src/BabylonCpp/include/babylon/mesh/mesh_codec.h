@@ -0,0 +1,67 @@
+#ifndef BABYLON_MESH_MESH_CODEC_H
+#define BABYLON_MESH_MESH_CODEC_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Compact encoding of the vertex attributes and the triangle indices of
+ * the geometries, for the scene files.
+ *
+ * Vertex buffers are encoded per component: the bits of consecutive values
+ * are delta and zigzag encoded, then split into byte planes, and each group of
+ * 16 bytes of a plane is stored with 0, 2, 4 or 8 bits per byte. The encoding
+ * is lossless unless the mantissa of the values is rounded before encoding.
+ * The decoder uses SSE2 when available.
+ *
+ * Index buffers of triangle lists are encoded one triangle per code byte: a
+ * triangle sharing an edge with one of the last triangles references the edge
+ * in a FIFO, and the other vertices are either the next new vertex or an
+ * explicit delta. Decoded triangles keep their winding but may be rotated.
+ */
+class BABYLON_SHARED_EXPORT MeshCodec {
+
+public:
+  static constexpr uint8_t VertexBufferMagic = 0xa0;
+  static constexpr uint8_t IndexBufferMagic  = 0xe0;
+
+public:
+  /**
+   * @brief Encodes a vertex buffer.
+   * @param vertices The vertex attribute values.
+   * @param stride The number of components per vertex.
+   * @param mantissaBits The number of mantissa bits kept, 23 is lossless.
+   * @returns The encoded buffer, empty when the stride does not divide the
+   * number of values.
+   */
+  static Uint8Array EncodeVertexBuffer(const Float32Array& vertices,
+                                       size_t stride,
+                                       unsigned int mantissaBits = 23);
+
+  /**
+   * @brief Decodes a vertex buffer into vertices.
+   * @returns Whether the encoded buffer is valid.
+   */
+  static bool DecodeVertexBuffer(const uint8_t* data, size_t size,
+                                 Float32Array& vertices);
+
+  /**
+   * @brief Encodes the index buffer of a triangle list.
+   * @returns The encoded buffer, empty when the number of indices is not a
+   * multiple of 3.
+   */
+  static Uint8Array EncodeIndexBuffer(const IndicesArray& indices);
+
+  /**
+   * @brief Decodes an index buffer into indices.
+   * @returns Whether the encoded buffer is valid.
+   */
+  static bool DecodeIndexBuffer(const uint8_t* data, size_t size,
+                                IndicesArray& indices);
+
+}; // end of class MeshCodec
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESH_MESH_CODEC_H
@@ -4,28 +4,26 @@
 #include <babylon/babylon_global.h>
 
 #include <babylon/math/vector3.h>
-#include <babylon/mesh/simplification/decimation_vertex.h>
 
 namespace BABYLON {
 
 /**
- * @brief
+ * @brief A triangle of the mesh being simplified.
  */
 class BABYLON_SHARED_EXPORT DecimationTriangle {
 
 public:
-  DecimationTriangle(const std::vector<DecimationVertex>& vertices);
+  DecimationTriangle(const std::array<uint32_t, 3>& vertices,
+                     const std::array<uint32_t, 3>& originalOffsets);
   ~DecimationTriangle();
 
 public:
   Vector3 normal;
-  std::array<int, 4> error;
   bool deleted;
-  bool isDirty;
-  float borderFactor;
-  bool deletePending;
-  float originalOffset;
-  std::vector<DecimationVertex> vertices;
+  // Ids of the decimation vertices of the corners
+  std::array<uint32_t, 3> vertices;
+  // Original vertices of the corners, holding their attributes
+  std::array<uint32_t, 3> originalOffsets;
 
 }; // end of class DecimationTriangle
 
@@ -9,7 +9,8 @@
 namespace BABYLON {
 
 /**
- * @brief
+ * @brief A vertex of the mesh being simplified, shared by the original
+ * vertices with the same position.
  */
 class BABYLON_SHARED_EXPORT DecimationVertex {
 
@@ -24,9 +25,14 @@ public:
   Vector3 position;
   int id;
   bool isBorder;
-  int triangleStart;
-  int triangleCount;
-  std::vector<float> originalOffsets;
+  // Locked vertices, e.g. the ones of non manifold edges, are never collapsed
+  bool isLocked;
+  bool deleted;
+  // Triangles using the vertex, some of them may be deleted
+  std::vector<uint32_t> triangles;
+  // Original vertices at the position of the vertex, one per set of
+  // attributes
+  std::vector<uint32_t> originalOffsets;
 
 }; // end of class DecimationVertex
 
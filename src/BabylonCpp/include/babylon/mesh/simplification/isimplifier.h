@@ -5,27 +5,67 @@
 
 namespace BABYLON {
 
+/**
+ * @brief Simplified geometry of a mesh, computed on a worker thread and turned
+ * into a mesh on the rendering thread.
+ */
+struct BABYLON_SHARED_EXPORT SimplifiedGeometry {
+  /**
+   * @brief Range of the vertices and indices of a simplified submesh.
+   */
+  struct SubMeshRange {
+    unsigned int materialIndex;
+    unsigned int verticesStart;
+    size_t verticesCount;
+    unsigned int indexStart;
+    size_t indexCount;
+  }; // end of struct SubMeshRange
+
+  std::unique_ptr<VertexData> vertexData;
+  std::vector<SubMeshRange> subMeshes;
+}; // end of struct SimplifiedGeometry
+
 /**
  * @brief A simplifier interface for future simplification implementations.
  */
 class BABYLON_SHARED_EXPORT ISimplifier {
 
 public:
+  virtual ~ISimplifier() = default;
+
+  /**
+   * @brief Simplification of the geometry of the mesh according to the given
+   * settings. This function is thread safe: it only reads the copy of the
+   * geometry taken when the simplifier was created, and never touches the
+   * scene nor the engine.
+   * @param settings The settings of the simplification, including quality and
+   * distance
+   */
+  virtual SimplifiedGeometry
+  simplifyGeometry(const ISimplificationSettings& settings) const = 0;
+
+  /**
+   * @brief Creates the simplified mesh from a simplified geometry, on the
+   * rendering thread.
+   */
+  virtual Mesh* createMesh(const ISimplificationSettings& settings,
+                           SimplifiedGeometry& geometry)
+    = 0;
+
   /**
-   * Simplification of a given mesh according to the given settings.
-   * Since this requires computation, it is assumed that the function runs
-   * async.
+   * @brief Simplification of a given mesh according to the given settings,
+   * on the calling thread.
    * @param settings The settings of the simplification, including quality and
    * distance
    * @param successCallback A callback that will be called after the mesh was
    * simplified.
-   * @param errorCallback in case of an error, this callback will be called.
-   * optional.
    */
-  virtual void simplify() = 0;
+  virtual void simplify(const ISimplificationSettings& settings,
+                        const std::function<void(Mesh* mesh)>& successCallback)
+    = 0;
 
 }; // end of class ISimplifier
 
 } // end of namespace BABYLON
 
-#endif // end of BABYLON_MESH_SIMPLIFICATION_ISIMPLIFIER_H
\ No newline at end of file
+#endif // end of BABYLON_MESH_SIMPLIFICATION_ISIMPLIFIER_H
@@ -2,6 +2,7 @@
 #define BABYLON_MESH_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 
 #include <babylon/babylon_global.h>
+#include <babylon/mesh/simplification/isimplifier.h>
 
 namespace BABYLON {
 
@@ -12,15 +13,61 @@ namespace BABYLON {
  * http://voxels.blogspot.de/2014/05/quadric-mesh-simplification-with-source.html
  * to babylon JS
  * @author RaananW
+ *
+ * The edges are collapsed onto one of their vertices, cheapest collapse
+ * first, until the number of triangles of each submesh is the quality times
+ * its original number of triangles. The cost of a collapse is the error of
+ * the quadrics of the planes of the triangles of both vertices, plus the
+ * error of the normals and texture coordinates of the original vertices
+ * against the linear fields of their triangles (Garland and Heckbert 1998),
+ * so that the flat and evenly mapped areas are simplified first.
+ *
+ * The original vertices at the same position with different attributes form
+ * seams, which are only collapsed along themselves, the borders of the mesh
+ * and of the submeshes being only collapsed along themselves as well. The
+ * collapses flipping a triangle or making the mesh non manifold are rejected.
  */
 class BABYLON_SHARED_EXPORT QuadraticErrorSimplification : public ISimplifier {
 
 public:
-  QuadraticErrorSimplification();
+  /**
+   * @brief Constructor, copies the geometry and the submeshes of the mesh to
+   * simplify.
+   */
+  QuadraticErrorSimplification(Mesh* mesh);
+
+  /**
+   * @brief Constructor simplifying the given geometry, made of the given
+   * submeshes, all the triangles being one submesh when none is given.
+   */
+  QuadraticErrorSimplification(
+    std::unique_ptr<VertexData>&& vertexData,
+    const std::vector<SimplifiedGeometry::SubMeshRange>& subMeshes = {});
   ~QuadraticErrorSimplification();
 
+  SimplifiedGeometry
+  simplifyGeometry(const ISimplificationSettings& settings) const override;
+  Mesh* createMesh(const ISimplificationSettings& settings,
+                   SimplifiedGeometry& geometry) override;
+  void
+  simplify(const ISimplificationSettings& settings,
+           const std::function<void(Mesh* mesh)>& successCallback) override;
+
+public:
+  // Weights of the errors of the normals and of the texture coordinates,
+  // relative to the squared distances of the mesh scaled to a unit box
+  float normalWeight;
+  float uvWeight;
+  // Weight of the planes keeping the borders and the seams in place
+  float borderWeight;
+
+private:
+  Mesh* _mesh;
+  std::unique_ptr<VertexData> _vertexData;
+  std::vector<SimplifiedGeometry::SubMeshRange> _subMeshes;
+
 }; // end of class QuadraticErrorSimplification
 
 } // end of namespace BABYLON
 
-#endif // end of BABYLON_MESH_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
\ No newline at end of file
+#endif // end of BABYLON_MESH_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
@@ -21,6 +21,12 @@ public:
   void addArrayInPlace(const std::array<float, 10>& data);
   QuadraticMatrix add(const QuadraticMatrix& matrix);
 
+  /**
+   * @brief Returns the error of the quadric at the given point, the sum of
+   * the squared distances of the point to the planes of the quadric.
+   */
+  float vertexError(const Vector3& point) const;
+
   static QuadraticMatrix FromData(float a, float b, float c, float d);
   static std::array<float, 10> DataFromNumbers(float a, float b, float c,
                                                float d);
@@ -2,31 +2,105 @@
 #define BABYLON_MESH_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 
 #include <babylon/babylon_global.h>
+#include <babylon/core/shared_queue.h>
 #include <babylon/mesh/simplification/isimplification_task.h>
+#include <babylon/mesh/simplification/isimplifier.h>
 
 namespace BABYLON {
 
+class WorkerTaskGroup;
+
 /**
- * @brief
+ * @brief Runs the simplification tasks of the meshes of a scene on worker
+ * threads.
+ *
+ * The geometry of a mesh is copied when its task starts, then the levels of
+ * detail of the task are simplified on the shared worker pool, all at the
+ * same time when the task is processed in parallel, one after the other
+ * otherwise. The simplified geometries are turned into meshes and added as
+ * levels of detail of their mesh by update(), called by the scene on the
+ * rendering thread, so that the simplification never blocks the rendering
+ * loop.
  */
 class BABYLON_SHARED_EXPORT SimplificationQueue {
 
 public:
-  SimplificationQueue();
+  /**
+   * @brief Constructor.
+   * @param workerCount The number of worker threads of a pool of its own, 0
+   * uses the shared worker pool.
+   */
+  SimplificationQueue(size_t workerCount = 0);
   ~SimplificationQueue();
 
+  SimplificationQueue(const SimplificationQueue&) = delete;
+  SimplificationQueue& operator=(const SimplificationQueue&) = delete;
+
   void addTask(const ISimplificationTask& task);
+
+  /**
+   * @brief Starts the next queued task.
+   */
   void executeNext();
+
+  /**
+   * @brief Copies the geometry of the mesh of a task, and starts the
+   * simplification of its levels of detail on the worker threads.
+   */
   void runSimplification(const ISimplificationTask& task);
 
+  /**
+   * @brief Adds the simplified meshes as levels of detail of their mesh and
+   * runs the callbacks of the completed tasks, then starts the queued tasks.
+   */
+  void update();
+
+  /**
+   * @brief Drops the tasks of a disposed mesh, their callbacks are not run.
+   */
+  void cancelTasks(Mesh* mesh);
+
+  /**
+   * @brief Returns the number of tasks queued or running.
+   */
+  size_t pendingCount() const;
+
+  size_t workerCount() const;
+
 private:
-  ISimplifier* getSimplifier(const ISimplificationTask& task);
+  struct RunningTask {
+    ISimplificationTask task;
+    // Shared with the workers, which may still read the geometry of a
+    // cancelled task
+    std::shared_ptr<ISimplifier> simplifier;
+    size_t completedCount;
+  }; // end of struct RunningTask
+
+  struct SimplificationResult {
+    size_t taskId;
+    size_t settingsIndex;
+    SimplifiedGeometry geometry;
+  }; // end of struct SimplificationResult
+
+  std::unique_ptr<ISimplifier> getSimplifier(const ISimplificationTask& task);
 
 public:
   bool running;
+  // Maximum number of tasks simplified at the same time
+  size_t maxConcurrentTasks;
+  // Maximum number of simplified meshes created per frame, 0 creates all of
+  // them
+  size_t maxMeshesPerFrame;
 
 private:
+  size_t _nextTaskId;
+  // Set when destroyed, the workers then skipping their pending levels
+  std::atomic<bool> _stopping;
   std::queue<ISimplificationTask> _simplificationQueue;
+  std::unordered_map<size_t, RunningTask> _runningTasks;
+  // Declared before the tasks, which push into it until they are run
+  SharedQueue<SimplificationResult> _completed;
+  std::unique_ptr<WorkerTaskGroup> _tasks;
 
 }; // end of class SimplificationQueue
 
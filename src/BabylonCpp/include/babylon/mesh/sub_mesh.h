@@ -97,7 +97,7 @@ public:
    * @brief Returns a new Index Buffer.
    * @returns The WebGLBuffer.
    */
-  GL::IGLBuffer* getLinesIndexBuffer(const Uint32Array& indices,
+  GL::IGLBuffer* getLinesIndexBuffer(const IndicesView& indices,
                                      Engine* engine);
 
   /**
@@ -110,7 +110,7 @@ public:
    */
   std::unique_ptr<IntersectionInfo>
   intersects(Ray& ray, const std::vector<Vector3>& positions,
-             const Uint32Array& indices, bool fastCheck);
+             const IndicesView& indices, bool fastCheck);
 
   /** Clone **/
 
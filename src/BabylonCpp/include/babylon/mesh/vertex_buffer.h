@@ -56,6 +56,17 @@ public:
   static constexpr const char* CellInfoKindChars = "cellInfo";
   static constexpr const char* OptionsKindChars  = "options";
 
+  /** Data types **/
+  static constexpr unsigned int BYTE               = 5120;
+  static constexpr unsigned int UNSIGNED_BYTE      = 5121;
+  static constexpr unsigned int SHORT              = 5122;
+  static constexpr unsigned int UNSIGNED_SHORT     = 5123;
+  static constexpr unsigned int INT                = 5124;
+  static constexpr unsigned int UNSIGNED_INT       = 5125;
+  static constexpr unsigned int FLOAT              = 5126;
+  static constexpr unsigned int HALF_FLOAT         = 5131;
+  static constexpr unsigned int INT_2_10_10_10_REV = 36255;
+
 public:
   VertexBuffer(Engine* engine, const Float32Array& data, unsigned int kind,
                bool updatable, bool postponeInternalCreation = false,
@@ -65,6 +76,22 @@ public:
                bool updatable, bool postponeInternalCreation = false,
                int stride = -1, bool instanced = false, int offset = -1,
                int size = -1);
+  /**
+   * @brief Creates a vertex buffer owning a buffer whose GPU data is stored
+   * with the given data type, e.g. a buffer created from quantized data.
+   * @param size The number of components of the attribute.
+   * @param byteOffset The offset of the attribute in a vertex, in bytes.
+   */
+  VertexBuffer(std::unique_ptr<Buffer>&& buffer, unsigned int kind, int size,
+               unsigned int type, bool normalized, int byteOffset = 0);
+  /**
+   * @brief Creates a vertex buffer reading its attribute from a buffer shared
+   * with other kinds (interleaved layout). The float data of the kind is kept
+   * on the CPU side, the shared buffer is owned by the caller.
+   */
+  VertexBuffer(Engine* engine, const Float32Array& data, Buffer* sharedBuffer,
+               unsigned int kind, int size, unsigned int type,
+               bool normalized, int byteOffset);
   virtual ~VertexBuffer();
 
   /** Statics **/
@@ -93,6 +120,12 @@ public:
    */
   GL::IGLBuffer* getBuffer();
 
+  /**
+   * @brief Returns whether the GPU data is stored in a buffer shared with
+   * other vertex buffers.
+   */
+  bool isShared() const;
+
   /**
    * Returns the stride of the VertexBuffer (integer).
    */
@@ -113,6 +146,39 @@ public:
    */
   bool getIsInstanced() const;
 
+  /**
+   * @brief Returns the data type of the attribute in the GPU buffer.
+   */
+  unsigned int getDataType() const;
+
+  /**
+   * @brief Returns whether integer data is normalized when fetched.
+   */
+  bool getNormalized() const;
+
+  /**
+   * @brief Returns the stride of the GPU buffer, in bytes.
+   */
+  int getByteStride() const;
+
+  /**
+   * @brief Returns the offset of the attribute in the GPU buffer, in bytes.
+   */
+  int getByteOffset() const;
+
+  /**
+   * @brief Returns whether the other vertex buffer stores the same kind with
+   * the same layout (stride, offset, size, data type and normalization) and
+   * the same update mode (updatable and instanced flags).
+   */
+  bool hasSameLayout(const VertexBuffer& other) const;
+
+  /**
+   * @brief Returns a hash of the layout and update mode compared by
+   * hasSameLayout.
+   */
+  uint64_t getLayoutHash() const;
+
   /** Methods **/
 
   /**
@@ -150,6 +216,7 @@ public:
 
 private:
   Buffer* _getBuffer() const;
+  Buffer* _getGPUBuffer() const;
 
 private:
   std::unique_ptr<Buffer> _ownedBuffer;
@@ -159,6 +226,11 @@ private:
   int _size;
   int _stride;
   bool _ownsBuffer;
+  unsigned int _type;
+  bool _normalized;
+  int _byteStride;
+  int _byteOffset;
+  Buffer* _sharedBuffer;
 
 }; // end of class VertexBuffer
 
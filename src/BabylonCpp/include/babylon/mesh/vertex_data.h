@@ -190,6 +190,86 @@ public:
   static void ImportVertexData(const Json::value& parsedVertexData,
                                Geometry* geometry);
 
+  /**
+   * @brief Creates a new VertexData from the imported parameters, completing
+   * the arrays already parsed into vertexData.
+   */
+  static void ImportVertexData(const Json::value& parsedVertexData,
+                               VertexData& vertexData, Geometry* geometry);
+
+  /**
+   * @brief Completes vertexData with the arrays of the imported parameters
+   * which are not already parsed into it. Does not touch the engine, so it can
+   * be called from worker threads.
+   */
+  static void ImportVertexData(const Json::value& parsedVertexData,
+                               VertexData& vertexData);
+
+  /**
+   * @brief Returns whether the indices can be stored as 16 bits indices. The
+   * indices are scanned for the largest value, unless the number of vertices
+   * is known to be above 65536.
+   */
+  static bool CanUse16BitIndices(const IndicesArray& indices,
+                                 size_t totalVertices = 0);
+
+  /**
+   * @brief Narrows the indices to 16 bits, the caller is responsible for
+   * checking that they fit with CanUse16BitIndices.
+   */
+  static Uint16Array ToUint16Indices(const IndicesArray& indices);
+
+  /**
+   * @brief Widens 16 bits indices to the default indices array type.
+   */
+  static IndicesArray ToIndicesArray(const Uint16Array& indices);
+
+  /** Quantization **/
+
+  /**
+   * @brief Quantizes the positions to normalized shorts, 8 bytes per vertex
+   * (x, y, z and a padding component). A single scale is used for the three
+   * axes so that the dequantization matrix can be folded into the world matrix
+   * without skewing the normals.
+   * @param dequantization Receives the matrix transforming the normalized
+   * positions back to object space.
+   */
+  static Uint32Array QuantizePositions(const Float32Array& positions,
+                                       Matrix& dequantization);
+
+  /**
+   * @brief Packs unit vectors to signed normalized 10:10:10:2 values, the
+   * fourth component of tangents (handedness) is stored in the 2 bits field.
+   * @param components 3 for normals, 4 for tangents.
+   */
+  static Uint32Array PackNormals(const Float32Array& normals,
+                                 size_t components);
+
+  /**
+   * @brief Packs the data to half floats, each vertex is padded to an even
+   * number of components.
+   */
+  static Uint32Array PackHalfFloats(const Float32Array& data,
+                                    size_t components);
+
+  /**
+   * @brief Packs data in the [0, 1] range to normalized unsigned shorts, each
+   * vertex is padded to an even number of components.
+   */
+  static Uint32Array PackUnorm16(const Float32Array& data, size_t components);
+
+  /**
+   * @brief Interleaves packed vertex attributes into a single array, the words
+   * of the attributes of a vertex following each other in the given order.
+   * @param wordOffsets Receives the offset of each attribute in a vertex, in
+   * 32 bits words.
+   * @returns The interleaved words, empty when the size of an attribute is
+   * not a multiple of the number of vertices.
+   */
+  static Uint32Array Interleave(const std::vector<Uint32Array>& attributes,
+                                size_t totalVertices,
+                                std::vector<size_t>& wordOffsets);
+
 private:
   VertexData& _applyTo(IGetSetVerticesData* meshOrGeometry,
                        bool updatable = false);
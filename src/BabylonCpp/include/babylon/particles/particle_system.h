@@ -105,6 +105,8 @@ private:
   Float32Array _vertexData;
   std::unique_ptr<Buffer> _vertexBuffer;
   std::unordered_map<std::string, std::unique_ptr<VertexBuffer>> _vertexBuffers;
+  // Kept alongside _vertexBuffers so that binding does not allocate
+  std::unordered_map<std::string, VertexBuffer*> _vertexBufferBindings;
   std::unique_ptr<GL::IGLBuffer> _indexBuffer;
   Effect* _effect;
   Effect* _customEffect;
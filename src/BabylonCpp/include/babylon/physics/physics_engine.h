@@ -71,6 +71,17 @@ public:
 
   bool isInitialized() const;
 
+  /**
+   * @brief Returns the number of impostors handled by the engine.
+   */
+  size_t getImpostorsCount() const;
+
+  /**
+   * @brief Returns an estimate of the memory in bytes used by the impostors
+   * and joints (the memory owned by the physics plugin is not included).
+   */
+  size_t getMemorySize() const;
+
 public:
   Vector3 gravity;
 
@@ -2,13 +2,20 @@
 #define BABYLON_RENDERING_EDGES_RENDERER_H
 
 #include <babylon/babylon_global.h>
+#include <babylon/core/span.h>
 #include <babylon/interfaces/idisposable.h>
 #include <babylon/math/vector3.h>
+#include <babylon/mesh/indices_view.h>
 
 namespace BABYLON {
 
 class BABYLON_SHARED_EXPORT EdgesRenderer : public IDisposable {
 
+public:
+  // Number of faces processed by each task when the faces are processed in
+  // parallel
+  static constexpr size_t FacesPerTask = 16384;
+
 public:
   EdgesRenderer(AbstractMesh* source, float epsilon = 0.95f,
                 bool checkVerticesInsteadOfIndices = false);
@@ -17,20 +24,32 @@ public:
   void dispose(bool doNotRecurse = false) override;
   void render();
 
+  /**
+   * @brief Flags the edges lines to be generated again before the next
+   * render, the positions or the indices of the source mesh being updated.
+   * The adjacencies of the faces are kept when the indices did not change.
+   */
+  void _markGeometryDirty();
+
+  /**
+   * @brief Returns the adjacent face of each edge of each face, -1 when the
+   * edge has no adjacent face, the edge i of a face joining its vertices i
+   * and (i + 1) % 3. The faces are adjacent when they share the indices of an
+   * edge, or its positions within MathTools::Epsilon when checking vertices
+   * instead of indices. An edge shared by more than two faces joins them in
+   * pairs, in face order.
+   */
+  static Int32Array BuildFaceAdjacencies(span<const float> positions,
+                                         const IndicesView& indices,
+                                         bool checkVerticesInsteadOfIndices);
+
 private:
   void _prepareResources();
-  int _processEdgeForAdjacencies(unsigned int pa, unsigned int pb,
-                                 unsigned int p0, unsigned int p1,
-                                 unsigned int p2);
-  int _processEdgeForAdjacenciesWithVertices(const Vector3& pa,
-                                             const Vector3& pb,
-                                             const Vector3& p0,
-                                             const Vector3& p1,
-                                             const Vector3& p2);
-  void _checkEdge(unsigned int faceIndex, int edge,
-                  std::vector<Vector3> faceNormals, const Vector3& p0,
-                  const Vector3& p1);
+  void _addLine(const Vector3& p0, const Vector3& p1);
+  void _computeEdgesLines(span<const float> positions,
+                          const IndicesView& indices);
   void _generateEdgesLines();
+  void _releaseBuffers();
 
 public:
   float edgesWidthScalerForOrthographic;
@@ -48,6 +67,10 @@ private:
   std::unordered_map<unsigned int, std::unique_ptr<VertexBuffer>> _buffers;
   std::unordered_map<std::string, VertexBuffer*> _bufferPtrs;
   bool _checkVerticesInsteadOfIndices;
+  bool _isGeometryDirty;
+  // Adjacencies of the faces, and hash of the geometry they were built from
+  Int32Array _faceAdjacencies;
+  uint64_t _adjacenciesHash;
 
 }; // end of class EdgesRenderer
 
@@ -143,11 +143,13 @@ private:
    * @param cameraPosition The camera position use to preprocess the submeshes
    * to help sorting
    * @param transparent Specifies to activate blending if true
+   * @param frameArena Optional arena used for the sorted copy of the list
    */
   static void
   renderSorted(const std::vector<SubMesh*>& subMeshes,
                const std::function<int(SubMesh* a, SubMesh* b)>& sortCompareFn,
-               const Vector3& cameraPosition, bool transparent);
+               const Vector3& cameraPosition, bool transparent,
+               FrameArena* frameArena = nullptr);
 
   /**
    * Renders the submeshes in the order they were dispatched (no sort applied).
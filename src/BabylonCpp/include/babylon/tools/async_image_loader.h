@@ -0,0 +1,94 @@
+#ifndef BABYLON_TOOLS_ASYNC_IMAGE_LOADER_H
+#define BABYLON_TOOLS_ASYNC_IMAGE_LOADER_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/core/shared_queue.h>
+#include <babylon/core/structs.h>
+
+namespace BABYLON {
+
+class WorkerTaskGroup;
+
+/**
+ * @brief Reads and decodes images on worker threads.
+ *
+ * The files are memory mapped and decoded (PNG, JPG, TGA, BMP, HDR, ...) on
+ * the shared worker pool. The decoded images are queued until
+ * processCompleted() is called from the rendering thread, which runs the load
+ * callbacks, e.g. to upload the images to textures.
+ */
+class BABYLON_SHARED_EXPORT AsyncImageLoader {
+
+public:
+  using OnLoad  = std::function<void(const Image& img)>;
+  using OnError = std::function<void(const std::string& msg)>;
+
+public:
+  /**
+   * @brief Constructor.
+   * @param workerCount The number of worker threads of a pool of its own, 0
+   * uses the shared worker pool.
+   */
+  AsyncImageLoader(size_t workerCount = 0);
+  ~AsyncImageLoader();
+
+  AsyncImageLoader(const AsyncImageLoader&) = delete;
+  AsyncImageLoader& operator=(const AsyncImageLoader&) = delete;
+
+  /**
+   * @brief Queues the loading of an image, the callbacks are run by
+   * processCompleted().
+   */
+  void loadImage(const std::string& url, const OnLoad& onLoad,
+                 const OnError& onError, bool flipVertically = false);
+
+  /**
+   * @brief Runs the callbacks of the loaded images on the calling thread.
+   * @param byteBudget Maximum number of image bytes to hand to the callbacks,
+   * at least one image is processed. 0 processes all the loaded images.
+   * @returns The number of image bytes processed.
+   */
+  size_t processCompleted(size_t byteBudget = 0);
+
+  /**
+   * @brief Returns the number of images queued and not processed yet.
+   */
+  size_t pendingCount() const;
+
+  size_t workerCount() const;
+
+  /**
+   * @brief Reads and decodes an image file as RGBA, this function is thread
+   * safe.
+   * @returns Whether the image could be decoded, error is set otherwise.
+   */
+  static bool DecodeImage(const std::string& url, Image& image,
+                          std::string& error, bool flipVertically = false);
+
+  /**
+   * @brief Decodes an image file held in memory as RGBA, this function is
+   * thread safe.
+   * @returns Whether the image could be decoded, error is set otherwise.
+   */
+  static bool DecodeImage(const uint8_t* buffer, size_t size, Image& image,
+                          std::string& error, bool flipVertically = false);
+
+private:
+  struct LoadResult {
+    Image image;
+    std::string error;
+    OnLoad onLoad;
+    OnError onError;
+  }; // end of struct LoadResult
+
+private:
+  // Declared before the tasks, which push into it until they are run
+  SharedQueue<LoadResult> _completed;
+  std::atomic<size_t> _pendingCount;
+  std::unique_ptr<WorkerTaskGroup> _tasks;
+
+}; // end of class AsyncImageLoader
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_TOOLS_ASYNC_IMAGE_LOADER_H
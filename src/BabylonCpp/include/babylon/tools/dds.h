@@ -68,32 +68,75 @@ inline std::string Int32ToFourCC(int value)
 struct DDS {
   static constexpr unsigned int FOURCC_DXT1
     = FourCCToInt32<'D', 'X', 'T', '1'>::value;
-  static constexpr int FOURCC_DXT3 = FourCCToInt32<'D', 'X', 'T', '3'>::value;
-  static constexpr int FOURCC_DXT5 = FourCCToInt32<'D', 'X', 'T', '5'>::value;
-
-  // The header length in 32 bit ints
-  static constexpr int headerLengthInt = 31;
+  static constexpr unsigned int FOURCC_DXT3
+    = FourCCToInt32<'D', 'X', 'T', '3'>::value;
+  static constexpr unsigned int FOURCC_DXT5
+    = FourCCToInt32<'D', 'X', 'T', '5'>::value;
+  static constexpr unsigned int FOURCC_ATI1
+    = FourCCToInt32<'A', 'T', 'I', '1'>::value;
+  static constexpr unsigned int FOURCC_ATI2
+    = FourCCToInt32<'A', 'T', 'I', '2'>::value;
+  static constexpr unsigned int FOURCC_BC4U
+    = FourCCToInt32<'B', 'C', '4', 'U'>::value;
+  static constexpr unsigned int FOURCC_BC4S
+    = FourCCToInt32<'B', 'C', '4', 'S'>::value;
+  static constexpr unsigned int FOURCC_BC5U
+    = FourCCToInt32<'B', 'C', '5', 'U'>::value;
+  static constexpr unsigned int FOURCC_BC5S
+    = FourCCToInt32<'B', 'C', '5', 'S'>::value;
+  static constexpr unsigned int FOURCC_DX10
+    = FourCCToInt32<'D', 'X', '1', '0'>::value;
+
+  // The header length in 32 bit ints, magic number included
+  static constexpr int headerLengthInt = 32;
+  // The length of the DX10 header extension in 32 bit ints
+  static constexpr int dx10HeaderLengthInt = 5;
 }; // end of struct DDS
 
 // Offsets into the header array
 enum {
-  off_magic       = 0,
-  off_size        = 1,
-  off_flags       = 2,
-  off_height      = 3,
-  off_width       = 4,
-  off_mipmapCount = 7,
-  off_pfFlags     = 20,
-  off_pfFourCC    = 21,
-  off_RGBbpp      = 22,
-  off_RMask       = 23,
-  off_GMask       = 24,
-  off_BMask       = 25,
-  off_AMask       = 26,
-  off_caps1       = 27,
-  off_caps2       = 28
+  off_magic             = 0,
+  off_size              = 1,
+  off_flags             = 2,
+  off_height            = 3,
+  off_width             = 4,
+  off_pitchOrLinearSize = 5,
+  off_mipmapCount       = 7,
+  off_pfSize            = 19,
+  off_pfFlags           = 20,
+  off_pfFourCC          = 21,
+  off_RGBbpp            = 22,
+  off_RMask             = 23,
+  off_GMask             = 24,
+  off_BMask             = 25,
+  off_AMask             = 26,
+  off_caps1             = 27,
+  off_caps2             = 28,
+  // DX10 header extension
+  off_dxgiFormat        = 32,
+  off_resourceDimension = 33,
+  off_miscFlag          = 34,
+  off_arraySize         = 35
 };
 
+// DXGI formats of the DX10 header extension
+enum {
+  DXGI_FORMAT_BC1_UNORM      = 71,
+  DXGI_FORMAT_BC1_UNORM_SRGB = 72,
+  DXGI_FORMAT_BC2_UNORM      = 74,
+  DXGI_FORMAT_BC2_UNORM_SRGB = 75,
+  DXGI_FORMAT_BC3_UNORM      = 77,
+  DXGI_FORMAT_BC3_UNORM_SRGB = 78,
+  DXGI_FORMAT_BC4_UNORM      = 80,
+  DXGI_FORMAT_BC4_SNORM      = 81,
+  DXGI_FORMAT_BC5_UNORM      = 83,
+  DXGI_FORMAT_BC5_SNORM      = 84,
+  DXGI_FORMAT_BC7_UNORM      = 98,
+  DXGI_FORMAT_BC7_UNORM_SRGB = 99
+};
+
+enum { DDS_RESOURCE_MISC_TEXTURECUBE = 0x4 };
+
 enum PixelFormat {
   AlphaFormat          = 1019,
   RGBFormat            = 1020,
@@ -118,12 +161,43 @@ struct DDSInfo {
   bool isRGB;
   bool isLuminance;
   bool isCube;
+  // GL format of the block compressed data, 0 for uncompressed data
+  unsigned int internalFormat;
+  // Size in bytes of a 4x4 block of the block compressed data
+  int blockBytes;
+  // Bits per pixel of the uncompressed RGB data
+  int bitsPerPixel;
+  // Offset of the first mip level of the first face in the file
+  size_t dataOffset;
 }; // end of struct DDSInfo
 
 class BABYLON_SHARED_EXPORT DDSTools {
 
+public:
+  /**
+   * @brief Reads and validates the header of a DDS file.
+   * @returns Whether the file is a supported DDS file with all its levels
+   * present.
+   */
+  static bool GetDDSInfo(const Uint8Array& arrayBuffer, DDSInfo& info);
+
+  /**
+   * @brief Returns the size in bytes of a mip level of a single face.
+   */
+  static size_t GetLevelLength(const DDSInfo& info, int width, int height);
+
+  /**
+   * @brief Uploads the levels of the faces to the texture bound to
+   * TEXTURE_2D, or to TEXTURE_CUBE_MAP when 6 faces are uploaded. Block
+   * compressed levels are uploaded as is.
+   * @returns The number of bytes uploaded.
+   */
+  static size_t UploadDDSLevels(GL::IGLRenderingContext* gl,
+                                const Uint8Array& arrayBuffer,
+                                const DDSInfo& info, bool loadMipmaps,
+                                unsigned int faces);
+
 private:
-  static DDSInfo GetDDSInfo(const Uint8Array& arrayBuffer);
   static Uint8Array GetRGBAArrayBuffer(float width, float height,
                                        size_t dataOffset, size_t dataLength,
                                        const Uint8Array& arrayBuffer);
@@ -134,11 +208,8 @@ private:
                                             size_t dataOffset,
                                             size_t dataLength,
                                             const Uint8Array& arrayBuffer);
-
-public:
-  static void UploadDDSLevels(GL::IGLRenderingContext* gl,
-                              const Uint8Array& arrayBuffer, DDSInfo& info,
-                              bool loadMipmaps, unsigned int faces);
+  static bool GetCompressedFormat(const Int32Array& header, DDSInfo& info);
+  static bool GetDX10Format(const Int32Array& header, DDSInfo& info);
 
 }; // end of class DDSTools
 
@@ -0,0 +1,159 @@
+#ifndef BABYLON_TOOLS_DERIVED_ASSET_CACHE_H
+#define BABYLON_TOOLS_DERIVED_ASSET_CACHE_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Content addressed cache of the assets derived from the loaded data by
+ * the costly processing steps, e.g. the normals of the geometries or the edge
+ * lines of the edges renderers.
+ *
+ * A processing step is identified by a name and a version, which must be
+ * increased whenever the output of the step changes. Its results are stored
+ * as binary blobs in the cache directory, keyed by the step and by the hash of
+ * its input, so that later loads of the same content skip the processing. A
+ * blob is written to a temporary file renamed once complete, and checked
+ * against the hash of its content when read.
+ *
+ * The cache is disabled until a directory is set. The directory is meant to be
+ * set once at startup, loading and storing blobs being thread safe otherwise.
+ */
+class BABYLON_SHARED_EXPORT DerivedAssetCache {
+
+public:
+  /**
+   * @brief A processing step whose results are cached.
+   */
+  struct Step {
+    const char* name;
+    uint32_t version;
+  }; // end of struct Step
+
+  static constexpr uint32_t Magic = 0x43414442; // "BDAC"
+
+public:
+  /**
+   * @brief Returns the cache of the process, used by the processing steps of
+   * the library.
+   */
+  static DerivedAssetCache& Instance();
+
+  DerivedAssetCache();
+  ~DerivedAssetCache();
+
+  DerivedAssetCache(const DerivedAssetCache&) = delete;
+  DerivedAssetCache& operator=(const DerivedAssetCache&) = delete;
+
+  /**
+   * @brief Sets the cache directory, which is created when missing. An empty
+   * directory disables the cache.
+   */
+  void setDirectory(const std::string& directory);
+  const std::string& directory() const;
+  bool isEnabled() const;
+
+  /**
+   * @brief Sets the size in bytes of the smallest input worth caching, the
+   * results derived from smaller inputs being faster to compute than to load.
+   */
+  void setMinimumInputSize(size_t size);
+  size_t minimumInputSize() const;
+
+  /**
+   * @brief Returns whether the results derived from an input of the given
+   * size in bytes are cached.
+   */
+  bool caches(size_t inputSize) const;
+
+  /**
+   * @brief Loads the blob derived by a step from the input with the given
+   * hash.
+   * @returns Whether the blob was found in the cache.
+   */
+  bool load(const Step& step, uint64_t inputHash, Uint8Array& blob);
+
+  /**
+   * @brief Stores the blob derived by a step from the input with the given
+   * hash.
+   * @returns Whether the blob was written.
+   */
+  bool store(const Step& step, uint64_t inputHash, const Uint8Array& blob);
+
+  /**
+   * @brief Returns the path of the file of the blob derived by a step from the
+   * input with the given hash.
+   */
+  std::string path(const Step& step, uint64_t inputHash) const;
+
+  size_t hits() const;
+  size_t misses() const;
+
+  /**
+   * @brief Appends a value to a blob.
+   */
+  template <typename T>
+  static void Append(Uint8Array& blob, T value)
+  {
+    static_assert(std::is_arithmetic<T>::value, "arithmetic type expected");
+    const auto offset = blob.size();
+    blob.resize(offset + sizeof(T));
+    std::memcpy(blob.data() + offset, &value, sizeof(T));
+  }
+
+  /**
+   * @brief Appends an array of vertex attributes with the given number of
+   * components per vertex to a blob, encoded by the mesh codec.
+   */
+  static void Append(Uint8Array& blob, const Float32Array& values,
+                     size_t stride);
+
+  /**
+   * @brief Appends an array of integers to a blob.
+   */
+  static void Append(Uint8Array& blob, const Uint32Array& values);
+
+  /**
+   * @brief Reads a value of a blob at offset, which is moved past the value.
+   * @returns Whether the blob holds the value.
+   */
+  template <typename T>
+  static bool Read(const Uint8Array& blob, size_t& offset, T& value)
+  {
+    static_assert(std::is_arithmetic<T>::value, "arithmetic type expected");
+    if (offset > blob.size() || blob.size() - offset < sizeof(T)) {
+      return false;
+    }
+    std::memcpy(&value, blob.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+  }
+
+  /**
+   * @brief Reads an array of vertex attributes of a blob at offset, which is
+   * moved past the array.
+   * @returns Whether the blob holds the array.
+   */
+  static bool Read(const Uint8Array& blob, size_t& offset,
+                   Float32Array& values);
+
+  /**
+   * @brief Reads an array of integers of a blob at offset, which is moved
+   * past the array.
+   * @returns Whether the blob holds the array.
+   */
+  static bool Read(const Uint8Array& blob, size_t& offset,
+                   Uint32Array& values);
+
+private:
+  std::string _directory;
+  size_t _minimumInputSize;
+  std::atomic<size_t> _hits;
+  std::atomic<size_t> _misses;
+
+}; // end of class DerivedAssetCache
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_TOOLS_DERIVED_ASSET_CACHE_H
@@ -0,0 +1,77 @@
+#ifndef BABYLON_TOOLS_KHRONOS_TEXTURE_CONTAINER_H
+#define BABYLON_TOOLS_KHRONOS_TEXTURE_CONTAINER_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Reads a KTX 1.1 texture container holding compressed 2D or cube
+ * textures.
+ *
+ * for description see https://www.khronos.org/opengles/sdk/tools/KTX/
+ * for file layout see
+ * https://www.khronos.org/opengles/sdk/tools/KTX/file_format_spec/
+ *
+ * The container only references the passed buffer, which must outlive it.
+ */
+class BABYLON_SHARED_EXPORT KhronosTextureContainer {
+
+public:
+  // Length of the identifier and of the header fields in bytes
+  static constexpr size_t HEADER_LEN = 12 + (13 * 4);
+
+  // Load types
+  static constexpr unsigned int COMPRESSED_2D = 0;
+  static constexpr unsigned int COMPRESSED_3D = 1;
+  static constexpr unsigned int TEX_2D        = 2;
+  static constexpr unsigned int TEX_3D        = 3;
+
+public:
+  /**
+   * @brief Reads and validates the header and the image sizes of the
+   * container, isInvalid is set when it cannot be uploaded.
+   * @param arrayBuffer Contents of the KTX file
+   * @param facesExpected Number of faces expected, 6 for cube textures
+   */
+  KhronosTextureContainer(const Uint8Array& arrayBuffer,
+                          unsigned int facesExpected);
+  ~KhronosTextureContainer();
+
+  /**
+   * @brief Uploads the compressed levels to the texture bound to TEXTURE_2D,
+   * or to TEXTURE_CUBE_MAP for cube textures. The levels are uploaded as is.
+   * @returns The number of bytes uploaded.
+   */
+  size_t uploadLevels(GL::IGLRenderingContext* gl, bool loadMipmaps) const;
+
+private:
+  uint32_t _readUint32(size_t offset) const;
+  bool _validateLevels();
+
+public:
+  const Uint8Array& arrayBuffer;
+  bool isInvalid;
+  unsigned int glType;
+  unsigned int glTypeSize;
+  unsigned int glFormat;
+  unsigned int glInternalFormat;
+  unsigned int glBaseInternalFormat;
+  unsigned int pixelWidth;
+  unsigned int pixelHeight;
+  unsigned int pixelDepth;
+  unsigned int numberOfArrayElements;
+  unsigned int numberOfFaces;
+  unsigned int numberOfMipmapLevels;
+  unsigned int bytesOfKeyValueData;
+  unsigned int loadType;
+
+private:
+  // Whether the container was written with the opposite endianness
+  bool _swapBytes;
+
+}; // end of class KhronosTextureContainer
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_TOOLS_KHRONOS_TEXTURE_CONTAINER_H
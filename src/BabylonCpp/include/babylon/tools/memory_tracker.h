@@ -0,0 +1,118 @@
+#ifndef BABYLON_TOOLS_MEMORY_TRACKER_H
+#define BABYLON_TOOLS_MEMORY_TRACKER_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/tools/observable.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Categories used to tag the memory owned by the engine and the scene.
+ */
+enum class MemoryCategory : unsigned int {
+  VertexBuffers  = 0,
+  IndexBuffers   = 1,
+  UniformBuffers = 2,
+  Textures       = 3,
+  RenderTargets  = 4,
+  Effects        = 5,
+  CpuVertexData  = 6,
+  Physics        = 7,
+}; // end of enum class MemoryCategory
+
+constexpr size_t MemoryCategoryCount = 8;
+
+/**
+ * @brief Memory usage per category, captured at the end of a frame.
+ */
+struct BABYLON_SHARED_EXPORT MemorySnapshot {
+  int renderId = 0;
+  std::array<size_t, MemoryCategoryCount> bytes   = {};
+  std::array<size_t, MemoryCategoryCount> objects = {};
+  // Resident set size of the process, 0 if unknown
+  size_t processRSS = 0;
+
+  size_t bytesOf(MemoryCategory category) const;
+  size_t objectsOf(MemoryCategory category) const;
+  size_t totalBytes() const;
+}; // end of struct MemorySnapshot
+
+/**
+ * @brief Event data of MemoryTracker::onBudgetExceededObservable.
+ */
+struct BABYLON_SHARED_EXPORT MemoryBudgetInfo {
+  MemoryCategory category;
+  size_t budget;
+  size_t bytes;
+}; // end of struct MemoryBudgetInfo
+
+/**
+ * @brief Keeps track of the number of bytes used per memory category.
+ *
+ * Resources created and released explicitly (GL buffers, CPU side copies)
+ * are accounted for with allocate() / release(), these calls are thread safe.
+ * Categories that are cheaper to measure by walking their owner (textures,
+ * effects, physics) are updated with setUsage() when a snapshot is taken.
+ *
+ * Soft budgets can be assigned per category. checkBudgets() notifies
+ * onBudgetExceededObservable once each time a category goes over its budget.
+ */
+class BABYLON_SHARED_EXPORT MemoryTracker {
+
+public:
+  MemoryTracker();
+  ~MemoryTracker();
+
+  MemoryTracker(const MemoryTracker&) = delete;
+  MemoryTracker& operator=(const MemoryTracker&) = delete;
+
+  static const char* CategoryName(MemoryCategory category);
+
+  void allocate(MemoryCategory category, size_t bytes);
+  void release(MemoryCategory category, size_t bytes);
+  void setUsage(MemoryCategory category, size_t bytes, size_t objects);
+
+  size_t bytes(MemoryCategory category) const;
+  size_t objects(MemoryCategory category) const;
+  size_t totalBytes() const;
+
+  /**
+   * @brief Sets the soft budget of a category, 0 disables the budget.
+   */
+  void setBudget(MemoryCategory category, size_t bytes);
+  size_t budget(MemoryCategory category) const;
+
+  /**
+   * @brief Sets the soft budget for the sum of all categories, 0 disables the
+   * budget. Exceeding it is reported with the category of the largest user.
+   */
+  void setTotalBudget(size_t bytes);
+  size_t totalBudget() const;
+
+  /**
+   * @brief Returns whether a category budget or the total budget is set.
+   */
+  bool hasBudgets() const;
+
+  MemorySnapshot snapshot(int renderId = 0) const;
+  void checkBudgets(const MemorySnapshot& snapshot);
+
+public:
+  Observable<MemoryBudgetInfo> onBudgetExceededObservable;
+
+private:
+  static size_t _index(MemoryCategory category);
+
+private:
+  std::array<std::atomic<size_t>, MemoryCategoryCount> _bytes;
+  std::array<std::atomic<size_t>, MemoryCategoryCount> _objects;
+  std::array<size_t, MemoryCategoryCount> _budgets;
+  std::array<bool, MemoryCategoryCount> _overBudget;
+  size_t _totalBudget;
+  bool _overTotalBudget;
+
+}; // end of class MemoryTracker
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_TOOLS_MEMORY_TRACKER_H
@@ -0,0 +1,111 @@
+#ifndef BABYLON_TOOLS_MIPMAP_GENERATOR_H
+#define BABYLON_TOOLS_MIPMAP_GENERATOR_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/core/structs.h>
+
+namespace BABYLON {
+
+class WorkerPool;
+
+/**
+ * @brief Pixel formats of the mip chains built by the MipmapGenerator, with 4
+ * channels per pixel.
+ */
+enum class MipmapFormat {
+  // 8 bits unsigned normalized channels
+  RGBA8,
+  // 16 bits half float channels
+  RGBA16F,
+  // 32 bits float channels
+  RGBA32F
+}; // end of enum class MipmapFormat
+
+/**
+ * @brief Downsampling filters of the MipmapGenerator.
+ */
+enum class MipmapFilter {
+  // Average of the covered pixels, cheap and without ringing
+  BOX,
+  // Kaiser windowed sinc, sharper mip levels
+  KAISER
+}; // end of enum class MipmapFilter
+
+struct BABYLON_SHARED_EXPORT MipmapOptions {
+  MipmapFilter filter = MipmapFilter::BOX;
+  // The 8 bits color channels are sRGB encoded and filtered in linear space
+  bool sRGB = false;
+  // Scale the alpha of each level so that the fraction of pixels passing the
+  // alpha test at alphaCutoff stays the one of the base level
+  bool preserveAlphaCoverage = false;
+  float alphaCutoff          = 0.5f;
+}; // end of struct MipmapOptions
+
+/**
+ * @brief Builds the mip chain of images on the CPU.
+ *
+ * The levels are filtered in float from the previous level, so that no
+ * quantization error accumulates down the chain, with the rows of each level
+ * split over the shared worker pool. The filters use SSE when the library is
+ * built with SIMD support. Building the mip chain on the CPU avoids stalls of
+ * the driver mipmap generation and gives the same levels on all drivers.
+ */
+class BABYLON_SHARED_EXPORT MipmapGenerator {
+
+public:
+  /**
+   * @brief Constructor.
+   * @param workerCount The number of worker threads of a pool of its own, 0
+   * uses the shared worker pool.
+   */
+  MipmapGenerator(size_t workerCount = 0);
+
+  /**
+   * @brief Constructor, the levels are filtered on the given pool.
+   */
+  MipmapGenerator(std::shared_ptr<WorkerPool> pool);
+  ~MipmapGenerator();
+
+  MipmapGenerator(const MipmapGenerator&) = delete;
+  MipmapGenerator& operator=(const MipmapGenerator&) = delete;
+
+  /**
+   * @brief Returns the levels following the base level, down to 1x1.
+   * @param data The base level, 4 channels per pixel
+   */
+  std::vector<Uint8Array> generate(const Uint8Array& data, int width,
+                                   int height, MipmapFormat format,
+                                   const MipmapOptions& options
+                                   = MipmapOptions());
+
+  /**
+   * @brief Returns the levels following an 8 bits image with 1 to 4 channels,
+   * down to 1x1. The last channel of 2 and 4 channels images is alpha.
+   */
+  std::vector<Image> generate(const Image& image,
+                              const MipmapOptions& options = MipmapOptions());
+
+  size_t workerCount() const;
+
+  /**
+   * @brief Returns the number of levels of the mip chain, base level included.
+   */
+  static unsigned int GetLevelCount(int width, int height);
+
+  static size_t GetBytesPerPixel(MipmapFormat format);
+
+private:
+  std::vector<Uint8Array> _generate(const uint8_t* data, int width, int height,
+                                    int channelCount, MipmapFormat format,
+                                    const MipmapOptions& options);
+  void _parallelFor(int count, int itemsPerTask,
+                    const std::function<void(int first, int last)>& func);
+
+private:
+  std::shared_ptr<WorkerPool> _pool;
+
+}; // end of class MipmapGenerator
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_TOOLS_MIPMAP_GENERATOR_H
@@ -0,0 +1,307 @@
+#ifndef BABYLON_TOOLS_SCENE_SNAPSHOT_H
+#define BABYLON_TOOLS_SCENE_SNAPSHOT_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/core/string_view.h>
+#include <babylon/math/color3.h>
+#include <babylon/math/quaternion.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Header of a snapshot, following its magic number and version.
+ */
+struct BABYLON_SHARED_EXPORT SnapshotHeader {
+  int animationTime = 0;
+  // Unique id of the active camera, NoId when there is none
+  unsigned int activeCameraId = std::numeric_limits<uint32_t>::max();
+}; // end of struct SnapshotHeader
+
+/**
+ * @brief Kind of the material referenced by a mesh.
+ */
+enum class SnapshotMaterialKind : uint8_t {
+  None   = 0,
+  Single = 1,
+  Multi  = 2,
+}; // end of enum class SnapshotMaterialKind
+
+/**
+ * @brief State of a mesh. The ids refer to the data they were read from, or to
+ * the objects they were captured from.
+ */
+struct BABYLON_SHARED_EXPORT SnapshotMesh {
+  unsigned int uniqueId = 0;
+  string_view id;
+  bool enabled     = true;
+  bool visible     = true;
+  float visibility = 1.f;
+  Vector3 position;
+  Vector3 rotation;
+  bool hasRotationQuaternion = false;
+  Quaternion rotationQuaternion;
+  Vector3 scaling;
+  // Geometry, by index in the geometries of the scene and id
+  bool hasGeometry       = false;
+  uint32_t geometryIndex = 0;
+  string_view geometryId;
+  // Material, by index in the materials or multi materials and id
+  SnapshotMaterialKind materialKind = SnapshotMaterialKind::None;
+  uint32_t materialIndex            = 0;
+  string_view materialId;
+  // Physics body
+  bool hasPhysics = false;
+  float mass      = 0.f;
+  Vector3 linearVelocity;
+  Vector3 angularVelocity;
+}; // end of struct SnapshotMesh
+
+/**
+ * @brief State of a camera.
+ */
+struct BABYLON_SHARED_EXPORT SnapshotCamera {
+  unsigned int uniqueId = 0;
+  string_view id;
+  bool enabled = true;
+  Vector3 position;
+  Vector3 upVector;
+  float fov         = 0.f;
+  float minZ        = 0.f;
+  float maxZ        = 0.f;
+  unsigned int mode = 0;
+  // Target cameras
+  bool hasRotation = false;
+  Vector3 rotation;
+  bool hasRotationQuaternion = false;
+  Quaternion rotationQuaternion;
+  // Arc rotate cameras
+  bool isArcRotate = false;
+  float alpha      = 0.f;
+  float beta       = 0.f;
+  float radius     = 0.f;
+  Vector3 target;
+}; // end of struct SnapshotCamera
+
+/**
+ * @brief State of a light.
+ */
+struct BABYLON_SHARED_EXPORT SnapshotLight {
+  unsigned int uniqueId = 0;
+  string_view id;
+  bool enabled = true;
+  Color3 diffuse;
+  Color3 specular;
+  float intensity = 0.f;
+  float range     = 0.f;
+  // Shadow lights have a position, hemispheric lights a ground color
+  bool isShadowLight = false;
+  bool isHemispheric = false;
+  Vector3 position;
+  Vector3 direction;
+  Color3 groundColor;
+}; // end of struct SnapshotLight
+
+/**
+ * @brief Parameters of a material.
+ */
+struct BABYLON_SHARED_EXPORT SnapshotMaterial {
+  string_view id;
+  bool backFaceCulling = true;
+  float alpha          = 1.f;
+  int alphaMode        = 0;
+  int sideOrientation  = 0;
+  // Standard materials
+  bool isStandard = false;
+  Color3 ambientColor;
+  Color3 diffuseColor;
+  Color3 specularColor;
+  Color3 emissiveColor;
+  float specularPower = 0.f;
+}; // end of struct SnapshotMaterial
+
+/**
+ * @brief Skeleton, followed by the records of its bones.
+ */
+struct BABYLON_SHARED_EXPORT SnapshotSkeleton {
+  string_view id;
+  uint32_t boneCount = 0;
+}; // end of struct SnapshotSkeleton
+
+/**
+ * @brief Local matrix of a bone.
+ */
+struct BABYLON_SHARED_EXPORT SnapshotBone {
+  std::array<float, 16> localMatrix{};
+}; // end of struct SnapshotBone
+
+/**
+ * @brief Running animatable, followed by the records of its animations.
+ */
+struct BABYLON_SHARED_EXPORT SnapshotAnimatable {
+  // Unique id of the target node, NoId when the target is not a node
+  unsigned int targetId = std::numeric_limits<uint32_t>::max();
+  bool loopAnimation    = false;
+  bool paused           = false;
+  bool started          = false;
+  int fromFrame         = 0;
+  int toFrame           = 0;
+  float speedRatio      = 1.f;
+  // Delays, in milliseconds
+  int64_t localDelayOffset = 0;
+  int64_t pausedDelay      = 0;
+  uint32_t animationCount  = 0;
+}; // end of struct SnapshotAnimatable
+
+/**
+ * @brief State of an animation of an animatable.
+ */
+struct BABYLON_SHARED_EXPORT SnapshotAnimation {
+  int currentFrame     = 0;
+  bool stopped         = false;
+  float blendingFactor = 0.f;
+}; // end of struct SnapshotAnimation
+
+/**
+ * @brief Binary snapshot of the runtime state of a scene, the binary
+ * counterpart of the scene serialization.
+ *
+ * A snapshot holds the state of the objects of the scene, not the objects
+ * themselves: the transforms and the enabled state of the meshes, cameras and
+ * lights, the geometry and material of the meshes, the parameters of the
+ * materials, the local matrices of the bones, the state of the running
+ * animatables and the velocities of the physics bodies. It is written in one
+ * pass, in the byte order of the host, and restored in place into a scene
+ * holding the same objects, e.g. the scene it was captured from or a scene
+ * loaded from the same file, without creating nor destroying any object.
+ *
+ * The snapshot is a header followed by the counted records of the meshes,
+ * cameras, lights, materials, skeletons and animatables. Nodes are matched by
+ * unique id and id, the other objects by index and id, the ids being compared
+ * in full. The state of the objects of the snapshot missing in the scene is
+ * ignored.
+ */
+class BABYLON_SHARED_EXPORT SceneSnapshot {
+
+public:
+  static constexpr uint32_t Magic   = 0x504e5342; // "BSNP"
+  static constexpr uint32_t Version = 1;
+  static constexpr uint32_t NoId    = std::numeric_limits<uint32_t>::max();
+
+public:
+  /**
+   * @brief Captures the state of a scene into buffer, replacing its content.
+   * The memory of buffer is reused, so that capturing a scene again into the
+   * same buffer does not allocate.
+   */
+  static void Capture(Scene* scene, Uint8Array& buffer);
+
+  /**
+   * @brief Restores the state captured in a snapshot into a scene. The
+   * snapshot is validated first, and the scene is left untouched when the
+   * snapshot is invalid.
+   * @returns Whether the snapshot is valid.
+   */
+  static bool Restore(Scene* scene, const uint8_t* data, size_t size);
+
+  /**
+   * @brief Returns whether the data holds a complete and well formed
+   * snapshot, without a scene.
+   */
+  static bool Validate(const uint8_t* data, size_t size);
+
+  /**
+   * @brief Returns a snapshot appending its records to buffer.
+   */
+  static SceneSnapshot Writer(Uint8Array& buffer);
+
+  /**
+   * @brief Returns a snapshot reading its records from data.
+   */
+  static SceneSnapshot Reader(const uint8_t* data, size_t size);
+
+  /** Records, written and read in the order of the snapshot **/
+  void write(const SnapshotHeader& header);
+  void writeCount(uint32_t count);
+  void write(const SnapshotMesh& mesh);
+  void write(const SnapshotCamera& camera);
+  void write(const SnapshotLight& light);
+  void write(const SnapshotMaterial& material);
+  void write(const SnapshotSkeleton& skeleton);
+  void write(const SnapshotBone& bone);
+  void write(const SnapshotAnimatable& animatable);
+  void write(const SnapshotAnimation& animation);
+
+  /**
+   * @brief Reads a record, the reader is invalid from the first truncated or
+   * malformed record on.
+   * @returns Whether the reader is still valid.
+   */
+  bool read(SnapshotHeader& header);
+  bool read(SnapshotMesh& mesh);
+  bool read(SnapshotCamera& camera);
+  bool read(SnapshotLight& light);
+  bool read(SnapshotMaterial& material);
+  bool read(SnapshotSkeleton& skeleton);
+  bool read(SnapshotBone& bone);
+  bool read(SnapshotAnimatable& animatable);
+  bool read(SnapshotAnimation& animation);
+  uint32_t readCount();
+
+  /**
+   * @brief Returns whether all the records read so far were well formed.
+   */
+  bool isValid() const;
+
+  /**
+   * @brief Returns whether all the data was read.
+   */
+  bool isAtEnd() const;
+
+private:
+  SceneSnapshot(Uint8Array* buffer, const uint8_t* data, size_t size);
+
+  template <typename T>
+  void _write(T value);
+  void _write(const string_view& value);
+  void _write(const Vector3& value);
+  void _write(const Quaternion& value);
+  void _write(const Color3& value);
+  template <typename T>
+  T _read();
+  void _read(string_view& value);
+  void _read(Vector3& value);
+  void _read(Quaternion& value);
+  void _read(Color3& value);
+
+  void _captureMeshes(Scene* scene);
+  void _captureCameras(Scene* scene);
+  void _captureLights(Scene* scene);
+  void _captureMaterials(Scene* scene);
+  void _captureSkeletons(Scene* scene);
+  void _captureAnimatables(Scene* scene);
+
+  /**
+   * @brief Reads the records of the snapshot, which are applied to the scene
+   * only when apply is true. The scene is not used when apply is false.
+   */
+  void _restore(Scene* scene, bool apply);
+  void _restoreMeshes(Scene* scene, bool apply);
+  void _restoreCameras(Scene* scene, bool apply);
+  void _restoreLights(Scene* scene, bool apply);
+  void _restoreMaterials(Scene* scene, bool apply);
+  void _restoreSkeletons(Scene* scene, bool apply);
+  void _restoreAnimatables(Scene* scene, bool apply);
+
+private:
+  Uint8Array* _buffer;
+  const uint8_t* _data;
+  size_t _size;
+  size_t _offset;
+  bool _valid;
+
+}; // end of class SceneSnapshot
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_TOOLS_SCENE_SNAPSHOT_H
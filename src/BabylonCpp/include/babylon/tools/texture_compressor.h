@@ -0,0 +1,168 @@
+#ifndef BABYLON_TOOLS_TEXTURE_COMPRESSOR_H
+#define BABYLON_TOOLS_TEXTURE_COMPRESSOR_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/core/structs.h>
+#include <babylon/tools/mipmap_generator.h>
+
+namespace BABYLON {
+
+class WorkerPool;
+class WorkerTaskGroup;
+
+/**
+ * @brief GPU block compression formats produced by the TextureCompressor.
+ */
+enum class BlockCompressionFormat {
+  // RGB with 1 bit alpha, 8 bytes per 4x4 block
+  BC1,
+  // RGBA with interpolated alpha, 16 bytes per block
+  BC3,
+  // Red channel, 8 bytes per block
+  BC4,
+  // Red and green channels, 16 bytes per block
+  BC5,
+  // High quality RGBA, 16 bytes per block
+  BC7
+}; // end of enum class BlockCompressionFormat
+
+/**
+ * @brief Block compressed image with its mip chain.
+ */
+struct BABYLON_SHARED_EXPORT CompressedTexture {
+  BlockCompressionFormat format;
+  int width  = 0;
+  int height = 0;
+  // Block compressed levels, the finest first
+  std::vector<Uint8Array> levels;
+}; // end of struct CompressedTexture
+
+/**
+ * @brief Compresses images to GPU block formats when they are imported.
+ *
+ * The mip chain is built by a MipmapGenerator, then the blocks of all the mip
+ * levels are compressed on the shared worker pool. The block encoders use
+ * SSE when the library is built with SIMD support. BC7 blocks are encoded in
+ * mode 6, a single subset of RGBA endpoints with 4 bits indices, which has a
+ * higher quality than BC1 and BC3 at a higher encoding cost.
+ *
+ * Compressed files are written as DDS files to a cache directory, keyed by the
+ * hash of the source file, so that an image is only compressed once. Image
+ * files are compressed on the worker pool by compressFileAsync(), without
+ * blocking the rendering thread.
+ */
+class BABYLON_SHARED_EXPORT TextureCompressor {
+
+public:
+  /**
+   * @brief Constructor.
+   * @param workerCount The number of worker threads of a pool of its own, 0
+   * uses the shared worker pool.
+   */
+  TextureCompressor(size_t workerCount = 0);
+
+  /**
+   * @brief Constructor, the images are compressed on the given pool.
+   */
+  TextureCompressor(std::shared_ptr<WorkerPool> pool);
+  ~TextureCompressor();
+
+  TextureCompressor(const TextureCompressor&) = delete;
+  TextureCompressor& operator=(const TextureCompressor&) = delete;
+
+  /**
+   * @brief Compresses the image and, when generateMipmaps is set, its mip
+   * chain down to 1x1.
+   */
+  CompressedTexture compress(const Image& image, BlockCompressionFormat format,
+                             bool generateMipmaps = true);
+
+  /**
+   * @brief Returns the path of a DDS file holding the compressed image file
+   * and its mip chain. The image is compressed on first use and read from the
+   * cache directory afterwards. Opaque images are compressed to BC1 and images
+   * with alpha to BC3, or both to BC7 when highQuality is set. Waits for the
+   * compression of the same file when it is queued by compressFileAsync().
+   * @returns The path of the DDS file, or an empty string if the image could
+   * not be decoded or the compressed file not written.
+   */
+  std::string compressFile(const std::string& url, bool highQuality = false,
+                           bool flipVertically = true);
+
+  /**
+   * @brief Returns the path of the DDS file of the compressed image file when
+   * it is in the cache directory. Otherwise queues its compression on the
+   * worker pool, as compressFile() does, and returns an empty string.
+   */
+  std::string compressFileAsync(const std::string& url,
+                                bool highQuality    = false,
+                                bool flipVertically = true);
+
+  /**
+   * @brief Returns the number of image files queued by compressFileAsync(),
+   * or compressed by compressFile(), and not written yet.
+   */
+  size_t pendingCount() const;
+
+  size_t workerCount() const;
+
+  static size_t GetBlockBytes(BlockCompressionFormat format);
+
+  /**
+   * @brief Returns the GL internal format of the compressed data.
+   */
+  static unsigned int GetInternalFormat(BlockCompressionFormat format);
+
+  /**
+   * @brief Compresses a block of 4x4 RGBA pixels, stored row by row.
+   */
+  static void CompressBlock(const uint8_t* rgba, BlockCompressionFormat format,
+                            uint8_t* dst);
+
+  /**
+   * @brief Compresses a single level on the calling thread.
+   */
+  static Uint8Array CompressImage(const Image& image,
+                                  BlockCompressionFormat format);
+
+  /**
+   * @brief Returns the contents of a DDS file holding the compressed levels.
+   */
+  static Uint8Array ToDDS(const CompressedTexture& texture);
+
+private:
+  CompressedTexture _compress(const Image& image, BlockCompressionFormat format,
+                              bool generateMipmaps,
+                              const MipmapOptions& options);
+  std::string _cachePath(const std::string& url, bool highQuality,
+                         bool flipVertically,
+                         const MipmapOptions& options) const;
+  bool _compressFile(const std::string& url, const std::string& path,
+                     bool highQuality, bool flipVertically,
+                     const MipmapOptions& options);
+  void _finishCompression(const std::string& path);
+  static void _compressBlocks(const Image& image, BlockCompressionFormat format,
+                              int firstBlockRow, int lastBlockRow,
+                              uint8_t* dst);
+
+public:
+  // Directory of the DDS files written by compressFile()
+  std::string cacheDirectory;
+  // Filtering of the mip chains built by compress()
+  MipmapOptions mipmapOptions;
+
+private:
+  MipmapGenerator _mipmapGenerator;
+  // Cache paths of the files being compressed
+  std::unordered_set<std::string> _compressing;
+  mutable std::mutex _compressingMutex;
+  std::condition_variable _compressed;
+  // Declared last, waits for the queued files before the members are
+  // destroyed
+  std::unique_ptr<WorkerTaskGroup> _tasks;
+
+}; // end of class TextureCompressor
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_TOOLS_TEXTURE_COMPRESSOR_H
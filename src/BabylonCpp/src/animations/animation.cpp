@@ -563,8 +563,9 @@ void Animation::setValue(const AnimationValue& currentValue, bool /*blend*/)
     destination = property;
   }
   else {
+    // The properties of the target are looked up from its IReflect pointer
     path        = targetPropertyPath[0];
-    destination = _target;
+    destination = static_cast<IReflect*>(_target);
   }
 
   // Blending
@@ -573,6 +574,9 @@ void Animation::setValue(const AnimationValue& currentValue, bool /*blend*/)
   else {
     any newValue = currentValue.getValue();
     _target->setProperty(destination, path, newValue);
+    if (_target->markTargetAsDirty()) {
+      _target->markAsDirty(0);
+    }
   }
 }
 
@@ -201,6 +201,11 @@ void Bone::markAsDirty(unsigned int /*property*/)
   _skeleton->_markAsDirty();
 }
 
+bool Bone::markTargetAsDirty() const
+{
+  return true;
+}
+
 bool Bone::copyAnimationRange(Bone* source, const std::string& rangeName,
                               int frameOffset, bool rescaleAsRequired,
                               const Vector3& skelDimensionsRatio,
@@ -393,7 +393,8 @@ Json::object Skeleton::serialize() const
   return Json::object();
 }
 
-Skeleton* Skeleton::Parse(const Json::value& parsedSkeleton, Scene* scene)
+Skeleton* Skeleton::Parse(const Json::value& parsedSkeleton, Scene* scene,
+                          const std::vector<Animation*>& boneAnimations)
 {
   auto skeleton = new Skeleton(Json::GetString(parsedSkeleton, "name"),
                                Json::GetString(parsedSkeleton, "id"), scene);
@@ -436,7 +437,11 @@ Skeleton* Skeleton::Parse(const Json::value& parsedSkeleton, Scene* scene)
       bone->length = Json::GetNumber(parsedBone, "length", 0);
     }
 
-    if (parsedBone.contains("animation")) {
+    const auto boneIndex = skeleton->bones.size() - 1;
+    if (boneIndex < boneAnimations.size() && boneAnimations[boneIndex]) {
+      bone->animations.emplace_back(boneAnimations[boneIndex]);
+    }
+    else if (parsedBone.contains("animation")) {
       bone->animations.emplace_back(
         Animation::Parse(parsedBone.get("animation")));
     }
@@ -31,15 +31,17 @@ Vector3 PickingInfo::getNormal(bool useWorldCoordinates,
     return Vector3();
   }
 
-  auto indices = pickedMesh->getIndices();
+  auto indices = pickedMesh->getIndicesView();
   Vector3 result;
 
   if (useVerticesNormals) {
-    auto normals = pickedMesh->getVerticesData(VertexBuffer::NormalKind);
+    auto normals = pickedMesh->getVerticesDataView(VertexBuffer::NormalKind);
 
-    auto normal0 = Vector3::FromArray(normals, indices[faceId * 3] * 3);
-    auto normal1 = Vector3::FromArray(normals, indices[faceId * 3 + 1] * 3);
-    auto normal2 = Vector3::FromArray(normals, indices[faceId * 3 + 2] * 3);
+    auto normal0 = Vector3::FromArray(normals.data(), indices[faceId * 3] * 3);
+    auto normal1
+      = Vector3::FromArray(normals.data(), indices[faceId * 3 + 1] * 3);
+    auto normal2
+      = Vector3::FromArray(normals.data(), indices[faceId * 3 + 2] * 3);
 
     normal0 = normal0.scale(bu);
     normal1 = normal1.scale(bv);
@@ -50,11 +52,15 @@ Vector3 PickingInfo::getNormal(bool useWorldCoordinates,
                      normal0.z + normal1.z + normal2.z);
   }
   else {
-    auto positions = pickedMesh->getVerticesData(VertexBuffer::PositionKind);
+    auto positions
+      = pickedMesh->getVerticesDataView(VertexBuffer::PositionKind);
 
-    auto vertex1 = Vector3::FromArray(positions, indices[faceId * 3] * 3);
-    auto vertex2 = Vector3::FromArray(positions, indices[faceId * 3 + 1] * 3);
-    auto vertex3 = Vector3::FromArray(positions, indices[faceId * 3 + 2] * 3);
+    auto vertex1
+      = Vector3::FromArray(positions.data(), indices[faceId * 3] * 3);
+    auto vertex2
+      = Vector3::FromArray(positions.data(), indices[faceId * 3 + 1] * 3);
+    auto vertex3
+      = Vector3::FromArray(positions.data(), indices[faceId * 3 + 2] * 3);
 
     auto p1p2 = vertex1.subtract(vertex2);
     auto p3p2 = vertex3.subtract(vertex2);
@@ -75,12 +81,12 @@ Vector2 PickingInfo::getTextureCoordinates()
     return Vector2();
   }
 
-  auto indices = pickedMesh->getIndices();
-  auto uvs     = pickedMesh->getVerticesData(VertexBuffer::UVKind);
+  auto indices = pickedMesh->getIndicesView();
+  auto uvs     = pickedMesh->getVerticesDataView(VertexBuffer::UVKind);
 
-  auto uv0 = Vector2::FromArray(uvs, indices[faceId * 3] * 2);
-  auto uv1 = Vector2::FromArray(uvs, indices[faceId * 3 + 1] * 2);
-  auto uv2 = Vector2::FromArray(uvs, indices[faceId * 3 + 2] * 2);
+  auto uv0 = Vector2::FromArray(uvs.data(), indices[faceId * 3] * 2);
+  auto uv1 = Vector2::FromArray(uvs.data(), indices[faceId * 3 + 1] * 2);
+  auto uv2 = Vector2::FromArray(uvs.data(), indices[faceId * 3 + 2] * 2);
 
   uv0 = uv0.scale(1.f - bu - bv);
   uv1 = uv1.scale(bu);
@@ -0,0 +1,107 @@
+#include <babylon/core/frame_arena.h>
+
+namespace BABYLON {
+
+FrameArena::FrameArena(size_t blockSize)
+    : _blockSize{std::max(blockSize, static_cast<size_t>(64))}
+    , _currentBlock{0}
+    , _offset{0}
+    , _allocationCount{0}
+    , _bytesAllocated{0}
+{
+}
+
+FrameArena::~FrameArena()
+{
+}
+
+void FrameArena::_addBlock(size_t minSize)
+{
+  Block block;
+  block.size = std::max(_blockSize, minSize);
+  block.data = std::unique_ptr<byte[]>(new byte[block.size]);
+  _blocks.emplace_back(std::move(block));
+}
+
+void* FrameArena::allocate(size_t size, size_t alignment)
+{
+  if (size == 0) {
+    size = 1;
+  }
+
+  ++_allocationCount;
+  _bytesAllocated += size;
+
+  while (true) {
+    if (_currentBlock < _blocks.size()) {
+      auto& block       = _blocks[_currentBlock];
+      const auto base   = reinterpret_cast<std::uintptr_t>(block.data.get());
+      const auto start  = base + _offset;
+      const auto offset = (start + alignment - 1) & ~(alignment - 1);
+      if (offset + size <= base + block.size) {
+        _offset = static_cast<size_t>(offset + size - base);
+        return reinterpret_cast<void*>(offset);
+      }
+      // Continue in the next block, if any
+      if (_currentBlock + 1 < _blocks.size()) {
+        ++_currentBlock;
+        _offset = 0;
+        continue;
+      }
+    }
+    _addBlock(size + alignment);
+    _currentBlock = _blocks.size() - 1;
+    _offset       = 0;
+  }
+}
+
+void FrameArena::deallocate(void* ptr, size_t size)
+{
+  if (!ptr || _currentBlock >= _blocks.size()) {
+    return;
+  }
+
+  // Only the most recent allocation can be rolled back
+  auto& block     = _blocks[_currentBlock];
+  const auto base = reinterpret_cast<std::uintptr_t>(block.data.get());
+  const auto addr = reinterpret_cast<std::uintptr_t>(ptr);
+  if (addr >= base && addr + size == base + _offset) {
+    _offset = static_cast<size_t>(addr - base);
+  }
+}
+
+void FrameArena::reset()
+{
+  if (_blocks.size() > 1) {
+    // Merge the blocks so that the next frame fits in a single block
+    const auto totalSize = capacity();
+    _blocks.clear();
+    _addBlock(totalSize);
+  }
+
+  _currentBlock    = 0;
+  _offset          = 0;
+  _allocationCount = 0;
+  _bytesAllocated  = 0;
+}
+
+size_t FrameArena::allocationCount() const
+{
+  return _allocationCount;
+}
+
+size_t FrameArena::bytesAllocated() const
+{
+  return _bytesAllocated;
+}
+
+size_t FrameArena::capacity() const
+{
+  size_t totalSize = 0;
+  for (const auto& block : _blocks) {
+    totalSize += block.size;
+  }
+  return totalSize;
+}
+
+} // end of namespace BABYLON
@@ -16,6 +16,7 @@ limitations under the License.
 
 #include <babylon/core/hash.h>
 #include <ctype.h>
+#include <cstring>
 
 namespace BABYLON {
 
@@ -62,4 +63,107 @@ HashValue HashCaseInsensitive(const char* str, size_t len)
   return value;
 }
 
+namespace {
+
+constexpr uint64_t kPrime64_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t kPrime64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t kPrime64_3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t kPrime64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t kPrime64_5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t RotateLeft(uint64_t value, unsigned int bits)
+{
+  return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t Read64(const unsigned char* ptr)
+{
+  uint64_t value;
+  std::memcpy(&value, ptr, sizeof(value));
+  return value;
+}
+
+inline uint32_t Read32(const unsigned char* ptr)
+{
+  uint32_t value;
+  std::memcpy(&value, ptr, sizeof(value));
+  return value;
+}
+
+inline uint64_t Round(uint64_t accumulator, uint64_t input)
+{
+  accumulator += input * kPrime64_2;
+  accumulator = RotateLeft(accumulator, 31);
+  return accumulator * kPrime64_1;
+}
+
+inline uint64_t MergeRound(uint64_t accumulator, uint64_t value)
+{
+  accumulator ^= Round(0, value);
+  return accumulator * kPrime64_1 + kPrime64_4;
+}
+
+} // end of anonymous namespace
+
+uint64_t Hash64(const void* data, size_t len, uint64_t seed)
+{
+  auto ptr       = static_cast<const unsigned char*>(data);
+  const auto end = ptr + len;
+  uint64_t value;
+
+  if (len >= 32) {
+    const auto limit = end - 32;
+    uint64_t v1      = seed + kPrime64_1 + kPrime64_2;
+    uint64_t v2      = seed + kPrime64_2;
+    uint64_t v3      = seed;
+    uint64_t v4      = seed - kPrime64_1;
+    do {
+      v1 = Round(v1, Read64(ptr));
+      v2 = Round(v2, Read64(ptr + 8));
+      v3 = Round(v3, Read64(ptr + 16));
+      v4 = Round(v4, Read64(ptr + 24));
+      ptr += 32;
+    } while (ptr <= limit);
+
+    value = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12)
+            + RotateLeft(v4, 18);
+    value = MergeRound(value, v1);
+    value = MergeRound(value, v2);
+    value = MergeRound(value, v3);
+    value = MergeRound(value, v4);
+  }
+  else {
+    value = seed + kPrime64_5;
+  }
+
+  value += static_cast<uint64_t>(len);
+
+  while (ptr + 8 <= end) {
+    value ^= Round(0, Read64(ptr));
+    value = RotateLeft(value, 27) * kPrime64_1 + kPrime64_4;
+    ptr += 8;
+  }
+
+  if (ptr + 4 <= end) {
+    value ^= static_cast<uint64_t>(Read32(ptr)) * kPrime64_1;
+    value = RotateLeft(value, 23) * kPrime64_2 + kPrime64_3;
+    ptr += 4;
+  }
+
+  while (ptr < end) {
+    value ^= (*ptr) * kPrime64_5;
+    value = RotateLeft(value, 11) * kPrime64_1;
+    ++ptr;
+  }
+
+  // Avalanche
+  value ^= value >> 33;
+  value *= kPrime64_2;
+  value ^= value >> 29;
+  value *= kPrime64_3;
+  value ^= value >> 32;
+
+  return value;
+}
+
 } // end of namespace BABYLON
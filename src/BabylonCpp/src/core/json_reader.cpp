@@ -0,0 +1,693 @@
+#include <babylon/core/json_reader.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define BABYLON_JSON_READER_SSE2
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+// Powers of ten represented exactly as doubles
+const std::array<double, 23> Pow10{{
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+}};
+
+// Largest mantissa represented exactly as a double
+const uint64_t MaxExactMantissa = uint64_t(1) << 53;
+
+inline bool isDigit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+inline bool isWhitespace(char c)
+{
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+#ifdef BABYLON_JSON_READER_SSE2
+inline unsigned int firstBit(int mask)
+{
+#ifdef _MSC_VER
+  unsigned long index;
+  _BitScanForward(&index, static_cast<unsigned long>(mask));
+  return static_cast<unsigned int>(index);
+#else
+  return static_cast<unsigned int>(__builtin_ctz(static_cast<unsigned>(mask)));
+#endif
+}
+
+inline unsigned int bitCount(int mask)
+{
+#ifdef _MSC_VER
+  return __popcnt(static_cast<unsigned int>(mask));
+#else
+  return static_cast<unsigned int>(
+    __builtin_popcount(static_cast<unsigned>(mask)));
+#endif
+}
+
+inline __m128i load(const char* data)
+{
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+#endif
+
+// Returns the first quote, backslash or control character of a string
+const char* scanString(const char* cur, const char* end)
+{
+#ifdef BABYLON_JSON_READER_SSE2
+  const __m128i quote     = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i control   = _mm_set1_epi8(0x1f);
+  for (; end - cur >= 16; cur += 16) {
+    const __m128i chunk = load(cur);
+    // Unsigned comparison: c <= 0x1f when max(c, 0x1f) == 0x1f
+    const __m128i found = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(chunk, quote),
+                   _mm_cmpeq_epi8(chunk, backslash)),
+      _mm_cmpeq_epi8(_mm_max_epu8(chunk, control), control));
+    const int mask = _mm_movemask_epi8(found);
+    if (mask != 0) {
+      return cur + firstBit(mask);
+    }
+  }
+#endif
+  while (cur < end && *cur != '"' && *cur != '\\'
+         && static_cast<unsigned char>(*cur) >= 0x20) {
+    ++cur;
+  }
+  return cur;
+}
+
+// Returns the first character which is not a whitespace
+const char* scanWhitespace(const char* cur, const char* end)
+{
+  // Whitespace runs are mostly single separators or indentation
+  if (cur < end && !isWhitespace(*cur)) {
+    return cur;
+  }
+#ifdef BABYLON_JSON_READER_SSE2
+  const __m128i space   = _mm_set1_epi8(' ');
+  const __m128i newline = _mm_set1_epi8('\n');
+  const __m128i ret     = _mm_set1_epi8('\r');
+  const __m128i tab     = _mm_set1_epi8('\t');
+  for (; end - cur >= 16; cur += 16) {
+    const __m128i chunk = load(cur);
+    const __m128i whitespace
+      = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space),
+                                  _mm_cmpeq_epi8(chunk, newline)),
+                     _mm_or_si128(_mm_cmpeq_epi8(chunk, ret),
+                                  _mm_cmpeq_epi8(chunk, tab)));
+    const int mask = _mm_movemask_epi8(whitespace) ^ 0xffff;
+    if (mask != 0) {
+      return cur + firstBit(mask);
+    }
+  }
+#endif
+  while (cur < end && isWhitespace(*cur)) {
+    ++cur;
+  }
+  return cur;
+}
+
+// Returns the number of commas before the first closing bracket, used to
+// size the buffer of an array of numbers
+size_t countSeparators(const char* cur, const char* end)
+{
+  size_t count = 0;
+#ifdef BABYLON_JSON_READER_SSE2
+  const __m128i comma   = _mm_set1_epi8(',');
+  const __m128i closing = _mm_set1_epi8(']');
+  for (; end - cur >= 16; cur += 16) {
+    const __m128i chunk = load(cur);
+    const int commas    = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, comma));
+    const int closings  = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, closing));
+    if (closings != 0) {
+      const int before = (1 << firstBit(closings)) - 1;
+      return count + bitCount(commas & before);
+    }
+    count += bitCount(commas);
+  }
+#endif
+  for (; cur < end && *cur != ']'; ++cur) {
+    count += (*cur == ',') ? 1 : 0;
+  }
+  return count;
+}
+
+template <typename T>
+inline bool isRepresentable(double value)
+{
+  return value >= static_cast<double>(std::numeric_limits<T>::lowest())
+         && value <= static_cast<double>(std::numeric_limits<T>::max())
+         && (!std::is_integral<T>::value || value == std::floor(value));
+}
+
+void appendUtf8(std::string& value, int codepoint)
+{
+  if (codepoint < 0x80) {
+    value.push_back(static_cast<char>(codepoint));
+  }
+  else if (codepoint < 0x800) {
+    value.push_back(static_cast<char>(0xc0 | (codepoint >> 6)));
+    value.push_back(static_cast<char>(0x80 | (codepoint & 0x3f)));
+  }
+  else if (codepoint < 0x10000) {
+    value.push_back(static_cast<char>(0xe0 | (codepoint >> 12)));
+    value.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
+    value.push_back(static_cast<char>(0x80 | (codepoint & 0x3f)));
+  }
+  else {
+    value.push_back(static_cast<char>(0xf0 | (codepoint >> 18)));
+    value.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3f)));
+    value.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
+    value.push_back(static_cast<char>(0x80 | (codepoint & 0x3f)));
+  }
+}
+
+int parseQuadHex(const char* cur, const char* end)
+{
+  if (end - cur < 4) {
+    return -1;
+  }
+  int codepoint = 0;
+  for (size_t i = 0; i < 4; ++i) {
+    const char c = cur[i];
+    codepoint <<= 4;
+    if (isDigit(c)) {
+      codepoint |= c - '0';
+    }
+    else if (c >= 'a' && c <= 'f') {
+      codepoint |= c - 'a' + 10;
+    }
+    else if (c >= 'A' && c <= 'F') {
+      codepoint |= c - 'A' + 10;
+    }
+    else {
+      return -1;
+    }
+  }
+  return codepoint;
+}
+
+} // end of anonymous namespace
+
+JsonReader::Handler::~Handler()
+{
+}
+
+Float32Array* JsonReader::Handler::floatArray()
+{
+  return nullptr;
+}
+
+Uint32Array* JsonReader::Handler::uint32Array()
+{
+  return nullptr;
+}
+
+constexpr size_t JsonReader::MaxDepth;
+
+JsonReader::JsonReader(const char* data, size_t size)
+    : _begin{data}, _cur{data}, _end{data + size}
+{
+}
+
+JsonReader::~JsonReader()
+{
+}
+
+std::string JsonReader::parse(Handler& handler)
+{
+  _cur = _begin;
+  if (_parseValue(handler, 0)) {
+    return "";
+  }
+
+  const auto line = 1 + std::count(_begin, std::min(_cur, _end), '\n');
+  std::string error
+    = "syntax error at line " + std::to_string(line) + " near: ";
+  for (auto c = _cur; c < _end && *c != '\n'; ++c) {
+    if (static_cast<unsigned char>(*c) >= ' ') {
+      error.push_back(*c);
+    }
+  }
+  return error;
+}
+
+bool JsonReader::_parseValue(Handler& handler, size_t depth)
+{
+  _skipWhitespace();
+  if (_cur == _end) {
+    return false;
+  }
+
+  switch (*_cur) {
+    case 'n':
+      return _match("null", 4) && handler.null();
+    case 't':
+      return _match("true", 4) && handler.boolean(true);
+    case 'f':
+      return _match("false", 5) && handler.boolean(false);
+    case '"':
+      ++_cur;
+      return _parseString(_buffer) && handler.string(_buffer);
+    case '[':
+      if (depth >= MaxDepth) {
+        return false;
+      }
+      ++_cur;
+      return _parseArray(handler, depth + 1);
+    case '{':
+      if (depth >= MaxDepth) {
+        return false;
+      }
+      ++_cur;
+      return _parseObject(handler, depth + 1);
+    default: {
+      double value;
+      return _parseNumber(value) && handler.number(value);
+    }
+  }
+}
+
+bool JsonReader::_parseObject(Handler& handler, size_t depth)
+{
+  if (!handler.startObject()) {
+    return false;
+  }
+
+  _skipWhitespace();
+  if (_cur < _end && *_cur == '}') {
+    ++_cur;
+    return handler.endObject();
+  }
+
+  do {
+    if (!_expect('"') || !_parseString(_buffer) || !handler.key(_buffer)
+        || !_expect(':') || !_parseValue(handler, depth)) {
+      return false;
+    }
+  } while (_expect(','));
+
+  return _expect('}') && handler.endObject();
+}
+
+bool JsonReader::_parseArray(Handler& handler, size_t depth)
+{
+  // Arrays of numbers parsed straight into the buffers of the handler
+  if (auto floats = handler.floatArray()) {
+    if (_parseNumbers(*floats)) {
+      return true;
+    }
+  }
+  else if (auto uint32s = handler.uint32Array()) {
+    if (_parseNumbers(*uint32s)) {
+      return true;
+    }
+  }
+
+  if (!handler.startArray()) {
+    return false;
+  }
+
+  _skipWhitespace();
+  if (_cur < _end && *_cur == ']') {
+    ++_cur;
+    return handler.endArray();
+  }
+
+  do {
+    if (!_parseValue(handler, depth)) {
+      return false;
+    }
+  } while (_expect(','));
+
+  return _expect(']') && handler.endArray();
+}
+
+template <typename T>
+bool JsonReader::_parseNumbers(std::vector<T>& array)
+{
+  const auto start = _cur;
+  const auto fail  = [this, start, &array]() {
+    array.clear();
+    _cur = start;
+    return false;
+  };
+
+  array.clear();
+  _skipWhitespace();
+  if (_cur < _end && *_cur == ']') {
+    ++_cur;
+    return true;
+  }
+
+  array.reserve(countSeparators(_cur, _end) + 1);
+  while (true) {
+    double value;
+    _skipWhitespace();
+    if (!_parseNumber(value) || !isRepresentable<T>(value)) {
+      return fail();
+    }
+    array.emplace_back(static_cast<T>(value));
+
+    _skipWhitespace();
+    if (_cur == _end) {
+      return fail();
+    }
+    else if (*_cur == ',') {
+      ++_cur;
+    }
+    else if (*_cur == ']') {
+      ++_cur;
+      return true;
+    }
+    else {
+      return fail();
+    }
+  }
+}
+
+bool JsonReader::_parseString(std::string& value)
+{
+  value.clear();
+  while (true) {
+    const auto run = _cur;
+    _cur           = scanString(_cur, _end);
+    value.append(run, _cur);
+    if (_cur == _end) {
+      return false;
+    }
+
+    const char c = *_cur++;
+    if (c == '"') {
+      return true;
+    }
+    // Control characters are not allowed in strings
+    if (c != '\\' || _cur == _end) {
+      return false;
+    }
+
+    switch (*_cur++) {
+      case '"':
+        value.push_back('"');
+        break;
+      case '\\':
+        value.push_back('\\');
+        break;
+      case '/':
+        value.push_back('/');
+        break;
+      case 'b':
+        value.push_back('\b');
+        break;
+      case 'f':
+        value.push_back('\f');
+        break;
+      case 'n':
+        value.push_back('\n');
+        break;
+      case 'r':
+        value.push_back('\r');
+        break;
+      case 't':
+        value.push_back('\t');
+        break;
+      case 'u':
+        if (!_parseCodepoint(value)) {
+          return false;
+        }
+        break;
+      default:
+        return false;
+    }
+  }
+}
+
+bool JsonReader::_parseCodepoint(std::string& value)
+{
+  int codepoint = parseQuadHex(_cur, _end);
+  if (codepoint == -1) {
+    return false;
+  }
+  _cur += 4;
+
+  // Surrogate pair
+  if (codepoint >= 0xd800 && codepoint <= 0xdfff) {
+    if (codepoint > 0xdbff || _end - _cur < 2 || _cur[0] != '\\'
+        || _cur[1] != 'u') {
+      return false;
+    }
+    const int low = parseQuadHex(_cur + 2, _end);
+    if (low < 0xdc00 || low > 0xdfff) {
+      return false;
+    }
+    _cur += 6;
+    codepoint = 0x10000 + (((codepoint - 0xd800) << 10) | (low - 0xdc00));
+  }
+
+  appendUtf8(value, codepoint);
+  return true;
+}
+
+bool JsonReader::_parseNumber(double& value)
+{
+  const auto start = _cur;
+  const bool negative = (_cur < _end && *_cur == '-');
+  if (negative) {
+    ++_cur;
+  }
+  if (_cur == _end || !isDigit(*_cur)) {
+    return false;
+  }
+
+  // Up to 19 significant digits are accumulated in the mantissa
+  uint64_t mantissa = 0;
+  int digits        = 0;
+  int exponent      = 0;
+  bool exact        = true;
+  const auto addDigit = [&](char c, int exponentOffset) {
+    if (digits < 19) {
+      mantissa = mantissa * 10 + static_cast<uint64_t>(c - '0');
+      digits += (mantissa != 0) ? 1 : 0;
+      exponent -= (exponentOffset < 0) ? 1 : 0;
+    }
+    else {
+      exact = exact && (c == '0');
+      exponent += (exponentOffset > 0) ? 1 : 0;
+    }
+  };
+
+  // Integer part, without leading zeros
+  if (*_cur == '0') {
+    ++_cur;
+  }
+  else {
+    for (; _cur < _end && isDigit(*_cur); ++_cur) {
+      addDigit(*_cur, 1);
+    }
+  }
+
+  // Fraction
+  if (_cur < _end && *_cur == '.') {
+    ++_cur;
+    if (_cur == _end || !isDigit(*_cur)) {
+      return false;
+    }
+    for (; _cur < _end && isDigit(*_cur); ++_cur) {
+      addDigit(*_cur, -1);
+    }
+  }
+
+  // Exponent
+  if (_cur < _end && (*_cur == 'e' || *_cur == 'E')) {
+    ++_cur;
+    const bool negativeExponent = (_cur < _end && *_cur == '-');
+    if (_cur < _end && (*_cur == '-' || *_cur == '+')) {
+      ++_cur;
+    }
+    if (_cur == _end || !isDigit(*_cur)) {
+      return false;
+    }
+    int exponentValue = 0;
+    for (; _cur < _end && isDigit(*_cur); ++_cur) {
+      exponentValue = std::min(exponentValue * 10 + (*_cur - '0'), 100000);
+    }
+    exponent += negativeExponent ? -exponentValue : exponentValue;
+  }
+
+  // Exact when the mantissa and the power of ten are exact doubles, the
+  // product or quotient then being correctly rounded
+  if (mantissa == 0) {
+    value = negative ? -0.0 : 0.0;
+    return true;
+  }
+  if (exact && mantissa <= MaxExactMantissa && exponent >= -22
+      && exponent <= 22) {
+    const auto result = (exponent < 0) ?
+                          static_cast<double>(mantissa) / Pow10[-exponent] :
+                          static_cast<double>(mantissa) * Pow10[exponent];
+    value = negative ? -result : result;
+    return true;
+  }
+
+  // Other numbers are converted by strtod, with the decimal point of the
+  // current locale
+  std::string number(start, _cur);
+  const char decimalPoint = *localeconv()->decimal_point;
+  if (decimalPoint != '.') {
+    std::replace(number.begin(), number.end(), '.', decimalPoint);
+  }
+  char* endp = nullptr;
+  value      = std::strtod(number.c_str(), &endp);
+  return endp == number.c_str() + number.size();
+}
+
+bool JsonReader::_match(const char* literal, size_t length)
+{
+  if (static_cast<size_t>(_end - _cur) < length
+      || std::memcmp(_cur, literal, length) != 0) {
+    return false;
+  }
+  _cur += length;
+  return true;
+}
+
+void JsonReader::_skipWhitespace()
+{
+  _cur = scanWhitespace(_cur, _end);
+}
+
+bool JsonReader::_expect(char c)
+{
+  _skipWhitespace();
+  if (_cur < _end && *_cur == c) {
+    ++_cur;
+    return true;
+  }
+  return false;
+}
+
+JsonDomBuilder::JsonDomBuilder(Json::value& root) : _root{root}
+{
+}
+
+JsonDomBuilder::~JsonDomBuilder()
+{
+}
+
+bool JsonDomBuilder::null()
+{
+  _add(Json::value());
+  return true;
+}
+
+bool JsonDomBuilder::boolean(bool value)
+{
+  _add(Json::value(value));
+  return true;
+}
+
+bool JsonDomBuilder::number(double value)
+{
+  // Json::value does not hold infinite numbers
+  if (!std::isfinite(value)) {
+    return false;
+  }
+  _add(Json::value(value));
+  return true;
+}
+
+bool JsonDomBuilder::string(std::string& value)
+{
+  Json::value parsedString(picojson::string_type, false);
+  parsedString.get<std::string>().swap(value);
+  _add(std::move(parsedString));
+  return true;
+}
+
+bool JsonDomBuilder::startObject()
+{
+  _containers.emplace_back(_add(Json::value(picojson::object_type, false)));
+  return true;
+}
+
+bool JsonDomBuilder::key(std::string& key)
+{
+  _key.swap(key);
+  return true;
+}
+
+bool JsonDomBuilder::endObject()
+{
+  _containers.pop_back();
+  return true;
+}
+
+bool JsonDomBuilder::startArray()
+{
+  _containers.emplace_back(_add(Json::value(picojson::array_type, false)));
+  return true;
+}
+
+bool JsonDomBuilder::endArray()
+{
+  _containers.pop_back();
+  return true;
+}
+
+size_t JsonDomBuilder::depth() const
+{
+  return _containers.size();
+}
+
+const Json::value& JsonDomBuilder::container(size_t index) const
+{
+  return *_containers[index];
+}
+
+const std::string& JsonDomBuilder::currentKey() const
+{
+  return _key;
+}
+
+Json::value* JsonDomBuilder::_add(Json::value&& value)
+{
+  if (_containers.empty()) {
+    _root = std::move(value);
+    return &_root;
+  }
+
+  // The innermost container is the last element of its parent, which is not
+  // resized before the container is closed
+  auto& container = *_containers.back();
+  if (container.is<Json::array>()) {
+    auto& array = container.get<Json::array>();
+    array.emplace_back(std::move(value));
+    return &array.back();
+  }
+
+  auto& element = container.get<Json::object>()[_key];
+  element       = std::move(value);
+  return &element;
+}
+
+namespace Json {
+
+std::string Parse(Json::value& parsedData, const char* data, size_t size)
+{
+  JsonDomBuilder builder(parsedData);
+  return JsonReader(data, size).parse(builder);
+}
+
+} // end of namespace Json
+
+} // end of namespace BABYLON
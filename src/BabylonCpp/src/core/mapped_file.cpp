@@ -0,0 +1,124 @@
+#include <babylon/core/mapped_file.h>
+
+#ifdef __unix__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace BABYLON {
+
+MappedFile::MappedFile() : _isOpen{false}, _data{nullptr}, _size{0}
+{
+}
+
+MappedFile::MappedFile(const std::string& path) : MappedFile()
+{
+  open(path);
+}
+
+MappedFile::~MappedFile()
+{
+  close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) : MappedFile()
+{
+  *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other)
+{
+  if (&other != this) {
+    close();
+    std::swap(_isOpen, other._isOpen);
+    std::swap(_data, other._data);
+    std::swap(_size, other._size);
+#ifndef __unix__
+    std::swap(_buffer, other._buffer);
+#endif
+  }
+
+  return *this;
+}
+
+bool MappedFile::open(const std::string& path)
+{
+  close();
+
+#ifdef __unix__
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat buffer;
+  if (fstat(fd, &buffer) != 0 || !S_ISREG(buffer.st_mode)) {
+    ::close(fd);
+    return false;
+  }
+
+  _size = static_cast<size_t>(buffer.st_size);
+  if (_size > 0) {
+    void* data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      ::close(fd);
+      _size = 0;
+      return false;
+    }
+    _data = static_cast<const uint8_t*>(data);
+  }
+  // The mapping stays valid once the descriptor is closed
+  ::close(fd);
+#else
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) {
+    return false;
+  }
+
+  _buffer.resize(static_cast<size_t>(file.tellg()));
+  file.seekg(0, std::ios::beg);
+  if (!file.read(reinterpret_cast<char*>(_buffer.data()),
+                 static_cast<std::streamsize>(_buffer.size()))) {
+    _buffer.clear();
+    return false;
+  }
+  _data = _buffer.data();
+  _size = _buffer.size();
+#endif
+
+  _isOpen = true;
+  return true;
+}
+
+void MappedFile::close()
+{
+#ifdef __unix__
+  if (_data) {
+    munmap(const_cast<uint8_t*>(_data), _size);
+  }
+#else
+  _buffer.clear();
+#endif
+  _isOpen = false;
+  _data   = nullptr;
+  _size   = 0;
+}
+
+bool MappedFile::isOpen() const
+{
+  return _isOpen;
+}
+
+const uint8_t* MappedFile::data() const
+{
+  return _data;
+}
+
+size_t MappedFile::size() const
+{
+  return _size;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,190 @@
+#include <babylon/core/worker_pool.h>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * @brief Ranges of a parallel for, shared with the workers which may start
+ * after the calling thread returned.
+ */
+struct ParallelForState {
+  const WorkerPool::RangeTask* func;
+  size_t count;
+  size_t itemsPerTask;
+  std::atomic<size_t> nextRange;
+  std::mutex mutex;
+  std::condition_variable idle;
+  size_t activeCount;
+  bool closed;
+
+  void runRanges()
+  {
+    for (size_t first = nextRange++ * itemsPerTask; first < count;
+         first        = nextRange++ * itemsPerTask) {
+      (*func)(first, std::min(first + itemsPerTask, count));
+    }
+  }
+
+}; // end of struct ParallelForState
+
+} // end of anonymous namespace
+
+std::shared_ptr<WorkerPool> WorkerPool::Shared()
+{
+  static auto pool = std::make_shared<WorkerPool>(DefaultWorkerCount());
+  return pool;
+}
+
+std::shared_ptr<WorkerPool> WorkerPool::Create(size_t workerCount)
+{
+  return (workerCount == 0) ? Shared() :
+                              std::make_shared<WorkerPool>(workerCount);
+}
+
+size_t WorkerPool::DefaultWorkerCount()
+{
+  const size_t hardwareThreads = std::thread::hardware_concurrency();
+  return (hardwareThreads > 1) ? hardwareThreads - 1 : 1;
+}
+
+WorkerPool::WorkerPool(size_t workerCount)
+{
+  _workers.reserve(workerCount);
+  for (size_t i = 0; i < workerCount; ++i) {
+    _workers.emplace_back(&WorkerPool::_run, this);
+  }
+}
+
+WorkerPool::~WorkerPool()
+{
+  // An empty task stops a worker once the tasks queued before it are run
+  for (size_t i = 0; i < _workers.size(); ++i) {
+    _tasks.push(Task());
+  }
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+void WorkerPool::send(Task task)
+{
+  _tasks.push(std::move(task));
+}
+
+void WorkerPool::parallelFor(size_t count, size_t itemsPerTask,
+                             const RangeTask& func)
+{
+  itemsPerTask           = std::max(itemsPerTask, static_cast<size_t>(1));
+  const size_t taskCount = (count + itemsPerTask - 1) / itemsPerTask;
+  if (_workers.empty() || taskCount <= 1) {
+    if (count > 0) {
+      func(0, count);
+    }
+    return;
+  }
+
+  auto state          = std::make_shared<ParallelForState>();
+  state->func         = &func;
+  state->count        = count;
+  state->itemsPerTask = itemsPerTask;
+  state->nextRange    = 0;
+  state->activeCount  = 0;
+  state->closed       = false;
+
+  // The calling thread and the workers take the next range until all the
+  // ranges are taken. A worker starting once the calling thread is done does
+  // nothing, the ranges being all processed
+  const auto helperCount = std::min(_workers.size(), taskCount - 1);
+  for (size_t i = 0; i < helperCount; ++i) {
+    send([state]() {
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->closed) {
+          return;
+        }
+        ++state->activeCount;
+      }
+      state->runRanges();
+      std::lock_guard<std::mutex> lock(state->mutex);
+      if (--state->activeCount == 0) {
+        state->idle.notify_all();
+      }
+    });
+  }
+  state->runRanges();
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->closed = true;
+  state->idle.wait(lock, [&state]() { return state->activeCount == 0; });
+}
+
+void WorkerPool::run(const std::vector<Task>& tasks)
+{
+  parallelFor(tasks.size(), 1, [&tasks](size_t first, size_t last) {
+    for (size_t i = first; i < last; ++i) {
+      tasks[i]();
+    }
+  });
+}
+
+size_t WorkerPool::workerCount() const
+{
+  return _workers.size();
+}
+
+void WorkerPool::_run()
+{
+  for (;;) {
+    Task task;
+    _tasks.waitAndPop(task);
+    if (!task) {
+      break;
+    }
+    task();
+  }
+}
+
+WorkerTaskGroup::WorkerTaskGroup(std::shared_ptr<WorkerPool> pool)
+    : _pool{std::move(pool)}, _taskCount{0}
+{
+}
+
+WorkerTaskGroup::~WorkerTaskGroup()
+{
+  wait();
+}
+
+void WorkerTaskGroup::send(WorkerPool::Task task)
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_taskCount;
+  }
+  _pool->send([this, task]() {
+    task();
+    // Notified under the lock, the group may be destroyed once released
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (--_taskCount == 0) {
+      _idle.notify_all();
+    }
+  });
+}
+
+void WorkerTaskGroup::wait()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  _idle.wait(lock, [this]() { return _taskCount == 0; });
+}
+
+WorkerPool& WorkerTaskGroup::pool()
+{
+  return *_pool;
+}
+
+size_t WorkerTaskGroup::workerCount() const
+{
+  return _pool->workerCount();
+}
+
+} // end of namespace BABYLON
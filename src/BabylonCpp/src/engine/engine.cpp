@@ -3,6 +3,7 @@
 #include <babylon/babylon_stl_util.h>
 #include <babylon/babylon_version.h>
 #include <babylon/cameras/camera.h>
+#include <babylon/core/hash.h>
 #include <babylon/core/logging.h>
 #include <babylon/core/string.h>
 #include <babylon/core/time.h>
@@ -19,10 +20,16 @@
 #include <babylon/math/color3.h>
 #include <babylon/math/color4.h>
 #include <babylon/mesh/vertex_buffer.h>
+#include <babylon/mesh/vertex_data.h>
 #include <babylon/postprocess/post_process.h>
 #include <babylon/states/_alpha_state.h>
 #include <babylon/states/_depth_culling_state.h>
 #include <babylon/states/_stencil_state.h>
+#include <babylon/core/mapped_file.h>
+#include <babylon/tools/async_image_loader.h>
+#include <babylon/tools/dds.h>
+#include <babylon/tools/khronos_texture_container.h>
+#include <babylon/tools/texture_compressor.h>
 #include <babylon/tools/tools.h>
 
 namespace BABYLON {
@@ -44,6 +51,11 @@ Engine::Engine(ICanvas* canvas, const EngineOptions& options)
     , renderEvenInBackground{true}
     , preventCacheWipeBetweenFrames{false}
     , enableOfflineSupport{true}
+    , asyncTextureLoading{false}
+    , textureUploadBudget{16 * 1024 * 1024}
+    , compressTexturesOnLoad{false}
+    , highQualityTextureCompression{false}
+    , cpuMipmapGeneration{false}
     , _gl{nullptr}
     , _renderingCanvas{canvas}
     , _windowIsBackground{false}
@@ -69,6 +81,8 @@ Engine::Engine(ICanvas* canvas, const EngineOptions& options)
     , _mustWipeVertexAttributes{false}
     , _emptyTexture{nullptr}
     , _emptyCubeTexture{nullptr}
+    , _textureStreaming{this}
+    , _imageLoadCounter{0}
 {
   Engine::Instances.emplace_back(this);
 
@@ -162,6 +176,43 @@ Engine::Engine(ICanvas* canvas, const EngineOptions& options)
     = stl_util::contains(extensions, "OES_texture_half_float_linear");
   _caps.textureHalfFloatRender = renderToHalfFloat;
 
+  // Compressed texture formats
+  const auto hasExtension = [&extensions](const std::string& name) {
+    return stl_util::contains(extensions, "GL_ARB_" + name)
+           || stl_util::contains(extensions, "GL_EXT_" + name);
+  };
+  _caps.s3tc  = hasExtension("texture_compression_s3tc");
+  _caps.rgtc  = hasExtension("texture_compression_rgtc");
+  _caps.bptc  = hasExtension("texture_compression_bptc");
+  _caps.etc2  = hasExtension("ES3_compatibility");
+  _caps.etc1  = _caps.etc2
+               || stl_util::contains(extensions,
+                                     "GL_OES_compressed_ETC1_RGB8_texture");
+  _caps.astc  = stl_util::contains(extensions,
+                                  "GL_KHR_texture_compression_astc_ldr");
+  _caps.pvrtc = stl_util::contains(extensions,
+                                   "GL_IMG_texture_compression_pvrtc");
+  _caps.atc = stl_util::contains(extensions, "GL_AMD_compressed_ATC_texture");
+  _caps.textureSRGB = hasExtension("texture_sRGB");
+
+  // Khronos texture containers in order of preference, see
+  // setTextureFormatToUse()
+  if (_caps.astc) {
+    _texturesSupported.emplace_back("-astc.ktx");
+  }
+  if (_caps.s3tc) {
+    _texturesSupported.emplace_back("-dxt.ktx");
+  }
+  if (_caps.pvrtc) {
+    _texturesSupported.emplace_back("-pvrtc.ktx");
+  }
+  if (_caps.etc2) {
+    _texturesSupported.emplace_back("-etc2.ktx");
+  }
+  if (_caps.etc1) {
+    _texturesSupported.emplace_back("-etc1.ktx");
+  }
+
   GL::IGLShaderPrecisionFormat* highp
     = _gl->getShaderPrecisionFormat(GL::FRAGMENT_SHADER, GL::HIGH_FLOAT);
   _caps.highPrecisionShaderSupported = highp ? highp->precision != 0 : false;
@@ -353,6 +404,100 @@ PerfCounter& Engine::drawCallsPerfCounter()
   return _drawCalls;
 }
 
+MemoryTracker& Engine::memoryTracker()
+{
+  return _memoryTracker;
+}
+
+TextureStreamingManager& Engine::textureStreaming()
+{
+  return _textureStreaming;
+}
+
+void Engine::_updateMemoryStats()
+{
+  size_t texturesBytes = 0, texturesCount = 0;
+  size_t renderTargetsBytes = 0, renderTargetsCount = 0;
+  for (const auto& texture : _loadedTexturesCache) {
+    if (texture->_framebuffer) {
+      renderTargetsBytes += GetTextureMemorySize(texture.get());
+      ++renderTargetsCount;
+    }
+    else {
+      texturesBytes += GetTextureMemorySize(texture.get());
+      ++texturesCount;
+    }
+  }
+  _memoryTracker.setUsage(MemoryCategory::Textures, texturesBytes,
+                          texturesCount);
+  _memoryTracker.setUsage(MemoryCategory::RenderTargets, renderTargetsBytes,
+                          renderTargetsCount);
+
+  size_t effectsBytes = 0;
+  for (const auto& item : _compiledEffects) {
+    auto program = item.second->getProgram();
+    if (program) {
+      effectsBytes += program->byteLength;
+    }
+  }
+  _memoryTracker.setUsage(MemoryCategory::Effects, effectsBytes,
+                          _compiledEffects.size());
+}
+
+size_t Engine::GetTextureMemorySize(const GL::IGLTexture* texture)
+{
+  if (!texture || texture->_width <= 0 || texture->_height <= 0) {
+    return 0;
+  }
+
+  // Block compressed levels are uploaded as stored in the file
+  if (texture->_compressedByteLength > 0) {
+    return texture->_compressedByteLength;
+  }
+
+  size_t bytesPerPixel = 4;
+  switch (texture->type) {
+    case EngineConstants::TEXTURETYPE_FLOAT:
+      bytesPerPixel = 16;
+      break;
+    case EngineConstants::TEXTURETYPE_HALF_FLOAT:
+      bytesPerPixel = 8;
+      break;
+    default:
+      break;
+  }
+
+  // Streamed textures only have the mip chain from their resident level
+  const auto level  = texture->_residentMipLevel;
+  const auto width  = std::max(texture->_width >> level, 1);
+  const auto height = std::max(texture->_height >> level, 1);
+  const auto pixels = static_cast<size_t>(width) * static_cast<size_t>(height);
+  const bool isRenderTarget = (texture->_framebuffer != nullptr);
+  const bool hasMipMaps
+    = texture->generateMipMaps || (!isRenderTarget && !texture->noMipmap);
+
+  auto size = pixels * bytesPerPixel;
+  if (hasMipMaps) {
+    // A full mip chain adds a third of the base level
+    size += size / 3;
+  }
+  if (texture->isCube) {
+    size *= 6;
+  }
+
+  if (isRenderTarget) {
+    const size_t samples = std::max(texture->samples, 1u);
+    if (samples > 1) {
+      size += pixels * bytesPerPixel * samples;
+    }
+    if (texture->_generateDepthBuffer) {
+      size += pixels * 4 * samples;
+    }
+  }
+
+  return size;
+}
+
 // Methods
 void Engine::backupGLState()
 {
@@ -829,6 +974,8 @@ Engine::createUniformBuffer(const Float32Array& elements)
   bindUniformBuffer(nullptr);
 
   ubo->references = 1;
+  _trackBuffer(ubo.get(), GL::UNIFORM_BUFFER,
+               elements.size() * sizeof(float));
   return ubo;
 }
 
@@ -843,6 +990,8 @@ Engine::createDynamicUniformBuffer(const Float32Array& elements)
   bindUniformBuffer(nullptr);
 
   ubo->references = 1;
+  _trackBuffer(ubo.get(), GL::UNIFORM_BUFFER,
+               elements.size() * sizeof(float));
   return ubo;
 }
 
@@ -870,6 +1019,48 @@ void Engine::updateUniformBuffer(GL::IGLBuffer* uniformBuffer,
 }
 
 // VBOs
+void Engine::_trackBuffer(GL::IGLBuffer* buffer, GL::GLenum target,
+                          size_t byteLength)
+{
+  buffer->target     = target;
+  buffer->byteLength = byteLength;
+
+  switch (target) {
+    case GL::ELEMENT_ARRAY_BUFFER:
+      _memoryTracker.allocate(MemoryCategory::IndexBuffers, byteLength);
+      break;
+    case GL::UNIFORM_BUFFER:
+      _memoryTracker.allocate(MemoryCategory::UniformBuffers, byteLength);
+      break;
+    default:
+      _memoryTracker.allocate(MemoryCategory::VertexBuffers, byteLength);
+      break;
+  }
+}
+
+void Engine::_untrackBuffer(GL::IGLBuffer* buffer)
+{
+  switch (buffer->target) {
+    case 0:
+      // Buffer not tracked
+      return;
+    case GL::ELEMENT_ARRAY_BUFFER:
+      _memoryTracker.release(MemoryCategory::IndexBuffers, buffer->byteLength);
+      break;
+    case GL::UNIFORM_BUFFER:
+      _memoryTracker.release(MemoryCategory::UniformBuffers,
+                             buffer->byteLength);
+      break;
+    default:
+      _memoryTracker.release(MemoryCategory::VertexBuffers,
+                             buffer->byteLength);
+      break;
+  }
+
+  buffer->target     = 0;
+  buffer->byteLength = 0;
+}
+
 void Engine::_resetVertexBufferBinding()
 {
   bindArrayBuffer(nullptr);
@@ -883,6 +1074,19 @@ Engine::GLBufferPtr Engine::createVertexBuffer(const Float32Array& vertices)
   _gl->bufferData(GL::ARRAY_BUFFER, vertices, GL::STATIC_DRAW);
   _resetVertexBufferBinding();
   vbo->references = 1;
+  _trackBuffer(vbo.get(), GL::ARRAY_BUFFER, vertices.size() * sizeof(float));
+  return vbo;
+}
+
+Engine::GLBufferPtr Engine::createVertexBuffer(const Uint32Array& vertices)
+{
+  auto vbo = _gl->createBuffer();
+  bindArrayBuffer(vbo.get());
+  _gl->bufferData(GL::ARRAY_BUFFER, vertices, GL::STATIC_DRAW);
+  _resetVertexBufferBinding();
+  vbo->references = 1;
+  _trackBuffer(vbo.get(), GL::ARRAY_BUFFER,
+               vertices.size() * sizeof(uint32_t));
   return vbo;
 }
 
@@ -894,6 +1098,7 @@ Engine::createDynamicVertexBuffer(const Float32Array& vertices)
   _gl->bufferData(GL::ARRAY_BUFFER, vertices, GL::DYNAMIC_DRAW);
   _resetVertexBufferBinding();
   vbo->references = 1;
+  _trackBuffer(vbo.get(), GL::ARRAY_BUFFER, vertices.size() * sizeof(float));
   return vbo;
 }
 
@@ -932,30 +1137,35 @@ Engine::GLBufferPtr Engine::createIndexBuffer(const IndicesArray& indices)
   bindIndexBuffer(vbo.get());
 
   // Check for 32 bits indices
-  auto need32Bits = false;
-
-  if (_caps.uintIndices) {
-    auto it = std::find_if(indices.begin(), indices.end(),
-                           std::bind2nd(std::greater<float>(), 65535.f));
-    if (it != indices.end()) {
-      need32Bits = true;
-    }
-  }
+  const auto need32Bits
+    = _caps.uintIndices && !VertexData::CanUse16BitIndices(indices);
 
   if (need32Bits) {
-    Uint32Array arrayBuffer;
-    arrayBuffer.assign(indices.begin(), indices.end());
-    _gl->bufferData(GL::ELEMENT_ARRAY_BUFFER, arrayBuffer, GL::STATIC_DRAW);
+    _gl->bufferData(GL::ELEMENT_ARRAY_BUFFER, indices, GL::STATIC_DRAW);
   }
   else {
-    Uint16Array arrayBuffer;
-    arrayBuffer.assign(indices.begin(), indices.end());
-    _gl->bufferData(GL::ELEMENT_ARRAY_BUFFER, arrayBuffer, GL::STATIC_DRAW);
+    _gl->bufferData(GL::ELEMENT_ARRAY_BUFFER,
+                    VertexData::ToUint16Indices(indices), GL::STATIC_DRAW);
   }
 
   _resetIndexBufferBinding();
   vbo->references = 1;
   vbo->is32Bits   = need32Bits;
+  _trackBuffer(vbo.get(), GL::ELEMENT_ARRAY_BUFFER,
+               indices.size() * (need32Bits ? 4 : 2));
+  return vbo;
+}
+
+Engine::GLBufferPtr Engine::createIndexBuffer(const Uint16Array& indices)
+{
+  auto vbo = _gl->createBuffer();
+  bindIndexBuffer(vbo.get());
+  _gl->bufferData(GL::ELEMENT_ARRAY_BUFFER, indices, GL::STATIC_DRAW);
+  _resetIndexBufferBinding();
+  vbo->references = 1;
+  vbo->is32Bits   = false;
+  _trackBuffer(vbo.get(), GL::ELEMENT_ARRAY_BUFFER,
+               indices.size() * sizeof(uint16_t));
   return vbo;
 }
 
@@ -1096,9 +1306,11 @@ void Engine::_bindVertexBuffersAttributes(
       }
 
       auto buffer = vertexBuffer->getBuffer();
-      vertexAttribPointer(buffer, _order, vertexBuffer->getSize(), GL::FLOAT,
-                          false, vertexBuffer->getStrideSize() * 4,
-                          static_cast<int>(vertexBuffer->getOffset() * 4));
+      vertexAttribPointer(buffer, _order, vertexBuffer->getSize(),
+                          vertexBuffer->getDataType(),
+                          vertexBuffer->getNormalized(),
+                          vertexBuffer->getByteStride(),
+                          vertexBuffer->getByteOffset());
 
       if (vertexBuffer->getIsInstanced()) {
         _gl->vertexAttribDivisor(_order, 1);
@@ -1239,6 +1451,7 @@ bool Engine::_releaseBuffer(GL::IGLBuffer* buffer)
   --buffer->references;
 
   if (buffer->references == 0) {
+    _untrackBuffer(buffer);
     _gl->deleteBuffer(buffer);
     return true;
   }
@@ -1254,11 +1467,13 @@ Engine::GLBufferPtr Engine::createInstancesBuffer(unsigned int capacity)
 
   bindArrayBuffer(buffer.get());
   _gl->bufferData(GL::ARRAY_BUFFER, capacity, GL::DYNAMIC_DRAW);
+  _trackBuffer(buffer.get(), GL::ARRAY_BUFFER, capacity);
   return buffer;
 }
 
 void Engine::deleteInstancesBuffer(GL::IGLBuffer* buffer)
 {
+  _untrackBuffer(buffer);
   _gl->deleteBuffer(buffer);
 }
 
@@ -1492,6 +1707,9 @@ std::unique_ptr<GL::IGLProgram> Engine::createShaderProgram(
   gl->deleteShader(vertexShader);
   gl->deleteShader(fragmentShader);
 
+  shaderProgram->byteLength
+    = vertexCode.size() + fragmentCode.size() + 2 * defines.size();
+
   return shaderProgram;
 }
 
@@ -1936,6 +2154,60 @@ Engine::setTextureFormatToUse(const std::vector<std::string>& formatsAvailable)
   return _textureFormatInUse;
 }
 
+bool Engine::isCompressedTextureFormatSupported(
+  unsigned int internalFormat) const
+{
+  switch (internalFormat) {
+    case GL::COMPRESSED_RGB_S3TC_DXT1_EXT:
+    case GL::COMPRESSED_RGBA_S3TC_DXT1_EXT:
+    case GL::COMPRESSED_RGBA_S3TC_DXT3_EXT:
+    case GL::COMPRESSED_RGBA_S3TC_DXT5_EXT:
+      return _caps.s3tc;
+    case GL::COMPRESSED_SRGB_S3TC_DXT1_EXT:
+    case GL::COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT:
+    case GL::COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT:
+    case GL::COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT:
+      return _caps.s3tc && _caps.textureSRGB;
+    case GL::COMPRESSED_RED_RGTC1:
+    case GL::COMPRESSED_SIGNED_RED_RGTC1:
+    case GL::COMPRESSED_RG_RGTC2:
+    case GL::COMPRESSED_SIGNED_RG_RGTC2:
+      return _caps.rgtc;
+    case GL::COMPRESSED_RGBA_BPTC_UNORM:
+    case GL::COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+      return _caps.bptc;
+    case GL::ETC1_RGB8_OES:
+      return _caps.etc1;
+    case GL::COMPRESSED_RGB8_ETC2:
+    case GL::COMPRESSED_SRGB8_ETC2:
+    case GL::COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+    case GL::COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+    case GL::COMPRESSED_RGBA8_ETC2_EAC:
+    case GL::COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
+      return _caps.etc2;
+    case GL::COMPRESSED_RGB_PVRTC_4BPPV1_IMG:
+    case GL::COMPRESSED_RGB_PVRTC_2BPPV1_IMG:
+    case GL::COMPRESSED_RGBA_PVRTC_4BPPV1_IMG:
+    case GL::COMPRESSED_RGBA_PVRTC_2BPPV1_IMG:
+      return _caps.pvrtc;
+    case GL::ATC_RGB_AMD:
+    case GL::ATC_RGBA_EXPLICIT_ALPHA_AMD:
+    case GL::ATC_RGBA_INTERPOLATED_ALPHA_AMD:
+      return _caps.atc;
+    default:
+      break;
+  }
+
+  // The ASTC block sizes are contiguous in both color spaces
+  const bool isASTC = (internalFormat >= GL::COMPRESSED_RGBA_ASTC_4x4_KHR
+                       && internalFormat <= GL::COMPRESSED_RGBA_ASTC_12x12_KHR)
+                      || (internalFormat
+                            >= GL::COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR
+                          && internalFormat
+                               <= GL::COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR);
+  return isASTC && _caps.astc;
+}
+
 GL::IGLTexture* Engine::createTexture(const std::vector<std::string>& list,
                                       bool noMipmap, bool invertY, Scene* scene,
                                       unsigned int samplingMode,
@@ -1959,8 +2231,23 @@ GL::IGLTexture* Engine::createTexture(const std::string& urlArg, bool noMipmap,
                                       Buffer* buffer, GL::IGLTexture* fallBack,
                                       unsigned int /*format*/)
 {
-  auto texture  = _gl->createTexture();
-  auto _texture = texture.get();
+  // Textures loaded from the same url with the same settings are shared
+  if (!fallBack) {
+    auto cachedTexture
+      = _getTextureFromCache(urlArg, noMipmap, samplingMode, invertY);
+    if (cachedTexture) {
+      _queueTextureOnLoad(cachedTexture, onLoad);
+      return cachedTexture;
+    }
+  }
+
+  // The fallback of a missing compressed texture reuses its texture object
+  std::unique_ptr<GL::IGLTexture> texture;
+  GL::IGLTexture* _texture = fallBack;
+  if (!fallBack) {
+    texture  = _gl->createTexture();
+    _texture = texture.get();
+  }
 
   std::string extension;
   bool isKTX        = false;
@@ -1997,30 +2284,50 @@ GL::IGLTexture* Engine::createTexture(const std::string& urlArg, bool noMipmap,
     }
   }
 
-  bool isDDS = getCaps().s3tc && (extension == ".dds");
+  // Image files are replaced by their block compressed version, read from the
+  // cache of the compressor. The image is loaded as is while it is being
+  // compressed by the worker pool on first use
+  if (compressTexturesOnLoad && !fromDataBool && !isKTX && !fallBack
+      && _caps.s3tc
+      && (extension == ".png" || extension == ".jpg" || extension == ".jpeg"
+          || extension == ".tga" || extension == ".bmp")) {
+    const auto compressedUrl = textureCompressor().compressFileAsync(
+      url, highQualityTextureCompression && _caps.bptc, true);
+    if (!compressedUrl.empty()) {
+      url       = compressedUrl;
+      extension = ".dds";
+    }
+  }
+
+  // The compressed format of DDS files is checked once their header is read
+  bool isDDS = (extension == ".dds");
   bool isTGA = (extension == ".tga");
 
   scene->_addPendingData(_texture);
   _texture->url          = url;
   _texture->noMipmap     = noMipmap;
+  _texture->invertY      = invertY;
   _texture->references   = 1;
   _texture->samplingMode = samplingMode;
-  texture->onLoadedCallbacks.clear();
+  _texture->onLoadedCallbacks.clear();
   if (onLoad) {
-    texture->onLoadedCallbacks.emplace_back(onLoad);
+    _texture->onLoadedCallbacks.emplace_back(onLoad);
   }
   if (!fallBack) {
     _loadedTexturesCache.emplace_back(std::move(texture));
+    _textureCache.addUrl(urlArg, _texture);
   }
 
-  auto onerror = [&](const std::string& msg) {
+  auto onerror = [this, scene, _texture, isKTX, urlArg, noMipmap, invertY,
+                  samplingMode, onLoad, onError,
+                  buffer](const std::string& msg) {
     scene->_removePendingData(_texture);
 
     // fallback for when compressed file not found to try again.  For instance,
     // etc1 does not have an alpha capable type
     if (isKTX) {
       createTexture(urlArg, noMipmap, invertY, scene, samplingMode, onLoad,
-                    onError, buffer, texture.get());
+                    onError, buffer, _texture);
     }
     else if (onError) {
       BABYLON_LOG_ERROR("Engine", msg);
@@ -2029,38 +2336,314 @@ GL::IGLTexture* Engine::createTexture(const std::string& urlArg, bool noMipmap,
   };
   std::function<void(const Image& img)> onload = nullptr;
 
-  if (isTGA) {
-    // Not implemented yet
+  if ((isKTX || isDDS) && fromDataArray.empty()) {
+    // The levels are uploaded as stored in the file, without being decoded
+    MappedFile file(url);
+    if (!file.isOpen()) {
+      onerror("Error loading texture " + url);
+      return _texture;
+    }
+    const Uint8Array data(file.data(), file.data() + file.size());
+    std::string error;
+    if (!_prepareCompressedTexture(_texture, scene, data, isKTX, noMipmap,
+                                   invertY, samplingMode, error)) {
+      onerror(error);
+    }
+    return _texture;
   }
-  else if (isDDS) {
+  else if (isTGA) {
     // Not implemented yet
   }
   else {
-    onload = [&](const Image& img) {
-      Engine::PrepareGLTexture(
-        _texture, _gl, scene, img.width, img.height, noMipmap, false,
-        [&](int potWidth, int potHeight) {
-          bool isPot = (img.width == potWidth && img.height == potHeight);
-          isPot      = true;
-          if (isPot) {
-            _gl->texImage2D(GL::TEXTURE_2D, 0, GL::RGBA, img.width, img.height,
-                            0, GL::RGBA, GL::UNSIGNED_BYTE, img.data);
-          }
-        },
-        invertY, samplingMode);
+    onload = [this, scene, _texture, noMipmap, invertY,
+              samplingMode](const Image& img) {
+      _prepareTextureFromImage(_texture, scene, img, noMipmap, invertY,
+                               samplingMode);
     };
   }
 
-  if (fromDataArray.empty()) {
-    Tools::LoadImage(url, onload, onerror);
+  if (!fromDataArray.empty() || !onload) {
+    // Not implemented yet, the pending data of the scene is released
+    onerror("Unsupported texture " + url);
+  }
+  else if (asyncTextureLoading) {
+    // Decoded by the image loader threads, uploaded by _processImageLoads()
+    const auto loadId            = ++_imageLoadCounter;
+    _pendingImageLoads[_texture] = loadId;
+    auto isPending               = [this, scene, _texture, loadId]() {
+      auto it = _pendingImageLoads.find(_texture);
+      if (it == _pendingImageLoads.end() || it->second != loadId) {
+        // The texture was released while loading
+        scene->_removePendingData(_texture);
+        return false;
+      }
+      _pendingImageLoads.erase(it);
+      return true;
+    };
+    imageLoader().loadImage(url,
+                            [isPending, onload](const Image& img) {
+                              if (isPending()) {
+                                onload(img);
+                              }
+                            },
+                            [isPending, onerror](const std::string& msg) {
+                              if (isPending()) {
+                                onerror(msg);
+                              }
+                            },
+                            true);
   }
   else {
-    // Not implemented yet
+    // Images with the same content as an already loaded texture, e.g. copies
+    // of a file referenced under different names, share the loaded texture
+    GL::IGLTexture* sharedTexture = nullptr;
+    Tools::LoadImage(url,
+                     [&](const Image& img) {
+                       if (!fallBack) {
+                         sharedTexture
+                           = _getTextureFromContentCache(_texture, img);
+                       }
+                       if (!sharedTexture) {
+                         onload(img);
+                       }
+                     },
+                     onerror);
+
+    if (sharedTexture) {
+      scene->_removePendingData(_texture);
+      _releaseTexture(_texture);
+      ++sharedTexture->references;
+      _textureCache.addUrl(urlArg, sharedTexture);
+      _queueTextureOnLoad(sharedTexture, onLoad);
+      return sharedTexture;
+    }
   }
 
   return _texture;
 }
 
+void Engine::_prepareTextureFromImage(GL::IGLTexture* texture, Scene* scene,
+                                      const Image& img, bool noMipmap,
+                                      bool invertY, unsigned int samplingMode)
+{
+  if (_textureStreaming.enabled && !noMipmap) {
+    // The streaming manager uploads the coarse levels of its own mip chain
+    Engine::PrepareGLTexture(
+      texture, _gl, scene, img.width, img.height, noMipmap, true,
+      [&](int /*potWidth*/, int /*potHeight*/) {
+        _textureStreaming.registerTexture(texture, img, invertY);
+      },
+      invertY, samplingMode);
+  }
+  else {
+    // The mip chain is either uploaded with the image or built by the driver
+    Engine::PrepareGLTexture(
+      texture, _gl, scene, img.width, img.height, noMipmap, cpuMipmapGeneration,
+      [&](int potWidth, int potHeight) {
+        bool isPot = (img.width == potWidth && img.height == potHeight);
+        isPot      = true;
+        if (isPot) {
+          _gl->texImage2D(GL::TEXTURE_2D, 0, GL::RGBA, img.width, img.height,
+                          0, GL::RGBA, GL::UNSIGNED_BYTE, img.data);
+          if (!noMipmap && cpuMipmapGeneration) {
+            _uploadMipmaps(img, GL::RGBA, mipmapOptions);
+          }
+        }
+      },
+      invertY, samplingMode);
+  }
+}
+
+bool Engine::_prepareCompressedTexture(GL::IGLTexture* texture, Scene* scene,
+                                       const Uint8Array& data, bool isKTX,
+                                       bool noMipmap, bool invertY,
+                                       unsigned int samplingMode,
+                                       std::string& error)
+{
+  const unsigned int faces = texture->isCube ? 6 : 1;
+  std::unique_ptr<KhronosTextureContainer> ktx;
+  Internals::DDSInfo info;
+  int width = 0, height = 0, levelCount = 1;
+  unsigned int internalFormat = 0;
+
+  if (isKTX) {
+    ktx = std::make_unique<KhronosTextureContainer>(data, faces);
+    if (ktx->isInvalid) {
+      error = "Invalid KTX texture " + texture->url;
+      return false;
+    }
+    width          = static_cast<int>(ktx->pixelWidth);
+    height         = static_cast<int>(ktx->pixelHeight);
+    levelCount     = static_cast<int>(ktx->numberOfMipmapLevels);
+    internalFormat = ktx->glInternalFormat;
+  }
+  else {
+    if (!Internals::DDSTools::GetDDSInfo(data, info)
+        || info.isCube != texture->isCube) {
+      error = "Invalid DDS texture " + texture->url;
+      return false;
+    }
+    width          = info.width;
+    height         = info.height;
+    levelCount     = info.mipmapCount;
+    internalFormat = info.internalFormat;
+  }
+
+  // Uncompressed DDS levels are uploaded with texImage2D
+  const bool isCompressed = (internalFormat != 0);
+  if (isCompressed && !isCompressedTextureFormatSupported(internalFormat)) {
+    error = "Unsupported compressed texture format in " + texture->url;
+    return false;
+  }
+
+  // Compressed levels can not be generated, a missing chain is not sampled
+  const bool loadMipmap = !noMipmap && (levelCount > 1 || !isCompressed);
+  const auto target = texture->isCube ? GL::TEXTURE_CUBE_MAP : GL::TEXTURE_2D;
+  auto uploadLevels = [&]() {
+    const auto byteLength
+      = ktx ? ktx->uploadLevels(_gl, loadMipmap) :
+              Internals::DDSTools::UploadDDSLevels(_gl, data, info, loadMipmap,
+                                                   faces);
+    texture->_compressedByteLength = isCompressed ? byteLength : 0;
+    if (loadMipmap && levelCount > 1) {
+      // The stored mip chain may stop before 1x1
+      _gl->texParameteri(target, GL::TEXTURE_MAX_LEVEL, levelCount - 1);
+    }
+  };
+
+  if (!texture->isCube) {
+    Engine::PrepareGLTexture(
+      texture, _gl, scene, width, height, !loadMipmap,
+      isCompressed || levelCount > 1,
+      [&](int /*potWidth*/, int /*potHeight*/) { uploadLevels(); }, invertY,
+      samplingMode);
+    return true;
+  }
+
+  _bindTextureDirectly(GL::TEXTURE_CUBE_MAP, texture);
+  _gl->pixelStorei(GL::UNPACK_FLIP_Y_WEBGL, invertY ? 1 : 0);
+
+  uploadLevels();
+  if (loadMipmap && levelCount == 1) {
+    _gl->generateMipmap(GL::TEXTURE_CUBE_MAP);
+  }
+
+  _gl->texParameteri(GL::TEXTURE_CUBE_MAP, GL::TEXTURE_MAG_FILTER, GL::LINEAR);
+  _gl->texParameteri(GL::TEXTURE_CUBE_MAP, GL::TEXTURE_MIN_FILTER,
+                     loadMipmap ? GL::LINEAR_MIPMAP_LINEAR : GL::LINEAR);
+  _gl->texParameteri(GL::TEXTURE_CUBE_MAP, GL::TEXTURE_WRAP_S,
+                     GL::CLAMP_TO_EDGE);
+  _gl->texParameteri(GL::TEXTURE_CUBE_MAP, GL::TEXTURE_WRAP_T,
+                     GL::CLAMP_TO_EDGE);
+  _bindTextureDirectly(GL::TEXTURE_CUBE_MAP, nullptr);
+  resetTextureCache();
+
+  texture->_width      = width;
+  texture->_height     = height;
+  texture->_baseWidth  = width;
+  texture->_baseHeight = height;
+  texture->isReady     = true;
+  scene->_removePendingData(texture);
+
+  for (auto& callback : texture->onLoadedCallbacks) {
+    callback();
+  }
+  texture->onLoadedCallbacks.clear();
+
+  return true;
+}
+
+AsyncImageLoader& Engine::imageLoader()
+{
+  if (!_imageLoader) {
+    _imageLoader = std::make_unique<AsyncImageLoader>();
+  }
+
+  return *_imageLoader;
+}
+
+TextureCompressor& Engine::textureCompressor()
+{
+  if (!_textureCompressor) {
+    _textureCompressor = std::make_unique<TextureCompressor>();
+  }
+
+  return *_textureCompressor;
+}
+
+MipmapGenerator& Engine::mipmapGenerator()
+{
+  if (!_mipmapGenerator) {
+    _mipmapGenerator = std::make_unique<MipmapGenerator>();
+  }
+
+  return *_mipmapGenerator;
+}
+
+void Engine::_uploadMipmaps(const Image& img, GL::GLenum format,
+                            const MipmapOptions& options)
+{
+  // The rows of the levels are tightly packed
+  if (img.depth != 4) {
+    _gl->pixelStorei(GL::UNPACK_ALIGNMENT, 1);
+  }
+
+  GL::GLint level = 1;
+  for (const auto& mip : mipmapGenerator().generate(img, options)) {
+    _gl->texImage2D(GL::TEXTURE_2D, level++, static_cast<GL::GLint>(format),
+                    mip.width, mip.height, 0, format, GL::UNSIGNED_BYTE,
+                    mip.data);
+  }
+
+  if (img.depth != 4) {
+    _gl->pixelStorei(GL::UNPACK_ALIGNMENT, 4);
+  }
+}
+
+void Engine::_processImageLoads()
+{
+  if (_imageLoader && _imageLoader->pendingCount() > 0) {
+    _imageLoader->processCompleted(textureUploadBudget);
+  }
+}
+
+GL::IGLTexture* Engine::_getTextureFromCache(const std::string& url,
+                                             bool noMipmap,
+                                             unsigned int samplingMode,
+                                             bool invertY)
+{
+  auto texture = _textureCache.getByUrl(url, noMipmap, samplingMode, invertY);
+  if (texture) {
+    ++texture->references;
+  }
+
+  return texture;
+}
+
+GL::IGLTexture* Engine::_getTextureFromContentCache(GL::IGLTexture* texture,
+                                                    const Image& img)
+{
+  const auto seed = (static_cast<uint64_t>(img.width) << 32)
+                    | static_cast<uint64_t>(img.height);
+  texture->_contentHash = Hash64(img.data.data(), img.data.size(), seed);
+  return _textureCache.getOrAddContent(texture);
+}
+
+void Engine::_queueTextureOnLoad(GL::IGLTexture* texture,
+                                 const std::function<void()>& onLoad)
+{
+  if (!onLoad) {
+    return;
+  }
+
+  if (texture->isReady) {
+    onLoad();
+  }
+  else {
+    texture->onLoadedCallbacks.emplace_back(onLoad);
+  }
+}
+
 GL::GLenum Engine::_getInternalFormat(unsigned int format) const
 {
   GL::GLenum internalFormat = GL::RGBA;
@@ -2099,6 +2682,7 @@ void Engine::updateRawTexture(GL::IGLTexture* texture, const Uint8Array& data,
     _gl->pixelStorei(GL::UNPACK_ALIGNMENT, 1);
   }
 
+  bool hasMipmaps = false;
   if (!compression.empty()) {
     //_gl->compressedTexImage2D(GL::TEXTURE_2D, 0, getCaps().s3tc[compression],
     //                          texture->_width, texture->_height, 0, data);
@@ -2108,9 +2692,35 @@ void Engine::updateRawTexture(GL::IGLTexture* texture, const Uint8Array& data,
     _gl->texImage2D(GL::TEXTURE_2D, 0, _internalFormat, texture->_width,
                     texture->_height, 0, internalFormat, GL::UNSIGNED_BYTE,
                     data);
+
+    if (texture->generateMipMaps && cpuMipmapGeneration) {
+      int depth    = 4;
+      auto options = mipmapOptions;
+      if (internalFormat == GL::RGB) {
+        depth = 3;
+      }
+      else if (internalFormat == GL::LUMINANCE_ALPHA) {
+        depth = 2;
+      }
+      else if (internalFormat == GL::LUMINANCE) {
+        depth = 1;
+      }
+      else if (internalFormat == GL::ALPHA) {
+        // No color channel to filter in linear space
+        depth        = 1;
+        options.sRGB = false;
+      }
+      _uploadMipmaps(Image(data, texture->_width, texture->_height, depth, 0),
+                     internalFormat, options);
+      hasMipmaps = true;
+    }
   }
 
-  if (texture->generateMipMaps) {
+  if (texture->_width % 4 != 0) {
+    _gl->pixelStorei(GL::UNPACK_ALIGNMENT, 4);
+  }
+
+  if (texture->generateMipMaps && !hasMipmaps) {
     _gl->generateMipmap(GL::TEXTURE_2D);
   }
   _bindTextureDirectly(GL::TEXTURE_2D, nullptr);
@@ -2132,6 +2742,9 @@ GL::IGLTexture* Engine::createRawTexture(const Uint8Array& data, int width,
   _texture->_height     = height;
   _texture->references  = 1;
 
+  // The mip chain is built by updateRawTexture(), also on later updates
+  _texture->generateMipMaps = generateMipMaps;
+
   updateRawTexture(_texture, data, format, invertY, compression);
   _bindTextureDirectly(GL::TEXTURE_2D, _texture);
 
@@ -2141,10 +2754,6 @@ GL::IGLTexture* Engine::createRawTexture(const Uint8Array& data, int width,
   _gl->texParameteri(GL::TEXTURE_2D, GL::TEXTURE_MAG_FILTER, filters.mag);
   _gl->texParameteri(GL::TEXTURE_2D, GL::TEXTURE_MIN_FILTER, filters.min);
 
-  if (generateMipMaps) {
-    _gl->generateMipmap(GL::TEXTURE_2D);
-  }
-
   _bindTextureDirectly(GL::TEXTURE_2D, nullptr);
 
   _texture->samplingMode = samplingMode;
@@ -2651,12 +3260,63 @@ Engine::createRenderTargetCubeTexture(const ISize& size,
 }
 
 GL::IGLTexture* Engine::createCubeTexture(
-  const std::string& /*rootUrl*/, Scene* /*scene*/,
-  const std::vector<std::string>& /*extensions*/, bool /*noMipmap*/,
-  const std::function<void()>& /*onLoad*/,
-  const std::function<void()>& /*onError*/, unsigned int /*format*/)
+  const std::string& rootUrl, Scene* scene,
+  const std::vector<std::string>& /*extensions*/, bool noMipmap,
+  const std::function<void()>& onLoad, const std::function<void()>& onError,
+  unsigned int /*format*/)
 {
-  return nullptr;
+  std::string url = rootUrl;
+  std::string extension;
+  bool isKTX         = false;
+  const auto lastDot = String::lastIndexOf(url, ".");
+  if (lastDot != -1) {
+    size_t _lastDot = static_cast<size_t>(lastDot);
+    extension       = String::toLowerCase(url.substr(_lastDot));
+    if (!_textureFormatInUse.empty()) {
+      url   = url.substr(0, _lastDot) + _textureFormatInUse;
+      isKTX = true;
+    }
+  }
+  const bool isDDS = (extension == ".dds");
+
+  if (!isKTX && !isDDS) {
+    // Not implemented yet, only single file cube textures are loaded
+    return nullptr;
+  }
+
+  auto texture         = _gl->createTexture();
+  auto _texture        = texture.get();
+  _texture->isCube     = true;
+  _texture->url        = rootUrl;
+  _texture->noMipmap   = noMipmap;
+  _texture->references = 1;
+  if (onLoad) {
+    _texture->onLoadedCallbacks.emplace_back(onLoad);
+  }
+  scene->_addPendingData(_texture);
+  _loadedTexturesCache.emplace_back(std::move(texture));
+  _textureCache.addUrl(rootUrl, _texture);
+
+  // The faces are uploaded as stored in the file, without being decoded
+  MappedFile file(url);
+  std::string error = "Error loading cube texture " + url;
+  bool isLoaded     = false;
+  if (file.isOpen()) {
+    const Uint8Array data(file.data(), file.data() + file.size());
+    isLoaded = _prepareCompressedTexture(
+      _texture, scene, data, isKTX, noMipmap, true,
+      TextureConstants::TRILINEAR_SAMPLINGMODE, error);
+  }
+
+  if (!isLoaded) {
+    scene->_removePendingData(_texture);
+    BABYLON_LOG_ERROR("Engine", error);
+    if (onError) {
+      onError();
+    }
+  }
+
+  return _texture;
 }
 
 void Engine::updateTextureSize(GL::IGLTexture* texture, int width, int height)
@@ -2881,6 +3541,9 @@ void Engine::_releaseTexture(GL::IGLTexture* texture)
     _gl->deleteRenderbuffer(texture->_MSAARenderBuffer);
   }
 
+  _textureStreaming.unregisterTexture(texture);
+  _textureCache.remove(texture);
+  _pendingImageLoads.erase(texture);
   _gl->deleteTexture(texture);
 
   // Unbind channels
@@ -3127,17 +3790,8 @@ void Engine::releaseInternalTexture(GL::IGLTexture* texture)
   --texture->references;
 
   // Final reference ?
-  if (texture->references == 0) {
-    auto& texturesCache = getLoadedTexturesCache();
-
-    texturesCache.erase(
-      std::remove_if(
-        texturesCache.begin(), texturesCache.end(),
-        [&texture](const std::unique_ptr<GL::IGLTexture>& _texture) {
-          return _texture.get() == texture;
-        }),
-      texturesCache.end());
-
+  if (texture->references <= 0) {
+    // Also removes the texture from the loaded textures cache, which owns it
     _releaseTexture(texture);
   }
 }
@@ -169,13 +169,13 @@ bool Node::isReady() const
   return _isReady;
 }
 
-bool Node::isEnabled()
+bool Node::isEnabled(bool checkAncestors)
 {
   if (!_isEnabled) {
     return false;
   }
 
-  if (parent()) {
+  if (checkAncestors && parent()) {
     return parent()->isEnabled();
   }
 
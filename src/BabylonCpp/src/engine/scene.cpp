@@ -15,8 +15,10 @@
 #include <babylon/collisions/collision_coordinator_worker.h>
 #include <babylon/collisions/icollision_coordinator.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/profiling/memory.h>
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/bounding_sphere.h>
 #include <babylon/culling/ray.h>
 #include <babylon/debug/debug_layer.h>
 #include <babylon/engine/engine.h>
@@ -40,6 +42,7 @@
 #include <babylon/math/frustum.h>
 #include <babylon/mesh/abstract_mesh.h>
 #include <babylon/mesh/geometry.h>
+#include <babylon/mesh/geometry_streaming_manager.h>
 #include <babylon/mesh/simplification/simplification_queue.h>
 #include <babylon/mesh/sub_mesh.h>
 #include <babylon/morph/morph_target_manager.h>
@@ -187,14 +190,14 @@ Scene::Scene(Engine* engine)
 
   mainSoundTrack = std::make_unique<SoundTrack>(this, true);
 
-  // simplification queue
-  simplificationQueue = std::make_unique<SimplificationQueue>();
-
   // Collision coordinator initialization.
   setWorkerCollisions(false);
 
   // Uniform Buffer
   _createUbo();
+
+  // No frame captured yet
+  _lastFrameMemorySnapshot.renderId = -1;
 }
 
 Scene::~Scene()
@@ -539,6 +542,22 @@ Engine* Scene::getEngine()
   return _engine;
 }
 
+GeometryStreamingManager& Scene::geometryStreaming()
+{
+  if (!_geometryStreaming) {
+    _geometryStreaming = std::make_unique<GeometryStreamingManager>(this);
+  }
+  return *_geometryStreaming;
+}
+
+SimplificationQueue& Scene::getSimplificationQueue()
+{
+  if (!simplificationQueue) {
+    simplificationQueue = std::make_unique<SimplificationQueue>();
+  }
+  return *simplificationQueue;
+}
+
 size_t Scene::getTotalVertices() const
 {
   return _totalVertices.current();
@@ -634,6 +653,57 @@ PerfCounter& Scene::spriteDuractionPerfCounter()
   return _spritesDuration;
 }
 
+size_t Scene::getFrameAllocations() const
+{
+  return _frameAllocations.current();
+}
+
+PerfCounter& Scene::frameAllocationsPerfCounter()
+{
+  return _frameAllocations;
+}
+
+FrameArena& Scene::frameArena()
+{
+  return _frameArena;
+}
+
+MemoryTracker& Scene::memoryTracker()
+{
+  return _engine->memoryTracker();
+}
+
+MemorySnapshot Scene::getMemoryStats()
+{
+  auto snapshot       = _captureMemorySnapshot();
+  snapshot.processRSS = Memory::GetCurrentRSS();
+  return snapshot;
+}
+
+const MemorySnapshot& Scene::getLastFrameMemorySnapshot()
+{
+  // Captured once per frame, on demand, as it walks the textures and effects
+  if (_lastFrameMemorySnapshot.renderId != _renderId) {
+    _lastFrameMemorySnapshot = _captureMemorySnapshot();
+  }
+  return _lastFrameMemorySnapshot;
+}
+
+MemorySnapshot Scene::_captureMemorySnapshot()
+{
+  _engine->_updateMemoryStats();
+  auto snapshot = _engine->memoryTracker().snapshot(_renderId);
+
+  // Physics is owned by the scene, not by the engine
+  const auto physicsIndex = static_cast<size_t>(MemoryCategory::Physics);
+  if (_physicsEngine) {
+    snapshot.bytes[physicsIndex]   = _physicsEngine->getMemorySize();
+    snapshot.objects[physicsIndex] = _physicsEngine->getImpostorsCount();
+  }
+
+  return snapshot;
+}
+
 float Scene::getAnimationRatio() const
 {
   return _animationRatio;
@@ -1150,20 +1220,39 @@ void Scene::unregisterAfterRender(const std::function<void()>& func)
   onAfterRenderObservable.removeCallback(func);
 }
 
-void Scene::_addPendingData(Mesh* /*mesh*/)
+void Scene::_addPendingData(Mesh* mesh)
+{
+  _pendingData.emplace_back(mesh);
+}
+
+void Scene::_addPendingData(Geometry* geometry)
+{
+  _pendingData.emplace_back(geometry);
+}
+
+void Scene::_addPendingData(GL::IGLTexture* texture)
+{
+  _pendingData.emplace_back(texture);
+}
+
+void Scene::_removePendingData(Mesh* mesh)
 {
+  stl_util::erase(_pendingData, mesh);
 }
 
-void Scene::_addPendingData(GL::IGLTexture* /*texure*/)
+void Scene::_removePendingData(Geometry* geometry)
 {
+  stl_util::erase(_pendingData, geometry);
 }
 
-void Scene::_removePendingData(GL::IGLTexture* /*texture*/)
+void Scene::_removePendingData(GL::IGLTexture* texture)
 {
+  stl_util::erase(_pendingData, texture);
 }
 
-void Scene::getWaitingItemsCount()
+size_t Scene::getWaitingItemsCount() const
 {
+  return _pendingData.size();
 }
 
 void Scene::executeWhenReady(const std::function<void()>& func)
@@ -1173,6 +1262,10 @@ void Scene::executeWhenReady(const std::function<void()>& func)
   if (_executeWhenReadyTimeoutId != -1) {
     return;
   }
+
+  // Checked again after each frame until the scene is ready
+  _executeWhenReadyTimeoutId = 0;
+  _checkIsReady();
 }
 
 void Scene::_checkIsReady()
@@ -1683,7 +1776,22 @@ Geometry* Scene::getGeometryByID(const std::string& id)
                            return geometry->id == id;
                          });
 
-  return (it == _geometries.end()) ? nullptr : (*it).get();
+  if (it != _geometries.end()) {
+    return (*it).get();
+  }
+
+  // Merged geometry
+  auto alias = _geometryAliases.find(id);
+  if (alias != _geometryAliases.end() && alias->second != id) {
+    return getGeometryByID(alias->second);
+  }
+
+  return nullptr;
+}
+
+void Scene::addGeometryAlias(const std::string& id, Geometry* geometry)
+{
+  _geometryAliases[id] = geometry->id;
 }
 
 bool Scene::pushGeometry(std::unique_ptr<Geometry>&& geometry, bool force)
@@ -2003,16 +2111,21 @@ void Scene::_evaluateActiveMeshes()
   }
 
   // Meshes
-  std::vector<AbstractMesh*> _meshes;
+  arena_vector<AbstractMesh*> _meshes{FrameArenaAllocator<AbstractMesh*>{
+    &_frameArena}};
 
   if (_selectionOctree) { // Octree
-    _meshes = _selectionOctree->select(_frustumPlanes);
+    const auto& selection = _selectionOctree->select(_frustumPlanes);
+    _meshes.assign(selection.begin(), selection.end());
   }
   else { // Full scene traversal
-    _meshes = getMeshes();
+    _meshes.reserve(meshes.size());
+    for (auto& mesh : meshes) {
+      _meshes.emplace_back(mesh.get());
+    }
   }
 
-  for (auto& mesh : meshes) {
+  for (auto& mesh : _meshes) {
     if (mesh->isBlocked()) {
       continue;
     }
@@ -2031,9 +2144,9 @@ void Scene::_evaluateActiveMeshes()
              {ActionManager::OnIntersectionEnterTrigger,
               ActionManager::OnIntersectionExitTrigger})) {
       if (std::find(_meshesForIntersections.begin(),
-                    _meshesForIntersections.end(), mesh.get())
+                    _meshesForIntersections.end(), mesh)
           == _meshesForIntersections.end()) {
-        _meshesForIntersections.emplace_back(mesh.get());
+        _meshesForIntersections.emplace_back(mesh);
       }
     }
 
@@ -2050,11 +2163,15 @@ void Scene::_evaluateActiveMeshes()
         || ((mesh->isVisible && mesh->visibility > 0)
             && ((mesh->layerMask & activeCamera->layerMask) != 0)
             && mesh->isInFrustum(_frustumPlanes))) {
-      _activeMeshes.emplace_back(dynamic_cast<Mesh*>(mesh.get()));
+      _activeMeshes.emplace_back(dynamic_cast<Mesh*>(mesh));
       activeCamera->_activeMeshes.emplace_back(_activeMeshes.back());
       mesh->_activate(_renderId);
 
       _activeMesh(meshLOD);
+
+      if (_engine->textureStreaming().enabled) {
+        _requestTextureLevels(mesh, meshLOD->getMaterial());
+      }
     }
   }
 
@@ -2078,6 +2195,47 @@ void Scene::_evaluateActiveMeshes()
   _particlesDuration.endMonitoring(false);
 }
 
+float Scene::_getScreenSize(AbstractMesh* mesh)
+{
+  if (!activeCamera || !mesh->getBoundingInfo()) {
+    return 0.f;
+  }
+
+  // Meshes surrounding the camera and orthographic views use the full render
+  // height
+  const auto& boundingSphere = mesh->getBoundingInfo()->boundingSphere;
+  auto screenSize = static_cast<float>(_engine->getRenderHeight());
+  if (activeCamera->mode == Camera::PERSPECTIVE_CAMERA) {
+    const auto distance = Vector3::Distance(activeCamera->globalPosition(),
+                                            boundingSphere.centerWorld);
+    if (distance > boundingSphere.radiusWorld) {
+      screenSize *= std::min(boundingSphere.radiusWorld
+                               / (distance * std::tan(activeCamera->fov / 2.f)),
+                             1.f);
+    }
+  }
+
+  return screenSize;
+}
+
+void Scene::_requestTextureLevels(AbstractMesh* mesh, Material* material)
+{
+  if (!material) {
+    return;
+  }
+
+  // The list is kept from mesh to mesh, so that it is not reallocated
+  _activeTextures.clear();
+  material->getActiveTextures(_activeTextures);
+
+  const auto screenSize  = _getScreenSize(mesh);
+  auto& textureStreaming = _engine->textureStreaming();
+  for (auto& texture : _activeTextures) {
+    textureStreaming.requestScreenSize(texture->getInternalTexture(),
+                                       screenSize);
+  }
+}
+
 void Scene::_activeMesh(AbstractMesh* mesh)
 {
   if (mesh->skeleton() && skeletonsEnabled()) {
@@ -2107,10 +2265,12 @@ void Scene::_activeMesh(AbstractMesh* mesh)
 
   if (mesh && !mesh->subMeshes.empty()) {
     // Submeshes Octrees
-    std::vector<SubMesh*> subMeshes;
+    arena_vector<SubMesh*> subMeshes{FrameArenaAllocator<SubMesh*>{
+      &_frameArena}};
 
     if (mesh->_submeshesOctree && mesh->useOctreeForRenderingSelection) {
-      subMeshes = mesh->_submeshesOctree->select(_frustumPlanes);
+      const auto& selection = mesh->_submeshesOctree->select(_frustumPlanes);
+      subMeshes.assign(selection.begin(), selection.end());
     }
     else {
       subMeshes.reserve(mesh->subMeshes.size());
@@ -2119,8 +2279,8 @@ void Scene::_activeMesh(AbstractMesh* mesh)
       }
     }
 
-    for (auto& subMesh : mesh->subMeshes) {
-      _evaluateSubMesh(subMesh.get(), mesh);
+    for (auto& subMesh : subMeshes) {
+      _evaluateSubMesh(subMesh, mesh);
     }
   }
 }
@@ -2355,6 +2515,8 @@ void Scene::render()
   }
 
   _lastFrameDuration.beginMonitoring();
+  _frameArena.reset();
+  _frameAllocations.fetchNewFrame();
   _particlesDuration.fetchNewFrame();
   _spritesDuration.fetchNewFrame();
   _activeParticles.fetchNewFrame();
@@ -2370,14 +2532,22 @@ void Scene::render()
 
   Tools::StartPerformanceCounter("Scene rendering");
 
+  // Textures decoded asynchronously
+  _engine->_processImageLoads();
+
+  // Delay loaded geometries
+  if (_geometryStreaming) {
+    _geometryStreaming->update();
+  }
+
   // Actions
   if (actionManager) {
     actionManager->processTrigger(ActionManager::OnEveryFrameTrigger);
   }
 
   // Simplification Queue
-  if (simplificationQueue && !simplificationQueue->running) {
-    simplificationQueue->executeNext();
+  if (simplificationQueue) {
+    simplificationQueue->update();
   }
 
   // Animations
@@ -2568,6 +2738,23 @@ void Scene::render()
   _activeBones.addCount(0, true);
   _activeIndices.addCount(0, true);
   _activeParticles.addCount(0, true);
+  _frameAllocations.addCount(_frameArena.allocationCount(), true);
+
+  // Execute when ready
+  if (_executeWhenReadyTimeoutId != -1) {
+    _checkIsReady();
+  }
+
+  // Texture streaming
+  if (_engine->textureStreaming().enabled) {
+    _engine->textureStreaming().update(_renderId);
+  }
+
+  // Memory budgets, the snapshot is only captured when a budget is set
+  auto& memoryTracker = _engine->memoryTracker();
+  if (memoryTracker.hasBudgets()) {
+    memoryTracker.checkBudgets(getLastFrameMemorySnapshot());
+  }
 }
 
 void Scene::_updateAudioParameters()
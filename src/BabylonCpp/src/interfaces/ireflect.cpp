@@ -1,4 +1,6 @@
 #include <babylon/interfaces/ireflect.h>
+
+#include <babylon/bones/bone.h>
 #include <babylon/mesh/abstract_mesh.h>
 
 namespace BABYLON {
@@ -97,6 +99,13 @@ any IReflect::getProperty(const any& property,
   // IAnimatable
   if (property.is<IReflect*>()) {
     switch (property._<IReflect*>()->type()) {
+      // Bones
+      case Type::BONE: {
+        auto bone = dynamic_cast<Bone*>(this);
+        if (targetProperty == "_matrix") {
+          _property = &bone->getLocalMatrix();
+        }
+      } break;
       // Meshes
       case Type::ABSTRACTMESH:
       case Type::GROUNDMESH:
@@ -216,6 +225,10 @@ void IReflect::setProperty(const any& oldProperty,
            && newProperty.is<Vector3 const*>()) {
     *_propertyToUpdate._<Vector3*>() = *newProperty._<Vector3 const*>();
   }
+  // Matrix property update
+  else if (_propertyToUpdate.is<Matrix*>() && newProperty.is<Matrix const*>()) {
+    *_propertyToUpdate._<Matrix*>() = *newProperty._<Matrix const*>();
+  }
   // Vector2 property update
   else if (_propertyToUpdate.is<Vector2*>()
            && newProperty.is<Vector2 const*>()) {
@@ -0,0 +1,530 @@
+#include <babylon/loading/plugins/babylon/babylon_binary_file.h>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/core/json.h>
+#include <babylon/core/logging.h>
+#include <babylon/core/mapped_file.h>
+#include <babylon/math/color4.h>
+#include <babylon/mesh/mesh_codec.h>
+#include <babylon/mesh/vertex_data.h>
+
+namespace BABYLON {
+
+namespace {
+
+const char Magic[4] = {'B', 'J', 'S', 'B'};
+
+struct VertexDataAttribute {
+  const char* name;
+  Float32Array VertexData::*member;
+  // Number of components per vertex
+  size_t stride;
+}; // end of struct VertexDataAttribute
+
+// The float attributes read by VertexData::ImportVertexData, plus the extra
+// weights read by Geometry::ImportGeometry
+const std::array<VertexDataAttribute, 13> VertexDataAttributes{{
+  {"positions", &VertexData::positions, 3},
+  {"normals", &VertexData::normals, 3},
+  {"tangents", &VertexData::tangents, 4},
+  {"uvs", &VertexData::uvs, 2},
+  {"uv2s", &VertexData::uvs2, 2},
+  {"uv3s", &VertexData::uvs3, 2},
+  {"uv4s", &VertexData::uvs4, 2},
+  {"uv5s", &VertexData::uvs5, 2},
+  {"uv6s", &VertexData::uvs6, 2},
+  {"colors", &VertexData::colors, 4},
+  {"matricesIndices", &VertexData::matricesIndices, 4},
+  {"matricesWeights", &VertexData::matricesWeights, 4},
+  {"matricesWeightsExtra", &VertexData::matricesWeightsExtra, 4},
+}};
+
+// Inline mesh geometry attribute name, vertex data attribute name
+const std::array<std::pair<const char*, const char*>, 10> MeshAttributes{{
+  {"positions", "positions"},
+  {"normals", "normals"},
+  {"uvs", "uvs"},
+  {"uvs2", "uv2s"},
+  {"uvs3", "uv3s"},
+  {"uvs4", "uv4s"},
+  {"uvs5", "uv5s"},
+  {"uvs6", "uv6s"},
+  {"colors", "colors"},
+  {"matricesWeights", "matricesWeights"},
+}};
+
+template <typename T>
+T read(const uint8_t* data)
+{
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return value;
+}
+
+template <typename T>
+void write(std::string& data, size_t offset, T value)
+{
+  std::memcpy(&data[offset], &value, sizeof(T));
+}
+
+size_t align(size_t offset)
+{
+  return (offset + BabylonBinaryFile::Alignment - 1)
+         & ~(BabylonBinaryFile::Alignment - 1);
+}
+
+// Size of the elements of the blobs, 0 for the unknown types
+size_t elementSize(uint32_t type)
+{
+  switch (static_cast<BinaryBlobType>(type)) {
+    case BinaryBlobType::FLOAT32:
+    case BinaryBlobType::UINT32:
+      return 4;
+    case BinaryBlobType::ENCODED_FLOAT32:
+    case BinaryBlobType::ENCODED_UINT32:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+// Number of components per vertex of a vertex data attribute
+size_t attributeStride(const std::string& name)
+{
+  for (const auto& attribute : VertexDataAttributes) {
+    if (name == attribute.name) {
+      return attribute.stride;
+    }
+  }
+  return 1;
+}
+
+/**
+ * @brief Accumulates the blobs of the converted file.
+ */
+struct BlobWriter {
+
+  BlobWriter(bool iEncode) : encode{iEncode}
+  {
+  }
+
+  size_t add(const void* elements, size_t count, BinaryBlobType type)
+  {
+    const size_t offset = align(blobs.size());
+    const size_t size   = count * elementSize(static_cast<uint32_t>(type));
+    blobs.resize(offset + size, '\0');
+    if (size > 0) {
+      std::memcpy(&blobs[offset], elements, size);
+    }
+    entries.emplace_back(Entry{offset, count, type});
+    return entries.size() - 1;
+  }
+
+  size_t addFloats(const Float32Array& array, size_t stride)
+  {
+    if (encode) {
+      const auto encoded = MeshCodec::EncodeVertexBuffer(array, stride);
+      if (!encoded.empty()) {
+        return add(encoded.data(), encoded.size(),
+                   BinaryBlobType::ENCODED_FLOAT32);
+      }
+    }
+    return add(array.data(), array.size(), BinaryBlobType::FLOAT32);
+  }
+
+  size_t addIndices(const IndicesArray& array)
+  {
+    if (encode) {
+      const auto encoded = MeshCodec::EncodeIndexBuffer(array);
+      if (!encoded.empty()) {
+        return add(encoded.data(), encoded.size(),
+                   BinaryBlobType::ENCODED_UINT32);
+      }
+    }
+    return add(array.data(), array.size(), BinaryBlobType::UINT32);
+  }
+
+  // Moves a float array of a parsed object to a blob
+  void moveFloats(Json::object& source, const std::string& key,
+                  Json::object& blobsRef, const std::string& name,
+                  size_t vertexCount)
+  {
+    auto it = source.find(key);
+    if (it == source.end() || !it->second.is<Json::array>()) {
+      return;
+    }
+    Float32Array array;
+    array.reserve(it->second.get<Json::array>().size());
+    for (const auto& element : it->second.get<Json::array>()) {
+      array.emplace_back(static_cast<float>(element.get<double>()));
+    }
+    // The colors are stored as they are uploaded, with 4 components
+    if (name == "colors") {
+      array = Color4::CheckColors4(array, vertexCount);
+    }
+    blobsRef[name] = Json::value(
+      static_cast<double>(addFloats(array, attributeStride(name))));
+    source.erase(it);
+  }
+
+  void moveIndices(Json::object& source, Json::object& blobsRef)
+  {
+    auto it = source.find("indices");
+    if (it == source.end() || !it->second.is<Json::array>()) {
+      return;
+    }
+    IndicesArray array;
+    array.reserve(it->second.get<Json::array>().size());
+    for (const auto& element : it->second.get<Json::array>()) {
+      array.emplace_back(static_cast<uint32_t>(element.get<double>()));
+    }
+    blobsRef["indices"] = Json::value(static_cast<double>(addIndices(array)));
+    source.erase(it);
+  }
+
+  struct Entry {
+    size_t offset;
+    size_t count;
+    BinaryBlobType type;
+  };
+
+  // Whether the blobs are encoded by the MeshCodec
+  bool encode;
+  std::string blobs;
+  std::vector<Entry> entries;
+
+}; // end of struct BlobWriter
+
+size_t vertexCount(const Json::object& parsedGeometry)
+{
+  auto it = parsedGeometry.find("positions");
+  return (it != parsedGeometry.end() && it->second.is<Json::array>()) ?
+           it->second.get<Json::array>().size() / 3 :
+           0;
+}
+
+// Writes the header, the scene graph, the blob table and the blobs
+std::string writeFile(const Json::value& parsedData, const BlobWriter& writer)
+{
+  const size_t headerSize    = BabylonBinaryFile::HeaderSize;
+  const size_t entrySize     = BabylonBinaryFile::BlobEntrySize;
+  const auto sceneGraph      = parsedData.serialize();
+  const auto blobTableOffset = align(headerSize + sceneGraph.size());
+  const auto blobsOffset
+    = align(blobTableOffset + writer.entries.size() * entrySize);
+  std::string data(blobsOffset + writer.blobs.size(), '\0');
+
+  std::memcpy(&data[0], Magic, sizeof(Magic));
+  write<uint32_t>(data, 4, BabylonBinaryFile::Version);
+  write<uint32_t>(data, 8, static_cast<uint32_t>(sceneGraph.size()));
+  write<uint32_t>(data, 12, static_cast<uint32_t>(writer.entries.size()));
+  write<uint64_t>(data, 16, blobTableOffset);
+  write<uint64_t>(data, 24, data.size());
+  std::memcpy(&data[headerSize], sceneGraph.data(), sceneGraph.size());
+
+  for (size_t i = 0; i < writer.entries.size(); ++i) {
+    const auto& entry  = writer.entries[i];
+    const size_t table = blobTableOffset + i * entrySize;
+    write<uint64_t>(data, table, blobsOffset + entry.offset);
+    write<uint64_t>(data, table + 8, entry.count);
+    write<uint32_t>(data, table + 16, static_cast<uint32_t>(entry.type));
+  }
+  if (!writer.blobs.empty()) {
+    std::memcpy(&data[blobsOffset], writer.blobs.data(), writer.blobs.size());
+  }
+
+  return data;
+}
+
+} // end of anonymous namespace
+
+constexpr uint32_t BabylonBinaryFile::Version;
+constexpr size_t BabylonBinaryFile::Alignment;
+constexpr size_t BabylonBinaryFile::HeaderSize;
+constexpr size_t BabylonBinaryFile::BlobEntrySize;
+
+BabylonBinaryFile::BabylonBinaryFile(const uint8_t* data, size_t size)
+    : _data{data}
+    , _size{size}
+    , _isValid{false}
+    , _blobCount{0}
+    , _blobTableOffset{0}
+{
+  if (!IsBinaryFile(data, size) || read<uint32_t>(data + 4) != Version) {
+    return;
+  }
+
+  const auto sceneGraphLength = read<uint32_t>(data + 8);
+  _blobCount                  = read<uint32_t>(data + 12);
+  _blobTableOffset            = read<uint64_t>(data + 16);
+  if (read<uint64_t>(data + 24) != size
+      || HeaderSize + sceneGraphLength > _blobTableOffset
+      || _blobTableOffset > size
+      || (size - _blobTableOffset) / BlobEntrySize < _blobCount) {
+    return;
+  }
+
+  // The blobs are checked once, so that they can be read without checks
+  for (size_t i = 0; i < _blobCount; ++i) {
+    const auto entry  = data + _blobTableOffset + i * BlobEntrySize;
+    const auto offset = read<uint64_t>(entry);
+    const auto count  = read<uint64_t>(entry + 8);
+    const auto bytes  = elementSize(read<uint32_t>(entry + 16));
+    if (bytes == 0 || offset % Alignment != 0 || offset > size
+        || (size - offset) / bytes < count) {
+      return;
+    }
+  }
+
+  _isValid = true;
+}
+
+BabylonBinaryFile::BabylonBinaryFile(const std::string& data)
+    : BabylonBinaryFile(reinterpret_cast<const uint8_t*>(data.data()),
+                        data.size())
+{
+}
+
+BabylonBinaryFile::~BabylonBinaryFile()
+{
+}
+
+bool BabylonBinaryFile::isValid() const
+{
+  return _isValid;
+}
+
+std::string BabylonBinaryFile::sceneGraph() const
+{
+  if (!_isValid) {
+    return "";
+  }
+
+  const auto sceneGraph = reinterpret_cast<const char*>(_data + HeaderSize);
+  return std::string(sceneGraph, sceneGraph + read<uint32_t>(_data + 8));
+}
+
+size_t BabylonBinaryFile::blobCount() const
+{
+  return _isValid ? _blobCount : 0;
+}
+
+const uint8_t* BabylonBinaryFile::blobData(size_t index, BinaryBlobType type,
+                                           size_t& count) const
+{
+  count = 0;
+  if (!_isValid || index >= _blobCount) {
+    return nullptr;
+  }
+
+  const auto entry = _data + _blobTableOffset + index * BlobEntrySize;
+  if (read<uint32_t>(entry + 16) != static_cast<uint32_t>(type)) {
+    return nullptr;
+  }
+
+  count = static_cast<size_t>(read<uint64_t>(entry + 8));
+  return _data + read<uint64_t>(entry);
+}
+
+bool BabylonBinaryFile::getFloats(size_t index, Float32Array& array) const
+{
+  size_t count      = 0;
+  const auto floats = blobData(index, BinaryBlobType::FLOAT32, count);
+  if (!floats) {
+    const auto encoded
+      = blobData(index, BinaryBlobType::ENCODED_FLOAT32, count);
+    return encoded && MeshCodec::DecodeVertexBuffer(encoded, count, array);
+  }
+
+  array.resize(count);
+  if (count > 0) {
+    std::memcpy(array.data(), floats, count * sizeof(float));
+  }
+  return true;
+}
+
+bool BabylonBinaryFile::getIndices(size_t index, IndicesArray& array) const
+{
+  size_t count       = 0;
+  const auto indices = blobData(index, BinaryBlobType::UINT32, count);
+  if (!indices) {
+    const auto encoded = blobData(index, BinaryBlobType::ENCODED_UINT32, count);
+    return encoded && MeshCodec::DecodeIndexBuffer(encoded, count, array);
+  }
+
+  array.resize(count);
+  if (count > 0) {
+    std::memcpy(array.data(), indices, count * sizeof(uint32_t));
+  }
+  return true;
+}
+
+std::unique_ptr<VertexData>
+BabylonBinaryFile::getVertexData(const Json::value& parsedVertexData) const
+{
+  if (!parsedVertexData.contains("blobs")) {
+    return nullptr;
+  }
+
+  const auto& blobs = parsedVertexData.get("blobs");
+  const auto blobIndex
+    = [&blobs](const std::string& name) -> std::pair<bool, size_t> {
+    if (!blobs.contains(name)) {
+      return {false, 0};
+    }
+    if (!blobs.get(name).is<double>()) {
+      return {true, std::numeric_limits<size_t>::max()};
+    }
+    return {true, static_cast<size_t>(blobs.get(name).get<double>())};
+  };
+
+  auto vertexData = std::make_unique<VertexData>();
+  for (const auto& attribute : VertexDataAttributes) {
+    const auto index = blobIndex(attribute.name);
+    if (index.first
+        && !getFloats(index.second, (*vertexData).*(attribute.member))) {
+      return nullptr;
+    }
+  }
+
+  const auto index = blobIndex("indices");
+  if (index.first && !getIndices(index.second, vertexData->indices)) {
+    return nullptr;
+  }
+
+  return vertexData;
+}
+
+bool BabylonBinaryFile::IsBinaryFile(const uint8_t* data, size_t size)
+{
+  return data && size >= HeaderSize
+         && std::memcmp(data, Magic, sizeof(Magic)) == 0;
+}
+
+std::string BabylonBinaryFile::FromBabylon(const std::string& json,
+                                           bool encodeBlobs)
+{
+  Json::value parsedData;
+  if (!Json::Parse(parsedData, json.data(), json.size()).empty()
+      || !parsedData.is<Json::object>()) {
+    return "";
+  }
+
+  auto& scene = parsedData.get<Json::object>();
+  BlobWriter writer(encodeBlobs);
+
+  // Delay loading files hold the vertex data of a geometry or a mesh at their
+  // root, the attributes of meshes are renamed as the ones of geometries
+  if (scene.count("positions")) {
+    const auto count = vertexCount(scene);
+    Json::object blobs;
+    for (const auto& attribute : VertexDataAttributes) {
+      writer.moveFloats(scene, attribute.name, blobs, attribute.name, count);
+    }
+    for (const auto& attribute : MeshAttributes) {
+      writer.moveFloats(scene, attribute.first, blobs, attribute.second,
+                        count);
+    }
+    writer.moveIndices(scene, blobs);
+    scene["blobs"] = Json::value(blobs);
+    return writeFile(parsedData, writer);
+  }
+
+  // Vertex data geometries
+  if (!scene["geometries"].is<Json::object>()) {
+    scene["geometries"] = Json::value(Json::object());
+  }
+  auto& geometries = scene["geometries"].get<Json::object>();
+  if (!geometries["vertexData"].is<Json::array>()) {
+    geometries["vertexData"] = Json::value(Json::array());
+  }
+  auto& vertexDatas = geometries["vertexData"].get<Json::array>();
+  std::unordered_set<std::string> geometryIds;
+  for (auto& parsedVertexData : vertexDatas) {
+    if (!parsedVertexData.is<Json::object>()) {
+      continue;
+    }
+    auto& geometry = parsedVertexData.get<Json::object>();
+    geometryIds.insert(Json::GetString(parsedVertexData, "id"));
+    const auto count = vertexCount(geometry);
+    Json::object blobs;
+    for (const auto& attribute : VertexDataAttributes) {
+      writer.moveFloats(geometry, attribute.name, blobs, attribute.name,
+                        count);
+    }
+    writer.moveIndices(geometry, blobs);
+    if (!blobs.empty()) {
+      geometry["blobs"] = Json::value(blobs);
+    }
+  }
+
+  // Inline geometries of the meshes, with the conditions of
+  // Geometry::ImportGeometry
+  auto meshes = scene.find("meshes");
+  if (meshes != scene.end() && meshes->second.is<Json::array>()) {
+    for (auto& parsedMesh : meshes->second.get<Json::array>()) {
+      if (!parsedMesh.is<Json::object>() || parsedMesh.contains("geometryId")
+          || !parsedMesh.contains("positions")
+          || !parsedMesh.contains("normals")
+          || !parsedMesh.contains("indices")) {
+        continue;
+      }
+      auto& mesh = parsedMesh.get<Json::object>();
+      auto geometryId = Json::GetString(parsedMesh, "id") + "_geometry";
+      for (size_t i = 1; geometryIds.count(geometryId); ++i) {
+        geometryId = Json::GetString(parsedMesh, "id") + "_geometry"
+                     + std::to_string(i);
+      }
+      geometryIds.insert(geometryId);
+
+      const auto count = vertexCount(mesh);
+      Json::object blobs;
+      for (const auto& attribute : MeshAttributes) {
+        writer.moveFloats(mesh, attribute.first, blobs, attribute.second,
+                          count);
+      }
+      writer.moveFloats(mesh, "matricesWeightsExtra", blobs,
+                        "matricesWeightsExtra", count);
+      writer.moveIndices(mesh, blobs);
+
+      Json::object geometry;
+      geometry["id"]     = Json::value(geometryId);
+      geometry["blobs"]  = Json::value(blobs);
+      mesh["geometryId"] = Json::value(geometryId);
+      vertexDatas.emplace_back(Json::value(geometry));
+    }
+  }
+
+  return writeFile(parsedData, writer);
+}
+
+bool BabylonBinaryFile::ConvertFile(const std::string& babylonFile,
+                                    const std::string& binaryFile,
+                                    bool encodeBlobs)
+{
+  std::string data;
+  {
+    MappedFile file(babylonFile);
+    if (!file.isOpen()) {
+      BABYLON_LOG_ERROR("BabylonBinaryFile", "Error loading file ",
+                        babylonFile);
+      return false;
+    }
+    const auto json = reinterpret_cast<const char*>(file.data());
+    data            = FromBabylon(std::string(json, json + file.size()),
+                                  encodeBlobs);
+  }
+  if (data.empty()) {
+    BABYLON_LOG_ERROR("BabylonBinaryFile", "Error parsing file ", babylonFile);
+    return false;
+  }
+
+  if (!Filesystem::writeFileAtomically(binaryFile, data.data(), data.size())) {
+    BABYLON_LOG_ERROR("BabylonBinaryFile", "Error writing file ", binaryFile);
+    return false;
+  }
+
+  return true;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,101 @@
+#include <babylon/loading/plugins/babylon/babylon_binary_file_loader.h>
+
+#include <babylon/core/json.h>
+#include <babylon/core/logging.h>
+#include <babylon/engine/scene.h>
+#include <babylon/loading/plugins/babylon/babylon_binary_file.h>
+#include <babylon/mesh/geometry.h>
+#include <babylon/mesh/vertex_data.h>
+
+namespace BABYLON {
+
+BabylonBinaryFileLoader::BabylonBinaryFileLoader(size_t workerCount)
+    : BabylonFileLoader{workerCount}, _file{nullptr}
+{
+  extensions.mapping.clear();
+  extensions.mapping.emplace(std::make_pair(".babylonbin", true));
+}
+
+BabylonBinaryFileLoader::~BabylonBinaryFileLoader()
+{
+}
+
+bool BabylonBinaryFileLoader::importMesh(
+  const std::vector<std::string>& meshesNames, Scene* scene,
+  const std::string& data, const std::string& rootUrl,
+  std::vector<AbstractMesh*>& meshes,
+  std::vector<ParticleSystem*>& particleSystems,
+  std::vector<Skeleton*>& skeletons)
+{
+  BabylonBinaryFile file(data);
+  if (!file.isValid()) {
+    BABYLON_LOG_ERROR("BabylonBinaryFileLoader",
+                      "importMesh has failed: invalid binary scene file");
+    return false;
+  }
+
+  _file       = &file;
+  auto result = BabylonFileLoader::importMesh(
+    meshesNames, scene, file.sceneGraph(), rootUrl, meshes, particleSystems,
+    skeletons);
+  _file = nullptr;
+  return result;
+}
+
+bool BabylonBinaryFileLoader::load(Scene* scene, const std::string& data,
+                                   const std::string& rootUrl)
+{
+  BabylonBinaryFile file(data);
+  if (!file.isValid()) {
+    BABYLON_LOG_ERROR("BabylonBinaryFileLoader",
+                      "importScene has failed: invalid binary scene file");
+    return false;
+  }
+
+  _file       = &file;
+  auto result = BabylonFileLoader::load(scene, file.sceneGraph(), rootUrl);
+  _file = nullptr;
+  return result;
+}
+
+void BabylonBinaryFileLoader::decodeVertexData(
+  const Json::value& parsedVertexData,
+  std::unique_ptr<VertexData>& vertexData) const
+{
+  if (!_file || !parsedVertexData.contains("blobs")) {
+    BabylonFileLoader::decodeVertexData(parsedVertexData, vertexData);
+    return;
+  }
+
+  vertexData = _file->getVertexData(parsedVertexData);
+}
+
+Geometry* BabylonBinaryFileLoader::parseGeometry(
+  const Json::value& parsedVertexData, Scene* scene, const std::string& rootUrl)
+{
+  if (!_file || !parsedVertexData.contains("blobs")) {
+    return BabylonFileLoader::parseGeometry(parsedVertexData, scene, rootUrl);
+  }
+
+  const auto parsedVertexDataId = Json::GetString(parsedVertexData, "id");
+  if (parsedVertexDataId.empty()
+      || scene->getGeometryByID(parsedVertexDataId)) {
+    return nullptr;
+  }
+
+  // Decoded from the blobs on the worker threads
+  auto vertexData = takeVertexData(parsedVertexDataId);
+  if (!vertexData) {
+    BABYLON_LOGF_WARN("BabylonBinaryFileLoader",
+                      "Invalid vertex data for geometry %s",
+                      parsedVertexDataId.c_str());
+    return nullptr;
+  }
+
+  auto geometry = Geometry::New(parsedVertexDataId, scene);
+  geometry->setAllVerticesData(
+    vertexData.get(), Json::GetBool(parsedVertexData, "updatable", false));
+  return geometry;
+}
+
+} // end of namespace BABYLON
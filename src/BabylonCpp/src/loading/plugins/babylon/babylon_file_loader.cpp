@@ -6,7 +6,9 @@
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/core/json.h>
+#include <babylon/core/json_reader.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/worker_pool.h>
 #include <babylon/engine/scene.h>
 #include <babylon/lensflare/lens_flare_system.h>
 #include <babylon/lights/light.h>
@@ -15,33 +17,304 @@
 #include <babylon/materials/material.h>
 #include <babylon/materials/multi_material.h>
 #include <babylon/mesh/geometry.h>
+#include <babylon/mesh/geometry_deduplicator.h>
 #include <babylon/mesh/geometry_primitives.h>
 #include <babylon/mesh/mesh.h>
+#include <babylon/mesh/vertex_data.h>
 #include <babylon/particles/particle_system.h>
 #include <babylon/tools/tools.h>
 
 namespace BABYLON {
 
-BabylonFileLoader::BabylonFileLoader()
+namespace {
+
+// Float attributes of the vertex data geometries read by
+// VertexData::ImportVertexData
+const std::array<std::pair<const char*, Float32Array VertexData::*>, 12>
+  VertexDataAttributes{{
+    {"positions", &VertexData::positions},
+    {"normals", &VertexData::normals},
+    {"tangents", &VertexData::tangents},
+    {"uvs", &VertexData::uvs},
+    {"uv2s", &VertexData::uvs2},
+    {"uv3s", &VertexData::uvs3},
+    {"uv4s", &VertexData::uvs4},
+    {"uv5s", &VertexData::uvs5},
+    {"uv6s", &VertexData::uvs6},
+    {"colors", &VertexData::colors},
+    {"matricesIndices", &VertexData::matricesIndices},
+    {"matricesWeights", &VertexData::matricesWeights},
+  }};
+
+/**
+ * @brief Builds the parsed scene, parsing the arrays of the vertex data
+ * geometries straight into vertex data objects instead of Json::values.
+ */
+class SceneDataBuilder : public JsonDomBuilder {
+
+public:
+  SceneDataBuilder(Json::value& root) : JsonDomBuilder{root}
+  {
+  }
+
+  Float32Array* floatArray() override
+  {
+    auto vertexData = _vertexData();
+    if (!vertexData) {
+      return nullptr;
+    }
+    for (const auto& attribute : VertexDataAttributes) {
+      if (currentKey() == attribute.first) {
+        return &((*vertexData).*(attribute.second));
+      }
+    }
+    return nullptr;
+  }
+
+  Uint32Array* uint32Array() override
+  {
+    auto vertexData = _vertexData();
+    return (vertexData && currentKey() == "indices") ? &vertexData->indices :
+                                                       nullptr;
+  }
+
+private:
+  // Returns the vertex data of the geometry being parsed, nullptr outside of
+  // the elements of "geometries": {"vertexData": [...]}
+  VertexData* _vertexData()
+  {
+    if (depth() != 4 || !container(0).is<Json::object>()
+        || !container(0).contains("geometries")
+        || &container(0).get("geometries") != &container(1)
+        || !container(1).is<Json::object>()
+        || !container(1).contains("vertexData")
+        || &container(1).get("vertexData") != &container(2)
+        || !container(2).is<Json::array>()
+        || !container(3).is<Json::object>()) {
+      return nullptr;
+    }
+
+    const auto index = container(2).get<Json::array>().size() - 1;
+    if (index >= vertexDatas.size()) {
+      vertexDatas.resize(index + 1);
+    }
+    if (!vertexDatas[index]) {
+      vertexDatas[index] = std::make_unique<VertexData>();
+    }
+    return vertexDatas[index].get();
+  }
+
+public:
+  // Vertex data of the vertex data geometries, by index
+  std::vector<std::unique_ptr<VertexData>> vertexDatas;
+
+}; // end of class SceneDataBuilder
+
+// Geometry types of the "geometries" of a file, in the order they are looked
+// up by id
+const std::array<std::string, 8> GeometryTypes{
+  {"boxes", "spheres", "cylinders", "toruses", "grounds", "planes",
+   "torusKnots", "vertexData"}};
+
+} // end of anonymous namespace
+
+BabylonFileLoader::BabylonFileLoader(size_t workerCount)
+    : _pool{WorkerPool::Create(workerCount)}
 {
   extensions.mapping.emplace(std::make_pair(".babylon", false));
 }
 
 BabylonFileLoader::~BabylonFileLoader()
 {
+  _clear();
+}
+
+size_t BabylonFileLoader::workerCount() const
+{
+  return _pool->workerCount();
 }
 
 Material* BabylonFileLoader::parseMaterialById(const std::string& id,
-                                               const Json::value& parsedData,
                                                Scene* scene,
                                                const std::string& rootUrl) const
 {
-  for (const auto& parsedMaterial : Json::GetArray(parsedData, "materials")) {
-    if (Json::GetString(parsedData, "id") == id) {
-      return Material::Parse(parsedMaterial, scene, rootUrl);
+  auto it = _materials.find(id);
+  if (it == _materials.end()) {
+    return nullptr;
+  }
+  return Material::Parse(*it->second, scene, rootUrl);
+}
+
+void BabylonFileLoader::decodeVertexData(
+  const Json::value& parsedVertexData,
+  std::unique_ptr<VertexData>& vertexData) const
+{
+  if (!vertexData) {
+    vertexData = std::make_unique<VertexData>();
+  }
+  VertexData::ImportVertexData(parsedVertexData, *vertexData);
+}
+
+Geometry* BabylonFileLoader::parseGeometry(const Json::value& parsedVertexData,
+                                           Scene* scene,
+                                           const std::string& rootUrl)
+{
+  auto vertexData = takeVertexData(Json::GetString(parsedVertexData, "id"));
+  return Geometry::Parse(parsedVertexData, scene, rootUrl, vertexData.get());
+}
+
+std::unique_ptr<VertexData>
+BabylonFileLoader::takeVertexData(const std::string& id)
+{
+  std::unique_ptr<VertexData> vertexData;
+  auto it = _vertexDatas.find(id);
+  if (it != _vertexDatas.end()) {
+    vertexData = std::move(it->second);
+    _vertexDatas.erase(it);
+  }
+  return vertexData;
+}
+
+std::string BabylonFileLoader::_parse(const std::string& data,
+                                      Json::value& parsedData)
+{
+  _clear();
+
+  SceneDataBuilder builder(parsedData);
+  const auto err = JsonReader(data.data(), data.size()).parse(builder);
+  if (!err.empty()) {
+    return err;
+  }
+
+  // Index the entities referenced by id, the first one of an id wins
+  const auto index
+    = [](const Json::array& entities,
+         std::unordered_map<std::string, const Json::value*>& entitiesById) {
+        for (const auto& entity : entities) {
+          const auto id = Json::GetString(entity, "id");
+          if (!id.empty()) {
+            entitiesById.emplace(id, &entity);
+          }
+        }
+      };
+  index(Json::GetArray(parsedData, "materials"), _materials);
+  index(Json::GetArray(parsedData, "multiMaterials"), _multiMaterials);
+  index(Json::GetArray(parsedData, "skeletons"), _skeletons);
+
+  if (!parsedData.contains("geometries")) {
+    return err;
+  }
+
+  const auto& geometries = parsedData.get("geometries");
+  for (const auto& geometryType : GeometryTypes) {
+    for (const auto& parsedGeometry :
+         Json::GetArray(geometries, geometryType)) {
+      const auto id = Json::GetString(parsedGeometry, "id");
+      if (!id.empty()) {
+        _geometries.emplace(id, std::make_pair(geometryType, &parsedGeometry));
+      }
+    }
+  }
+
+  const auto& vertexDatas = Json::GetArray(geometries, "vertexData");
+  for (size_t i = 0; i < builder.vertexDatas.size(); ++i) {
+    if (builder.vertexDatas[i]) {
+      _vertexDatas.emplace(Json::GetString(vertexDatas[i], "id"),
+                           std::move(builder.vertexDatas[i]));
+    }
+  }
+
+  return err;
+}
+
+void BabylonFileLoader::_decode(
+  const Json::value& parsedData,
+  const std::vector<const Json::value*>& geometries,
+  const std::vector<const Json::value*>& skeletons, bool withAnimations)
+{
+  std::vector<std::function<void()>> jobs;
+
+  // Vertex data, the delay loaded geometries being decoded when streamed
+  std::vector<std::unique_ptr<VertexData>> vertexDatas(geometries.size());
+  for (size_t i = 0; i < geometries.size(); ++i) {
+    const auto& parsedVertexData = *geometries[i];
+    if (parsedVertexData.contains("delayLoadingFile")) {
+      continue;
+    }
+    vertexDatas[i] = takeVertexData(Json::GetString(parsedVertexData, "id"));
+    jobs.emplace_back([this, &parsedVertexData, &vertexDatas, i]() {
+      decodeVertexData(parsedVertexData, vertexDatas[i]);
+    });
+  }
+
+  // Animations of the bones, by bone index
+  for (const auto parsedSkeleton : skeletons) {
+    const auto& parsedBones = Json::GetArray(*parsedSkeleton, "bones");
+    auto& boneAnimations    = _boneAnimations[parsedSkeleton];
+    boneAnimations.resize(parsedBones.size(), nullptr);
+    for (size_t i = 0; i < parsedBones.size(); ++i) {
+      if (parsedBones[i].contains("animation")) {
+        const auto& parsedAnimation = parsedBones[i].get("animation");
+        jobs.emplace_back([&parsedAnimation, &boneAnimations, i]() {
+          boneAnimations[i] = Animation::Parse(parsedAnimation);
+        });
+      }
+    }
+  }
+
+  // Animations of the scene
+  if (withAnimations) {
+    const auto& parsedAnimations = Json::GetArray(parsedData, "animations");
+    _animations.resize(parsedAnimations.size(), nullptr);
+    for (size_t i = 0; i < parsedAnimations.size(); ++i) {
+      jobs.emplace_back([this, &parsedAnimations, i]() {
+        _animations[i] = Animation::Parse(parsedAnimations[i]);
+      });
+    }
+  }
+
+  _pool->run(jobs);
+
+  for (size_t i = 0; i < geometries.size(); ++i) {
+    if (vertexDatas[i]) {
+      _vertexDatas[Json::GetString(*geometries[i], "id")]
+        = std::move(vertexDatas[i]);
     }
   }
-  return nullptr;
+}
+
+Skeleton* BabylonFileLoader::_parseSkeleton(const Json::value& parsedSkeleton,
+                                            Scene* scene)
+{
+  auto it = _boneAnimations.find(&parsedSkeleton);
+  if (it == _boneAnimations.end()) {
+    return Skeleton::Parse(parsedSkeleton, scene);
+  }
+
+  const auto boneAnimations = std::move(it->second);
+  _boneAnimations.erase(it);
+  return Skeleton::Parse(parsedSkeleton, scene, boneAnimations);
+}
+
+void BabylonFileLoader::_clear()
+{
+  // Decoded animations which were not handed over to the scene
+  for (auto animation : _animations) {
+    delete animation;
+  }
+  for (auto& boneAnimations : _boneAnimations) {
+    for (auto animation : boneAnimations.second) {
+      delete animation;
+    }
+  }
+
+  _vertexDatas.clear();
+  _materials.clear();
+  _multiMaterials.clear();
+  _skeletons.clear();
+  _geometries.clear();
+  _animations.clear();
+  _boneAnimations.clear();
 }
 
 bool BabylonFileLoader::isDescendantOf(const Json::value& mesh,
@@ -84,170 +357,151 @@ bool BabylonFileLoader::importMesh(
   std::vector<Skeleton*>& skeletons)
 {
   Json::value parsedData;
-  std::string err = Json::Parse(parsedData, data.c_str());
+  std::string err = _parse(data, parsedData);
   if (!err.empty()) {
     std::string log = "importMesh has failed JSON parse";
     BABYLON_LOGF_ERROR("BabylonFileLoader", "%s", log.c_str());
+    _clear();
     return false;
   }
   std::ostringstream log;
 
   bool fullDetails = SceneLoader::LoggingLevel == SceneLoader::DETAILED_LOGGING;
 
-  std::vector<std::string> loadedSkeletonsIds;
-  std::vector<std::string> loadedMaterialsIds;
+  // Meshes to import, with the vertex data geometries and the skeletons they
+  // use
   std::vector<std::string> hierarchyIds;
+  std::vector<const Json::value*> parsedMeshes;
+  std::vector<const Json::value*> parsedGeometries;
+  std::vector<const Json::value*> parsedSkeletons;
+  std::unordered_set<std::string> geometriesIds;
+  std::unordered_set<std::string> skeletonsIds;
+  for (const auto& parsedMesh : Json::GetArray(parsedData, "meshes")) {
+    if (!meshesNames.empty()
+        && !isDescendantOf(parsedMesh, meshesNames, hierarchyIds)) {
+      continue;
+    }
+    parsedMeshes.emplace_back(&parsedMesh);
 
-  for (auto& parsedMesh : Json::GetArray(parsedData, "meshes")) {
-    if (meshesNames.empty()
-        || isDescendantOf(parsedMesh, meshesNames, hierarchyIds)) {
-
-      // Id
-      const std::string parsedMeshId = Json::GetString(parsedMesh, "id", "");
-
-      // Geometry ?
-      if (parsedMesh.contains("geometryId")) {
-        const std::string parsedMeshGeometryId
-          = Json::GetString(parsedMesh, "geometryId");
-        // Does the file contain geometries?
-        if (parsedData.contains("geometries")) {
-          auto& geometries = parsedData.get("geometries");
-          // find the correct geometry and add it to the scene
-          bool found = false;
-          const std::array<std::string, 8> geometryTypes{
-            {"boxes", "spheres", "cylinders", "toruses", "grounds", "planes",
-             "torusKnots", "vertexData"}};
-          for (const auto& geometryType : geometryTypes) {
-            if (found || !geometries.contains(geometryType)
-                || !(geometries.get(geometryType).is<Json::array>())) {
-              break;
-            }
-            else {
-              for (const auto& parsedGeometryData :
-                   Json::GetArray(geometries, geometryType)) {
-                const std::string parsedGeometryDataId
-                  = Json::GetString(parsedGeometryData, "id");
-                if (!parsedGeometryDataId.empty()
-                    && (parsedGeometryDataId == parsedMeshGeometryId)) {
-                  if (geometryType == "boxes") {
-                    GeometryPrimitives::Box::Parse(parsedGeometryData, scene);
-                  }
-                  else if (geometryType == "spheres") {
-                    GeometryPrimitives::Sphere::Parse(parsedGeometryData,
-                                                      scene);
-                  }
-                  else if (geometryType == "cylinders") {
-                    GeometryPrimitives::Cylinder::Parse(parsedGeometryData,
-                                                        scene);
-                  }
-                  else if (geometryType == "toruses") {
-                    GeometryPrimitives::Torus::Parse(parsedGeometryData, scene);
-                  }
-                  else if (geometryType == "grounds") {
-                    GeometryPrimitives::Ground::Parse(parsedGeometryData,
-                                                      scene);
-                  }
-                  else if (geometryType == "planes") {
-                    GeometryPrimitives::Plane::Parse(parsedGeometryData, scene);
-                  }
-                  else if (geometryType == "torusKnots") {
-                    GeometryPrimitives::TorusKnot::Parse(parsedGeometryData,
-                                                         scene);
-                  }
-                  else if (geometryType == "vertexData") {
-                    Geometry::Parse(parsedGeometryData, scene, rootUrl);
-                  }
-                  found = true;
-                }
-              }
-            }
-          }
-          if (!found) {
-            BABYLON_LOGF_WARN("BabylonFileLoader",
-                              "Geometry not found for mesh %s",
-                              parsedMeshId.c_str());
-          }
-        }
-      }
+    auto geometry = _geometries.find(Json::GetString(parsedMesh, "geometryId"));
+    if (geometry != _geometries.end() && geometry->second.first == "vertexData"
+        && geometriesIds.insert(geometry->first).second) {
+      parsedGeometries.emplace_back(geometry->second.second);
+    }
+
+    auto skeleton = _skeletons.find(Json::GetString(parsedMesh, "skeletonId"));
+    if (skeleton != _skeletons.end()
+        && skeletonsIds.insert(skeleton->first).second) {
+      parsedSkeletons.emplace_back(skeleton->second);
+    }
+  }
 
-      // Material ?
-      if (parsedMesh.contains("materialId")) {
-        const std::string parsedMeshMaterialId
-          = Json::GetString(parsedMesh, "materialId");
-        bool materialFound
-          = stl_util::contains(loadedMaterialsIds, parsedMeshMaterialId);
-        if (!parsedMeshMaterialId.empty() && !materialFound
-            && parsedData.contains("multiMaterials")
-            && parsedData.get("multiMaterials").is<Json::array>()) {
-          for (const auto& parsedMultiMaterial :
-               Json::GetArray(parsedData, "multiMaterials")) {
-            const std::string parsedMultiMaterialId
-              = Json::GetString(parsedMultiMaterial, "id", "");
-            if ((!parsedMultiMaterialId.empty())
-                && (parsedMultiMaterialId == parsedMeshMaterialId)) {
-              if (parsedMultiMaterial.contains("materials")
-                  && parsedMultiMaterial.get("materials").is<Json::array>()) {
-                for (const auto& subMatId :
-                     Json::GetArray(parsedMultiMaterial, "materials")) {
-                  loadedMaterialsIds.emplace_back(subMatId.get<std::string>());
-                  auto mat = parseMaterialById(subMatId.get<std::string>(),
-                                               parsedData, scene, rootUrl);
-                  log << "\n\tMaterial " << mat->toString(fullDetails);
-                }
-              }
-              loadedMaterialsIds.emplace_back(parsedMultiMaterialId);
-              auto mmat
-                = Material::ParseMultiMaterial(parsedMultiMaterial, scene);
-              materialFound = true;
-              log << "\n\tMulti-Material " << mmat->toString(fullDetails);
-              break;
-            }
+  // Decode them on the worker threads
+  _decode(parsedData, parsedGeometries, parsedSkeletons, false);
+
+  // Create the scene objects
+  std::unordered_set<std::string> loadedSkeletonsIds;
+  std::unordered_set<std::string> loadedMaterialsIds;
+  GeometryDeduplicator geometryDeduplicator(scene);
+
+  for (const auto parsedMeshPtr : parsedMeshes) {
+    const auto& parsedMesh = *parsedMeshPtr;
+
+    // Id
+    const std::string parsedMeshId = Json::GetString(parsedMesh, "id", "");
+
+    // Geometry ?
+    if (parsedMesh.contains("geometryId")) {
+      auto it = _geometries.find(Json::GetString(parsedMesh, "geometryId"));
+      if (it != _geometries.end()) {
+        const auto& geometryType       = it->second.first;
+        const auto& parsedGeometryData = *it->second.second;
+        if (geometryType == "boxes") {
+          GeometryPrimitives::Box::Parse(parsedGeometryData, scene);
+        }
+        else if (geometryType == "spheres") {
+          GeometryPrimitives::Sphere::Parse(parsedGeometryData, scene);
+        }
+        else if (geometryType == "cylinders") {
+          GeometryPrimitives::Cylinder::Parse(parsedGeometryData, scene);
+        }
+        else if (geometryType == "toruses") {
+          GeometryPrimitives::Torus::Parse(parsedGeometryData, scene);
+        }
+        else if (geometryType == "grounds") {
+          GeometryPrimitives::Ground::Parse(parsedGeometryData, scene);
+        }
+        else if (geometryType == "planes") {
+          GeometryPrimitives::Plane::Parse(parsedGeometryData, scene);
+        }
+        else if (geometryType == "torusKnots") {
+          GeometryPrimitives::TorusKnot::Parse(parsedGeometryData, scene);
+        }
+        else if (geometryType == "vertexData") {
+          auto geometry = parseGeometry(parsedGeometryData, scene, rootUrl);
+          if (SceneLoader::DeduplicateGeometries) {
+            geometryDeduplicator.deduplicate(geometry);
           }
         }
+      }
+      else if (parsedData.contains("geometries")) {
+        BABYLON_LOGF_WARN("BabylonFileLoader", "Geometry not found for mesh %s",
+                          parsedMeshId.c_str());
+      }
+    }
 
-        if (!materialFound) {
-          loadedMaterialsIds.emplace_back(parsedMeshMaterialId);
-          auto mat = parseMaterialById(parsedMeshMaterialId, parsedData, scene,
-                                       rootUrl);
-          if (!mat) {
-            BABYLON_LOGF_WARN("BabylonFileLoader",
-                              "Material not found for mesh %s",
-                              parsedMeshId.c_str());
-          }
-          else {
+    // Material ?
+    if (parsedMesh.contains("materialId")) {
+      const std::string parsedMeshMaterialId
+        = Json::GetString(parsedMesh, "materialId");
+      bool materialFound = loadedMaterialsIds.count(parsedMeshMaterialId) > 0;
+      auto it            = _multiMaterials.find(parsedMeshMaterialId);
+      if (!materialFound && it != _multiMaterials.end()) {
+        const auto& parsedMultiMaterial = *it->second;
+        for (const auto& subMatId :
+             Json::ToStringVector(parsedMultiMaterial, "materials")) {
+          loadedMaterialsIds.insert(subMatId);
+          auto mat = parseMaterialById(subMatId, scene, rootUrl);
+          if (mat) {
             log << "\n\tMaterial " << mat->toString(fullDetails);
           }
         }
+        loadedMaterialsIds.insert(parsedMeshMaterialId);
+        auto mmat = Material::ParseMultiMaterial(parsedMultiMaterial, scene);
+        materialFound = true;
+        log << "\n\tMulti-Material " << mmat->toString(fullDetails);
       }
 
-      // Skeleton ?
-      if (parsedMesh.contains("skeletonId")) {
-        const std::string parsedMeshSkeletonId
-          = Json::GetString(parsedMesh, "skeletonId");
-        bool skeletonAlreadyLoaded
-          = stl_util::contains(loadedSkeletonsIds, parsedMeshSkeletonId);
-        if (!parsedMeshSkeletonId.empty() && !skeletonAlreadyLoaded
-            && parsedData.contains("skeletons")
-            && parsedData.get("skeletons").is<Json::array>()) {
-          for (const auto& parsedSkeleton :
-               Json::GetArray(parsedData, "skeletons")) {
-            const std::string parsedSkeletonId
-              = Json::GetString(parsedSkeleton, "id", "");
-            if ((!parsedSkeletonId.empty())
-                && (parsedSkeletonId == parsedMeshSkeletonId)) {
-              auto skeleton = Skeleton::Parse(parsedSkeleton, scene);
-              skeletons.emplace_back(skeleton);
-              loadedSkeletonsIds.emplace_back(parsedSkeletonId);
-              log << "\n\tSkeleton " << skeleton->toString(fullDetails);
-            }
-          }
+      if (!materialFound) {
+        loadedMaterialsIds.insert(parsedMeshMaterialId);
+        auto mat = parseMaterialById(parsedMeshMaterialId, scene, rootUrl);
+        if (!mat) {
+          BABYLON_LOGF_WARN("BabylonFileLoader",
+                            "Material not found for mesh %s",
+                            parsedMeshId.c_str());
+        }
+        else {
+          log << "\n\tMaterial " << mat->toString(fullDetails);
         }
       }
+    }
 
-      auto mesh = Mesh::Parse(parsedMesh, scene, rootUrl);
-      meshes.emplace_back(mesh);
-      log << "\n\tMesh " << mesh->toString(fullDetails);
+    // Skeleton ?
+    if (parsedMesh.contains("skeletonId")) {
+      const std::string parsedMeshSkeletonId
+        = Json::GetString(parsedMesh, "skeletonId");
+      auto it = _skeletons.find(parsedMeshSkeletonId);
+      if (it != _skeletons.end()
+          && loadedSkeletonsIds.insert(parsedMeshSkeletonId).second) {
+        auto skeleton = _parseSkeleton(*it->second, scene);
+        skeletons.emplace_back(skeleton);
+        log << "\n\tSkeleton " << skeleton->toString(fullDetails);
+      }
     }
+
+    auto mesh = Mesh::Parse(parsedMesh, scene, rootUrl);
+    meshes.emplace_back(mesh);
+    log << "\n\tMesh " << mesh->toString(fullDetails);
   }
 
   // Connecting parents
@@ -292,6 +546,7 @@ bool BabylonFileLoader::importMesh(
     BABYLON_LOGF_INFO("BabylonFileLoader", "%s%s", msg.c_str(), logStr.c_str());
   }
 
+  _clear();
   return true;
 }
 
@@ -299,12 +554,32 @@ bool BabylonFileLoader::load(Scene* scene, const std::string& data,
                              const std::string& rootUrl)
 {
   Json::value parsedData;
-  std::string err = Json::Parse(parsedData, data.c_str());
+  std::string err = _parse(data, parsedData);
   if (!err.empty()) {
     std::string log = "importScene has failed JSON parse";
     BABYLON_LOGF_ERROR("BabylonFileLoader", "%s", log.c_str());
+    _clear();
     return false;
   }
+
+  // Decode the vertex data, the skeletons and the animations on the worker
+  // threads
+  std::vector<const Json::value*> parsedGeometries;
+  std::vector<const Json::value*> parsedSkeletons;
+  if (parsedData.contains("geometries")) {
+    for (const auto& parsedVertexData :
+         Json::GetArray(parsedData.get("geometries"), "vertexData")) {
+      auto it = _geometries.find(Json::GetString(parsedVertexData, "id"));
+      if (it != _geometries.end() && it->second.second == &parsedVertexData) {
+        parsedGeometries.emplace_back(&parsedVertexData);
+      }
+    }
+  }
+  for (const auto& parsedSkeleton : Json::GetArray(parsedData, "skeletons")) {
+    parsedSkeletons.emplace_back(&parsedSkeleton);
+  }
+  _decode(parsedData, parsedGeometries, parsedSkeletons, true);
+
   std::ostringstream log;
   bool fullDetails = SceneLoader::LoggingLevel == SceneLoader::DETAILED_LOGGING;
 
@@ -371,13 +646,13 @@ bool BabylonFileLoader::load(Scene* scene, const std::string& data,
 
   // Animations
   index = 0;
-  for (const auto& parsedAnimation : Json::GetArray(parsedData, "animations")) {
-    auto animation = Animation::Parse(parsedAnimation);
+  for (auto animation : _animations) {
     scene->animations.emplace_back(animation);
     log << (index == 0 ? "\n\tAnimations:" : "");
     log << "\n\t\t" << animation->toString(fullDetails);
     ++index;
   }
+  _animations.clear();
 
   if (Json::GetBool(parsedData, "autoAnimate", false)) {
     scene->beginAnimation(scene,
@@ -409,7 +684,7 @@ bool BabylonFileLoader::load(Scene* scene, const std::string& data,
   // Skeletons
   index = 0;
   for (const auto& parsedSkeleton : Json::GetArray(parsedData, "skeletons")) {
-    auto skeleton = Skeleton::Parse(parsedSkeleton, scene);
+    auto skeleton = _parseSkeleton(parsedSkeleton, scene);
     log << (index == 0 ? "\n\tSkeletons:" : "");
     log << "\n\t\t" << skeleton->toString(fullDetails);
     ++index;
@@ -455,21 +730,39 @@ bool BabylonFileLoader::load(Scene* scene, const std::string& data,
     }
 
     // VertexData
+    GeometryDeduplicator geometryDeduplicator(scene);
     for (const auto& parsedVertexData :
          Json::GetArray(geometries, "vertexData")) {
-      Geometry::Parse(parsedVertexData, scene, rootUrl);
+      auto geometry = parseGeometry(parsedVertexData, scene, rootUrl);
+      if (SceneLoader::DeduplicateGeometries) {
+        geometryDeduplicator.deduplicate(geometry);
+      }
+    }
+    if (geometryDeduplicator.mergedCount() > 0) {
+      log << "\n\tMerged geometries: " << geometryDeduplicator.mergedCount();
     }
   }
 
   // Meshes
   index = 0;
+  std::vector<Mesh*> parsedMeshes;
   for (const auto& parsedMesh : Json::GetArray(parsedData, "meshes")) {
     auto mesh = Mesh::Parse(parsedMesh, scene, rootUrl);
+    parsedMeshes.emplace_back(mesh);
     log << (index == 0 ? "\n\tMeshes:" : "");
     log << "\n\t\t" << mesh->toString(fullDetails);
     ++index;
   }
 
+  // Meshes sharing a geometry
+  if (SceneLoader::ConvertDuplicatesToInstances) {
+    const auto convertedCount
+      = GeometryDeduplicator::ConvertToInstances(parsedMeshes);
+    if (convertedCount > 0) {
+      log << "\n\tMeshes converted to instances: " << convertedCount;
+    }
+  }
+
   // Cameras
   index = 0;
   for (const auto& parsedCamera : Json::GetArray(parsedData, "cameras")) {
@@ -560,6 +853,7 @@ bool BabylonFileLoader::load(Scene* scene, const std::string& data,
   }
 
   // Finish
+  _clear();
   return true;
 }
 
@@ -6,6 +6,7 @@
 #include <babylon/engine/engine.h>
 #include <babylon/engine/scene.h>
 #include <babylon/loading/iregistered_plugin.h>
+#include <babylon/loading/plugins/babylon/babylon_binary_file_loader.h>
 #include <babylon/loading/plugins/babylon/babylon_file_loader.h>
 #include <babylon/tools/tools.h>
 
@@ -14,15 +15,18 @@ namespace BABYLON {
 bool SceneLoader::ForceFullSceneLoadingForIncremental = false;
 bool SceneLoader::ShowLoadingScreen                   = true;
 unsigned int SceneLoader::LoggingLevel                = SceneLoader::NO_LOGGING;
+bool SceneLoader::DeduplicateGeometries               = false;
+bool SceneLoader::ConvertDuplicatesToInstances        = false;
 
 std::unordered_map<std::string, IRegisteredPlugin>
   SceneLoader::_registeredPlugins{};
 
 IRegisteredPlugin SceneLoader::_getDefaultPlugin()
 {
-  // Add default plugin
+  // Add default plugins
   if (SceneLoader::_registeredPlugins.empty()) {
     SceneLoader::RegisterPlugin(std::make_shared<BabylonFileLoader>());
+    SceneLoader::RegisterPlugin(std::make_shared<BabylonBinaryFileLoader>());
   }
 
   return SceneLoader::_registeredPlugins[".babylon"];
@@ -31,6 +35,10 @@ IRegisteredPlugin SceneLoader::_getDefaultPlugin()
 IRegisteredPlugin
 SceneLoader::_getPluginForExtension(const std::string& extension)
 {
+  if (SceneLoader::_registeredPlugins.empty()) {
+    SceneLoader::_getDefaultPlugin();
+  }
+
   if (stl_util::contains(SceneLoader::_registeredPlugins, extension)) {
     return SceneLoader::_registeredPlugins[extension];
   }
@@ -181,7 +189,8 @@ void SceneLoader::Append(const std::string& rootUrl,
     }
 
     if (SceneLoader::ShowLoadingScreen) {
-      scene->executeWhenReady([&]() { scene->getEngine()->hideLoadingUI(); });
+      scene->executeWhenReady(
+        [scene]() { scene->getEngine()->hideLoadingUI(); });
     }
   };
 
@@ -238,6 +238,10 @@ BaseTexture* Material::getAlphaTestTexture()
   return nullptr;
 }
 
+void Material::getActiveTextures(std::vector<BaseTexture*>& /*textures*/)
+{
+}
+
 void Material::trackCreation(
   const std::function<void(const Effect* effect)>& /*onCompiled*/,
   const std::function<void(const Effect* effect, const std::string& errors)>&
@@ -1,5 +1,6 @@
 #include <babylon/materials/multi_material.h>
 
+#include <babylon/babylon_stl_util.h>
 #include <babylon/core/json.h>
 #include <babylon/engine/scene.h>
 #include <babylon/materials/standard_material.h>
@@ -49,6 +50,25 @@ bool MultiMaterial::isReady(AbstractMesh* mesh, bool /*useInstances*/)
   return true;
 }
 
+void MultiMaterial::getActiveTextures(std::vector<BaseTexture*>& textures)
+{
+  const auto first = static_cast<std::ptrdiff_t>(textures.size());
+  for (auto& subMaterial : subMaterials) {
+    if (subMaterial) {
+      subMaterial->getActiveTextures(textures);
+    }
+  }
+
+  // Textures shared by sub materials are listed once
+  auto last = textures.begin() + first;
+  for (auto it = last; it != textures.end(); ++it) {
+    if (std::find(textures.begin() + first, last, *it) == last) {
+      *last++ = *it;
+    }
+  }
+  textures.erase(last, textures.end());
+}
+
 Material* MultiMaterial::clone(const std::string& iName,
                                bool cloneChildren) const
 {
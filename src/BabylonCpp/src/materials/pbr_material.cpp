@@ -1354,6 +1354,18 @@ std::vector<IAnimatable*> PBRMaterial::getAnimatables()
   return results;
 }
 
+void PBRMaterial::getActiveTextures(std::vector<BaseTexture*>& textures)
+{
+  for (auto& texture :
+       {albedoTexture, ambientTexture, opacityTexture, emissiveTexture,
+        reflectivityTexture, metallicTexture, microSurfaceTexture, bumpTexture,
+        lightmapTexture}) {
+    if (texture) {
+      textures.emplace_back(texture);
+    }
+  }
+}
+
 void PBRMaterial::dispose(bool forceDisposeEffect, bool forceDisposeTextures)
 {
   if (forceDisposeTextures) {
@@ -1140,6 +1140,17 @@ std::vector<IAnimatable*> StandardMaterial::getAnimatables()
   return results;
 }
 
+void StandardMaterial::getActiveTextures(std::vector<BaseTexture*>& textures)
+{
+  for (auto& texture :
+       {_diffuseTexture, _ambientTexture, _opacityTexture, _emissiveTexture,
+        _specularTexture, _bumpTexture, _lightmapTexture}) {
+    if (texture) {
+      textures.emplace_back(texture);
+    }
+  }
+}
+
 void StandardMaterial::dispose(bool forceDisposeEffect,
                                bool forceDisposeTextures)
 {
@@ -190,20 +190,11 @@ void BaseTexture::_removeFromCache(const std::string& url, bool noMipmap)
 }
 
 GL::IGLTexture* BaseTexture::_getFromCache(const std::string& url,
-                                           bool noMipmap, unsigned int sampling)
+                                           bool noMipmap, unsigned int sampling,
+                                           bool invertY)
 {
-  auto& texturesCache = _scene->getEngine()->getLoadedTexturesCache();
-  for (auto& texturesCacheEntry : texturesCache) {
-    if ((texturesCacheEntry->url.compare(url) == 0)
-        && texturesCacheEntry->noMipmap == noMipmap) {
-      if (!sampling || sampling == texturesCacheEntry->samplingMode) {
-        ++texturesCacheEntry->references;
-        return texturesCacheEntry.get();
-      }
-    }
-  }
-
-  return nullptr;
+  return _scene->getEngine()->_getTextureFromCache(url, noMipmap, sampling,
+                                                   invertY);
 }
 
 void BaseTexture::delayLoad()
@@ -233,24 +224,23 @@ void BaseTexture::dispose(bool /*doNotRecurse*/)
   // Animations
   getScene()->stopAnimation(this);
 
-  // Remove from scene
-  _scene->textures.erase(
-    std::remove_if(_scene->textures.begin(), _scene->textures.end(),
-                   [this](const std::unique_ptr<BaseTexture>& baseTexture) {
-                     return baseTexture.get() == this;
-                   }),
-    _scene->textures.end());
+  if (_texture) {
+    // Release
+    releaseInternalTexture();
 
-  if (_texture == nullptr) {
-    return;
+    // Callback
+    onDisposeObservable.notifyObservers(this);
+    onDisposeObservable.clear();
   }
 
-  // Release
-  releaseInternalTexture();
-
-  // Callback
-  onDisposeObservable.notifyObservers(this);
-  onDisposeObservable.clear();
+  // Remove from scene, last as the scene owns this texture
+  auto scene = _scene;
+  scene->textures.erase(
+    std::remove_if(scene->textures.begin(), scene->textures.end(),
+                   [this](const std::unique_ptr<BaseTexture>& baseTexture) {
+                     return baseTexture.get() == this;
+                   }),
+    scene->textures.end());
 }
 
 Json::object BaseTexture::serialize() const
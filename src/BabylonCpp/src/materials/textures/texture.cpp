@@ -40,7 +40,7 @@ Texture::Texture(const std::string& _url, Scene* scene, bool noMipmap,
     return;
   }
 
-  _texture = _getFromCache(url, noMipmap, samplingMode);
+  _texture = _getFromCache(url, noMipmap, samplingMode, invertY);
 
   _load = [this]() {
     if (_onLoadObservable.hasObservers()) {
@@ -98,7 +98,7 @@ void Texture::delayLoad()
   }
 
   delayLoadState = EngineConstants::DELAYLOADSTATE_LOADED;
-  _texture       = _getFromCache(url, _noMipmap, _samplingMode);
+  _texture       = _getFromCache(url, _noMipmap, _samplingMode, _invertY);
 
   if (!_texture) {
     _texture = getScene()->getEngine()->createTexture(
@@ -0,0 +1,76 @@
+#include <babylon/materials/textures/texture_cache.h>
+
+#include <babylon/interfaces/igl_rendering_context.h>
+
+namespace BABYLON {
+
+TextureCache::TextureCache()
+{
+}
+
+TextureCache::~TextureCache()
+{
+}
+
+GL::IGLTexture* TextureCache::getByUrl(const std::string& url, bool noMipmap,
+                                       unsigned int samplingMode,
+                                       bool invertY) const
+{
+  const auto range = _texturesByUrl.equal_range(url);
+  for (auto it = range.first; it != range.second; ++it) {
+    auto texture = it->second;
+    if (texture->noMipmap == noMipmap && texture->invertY == invertY
+        && (!samplingMode || texture->samplingMode == samplingMode)) {
+      return texture;
+    }
+  }
+
+  return nullptr;
+}
+
+void TextureCache::addUrl(const std::string& url, GL::IGLTexture* texture)
+{
+  _texturesByUrl.emplace(url, texture);
+  _urlsByTexture.emplace(texture, url);
+}
+
+GL::IGLTexture* TextureCache::getOrAddContent(GL::IGLTexture* texture)
+{
+  const auto range = _texturesByContent.equal_range(texture->_contentHash);
+  for (auto it = range.first; it != range.second; ++it) {
+    auto cachedTexture = it->second;
+    if (cachedTexture->noMipmap == texture->noMipmap
+        && cachedTexture->invertY == texture->invertY
+        && cachedTexture->samplingMode == texture->samplingMode) {
+      return cachedTexture;
+    }
+  }
+
+  _texturesByContent.emplace(texture->_contentHash, texture);
+  return nullptr;
+}
+
+void TextureCache::remove(GL::IGLTexture* texture)
+{
+  const auto urls = _urlsByTexture.equal_range(texture);
+  for (auto url = urls.first; url != urls.second; ++url) {
+    const auto range = _texturesByUrl.equal_range(url->second);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == texture) {
+        _texturesByUrl.erase(it);
+        break;
+      }
+    }
+  }
+  _urlsByTexture.erase(urls.first, urls.second);
+
+  const auto range = _texturesByContent.equal_range(texture->_contentHash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == texture) {
+      _texturesByContent.erase(it);
+      break;
+    }
+  }
+}
+
+} // end of namespace BABYLON
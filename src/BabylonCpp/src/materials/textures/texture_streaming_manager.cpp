@@ -0,0 +1,229 @@
+#include <babylon/materials/textures/texture_streaming_manager.h>
+
+#include <babylon/engine/engine.h>
+#include <babylon/interfaces/igl_rendering_context.h>
+
+namespace BABYLON {
+
+TextureStreamingManager::TextureStreamingManager(Engine* engine)
+    : enabled{false}
+    , initialMaxSize{64}
+    , maxUploadsPerFrame{4}
+    , _engine{engine}
+    , _budget{0}
+{
+}
+
+TextureStreamingManager::~TextureStreamingManager()
+{
+}
+
+void TextureStreamingManager::setBudget(size_t bytes)
+{
+  _budget = bytes;
+}
+
+size_t TextureStreamingManager::budget() const
+{
+  return _budget;
+}
+
+void TextureStreamingManager::registerTexture(GL::IGLTexture* texture,
+                                              const Image& image, bool invertY)
+{
+  StreamedTexture entry;
+  entry.texture               = texture;
+  entry.invertY               = invertY;
+  entry.screenSize            = 0.f;
+  entry.lastRequestedRenderId = -1;
+
+  // Mip chain down to 1x1
+  entry.mips.emplace_back(image);
+  for (auto& mip :
+       _engine->mipmapGenerator().generate(image, _engine->mipmapOptions)) {
+    entry.mips.emplace_back(std::move(mip));
+  }
+
+  const auto levelCount = static_cast<unsigned int>(entry.mips.size());
+  entry.chainSizes.resize(levelCount + 1, 0);
+  for (unsigned int level = levelCount; level-- > 0;) {
+    entry.chainSizes[level]
+      = entry.chainSizes[level + 1] + entry.mips[level].data.size();
+  }
+
+  entry.coarsestLevel = 0;
+  while (entry.coarsestLevel + 1 < levelCount
+         && std::max(entry.mips[entry.coarsestLevel].width,
+                     entry.mips[entry.coarsestLevel].height)
+              > initialMaxSize) {
+    ++entry.coarsestLevel;
+  }
+  entry.targetLevel = entry.coarsestLevel;
+
+  auto& streamed = _textures[texture];
+  streamed       = std::move(entry);
+  _upload(streamed, streamed.coarsestLevel);
+}
+
+void TextureStreamingManager::unregisterTexture(GL::IGLTexture* texture)
+{
+  _textures.erase(texture);
+}
+
+bool TextureStreamingManager::isStreamed(GL::IGLTexture* texture) const
+{
+  return _textures.find(texture) != _textures.end();
+}
+
+void TextureStreamingManager::requestScreenSize(GL::IGLTexture* texture,
+                                                float screenSize)
+{
+  auto it = _textures.find(texture);
+  if (it != _textures.end()) {
+    it->second.screenSize = std::max(it->second.screenSize, screenSize);
+  }
+}
+
+void TextureStreamingManager::update(int renderId)
+{
+  _stats.uploads   = 0;
+  _stats.evictions = 0;
+
+  std::vector<StreamedTexture*> entries;
+  entries.reserve(_textures.size());
+  size_t requestedBytes = 0;
+  for (auto& item : _textures) {
+    auto& entry = item.second;
+    if (entry.screenSize > 0.f) {
+      const auto& mip0 = entry.mips[0];
+      entry.lastRequestedRenderId = renderId;
+      entry.targetLevel           = std::min(
+        GetRequiredMipLevel(mip0.width, mip0.height, entry.screenSize,
+                            static_cast<unsigned int>(entry.mips.size())),
+        entry.coarsestLevel);
+    }
+    else {
+      // Textures not seen during this frame keep their mip levels until the
+      // memory is needed
+      entry.targetLevel = entry.texture->_residentMipLevel;
+    }
+    requestedBytes += entry.chainSizes[entry.targetLevel];
+    entries.emplace_back(&entry);
+  }
+  _stats.requestedBytes = requestedBytes;
+
+  // Lowest priority first: not seen for the longest time, then the smallest
+  // on screen
+  std::sort(entries.begin(), entries.end(),
+            [](const StreamedTexture* a, const StreamedTexture* b) {
+              if (a->lastRequestedRenderId != b->lastRequestedRenderId) {
+                return a->lastRequestedRenderId < b->lastRequestedRenderId;
+              }
+              return a->screenSize < b->screenSize;
+            });
+
+  // Coarsen the target levels until the budget is met
+  if (_budget > 0) {
+    auto bytes = requestedBytes;
+    for (auto& entry : entries) {
+      while (bytes > _budget && entry->targetLevel < entry->coarsestLevel) {
+        bytes -= entry->chainSizes[entry->targetLevel]
+                 - entry->chainSizes[entry->targetLevel + 1];
+        ++entry->targetLevel;
+      }
+      if (bytes <= _budget) {
+        break;
+      }
+    }
+  }
+
+  // Evict first so that the memory is released before streaming in
+  for (auto& entry : entries) {
+    if (entry->targetLevel > entry->texture->_residentMipLevel) {
+      _upload(*entry, entry->targetLevel);
+      ++_stats.evictions;
+    }
+  }
+
+  // Stream in one finer level per texture, highest priority first
+  for (auto it = entries.rbegin(); it != entries.rend(); ++it) {
+    if (_stats.uploads >= maxUploadsPerFrame) {
+      break;
+    }
+    auto& entry = **it;
+    if (entry.targetLevel < entry.texture->_residentMipLevel) {
+      _upload(entry, entry.texture->_residentMipLevel - 1);
+      ++_stats.uploads;
+    }
+  }
+
+  if (_stats.uploads > 0 || _stats.evictions > 0) {
+    _engine->_bindTextureDirectly(GL::TEXTURE_2D, nullptr);
+    _engine->resetTextureCache();
+  }
+
+  for (auto& entry : entries) {
+    entry->screenSize = 0.f;
+  }
+
+  _updateStats();
+}
+
+const TextureStreamingStats& TextureStreamingManager::stats() const
+{
+  return _stats;
+}
+
+unsigned int TextureStreamingManager::GetRequiredMipLevel(
+  int width, int height, float screenSize, unsigned int levelCount)
+{
+  if (levelCount == 0) {
+    return 0;
+  }
+  if (screenSize <= 0.f) {
+    return levelCount - 1;
+  }
+
+  const float ratio = static_cast<float>(std::max(width, height)) / screenSize;
+  if (ratio <= 1.f) {
+    return 0;
+  }
+
+  const auto level = static_cast<unsigned int>(std::floor(std::log2(ratio)));
+  return std::min(level, levelCount - 1);
+}
+
+void TextureStreamingManager::_upload(StreamedTexture& entry,
+                                      unsigned int level)
+{
+  auto gl = _engine->_gl;
+  _engine->_bindTextureDirectly(GL::TEXTURE_2D, entry.texture);
+  gl->pixelStorei(GL::UNPACK_FLIP_Y_WEBGL, entry.invertY ? 1 : 0);
+
+  for (auto i = level; i < entry.mips.size(); ++i) {
+    const auto& mip = entry.mips[i];
+    gl->texImage2D(GL::TEXTURE_2D, static_cast<GL::GLint>(i - level), GL::RGBA,
+                   mip.width, mip.height, 0, GL::RGBA, GL::UNSIGNED_BYTE,
+                   mip.data);
+  }
+
+  entry.texture->_residentMipLevel = level;
+}
+
+void TextureStreamingManager::_updateStats()
+{
+  _stats.registeredTextures    = _textures.size();
+  _stats.fullyResidentTextures = 0;
+  _stats.residentBytes         = 0;
+  _stats.budget                = _budget;
+  for (const auto& item : _textures) {
+    const auto& entry = item.second;
+    const auto level  = entry.texture->_residentMipLevel;
+    _stats.residentBytes += entry.chainSizes[level];
+    if (level == 0) {
+      ++_stats.fullyResidentTextures;
+    }
+  }
+}
+
+} // end of namespace BABYLON
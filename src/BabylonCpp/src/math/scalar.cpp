@@ -21,4 +21,81 @@ float Scalar::Hermite(float value1, float tangent1, float value2,
          + (tangent2 * part4);
 }
 
+uint16_t Scalar::ToHalfFloat(float value)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(float));
+
+  const uint32_t sign     = (bits >> 16) & 0x8000;
+  const uint32_t exponent = (bits >> 23) & 0xff;
+  uint32_t mantissa       = bits & 0x007fffff;
+
+  // Infinity and NaN
+  if (exponent == 0xff) {
+    return static_cast<uint16_t>(sign | 0x7c00 | (mantissa ? 0x200 : 0));
+  }
+
+  const int halfExponent = static_cast<int>(exponent) - 127 + 15;
+  // Overflow, clamp to infinity
+  if (halfExponent >= 0x1f) {
+    return static_cast<uint16_t>(sign | 0x7c00);
+  }
+
+  // Subnormal half float or underflow to zero
+  if (halfExponent <= 0) {
+    if (halfExponent < -10) {
+      return static_cast<uint16_t>(sign);
+    }
+    mantissa |= 0x00800000;
+    const auto shift      = static_cast<uint32_t>(14 - halfExponent);
+    uint32_t halfMantissa = mantissa >> shift;
+    if ((mantissa >> (shift - 1)) & 1) {
+      ++halfMantissa;
+    }
+    return static_cast<uint16_t>(sign | halfMantissa);
+  }
+
+  // Rounding may carry into the exponent, which is the expected result
+  uint32_t half
+    = sign | (static_cast<uint32_t>(halfExponent) << 10) | (mantissa >> 13);
+  if (mantissa & 0x1000) {
+    ++half;
+  }
+  return static_cast<uint16_t>(half);
+}
+
+float Scalar::FromHalfFloat(uint16_t value)
+{
+  const uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+  uint32_t exponent   = (value >> 10) & 0x1f;
+  uint32_t mantissa   = value & 0x3ff;
+
+  uint32_t bits;
+  if (exponent == 0) {
+    if (mantissa == 0) {
+      bits = sign;
+    }
+    else {
+      // Normalize the subnormal half float
+      exponent = 127 - 15 + 1;
+      while (!(mantissa & 0x400)) {
+        mantissa <<= 1;
+        --exponent;
+      }
+      mantissa &= 0x3ff;
+      bits = sign | (exponent << 23) | (mantissa << 13);
+    }
+  }
+  else if (exponent == 0x1f) {
+    bits = sign | 0x7f800000 | (mantissa << 13);
+  }
+  else {
+    bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+  }
+
+  float result;
+  std::memcpy(&result, &bits, sizeof(float));
+  return result;
+}
+
 } // end of namespace BABYLON
@@ -412,6 +412,11 @@ Vector2 Vector2::FromArray(const Float32Array& array, unsigned int offset)
   return Vector2(array[offset], array[offset + 1]);
 }
 
+Vector2 Vector2::FromArray(const float* array, unsigned int offset)
+{
+  return Vector2(array[offset], array[offset + 1]);
+}
+
 void Vector2::FromArrayToRef(const Float32Array& array, unsigned int offset,
                              Vector2& result)
 {
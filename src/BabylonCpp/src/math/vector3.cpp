@@ -479,6 +479,11 @@ Vector3 Vector3::FromArray(const Float32Array& array, unsigned int offset)
   return Vector3(array[offset], array[offset + 1], array[offset + 2]);
 }
 
+Vector3 Vector3::FromArray(const float* array, unsigned int offset)
+{
+  return Vector3(array[offset], array[offset + 1], array[offset + 2]);
+}
+
 void Vector3::FromArrayToRef(const Float32Array& array, unsigned int offset,
                              Vector3& result)
 {
@@ -599,6 +599,16 @@ Float32Array AbstractMesh::getVerticesData(unsigned int /*kind*/,
   return Float32Array();
 }
 
+span<const float> AbstractMesh::getVerticesDataView(unsigned int /*kind*/)
+{
+  return span<const float>();
+}
+
+IndicesView AbstractMesh::getIndicesView()
+{
+  return IndicesView();
+}
+
 Mesh* AbstractMesh::setVerticesData(unsigned int /*kind*/,
                                     const Float32Array& /*data*/,
                                     bool /*updatable*/, int /*stride*/)
@@ -1835,7 +1845,7 @@ AbstractMesh& AbstractMesh::getAbsolutePivotPointToRef(Vector3& result)
 
 AbstractMesh& AbstractMesh::_initFacetData()
 {
-  _facetNb = getIndices().size() / 3;
+  _facetNb = getIndicesView().size() / 3;
 
   _facetNormals.resize(_facetNb);
   std::fill(_facetNormals.begin(), _facetNormals.end(), Vector3::Zero());
@@ -15,8 +15,11 @@ Buffer::Buffer(Engine* engine, const Float32Array& data, bool updatable,
     , _data{data}
     , _updatable{updatable}
     , _strideSize{stride}
+    , _byteStride{stride * 4}
     , _instanced{instanced}
+    , _trackedDataSize{0}
 {
+  _updateMemoryStats();
   if (!postponeInternalCreation) { // by default
     create();
   }
@@ -28,17 +31,37 @@ Buffer::Buffer(Mesh* mesh, const Float32Array& data, bool updatable, int stride,
     , _data{data}
     , _updatable{updatable}
     , _strideSize{stride}
+    , _byteStride{stride * 4}
     , _instanced{instanced}
+    , _trackedDataSize{0}
 {
   // old versions of BABYLON.VertexBuffer accepted 'mesh' instead of 'engine'
   _engine = mesh->getScene()->getEngine();
+  _updateMemoryStats();
   if (!postponeInternalCreation) { // by default
     create();
   }
 }
 
+Buffer::Buffer(Engine* engine, const Float32Array& data,
+               const Uint32Array& packedData, int stride, int byteStride)
+    : _engine{engine}
+    , _buffer{nullptr}
+    , _data{data}
+    , _packedData{packedData}
+    , _updatable{false}
+    , _strideSize{stride}
+    , _byteStride{byteStride}
+    , _instanced{false}
+    , _trackedDataSize{0}
+{
+  _updateMemoryStats();
+  create();
+}
+
 Buffer::~Buffer()
 {
+  _releaseMemoryStats();
 }
 
 std::unique_ptr<VertexBuffer> Buffer::createVertexBuffer(unsigned int kind,
@@ -78,6 +101,11 @@ int Buffer::getStrideSize() const
   return _strideSize;
 }
 
+int Buffer::getByteStride() const
+{
+  return _byteStride;
+}
+
 bool Buffer::getIsInstanced() const
 {
   return _instanced;
@@ -91,7 +119,13 @@ GL::IGLBuffer* Buffer::create()
   }
 
   if (!_buffer) { // create buffer
-    if (_updatable) {
+    if (!_packedData.empty()) {
+      _buffer = _engine->createVertexBuffer(_packedData);
+      // The packed data only lives on the GPU
+      _packedData.clear();
+      _packedData.shrink_to_fit();
+    }
+    else if (_updatable) {
       _buffer = _engine->createDynamicVertexBuffer(_data);
     }
     else {
@@ -116,6 +150,7 @@ GL::IGLBuffer* Buffer::create(const Float32Array& data)
       _buffer = _engine->createDynamicVertexBuffer(data.empty() ? _data : data);
       if (!data.empty()) {
         _data = data;
+        _updateMemoryStats();
       }
     }
     else {
@@ -126,6 +161,7 @@ GL::IGLBuffer* Buffer::create(const Float32Array& data)
     _engine->updateDynamicVertexBuffer(_buffer, data.empty() ? _data : data);
     if (!data.empty()) {
       _data = data;
+      _updateMemoryStats();
     }
   }
 
@@ -146,6 +182,7 @@ GL::IGLBuffer* Buffer::updateDirectly(const Float32Array& data, int offset)
   if (_updatable) { // update buffer
     _engine->updateDynamicVertexBuffer(_buffer, data, offset, -1);
     _data.clear();
+    _updateMemoryStats();
   }
 
   return _buffer ? _buffer.get() : nullptr;
@@ -162,13 +199,43 @@ GL::IGLBuffer* Buffer::updateDirectly(const Float32Array& data, int offset,
     _engine->updateDynamicVertexBuffer(
       _buffer, data, offset, static_cast<int>(vertexCount) * getStrideSize());
     _data.clear();
+    _updateMemoryStats();
   }
 
   return _buffer ? _buffer.get() : nullptr;
 }
 
+void Buffer::_updateMemoryStats()
+{
+  const auto dataSize = _data.size() * sizeof(float);
+  if (dataSize == _trackedDataSize) {
+    return;
+  }
+
+  auto& memoryTracker = _engine->memoryTracker();
+  if (_trackedDataSize > 0) {
+    memoryTracker.release(MemoryCategory::CpuVertexData, _trackedDataSize);
+  }
+  if (dataSize > 0) {
+    memoryTracker.allocate(MemoryCategory::CpuVertexData, dataSize);
+  }
+  _trackedDataSize = dataSize;
+}
+
+void Buffer::_releaseMemoryStats()
+{
+  // Zeroed once released, so that dispose() and the destructor release once
+  if (_trackedDataSize > 0) {
+    _engine->memoryTracker().release(MemoryCategory::CpuVertexData,
+                                     _trackedDataSize);
+    _trackedDataSize = 0;
+  }
+}
+
 void Buffer::dispose(bool /*doNotRecurse*/)
 {
+  _releaseMemoryStats();
+
   if (!_buffer) {
     return;
   }
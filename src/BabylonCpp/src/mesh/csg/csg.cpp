@@ -44,10 +44,10 @@ CSG::CSG* CSG::CSG::FromMesh(Mesh* mesh)
   }
   meshScaling = mesh->rotation()->clone();*/
 
-  Uint32Array indices    = mesh->getIndices();
-  Float32Array positions = mesh->getVerticesData(VertexBuffer::PositionKind);
-  Float32Array normals   = mesh->getVerticesData(VertexBuffer::NormalKind);
-  Float32Array uvs       = mesh->getVerticesData(VertexBuffer::UVKind);
+  auto indices   = mesh->getIndicesView();
+  auto positions = mesh->getVerticesDataView(VertexBuffer::PositionKind);
+  auto normals   = mesh->getVerticesDataView(VertexBuffer::NormalKind);
+  auto uvs       = mesh->getVerticesDataView(VertexBuffer::UVKind);
 
   unsigned int sm = 0;
   for (auto& subMesh : mesh->subMeshes) {
@@ -1,21 +1,62 @@
 #include <babylon/mesh/geometry.h>
 
 #include <babylon/babylon_stl_util.h>
+#include <babylon/core/hash.h>
 #include <babylon/core/json.h>
+#include <babylon/core/logging.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/engine/engine.h>
 #include <babylon/engine/scene.h>
 #include <babylon/interfaces/igl_rendering_context.h>
 #include <babylon/materials/effect.h>
+#include <babylon/math/matrix.h>
+#include <babylon/mesh/buffer.h>
+#include <babylon/mesh/geometry_streaming_manager.h>
+#include <babylon/mesh/index_optimizer.h>
 #include <babylon/mesh/lines_mesh.h>
 #include <babylon/mesh/mesh.h>
 #include <babylon/mesh/sub_mesh.h>
 #include <babylon/mesh/vertex_buffer.h>
 #include <babylon/mesh/vertex_data.h>
+#include <babylon/rendering/edges_renderer.h>
 #include <babylon/tools/tools.h>
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * @brief Packs float vertex data in the GPU data type of a vertex buffer.
+ * @returns Whether the data type is supported.
+ */
+bool packVertexData(const Float32Array& data, size_t components,
+                    unsigned int type, Uint32Array& words,
+                    Matrix& dequantization)
+{
+  switch (type) {
+    case VertexBuffer::FLOAT:
+      words.resize(data.size());
+      std::memcpy(words.data(), data.data(), data.size() * sizeof(float));
+      return true;
+    case VertexBuffer::SHORT:
+      words = VertexData::QuantizePositions(data, dequantization);
+      return true;
+    case VertexBuffer::INT_2_10_10_10_REV:
+      words = VertexData::PackNormals(data, components);
+      return true;
+    case VertexBuffer::HALF_FLOAT:
+      words = VertexData::PackHalfFloats(data, components);
+      return true;
+    case VertexBuffer::UNSIGNED_SHORT:
+      words = VertexData::PackUnorm16(data, components);
+      return true;
+    default:
+      return false;
+  }
+}
+
+} // end of anonymous namespace
+
 Geometry::Geometry(const std::string& iId, Scene* scene, VertexData* vertexData,
                    bool updatable, Mesh* mesh)
     : id{iId}
@@ -23,15 +64,18 @@ Geometry::Geometry(const std::string& iId, Scene* scene, VertexData* vertexData,
     , _scene{scene}
     , _engine{scene->getEngine()}
     , _totalVertices{0}
+    , _is16BitIndices{false}
     , _isDisposed{false}
     , _extendSet{false}
     , _hasBoundingBias{false}
     , _indexBuffer{nullptr}
+    , _positionDequantization{nullptr}
 {
   _meshes.clear();
   // Init vertex buffer cache
   _vertexBuffers.clear();
   _indices.clear();
+  _indices16.clear();
 
   // vertexData
   if (vertexData) {
@@ -138,7 +182,13 @@ void Geometry::removeVerticesData(unsigned int kind)
 {
   if (stl_util::contains(_vertexBuffers, kind)) {
     _vertexBuffers[kind]->dispose();
-    _vertexBuffers[kind].reset(nullptr);
+    _vertexBuffers.erase(kind);
+    _updateVertexBuffersCache();
+    _releaseUnusedInterleavedBuffers();
+  }
+
+  if (kind == VertexBuffer::PositionKind) {
+    _positionDequantization = nullptr;
   }
 }
 
@@ -151,8 +201,12 @@ void Geometry::setVerticesBuffer(std::unique_ptr<VertexBuffer>&& buffer)
 
   _vertexBuffers[kind] = std::move(buffer);
   auto _buffer         = _vertexBuffers[kind].get();
+  _updateVertexBuffersCache();
+  _releaseUnusedInterleavedBuffers();
 
   if (kind == VertexBuffer::PositionKind) {
+    _positionDequantization = nullptr;
+
     auto& data  = _buffer->getData();
     auto stride = _buffer->getStrideSize();
 
@@ -282,6 +336,28 @@ Float32Array Geometry::getVerticesData(unsigned int kind, bool copyWhenShared,
   }
 }
 
+span<const float> Geometry::getVerticesDataView(unsigned int kind) const
+{
+  auto vertexBuffer = getVertexBuffer(kind);
+  if (!vertexBuffer) {
+    return span<const float>();
+  }
+  const auto& data = vertexBuffer->getData();
+  return span<const float>(data.data(), data.size(),
+                           static_cast<size_t>(vertexBuffer->getStrideSize()));
+}
+
+span<float> Geometry::getMutableVerticesDataView(unsigned int kind)
+{
+  auto vertexBuffer = getVertexBuffer(kind);
+  if (!vertexBuffer) {
+    return span<float>();
+  }
+  auto& data = vertexBuffer->getData();
+  return span<float>(data.data(), data.size(),
+                     static_cast<size_t>(vertexBuffer->getStrideSize()));
+}
+
 VertexBuffer* Geometry::getVertexBuffer(unsigned int kind) const
 {
   if (!isReady() || _vertexBuffers.empty()) {
@@ -297,27 +373,33 @@ VertexBuffer* Geometry::getVertexBuffer(unsigned int kind) const
   }
 }
 
-std::unordered_map<std::string, VertexBuffer*> Geometry::getVertexBuffers()
+const std::unordered_map<std::string, VertexBuffer*>&
+Geometry::getVertexBuffers() const
 {
+  static const std::unordered_map<std::string, VertexBuffer*> noVertexBuffers;
+
   if (!isReady()) {
-    return std::unordered_map<std::string, VertexBuffer*>();
+    return noVertexBuffers;
   }
 
-  std::unordered_map<std::string, VertexBuffer*> vertexBuffers;
+  return _vertexBuffersCache;
+}
+
+void Geometry::_updateVertexBuffersCache()
+{
+  _vertexBuffersCache.clear();
   for (const auto& item : _vertexBuffers) {
-    const std::string kind = VertexBuffer::KindAsString(item.first);
-    vertexBuffers[kind]    = item.second.get();
+    const std::string kind    = VertexBuffer::KindAsString(item.first);
+    _vertexBuffersCache[kind] = item.second.get();
   }
-
-  return vertexBuffers;
 }
 
 bool Geometry::isVerticesDataPresent(unsigned int kind)
 {
   if (_vertexBuffers.empty()) {
-    if (!_delayInfo.empty()) {
-      return (std::find(_delayInfo.begin(), _delayInfo.end(), kind)
-              != _delayInfo.end());
+    if (!_delayInfoKinds.empty()) {
+      return (std::find(_delayInfoKinds.begin(), _delayInfoKinds.end(), kind)
+              != _delayInfoKinds.end());
     }
     return false;
   }
@@ -327,8 +409,8 @@ bool Geometry::isVerticesDataPresent(unsigned int kind)
 Uint32Array Geometry::getVerticesDataKinds()
 {
   Uint32Array result;
-  if (_vertexBuffers.empty() && !_delayInfo.empty()) {
-    for (auto& kind : _delayInfo) {
+  if (_vertexBuffers.empty() && !_delayInfoKinds.empty()) {
+    for (auto& kind : _delayInfoKinds) {
       result.emplace_back(kind);
     }
   }
@@ -349,16 +431,48 @@ Mesh* Geometry::setIndices(const IndicesArray& indices, size_t totalVertices)
 
   _disposeVertexArrayObjects();
 
-  _indices = indices;
-  if (!_meshes.empty() && !_indices.empty()) {
-    _indexBuffer
-      = std::unique_ptr<GL::IGLBuffer>(_engine->createIndexBuffer(_indices));
+  if (totalVertices != 0) {
+    _totalVertices = static_cast<size_t>(totalVertices);
+  }
+
+  // Small meshes are stored with 16 bits indices, halving the index memory
+  _is16BitIndices = VertexData::CanUse16BitIndices(indices, _totalVertices);
+  if (_is16BitIndices) {
+    _indices16 = VertexData::ToUint16Indices(indices);
+    _indices.clear();
+  }
+  else {
+    _indices = indices;
+    _indices16.clear();
+  }
+  _createIndexBuffer();
+
+  for (auto& mesh : _meshes) {
+    mesh->_createGlobalSubMesh();
+  }
+
+  notifyUpdate();
+
+  return nullptr;
+}
+
+Mesh* Geometry::setIndices(const Uint16Array& indices, size_t totalVertices)
+{
+  if (_indexBuffer) {
+    _engine->_releaseBuffer(_indexBuffer.get());
   }
 
+  _disposeVertexArrayObjects();
+
   if (totalVertices != 0) {
     _totalVertices = static_cast<size_t>(totalVertices);
   }
 
+  _is16BitIndices = true;
+  _indices16      = indices;
+  _indices.clear();
+  _createIndexBuffer();
+
   for (auto& mesh : _meshes) {
     mesh->_createGlobalSubMesh();
   }
@@ -368,12 +482,34 @@ Mesh* Geometry::setIndices(const IndicesArray& indices, size_t totalVertices)
   return nullptr;
 }
 
+void Geometry::_createIndexBuffer()
+{
+  _indexBuffer = nullptr;
+  if (_meshes.empty()) {
+    return;
+  }
+
+  if (_is16BitIndices && !_indices16.empty()) {
+    _indexBuffer
+      = std::unique_ptr<GL::IGLBuffer>(_engine->createIndexBuffer(_indices16));
+  }
+  else if (!_is16BitIndices && !_indices.empty()) {
+    _indexBuffer
+      = std::unique_ptr<GL::IGLBuffer>(_engine->createIndexBuffer(_indices));
+  }
+}
+
 size_t Geometry::getTotalIndices()
 {
   if (!isReady()) {
     return 0;
   }
-  return _indices.size();
+  return _is16BitIndices ? _indices16.size() : _indices.size();
+}
+
+bool Geometry::is16BitIndices() const
+{
+  return _is16BitIndices;
 }
 
 IndicesArray Geometry::getIndices(bool copyWhenShared)
@@ -381,6 +517,9 @@ IndicesArray Geometry::getIndices(bool copyWhenShared)
   if (!isReady()) {
     return IndicesArray();
   }
+  if (_is16BitIndices) {
+    return VertexData::ToIndicesArray(_indices16);
+  }
   if (!copyWhenShared || _meshes.size() == 1) {
     return _indices;
   }
@@ -391,6 +530,83 @@ IndicesArray Geometry::getIndices(bool copyWhenShared)
   }
 }
 
+IndicesView Geometry::getIndicesView() const
+{
+  if (!isReady()) {
+    return IndicesView();
+  }
+  if (_is16BitIndices) {
+    return IndicesView(span<const uint16_t>(_indices16));
+  }
+  return IndicesView(span<const uint32_t>(_indices));
+}
+
+size_t Geometry::getMeshCount() const
+{
+  return _meshes.size();
+}
+
+uint64_t Geometry::getContentHash() const
+{
+  Uint32Array kinds;
+  for (const auto& item : _vertexBuffers) {
+    kinds.emplace_back(item.first);
+  }
+  std::sort(kinds.begin(), kinds.end());
+
+  // The layout and the update mode are part of the content, a geometry with
+  // updatable buffers is not interchangeable with a static one
+  uint64_t hash = _totalVertices;
+  for (auto kind : kinds) {
+    const auto data   = getVerticesDataView(kind);
+    const auto layout = getVertexBuffer(kind)->getLayoutHash();
+    hash = Hash64(data.data(), data.size() * sizeof(float), hash + layout);
+  }
+
+  if (_is16BitIndices) {
+    return Hash64(_indices16.data(), _indices16.size() * sizeof(uint16_t),
+                  hash);
+  }
+  return Hash64(_indices.data(), _indices.size() * sizeof(uint32_t), hash);
+}
+
+bool Geometry::hasSameContent(const Geometry& other) const
+{
+  if (_totalVertices != other._totalVertices
+      || _vertexBuffers.size() != other._vertexBuffers.size()) {
+    return false;
+  }
+
+  for (const auto& item : _vertexBuffers) {
+    auto otherVertexBuffer = other.getVertexBuffer(item.first);
+    if (!otherVertexBuffer || !item.second->hasSameLayout(*otherVertexBuffer)) {
+      return false;
+    }
+    const auto data      = getVerticesDataView(item.first);
+    const auto otherData = other.getVerticesDataView(item.first);
+    // Compares the bytes, so that NaNs written by the exporter compare equal
+    if (data.size() != otherData.size()
+        || std::memcmp(data.data(), otherData.data(),
+                       data.size() * sizeof(float))
+             != 0) {
+      return false;
+    }
+  }
+
+  const auto indices      = getIndicesView();
+  const auto otherIndices = other.getIndicesView();
+  if (indices.size() != otherIndices.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < indices.size(); ++i) {
+    if (indices[i] != otherIndices[i]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 GL::IGLBuffer* Geometry::getIndexBuffer()
 {
   if (!isReady()) {
@@ -399,6 +615,230 @@ GL::IGLBuffer* Geometry::getIndexBuffer()
   return _indexBuffer.get();
 }
 
+size_t Geometry::quantize(bool quantizePositions)
+{
+  const auto createVertexBuffer
+    = [this](unsigned int kind, const Float32Array& data,
+             const Uint32Array& packedData, int stride, int byteStride,
+             int size, unsigned int type, bool normalized) {
+        auto buffer = std::make_unique<Buffer>(_engine, data, packedData,
+                                               stride, byteStride);
+        return std::make_unique<VertexBuffer>(std::move(buffer), kind, size,
+                                              type, normalized);
+      };
+
+  size_t quantizedCount = 0;
+  for (auto kind : getVerticesDataKinds()) {
+    auto vertexBuffer = getVertexBuffer(kind);
+    const auto stride = VertexBuffer::KindToStride(kind);
+    if (!vertexBuffer || vertexBuffer->isUpdatable()
+        || vertexBuffer->getIsInstanced() || vertexBuffer->isShared()
+        || vertexBuffer->getDataType() != VertexBuffer::FLOAT
+        || vertexBuffer->getStrideSize() != stride
+        || vertexBuffer->getOffset() != 0) {
+      continue;
+    }
+
+    // Copy, the current buffer is disposed when replaced
+    const Float32Array data = vertexBuffer->getData();
+    if (data.empty()) {
+      continue;
+    }
+    const auto components = static_cast<size_t>(stride);
+    Matrix dequantization;
+    std::unique_ptr<VertexBuffer> quantized;
+    switch (kind) {
+      case VertexBuffer::PositionKind:
+        if (quantizePositions) {
+          quantized = createVertexBuffer(
+            kind, data, VertexData::QuantizePositions(data, dequantization),
+            stride, 8, 3, VertexBuffer::SHORT, true);
+        }
+        break;
+      case VertexBuffer::NormalKind:
+      case VertexBuffer::TangentKind:
+        quantized = createVertexBuffer(
+          kind, data, VertexData::PackNormals(data, components), stride, 4, 4,
+          VertexBuffer::INT_2_10_10_10_REV, true);
+        break;
+      case VertexBuffer::UVKind:
+      case VertexBuffer::UV2Kind:
+      case VertexBuffer::UV3Kind:
+      case VertexBuffer::UV4Kind:
+      case VertexBuffer::UV5Kind:
+      case VertexBuffer::UV6Kind:
+        quantized = createVertexBuffer(
+          kind, data, VertexData::PackHalfFloats(data, components), stride, 4,
+          stride, VertexBuffer::HALF_FLOAT, false);
+        break;
+      case VertexBuffer::ColorKind:
+        quantized = createVertexBuffer(
+          kind, data, VertexData::PackUnorm16(data, components), stride, 8,
+          stride, VertexBuffer::UNSIGNED_SHORT, true);
+        break;
+      default:
+        break;
+    }
+
+    if (quantized) {
+      setVerticesBuffer(std::move(quantized));
+      if (kind == VertexBuffer::PositionKind) {
+        _positionDequantization = std::make_unique<Matrix>(dequantization);
+      }
+      ++quantizedCount;
+    }
+  }
+
+  return quantizedCount;
+}
+
+Matrix* Geometry::positionDequantization()
+{
+  return _positionDequantization.get();
+}
+
+size_t Geometry::interleave()
+{
+  std::vector<VertexBuffer*> vertexBuffers;
+  std::vector<Uint32Array> attributes;
+  Matrix dequantization;
+  for (auto kind : getVerticesDataKinds()) {
+    auto vertexBuffer = getVertexBuffer(kind);
+    const auto stride = VertexBuffer::KindToStride(kind);
+    // Dynamic kinds keep their own buffer so that updates stay cheap
+    if (!vertexBuffer || vertexBuffer->isUpdatable()
+        || vertexBuffer->getIsInstanced() || stride <= 0
+        || vertexBuffer->getStrideSize() != stride
+        || vertexBuffer->getOffset() != 0) {
+      continue;
+    }
+
+    const auto& data      = vertexBuffer->getData();
+    const auto components = static_cast<size_t>(stride);
+    if (data.empty() || data.size() != _totalVertices * components) {
+      continue;
+    }
+
+    // The GPU layout of the kind is kept, quantized kinds are packed again
+    // from their float data
+    Uint32Array words;
+    if (!packVertexData(data, components, vertexBuffer->getDataType(), words,
+                        dequantization)) {
+      continue;
+    }
+
+    vertexBuffers.emplace_back(vertexBuffer);
+    attributes.emplace_back(std::move(words));
+  }
+
+  if (attributes.size() < 2) {
+    return 0;
+  }
+
+  std::vector<size_t> wordOffsets;
+  const auto interleavedData
+    = VertexData::Interleave(attributes, _totalVertices, wordOffsets);
+  if (interleavedData.empty()) {
+    return 0;
+  }
+
+  const auto wordsPerVertex = interleavedData.size() / _totalVertices;
+  _interleavedBuffers.emplace_back(std::make_unique<Buffer>(
+    _engine, Float32Array(), interleavedData, static_cast<int>(wordsPerVertex),
+    static_cast<int>(wordsPerVertex * 4)));
+  auto interleavedBuffer = _interleavedBuffers.back().get();
+
+  const auto hasQuantizedPositions = (_positionDequantization != nullptr);
+  for (size_t i = 0; i < vertexBuffers.size(); ++i) {
+    auto vertexBuffer = vertexBuffers[i];
+    setVerticesBuffer(std::make_unique<VertexBuffer>(
+      _engine, vertexBuffer->getData(), interleavedBuffer,
+      vertexBuffer->getKind(), vertexBuffer->getSize(),
+      vertexBuffer->getDataType(), vertexBuffer->getNormalized(),
+      static_cast<int>(wordOffsets[i] * 4)));
+  }
+  if (hasQuantizedPositions) {
+    _positionDequantization = std::make_unique<Matrix>(dequantization);
+  }
+
+  return vertexBuffers.size();
+}
+
+void Geometry::remapVertices(const Uint32Array& remap)
+{
+  Matrix dequantization;
+  for (auto kind : getVerticesDataKinds()) {
+    auto vertexBuffer = getVertexBuffer(kind);
+    if (!vertexBuffer || vertexBuffer->isShared()) {
+      continue;
+    }
+
+    const auto updatable = vertexBuffer->isUpdatable();
+    const auto size      = vertexBuffer->getSize();
+    const auto type      = vertexBuffer->getDataType();
+    if (type == VertexBuffer::FLOAT) {
+      auto data = vertexBuffer->getData();
+      IndexOptimizer::RemapVertexBuffer(data, static_cast<size_t>(size),
+                                        remap);
+      setVerticesData(kind, data, updatable, size);
+      continue;
+    }
+
+    // Quantized kinds are packed again from their float data, whose layout
+    // is the one of the kind
+    const auto stride     = vertexBuffer->getStrideSize();
+    const auto byteStride = vertexBuffer->getByteStride();
+    const auto normalized = vertexBuffer->getNormalized();
+    auto data             = vertexBuffer->getData();
+    IndexOptimizer::RemapVertexBuffer(data, static_cast<size_t>(stride), remap);
+    Uint32Array words;
+    if (!packVertexData(data, static_cast<size_t>(stride), type, words,
+                        dequantization)) {
+      continue;
+    }
+    const auto hasQuantizedPositions = (_positionDequantization != nullptr);
+    auto buffer = std::make_unique<Buffer>(_engine, data, words, stride,
+                                           byteStride);
+    setVerticesBuffer(std::make_unique<VertexBuffer>(std::move(buffer), kind,
+                                                     size, type, normalized));
+    // Reordering the positions keeps their bounds, and their dequantization
+    if (kind == VertexBuffer::PositionKind && hasQuantizedPositions) {
+      _positionDequantization = std::make_unique<Matrix>(dequantization);
+    }
+  }
+}
+
+bool Geometry::isInterleaved() const
+{
+  return !_interleavedBuffers.empty();
+}
+
+void Geometry::_releaseUnusedInterleavedBuffers()
+{
+  if (_interleavedBuffers.empty()) {
+    return;
+  }
+
+  // Kinds left out of a new layout may still read from a previous buffer
+  for (auto it = _interleavedBuffers.begin();
+       it != _interleavedBuffers.end();) {
+    auto glBuffer        = (*it)->getBuffer();
+    const auto stillUsed = std::any_of(
+      _vertexBuffers.begin(), _vertexBuffers.end(),
+      [glBuffer](const std::pair<const unsigned int,
+                                 std::unique_ptr<VertexBuffer>>& item) {
+        return item.second->getBuffer() == glBuffer;
+      });
+    if (stillUsed) {
+      ++it;
+    }
+    else {
+      (*it)->dispose();
+      it = _interleavedBuffers.erase(it);
+    }
+  }
+}
+
 void Geometry::_releaseVertexArrayObject(Effect* effect)
 {
   if (!effect || _vertexArrayObjects.empty()) {
@@ -450,8 +890,10 @@ void Geometry::applyToMesh(Mesh* mesh)
   if (isReady()) {
     _applyToMesh(mesh);
   }
-  else {
-    mesh->_boundingInfo = std::unique_ptr<BoundingInfo>(_boundingInfo.get());
+  else if (_boundingInfo) {
+    // Placeholder bounds until the vertex data is loaded
+    mesh->_boundingInfo = std::make_unique<BoundingInfo>(
+      _boundingInfo->minimum, _boundingInfo->maximum);
   }
 }
 
@@ -504,9 +946,8 @@ void Geometry::_applyToMesh(Mesh* mesh)
   }
 
   // indexBuffer
-  if (numOfMeshes == 1 && _indices.size() > 0) {
-    _indexBuffer
-      = std::unique_ptr<GL::IGLBuffer>(_engine->createIndexBuffer(_indices));
+  if (numOfMeshes == 1) {
+    _createIndexBuffer();
   }
   if (_indexBuffer) {
     _indexBuffer->references = numOfMeshes;
@@ -521,9 +962,18 @@ void Geometry::notifyUpdate(unsigned int kind)
 
   for (auto& mesh : _meshes) {
     mesh->_markSubMeshesAsAttributesDirty();
+    // The indices are updated with the position kind
+    if (mesh->_edgesRenderer && kind == VertexBuffer::PositionKind) {
+      mesh->_edgesRenderer->_markGeometryDirty();
+    }
   }
 }
 
+const std::vector<Mesh*>& Geometry::meshes() const
+{
+  return _meshes;
+}
+
 void Geometry::load(Scene* scene, const std::function<void()>& onLoaded)
 {
   if (delayLoadState == EngineConstants::DELAYLOADSTATE_LOADING) {
@@ -542,9 +992,43 @@ void Geometry::load(Scene* scene, const std::function<void()>& onLoaded)
   _queueLoad(scene, onLoaded);
 }
 
-void Geometry::_queueLoad(Scene* /*scene*/,
-                          const std::function<void()>& /*onLoaded*/)
+void Geometry::_queueLoad(Scene* scene, const std::function<void()>& onLoaded)
 {
+  if (delayLoadingFile.empty()) {
+    return;
+  }
+
+  scene->_addPendingData(this);
+  scene->geometryStreaming().queueLoad(
+    this,
+    [this, scene, onLoaded](const Json::value& parsedData,
+                            VertexData* vertexData) {
+      if (vertexData) {
+        setAllVerticesData(vertexData,
+                           Json::GetBool(parsedData, "updatable", false));
+      }
+      else if (_delayLoadingFunction) {
+        _delayLoadingFunction(parsedData, this);
+      }
+
+      delayLoadState = EngineConstants::DELAYLOADSTATE_LOADED;
+      _delayInfoKinds.clear();
+      scene->_removePendingData(this);
+
+      for (auto& mesh : _meshes) {
+        _applyToMesh(mesh);
+      }
+
+      if (onLoaded) {
+        onLoaded();
+      }
+    },
+    [this, scene](const std::string& msg) {
+      // Not retried, the meshes using the geometry are not rendered
+      BABYLON_LOG_ERROR("Geometry", msg);
+      delayLoadState = EngineConstants::DELAYLOADSTATE_LOADED;
+      scene->_removePendingData(this);
+    });
 }
 
 void Geometry::toLeftHanded()
@@ -620,6 +1104,11 @@ void Geometry::_disposeVertexArrayObjects()
 
 void Geometry::dispose(bool /*doNotRecurse*/)
 {
+  if (delayLoadState == EngineConstants::DELAYLOADSTATE_LOADING) {
+    _scene->geometryStreaming().cancelLoad(this);
+    _scene->_removePendingData(this);
+  }
+
   for (const auto& mesh : _meshes) {
     releaseForMesh(mesh);
   }
@@ -632,6 +1121,7 @@ void Geometry::dispose(bool /*doNotRecurse*/)
     _vertexBuffers[item.first].reset(nullptr);
   }
   _vertexBuffers.clear();
+  _vertexBuffersCache.clear();
   _totalVertices = 0;
 
   if (_indexBuffer) {
@@ -639,16 +1129,25 @@ void Geometry::dispose(bool /*doNotRecurse*/)
   }
   _indexBuffer = nullptr;
   _indices.clear();
+  _indices16.clear();
+
+  for (auto& interleavedBuffer : _interleavedBuffers) {
+    interleavedBuffer->dispose();
+  }
+  _interleavedBuffers.clear();
+  _is16BitIndices         = false;
+  _positionDequantization = nullptr;
 
   delayLoadState = EngineConstants::DELAYLOADSTATE_NONE;
   delayLoadingFile.clear();
   _delayLoadingFunction = nullptr;
-  _delayInfo.clear();
+  _delayInfoKinds.clear();
 
   _boundingInfo = nullptr;
 
-  _scene->removeGeometry(this);
+  // The scene owns the geometry, removing it from the scene deletes it
   _isDisposed = true;
+  _scene->removeGeometry(this);
 }
 
 Geometry* Geometry::copy(const std::string& iId)
@@ -682,7 +1181,7 @@ Geometry* Geometry::copy(const std::string& iId)
   geometry->delayLoadState        = delayLoadState;
   geometry->delayLoadingFile      = delayLoadingFile;
   geometry->_delayLoadingFunction = _delayLoadingFunction;
-  geometry->_delayInfo            = _delayInfo;
+  geometry->_delayInfoKinds       = _delayInfoKinds;
 
   // Bounding info
   geometry->_boundingInfo
@@ -829,7 +1328,7 @@ void Geometry::ImportGeometry(const Json::value& parsedGeometry, Mesh* mesh)
 }
 
 Geometry* Geometry::Parse(const Json::value& parsedVertexData, Scene* scene,
-                          const std::string& rootUrl)
+                          const std::string& rootUrl, VertexData* vertexData)
 {
   const auto parsedVertexDataId = Json::GetString(parsedVertexData, "id");
   if (parsedVertexDataId.empty()
@@ -889,7 +1388,13 @@ Geometry* Geometry::Parse(const Json::value& parsedVertexData, Scene* scene,
       geometry->_delayInfoKinds.emplace_back(VertexBuffer::MatricesWeightsKind);
     }
 
-    geometry->_delayLoadingFunction = VertexData::ImportVertexData;
+    geometry->_delayLoadingFunction
+      = [](const Json::value& parsedData, Geometry* target) {
+          VertexData::ImportVertexData(parsedData, target);
+        };
+  }
+  else if (vertexData) {
+    VertexData::ImportVertexData(parsedVertexData, *vertexData, geometry);
   }
   else {
     VertexData::ImportVertexData(parsedVertexData, geometry);
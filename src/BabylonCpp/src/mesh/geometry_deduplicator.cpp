@@ -0,0 +1,166 @@
+#include <babylon/mesh/geometry_deduplicator.h>
+
+#include <babylon/engine/engine_constants.h>
+#include <babylon/engine/scene.h>
+#include <babylon/mesh/geometry.h>
+#include <babylon/mesh/instanced_mesh.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/sub_mesh.h>
+
+namespace BABYLON {
+
+InstanceRenderingKey InstanceRenderingKey::FromMesh(Mesh* mesh)
+{
+  InstanceRenderingKey key;
+  key.geometry = mesh->geometry();
+  key.material = mesh->getMaterial();
+  for (const auto& subMesh : mesh->subMeshes) {
+    key.subMeshes.emplace_back(std::array<size_t, 5>{
+      {subMesh->materialIndex, subMesh->indexStart, subMesh->indexCount,
+       subMesh->verticesStart, subMesh->verticesCount}});
+  }
+  key.receiveShadows   = mesh->receiveShadows();
+  key.hasVertexAlpha   = mesh->hasVertexAlpha();
+  key.applyFog         = mesh->applyFog();
+  key.billboardMode    = mesh->billboardMode;
+  key.visibility       = mesh->visibility;
+  key.alphaIndex       = mesh->alphaIndex;
+  key.layerMask        = mesh->layerMask;
+  key.renderOverlay    = mesh->renderOverlay;
+  key.infiniteDistance = mesh->infiniteDistance;
+  return key;
+}
+
+bool InstanceRenderingKey::operator==(const InstanceRenderingKey& other) const
+{
+  return geometry == other.geometry && material == other.material
+         && subMeshes == other.subMeshes
+         && receiveShadows == other.receiveShadows
+         && hasVertexAlpha == other.hasVertexAlpha
+         && applyFog == other.applyFog && billboardMode == other.billboardMode
+         && visibility == other.visibility && alphaIndex == other.alphaIndex
+         && layerMask == other.layerMask
+         && renderOverlay == other.renderOverlay
+         && infiniteDistance == other.infiniteDistance;
+}
+
+GeometryDeduplicator::GeometryDeduplicator(Scene* scene)
+    : _scene{scene}, _mergedCount{0}
+{
+}
+
+GeometryDeduplicator::~GeometryDeduplicator()
+{
+}
+
+Geometry* GeometryDeduplicator::deduplicate(Geometry* geometry)
+{
+  // Delay loaded geometries have no data to compare yet
+  if (!geometry
+      || geometry->delayLoadState != EngineConstants::DELAYLOADSTATE_NONE
+      || geometry->getTotalVertices() == 0) {
+    return geometry;
+  }
+
+  auto& candidates = _geometries[geometry->getContentHash()];
+  for (auto& candidate : candidates) {
+    if (candidate->hasSameContent(*geometry)) {
+      _scene->addGeometryAlias(geometry->id, candidate);
+      geometry->dispose();
+      ++_mergedCount;
+      return candidate;
+    }
+  }
+
+  candidates.emplace_back(geometry);
+  return geometry;
+}
+
+size_t GeometryDeduplicator::mergedCount() const
+{
+  return _mergedCount;
+}
+
+bool GeometryDeduplicator::_canBeInstanced(Mesh* mesh)
+{
+  return mesh->type() == IReflect::Type::MESH && mesh->geometry()
+         && mesh->delayLoadState == EngineConstants::DELAYLOADSTATE_NONE
+         && !mesh->skeleton() && !mesh->morphTargetManager()
+         && mesh->animations.empty() && mesh->_waitingActions.empty()
+         && mesh->instances.empty() && !mesh->hasLODLevels();
+}
+
+size_t
+GeometryDeduplicator::ConvertToInstances(const std::vector<Mesh*>& meshes)
+{
+  std::vector<Mesh*> candidates;
+  std::vector<InstanceRenderingKey> keys;
+  for (auto& mesh : meshes) {
+    if (_canBeInstanced(mesh) && mesh->geometry()->getMeshCount() >= 2) {
+      candidates.emplace_back(mesh);
+      keys.emplace_back(InstanceRenderingKey::FromMesh(mesh));
+    }
+  }
+
+  const auto sources = FindInstanceSources(keys);
+  std::vector<Mesh*> toDispose;
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    if (sources[i] < 0) {
+      continue;
+    }
+
+    auto mesh     = candidates[i];
+    auto source   = candidates[static_cast<size_t>(sources[i])];
+    auto instance = source->createInstance(mesh->name);
+    instance->id  = mesh->id;
+    instance->setPosition(mesh->position());
+    if (mesh->rotationQuaternionSet()) {
+      instance->setRotationQuaternion(mesh->rotationQuaternion());
+    }
+    else {
+      instance->nullifyRotationQuaternion();
+      instance->setRotation(mesh->rotation());
+    }
+    instance->setScaling(mesh->scaling());
+    instance->setPivotMatrix(mesh->getPivotMatrix());
+    instance->setEnabled(mesh->isEnabled());
+    instance->isVisible       = mesh->isVisible;
+    instance->isPickable      = mesh->isPickable;
+    instance->isBlocker       = mesh->isBlocker;
+    instance->showBoundingBox = mesh->showBoundingBox;
+    instance->setCheckCollisions(mesh->checkCollisions());
+    instance->_waitingParentId          = mesh->_waitingParentId;
+    instance->_waitingFreezeWorldMatrix = mesh->_waitingFreezeWorldMatrix;
+
+    toDispose.emplace_back(mesh);
+  }
+
+  for (auto& mesh : toDispose) {
+    mesh->dispose();
+  }
+
+  return toDispose.size();
+}
+
+std::vector<int> GeometryDeduplicator::FindInstanceSources(
+  const std::vector<InstanceRenderingKey>& keys)
+{
+  std::vector<int> result(keys.size(), -1);
+  std::unordered_map<const Geometry*, std::vector<size_t>> sources;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    auto& geometrySources = sources[keys[i].geometry];
+    auto source          = std::find_if(
+      geometrySources.begin(), geometrySources.end(),
+      [&keys, i](size_t index) { return keys[index] == keys[i]; });
+    if (source == geometrySources.end()) {
+      geometrySources.emplace_back(i);
+    }
+    else {
+      result[i] = static_cast<int>(*source);
+    }
+  }
+
+  return result;
+}
+
+} // end of namespace BABYLON
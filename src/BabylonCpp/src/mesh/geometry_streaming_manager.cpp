@@ -0,0 +1,240 @@
+#include <babylon/mesh/geometry_streaming_manager.h>
+
+#include <babylon/cameras/camera.h>
+#include <babylon/core/mapped_file.h>
+#include <babylon/core/worker_pool.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engine/scene.h>
+#include <babylon/loading/plugins/babylon/babylon_binary_file.h>
+#include <babylon/mesh/geometry.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/vertex_data.h>
+
+namespace BABYLON {
+
+GeometryStreamingManager::GeometryStreamingManager(Scene* scene,
+                                                   size_t workerCount)
+    : maxConcurrentLoads{4}
+    , maxLoadsPerFrame{8}
+    , _scene{scene}
+    , _nextRequestId{0}
+    , _loadingCount{0}
+    , _tasks{
+        std::make_unique<WorkerTaskGroup>(WorkerPool::Create(workerCount))}
+{
+}
+
+GeometryStreamingManager::~GeometryStreamingManager()
+{
+  // Waits for the files being read
+  _tasks.reset();
+}
+
+void GeometryStreamingManager::queueLoad(Geometry* geometry,
+                                         const OnLoad& onLoad,
+                                         const OnError& onError)
+{
+  _queueLoad(geometry, nullptr, geometry->delayLoadingFile, onLoad, onError);
+}
+
+void GeometryStreamingManager::queueLoad(Mesh* mesh, const OnLoad& onLoad,
+                                         const OnError& onError)
+{
+  _queueLoad(nullptr, mesh, mesh->delayLoadingFile, onLoad, onError);
+}
+
+void GeometryStreamingManager::_queueLoad(Geometry* geometry, Mesh* mesh,
+                                          const std::string& url,
+                                          const OnLoad& onLoad,
+                                          const OnError& onError)
+{
+  Request request;
+  request.geometry   = geometry;
+  request.mesh       = mesh;
+  request.url        = url;
+  request.onLoad     = onLoad;
+  request.onError    = onError;
+  request.loading    = false;
+  request.screenSize = 0.f;
+  request.distance   = 0.f;
+  _requests.emplace(_nextRequestId++, std::move(request));
+}
+
+void GeometryStreamingManager::cancelLoad(Geometry* geometry)
+{
+  _cancelLoad([geometry](const Request& request) {
+    return request.geometry == geometry;
+  });
+}
+
+void GeometryStreamingManager::cancelLoad(Mesh* mesh)
+{
+  _cancelLoad([mesh](const Request& request) { return request.mesh == mesh; });
+}
+
+void GeometryStreamingManager::_cancelLoad(
+  const std::function<bool(const Request& request)>& match)
+{
+  // The result of a file being read is dropped once completed
+  for (auto it = _requests.begin(); it != _requests.end();) {
+    if (match(it->second)) {
+      if (it->second.loading) {
+        --_loadingCount;
+      }
+      it = _requests.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+}
+
+void GeometryStreamingManager::update()
+{
+  // Loaded files
+  LoadResult result;
+  size_t loadCount = 0;
+  while ((maxLoadsPerFrame == 0 || loadCount < maxLoadsPerFrame)
+         && _completed.tryAndPop(result)) {
+    auto it = _requests.find(result.requestId);
+    if (it == _requests.end()) {
+      continue;
+    }
+    auto request = std::move(it->second);
+    _requests.erase(it);
+    --_loadingCount;
+    ++loadCount;
+    if (result.error.empty()) {
+      if (request.onLoad) {
+        request.onLoad(*result.parsedData, result.vertexData.get());
+      }
+    }
+    else if (request.onError) {
+      request.onError(result.error);
+    }
+  }
+
+  if (_loadingCount >= maxConcurrentLoads
+      || _requests.size() == _loadingCount) {
+    return;
+  }
+
+  // Queued files, by decreasing screen size then increasing distance
+  std::vector<std::pair<size_t, Request*>> queued;
+  for (auto& item : _requests) {
+    if (!item.second.loading) {
+      _updatePriority(item.second);
+      queued.emplace_back(item.first, &item.second);
+    }
+  }
+  std::sort(queued.begin(), queued.end(),
+            [](const std::pair<size_t, Request*>& a,
+               const std::pair<size_t, Request*>& b) {
+              if (a.second->screenSize != b.second->screenSize) {
+                return a.second->screenSize > b.second->screenSize;
+              }
+              if (a.second->distance != b.second->distance) {
+                return a.second->distance < b.second->distance;
+              }
+              return a.first < b.first;
+            });
+
+  for (auto& item : queued) {
+    if (_loadingCount >= maxConcurrentLoads) {
+      break;
+    }
+    item.second->loading = true;
+    ++_loadingCount;
+
+    const auto requestId = item.first;
+    const auto url       = item.second->url;
+    _tasks->send([this, requestId, url]() {
+      LoadResult result;
+      result.requestId  = requestId;
+      result.parsedData = std::make_unique<Json::value>();
+      ReadFile(url, *result.parsedData, result.vertexData, result.error);
+      _completed.push(std::move(result));
+    });
+  }
+}
+
+void GeometryStreamingManager::_updatePriority(Request& request) const
+{
+  request.screenSize = 0.f;
+  request.distance   = std::numeric_limits<float>::max();
+  if (!_scene->activeCamera) {
+    return;
+  }
+
+  const auto& cameraPosition = _scene->activeCamera->globalPosition();
+  const auto updatePriority  = [&](Mesh* mesh) {
+    if (!mesh->getBoundingInfo()) {
+      return;
+    }
+    const auto& boundingSphere = mesh->getBoundingInfo()->boundingSphere;
+    request.screenSize
+      = std::max(request.screenSize, _scene->_getScreenSize(mesh));
+    request.distance = std::min(
+      request.distance,
+      Vector3::Distance(cameraPosition, boundingSphere.centerWorld));
+  };
+
+  if (request.mesh) {
+    updatePriority(request.mesh);
+  }
+  else if (request.geometry) {
+    for (auto& mesh : request.geometry->meshes()) {
+      updatePriority(mesh);
+    }
+  }
+}
+
+size_t GeometryStreamingManager::pendingCount() const
+{
+  return _requests.size();
+}
+
+size_t GeometryStreamingManager::workerCount() const
+{
+  return _tasks->workerCount();
+}
+
+bool GeometryStreamingManager::ReadFile(const std::string& url,
+                                        Json::value& parsedData,
+                                        std::unique_ptr<VertexData>& vertexData,
+                                        std::string& error)
+{
+  MappedFile file(url);
+  if (!file.isOpen()) {
+    error = "Error loading file " + url;
+    return false;
+  }
+
+  // Binary scene file, the vertex data is read from its blobs
+  if (BabylonBinaryFile::IsBinaryFile(file.data(), file.size())) {
+    BabylonBinaryFile binaryFile(file.data(), file.size());
+    const auto sceneGraph = binaryFile.sceneGraph();
+    if (!binaryFile.isValid()
+        || !Json::Parse(parsedData, sceneGraph.data(), sceneGraph.size())
+              .empty()) {
+      error = "Error parsing binary scene file " + url;
+      return false;
+    }
+    vertexData = binaryFile.getVertexData(parsedData);
+    if (!vertexData) {
+      error = "Error reading vertex data from file " + url;
+      return false;
+    }
+    return true;
+  }
+
+  const auto data = reinterpret_cast<const char*>(file.data());
+  if (!Json::Parse(parsedData, data, file.size()).empty()) {
+    error = "Error parsing file " + url;
+    return false;
+  }
+
+  return true;
+}
+
+} // end of namespace BABYLON
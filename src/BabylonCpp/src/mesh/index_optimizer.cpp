@@ -0,0 +1,375 @@
+#include <babylon/mesh/index_optimizer.h>
+
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+namespace {
+
+constexpr uint32_t InvalidVertex = std::numeric_limits<uint32_t>::max();
+
+/**
+ * @brief Clamps a range of indices to the indices, and to whole triangles.
+ */
+void clampRange(const IndicesArray& indices, size_t& indexStart,
+                size_t& indexCount)
+{
+  indexStart = std::min(indexStart, indices.size());
+  indexCount = std::min(indexCount, indices.size() - indexStart) / 3 * 3;
+}
+
+/**
+ * @brief Returns the smallest index of a range of indices, and the number of
+ * vertices up to the largest one.
+ */
+uint32_t vertexRange(const IndicesArray& indices, size_t indexStart,
+                     size_t indexCount, size_t& vertexCount)
+{
+  const auto range
+    = std::minmax_element(indices.begin() + indexStart,
+                          indices.begin() + indexStart + indexCount);
+  vertexCount = *range.second - *range.first + 1;
+  return *range.first;
+}
+
+/**
+ * @brief FIFO vertex cache, a vertex being in the cache while less than size
+ * vertices were added after it.
+ */
+class FifoCache {
+
+public:
+  FifoCache(size_t size, size_t vertexCount)
+      : _size{size}
+      , _time{size + 1}
+      , _timestamps(vertexCount, 0)
+  {
+  }
+
+  /**
+   * @brief Returns the age of a vertex, larger than the size of the cache
+   * when the vertex is not in the cache.
+   */
+  size_t age(uint32_t vertex) const
+  {
+    return _time - _timestamps[vertex];
+  }
+
+  /**
+   * @brief Adds a vertex to the cache when missing.
+   * @returns Whether the vertex was missing.
+   */
+  bool access(uint32_t vertex)
+  {
+    if (age(vertex) <= _size) {
+      return false;
+    }
+    _timestamps[vertex] = _time++;
+    return true;
+  }
+
+  void clear()
+  {
+    _time += _size + 1;
+  }
+
+private:
+  size_t _size;
+  size_t _time;
+  std::vector<size_t> _timestamps;
+
+}; // end of class FifoCache
+
+} // end of anonymous namespace
+
+IndexOptimizer::VertexCacheStatistics
+IndexOptimizer::AnalyzeVertexCache(const IndicesArray& indices,
+                                   size_t indexStart, size_t indexCount,
+                                   size_t cacheSize)
+{
+  VertexCacheStatistics statistics{0, 0.f, 0.f};
+  clampRange(indices, indexStart, indexCount);
+  if (indexCount == 0) {
+    return statistics;
+  }
+
+  size_t vertexCount = 0;
+  const auto firstVertex
+    = vertexRange(indices, indexStart, indexCount, vertexCount);
+  FifoCache cache(cacheSize, vertexCount);
+  std::vector<bool> used(vertexCount, false);
+  size_t usedCount = 0;
+  for (size_t i = indexStart; i < indexStart + indexCount; ++i) {
+    const auto vertex = indices[i] - firstVertex;
+    if (cache.access(vertex)) {
+      ++statistics.transformedVertices;
+    }
+    if (!used[vertex]) {
+      used[vertex] = true;
+      ++usedCount;
+    }
+  }
+
+  statistics.acmr = static_cast<float>(statistics.transformedVertices)
+                    / static_cast<float>(indexCount / 3);
+  statistics.atvr = static_cast<float>(statistics.transformedVertices)
+                    / static_cast<float>(usedCount);
+  return statistics;
+}
+
+void IndexOptimizer::OptimizeVertexCache(IndicesArray& indices,
+                                         size_t indexStart, size_t indexCount,
+                                         size_t cacheSize)
+{
+  clampRange(indices, indexStart, indexCount);
+  if (indexCount < 6) {
+    return;
+  }
+
+  const auto triangles     = indices.begin() + indexStart;
+  const auto triangleCount = indexCount / 3;
+  size_t vertexCount       = 0;
+  const auto firstVertex
+    = vertexRange(indices, indexStart, indexCount, vertexCount);
+
+  // Triangles of each vertex, and number of triangles of each vertex not
+  // emitted yet
+  std::vector<uint32_t> liveCounts(vertexCount, 0);
+  std::vector<uint32_t> offsets(vertexCount + 1, 0);
+  std::vector<uint32_t> adjacency(indexCount);
+  for (size_t i = 0; i < indexCount; ++i) {
+    ++liveCounts[triangles[i] - firstVertex];
+  }
+  for (size_t i = 0; i < vertexCount; ++i) {
+    offsets[i + 1] = offsets[i] + liveCounts[i];
+  }
+  {
+    auto cursors = offsets;
+    for (size_t i = 0; i < indexCount; ++i) {
+      adjacency[cursors[triangles[i] - firstVertex]++]
+        = static_cast<uint32_t>(i / 3);
+    }
+  }
+
+  // Fans around the vertex staying the longest in the cache after its fan,
+  // the dead ends restarting from the last vertices with triangles left
+  FifoCache cache(cacheSize, vertexCount);
+  std::vector<bool> emitted(triangleCount, false);
+  std::vector<uint32_t> deadEnds, candidates;
+  deadEnds.reserve(indexCount);
+  IndicesArray output;
+  output.reserve(indexCount);
+  uint32_t fanning = triangles[0] - firstVertex;
+  uint32_t cursor  = 0;
+  while (fanning != InvalidVertex) {
+    candidates.clear();
+    for (auto i = offsets[fanning]; i < offsets[fanning + 1]; ++i) {
+      const auto triangle = adjacency[i];
+      if (emitted[triangle]) {
+        continue;
+      }
+      emitted[triangle] = true;
+      for (size_t j = 0; j < 3; ++j) {
+        const auto index  = triangles[triangle * 3 + j];
+        const auto vertex = index - firstVertex;
+        output.emplace_back(index);
+        deadEnds.emplace_back(vertex);
+        candidates.emplace_back(vertex);
+        --liveCounts[vertex];
+        cache.access(vertex);
+      }
+    }
+
+    fanning             = InvalidVertex;
+    size_t bestPriority = 0;
+    for (auto vertex : candidates) {
+      if (liveCounts[vertex] == 0) {
+        continue;
+      }
+      // Vertices leaving the cache during their fan have the lowest priority
+      size_t priority = 0;
+      if (cache.age(vertex) + 2 * liveCounts[vertex] <= cacheSize) {
+        priority = cache.age(vertex);
+      }
+      if (fanning == InvalidVertex || priority > bestPriority) {
+        fanning      = vertex;
+        bestPriority = priority;
+      }
+    }
+    while (fanning == InvalidVertex && !deadEnds.empty()) {
+      if (liveCounts[deadEnds.back()] > 0) {
+        fanning = deadEnds.back();
+      }
+      deadEnds.pop_back();
+    }
+    while (fanning == InvalidVertex && cursor < vertexCount) {
+      if (liveCounts[cursor] > 0) {
+        fanning = cursor;
+      }
+      ++cursor;
+    }
+  }
+
+  std::copy(output.begin(), output.end(), triangles);
+}
+
+void IndexOptimizer::OptimizeOverdraw(IndicesArray& indices, size_t indexStart,
+                                      size_t indexCount,
+                                      const Float32Array& positions,
+                                      float threshold, size_t cacheSize)
+{
+  clampRange(indices, indexStart, indexCount);
+  if (indexCount < 6) {
+    return;
+  }
+
+  const auto triangles     = indices.begin() + indexStart;
+  const auto triangleCount = indexCount / 3;
+  size_t vertexCount       = 0;
+  const auto firstVertex
+    = vertexRange(indices, indexStart, indexCount, vertexCount);
+  if (positions.size() < (firstVertex + vertexCount) * 3) {
+    return;
+  }
+
+  const auto accessTriangle = [&](FifoCache& cache, size_t triangle) {
+    size_t misses = 0;
+    for (size_t j = 0; j < 3; ++j) {
+      if (cache.access(triangles[triangle * 3 + j] - firstVertex)) {
+        ++misses;
+      }
+    }
+    return misses;
+  };
+
+  // Hard boundaries, where the cache starts again, at the triangles whose
+  // vertices all miss the cache
+  FifoCache cache(cacheSize, vertexCount);
+  std::vector<size_t> hardBoundaries;
+  size_t misses = 0;
+  for (size_t i = 0; i < triangleCount; ++i) {
+    const auto triangleMisses = accessTriangle(cache, i);
+    if (triangleMisses == 3) {
+      hardBoundaries.emplace_back(i);
+    }
+    misses += triangleMisses;
+  }
+  hardBoundaries.emplace_back(triangleCount);
+  const float acmr
+    = static_cast<float>(misses) / static_cast<float>(triangleCount);
+
+  // Soft boundaries, splitting the clusters once their own ACMR, the cache
+  // starting empty, is close enough to the one of the range
+  std::vector<size_t> clusters;
+  for (size_t i = 0; i + 1 < hardBoundaries.size(); ++i) {
+    const auto end       = hardBoundaries[i + 1];
+    size_t start         = hardBoundaries[i];
+    size_t clusterMisses = 0;
+    cache.clear();
+    clusters.emplace_back(start);
+    for (auto triangle = start; triangle < end; ++triangle) {
+      clusterMisses += accessTriangle(cache, triangle);
+      const auto count = static_cast<float>(triangle - start + 1);
+      if (triangle + 1 < end
+          && static_cast<float>(clusterMisses) <= threshold * acmr * count) {
+        start         = triangle + 1;
+        clusterMisses = 0;
+        cache.clear();
+        clusters.emplace_back(start);
+      }
+    }
+  }
+  clusters.emplace_back(triangleCount);
+
+  // Clusters sorted by decreasing distance of their center to the center of
+  // the range along their normal, the outer ones first
+  const auto position = [&](size_t index) {
+    const auto offset = static_cast<size_t>(triangles[index]) * 3;
+    return Vector3(positions[offset], positions[offset + 1],
+                   positions[offset + 2]);
+  };
+  const size_t clusterCount = clusters.size() - 1;
+  std::vector<Vector3> centers(clusterCount), normals(clusterCount);
+  std::vector<float> areas(clusterCount, 0.f);
+  Vector3 center;
+  float area = 0.f;
+  for (size_t c = 0; c < clusterCount; ++c) {
+    for (auto triangle = clusters[c]; triangle < clusters[c + 1]; ++triangle) {
+      const auto p0 = position(triangle * 3);
+      const auto p1 = position(triangle * 3 + 1);
+      const auto p2 = position(triangle * 3 + 2);
+      const auto normal = Vector3::Cross(p1.subtract(p0), p2.subtract(p0));
+      const float triangleArea = normal.length() * 0.5f;
+      centers[c].addInPlace(
+        p0.add(p1).addInPlace(p2).scaleInPlace(triangleArea / 3.f));
+      normals[c].addInPlace(normal);
+      areas[c] += triangleArea;
+    }
+    center.addInPlace(centers[c]);
+    area += areas[c];
+    if (areas[c] > 0.f) {
+      centers[c].scaleInPlace(1.f / areas[c]);
+    }
+    normals[c].normalize();
+  }
+  if (area > 0.f) {
+    center.scaleInPlace(1.f / area);
+  }
+
+  std::vector<float> keys(clusterCount);
+  std::vector<size_t> order(clusterCount);
+  for (size_t c = 0; c < clusterCount; ++c) {
+    keys[c]  = Vector3::Dot(centers[c].subtract(center), normals[c]);
+    order[c] = c;
+  }
+  std::stable_sort(order.begin(), order.end(),
+                   [&keys](size_t a, size_t b) { return keys[a] > keys[b]; });
+
+  IndicesArray output;
+  output.reserve(indexCount);
+  for (auto c : order) {
+    output.insert(output.end(), triangles + clusters[c] * 3,
+                  triangles + clusters[c + 1] * 3);
+  }
+  std::copy(output.begin(), output.end(), triangles);
+}
+
+Uint32Array IndexOptimizer::OptimizeVertexFetch(IndicesArray& indices,
+                                                size_t vertexCount)
+{
+  Uint32Array remap(vertexCount, InvalidVertex);
+  uint32_t next = 0;
+  for (auto& index : indices) {
+    if (index >= vertexCount) {
+      continue;
+    }
+    if (remap[index] == InvalidVertex) {
+      remap[index] = next++;
+    }
+    index = remap[index];
+  }
+  for (auto& index : remap) {
+    if (index == InvalidVertex) {
+      index = next++;
+    }
+  }
+  return remap;
+}
+
+void IndexOptimizer::RemapVertexBuffer(Float32Array& vertices, size_t stride,
+                                       const Uint32Array& remap)
+{
+  if (stride == 0 || vertices.size() < remap.size() * stride) {
+    return;
+  }
+
+  Float32Array remapped(vertices);
+  for (size_t i = 0; i < remap.size(); ++i) {
+    std::copy(vertices.begin() + i * stride,
+              vertices.begin() + (i + 1) * stride,
+              remapped.begin() + remap[i] * stride);
+  }
+  vertices.swap(remapped);
+}
+
+} // end of namespace BABYLON
@@ -85,6 +85,11 @@ Float32Array InstancedMesh::getVerticesData(unsigned int kind,
   return _sourceMesh->getVerticesData(kind, copyWhenShared, forceCopy);
 }
 
+span<const float> InstancedMesh::getVerticesDataView(unsigned int kind)
+{
+  return _sourceMesh->getVerticesDataView(kind);
+}
+
 Mesh* InstancedMesh::setVerticesData(unsigned int kind,
                                      const Float32Array& data, bool updatable,
                                      int stride)
@@ -124,6 +129,11 @@ IndicesArray InstancedMesh::getIndices(bool /*copyWhenShared*/)
   return _sourceMesh->getIndices();
 }
 
+IndicesView InstancedMesh::getIndicesView()
+{
+  return _sourceMesh->getIndicesView();
+}
+
 std::vector<Vector3>& InstancedMesh::_positions()
 {
   return _sourceMesh->_positions();
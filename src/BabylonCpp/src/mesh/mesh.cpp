@@ -23,10 +23,13 @@
 #include <babylon/mesh/_visible_instances.h>
 #include <babylon/mesh/buffer.h>
 #include <babylon/mesh/geometry.h>
+#include <babylon/mesh/geometry_streaming_manager.h>
 #include <babylon/mesh/ground_mesh.h>
+#include <babylon/mesh/index_optimizer.h>
 #include <babylon/mesh/instanced_mesh.h>
 #include <babylon/mesh/mesh_builder.h>
 #include <babylon/mesh/mesh_lod_level.h>
+#include <babylon/mesh/simplification/simplification_queue.h>
 #include <babylon/mesh/vertex_buffer.h>
 #include <babylon/mesh/vertex_data.h>
 #include <babylon/mesh/vertex_data_options.h>
@@ -179,12 +182,14 @@ std::string Mesh::toString(bool fullDetails)
   }
 
   if (fullDetails) {
-    oss << ", flat shading: "
-        << (_geometry ? (getVerticesData(VertexBuffer::PositionKind).size() / 3
-                             == getIndices().size() ?
-                           "YES" :
-                           "NO") :
-                        "UNKNOWN");
+    oss << ", flat shading: ";
+    if (_geometry) {
+      const auto positions = getVerticesDataView(VertexBuffer::PositionKind);
+      oss << (positions.size() / 3 == getIndicesView().size() ? "YES" : "NO");
+    }
+    else {
+      oss << "UNKNOWN";
+    }
   }
   return oss.str();
 }
@@ -332,6 +337,38 @@ Float32Array Mesh::getVerticesData(unsigned int kind, bool copyWhenShared,
   return _geometry->getVerticesData(kind, copyWhenShared, forceCopy);
 }
 
+span<const float> Mesh::getVerticesDataView(unsigned int kind)
+{
+  if (!_geometry) {
+    return span<const float>();
+  }
+  return _geometry->getVerticesDataView(kind);
+}
+
+span<float> Mesh::getMutableVerticesDataView(unsigned int kind)
+{
+  if (!_geometry) {
+    return span<float>();
+  }
+  // Copy-on-write
+  if (_geometry->getMeshCount() > 1) {
+    makeGeometryUnique();
+  }
+  return _geometry->getMutableVerticesDataView(kind);
+}
+
+Mesh& Mesh::markVerticesDataAsUpdated(unsigned int kind, bool updateExtends)
+{
+  auto vertexBuffer = getVertexBuffer(kind);
+  if (!vertexBuffer || !vertexBuffer->isUpdatable()) {
+    return *this;
+  }
+
+  _geometry->updateVerticesData(kind, vertexBuffer->getData(), updateExtends);
+
+  return *this;
+}
+
 VertexBuffer* Mesh::getVertexBuffer(unsigned int kind)
 {
   if (!_geometry) {
@@ -343,11 +380,9 @@ VertexBuffer* Mesh::getVertexBuffer(unsigned int kind)
 bool Mesh::isVerticesDataPresent(unsigned int kind)
 {
   if (!_geometry) {
-    if (!_delayInfo.empty()) {
-      return std::find_if(
-               _delayInfo.begin(), _delayInfo.end(),
-               [&](VertexBuffer* item) { return item->getKind() == kind; })
-             != _delayInfo.end();
+    if (!_delayInfoKinds.empty()) {
+      return std::find(_delayInfoKinds.begin(), _delayInfoKinds.end(), kind)
+             != _delayInfoKinds.end();
     }
     return false;
   }
@@ -359,9 +394,9 @@ Uint32Array Mesh::getVerticesDataKinds()
 {
   if (!_geometry) {
     Uint32Array result;
-    if (!_delayInfo.empty()) {
-      for (auto& vertexBuffer : _delayInfo) {
-        result.emplace_back(vertexBuffer->getKind());
+    if (!_delayInfoKinds.empty()) {
+      for (auto& kind : _delayInfoKinds) {
+        result.emplace_back(kind);
       }
     }
     return result;
@@ -385,6 +420,14 @@ IndicesArray Mesh::getIndices(bool copyWhenShared)
   return _geometry->getIndices(copyWhenShared);
 }
 
+IndicesView Mesh::getIndicesView()
+{
+  if (!_geometry) {
+    return IndicesView();
+  }
+  return _geometry->getIndicesView();
+}
+
 bool Mesh::isBlocked()
 {
   return _masterMesh != nullptr;
@@ -626,6 +669,40 @@ Mesh& Mesh::makeGeometryUnique()
   return *this;
 }
 
+Mesh& Mesh::quantizeVertexData(bool quantizePositions)
+{
+  if (!_geometry) {
+    return *this;
+  }
+
+  _geometry->quantize(quantizePositions && !skeleton()
+                      && !_morphTargetManager);
+
+  return *this;
+}
+
+Mesh& Mesh::interleaveVertexData()
+{
+  if (_geometry) {
+    _geometry->interleave();
+  }
+
+  return *this;
+}
+
+Matrix Mesh::_applyPositionDequantization(const Matrix& world)
+{
+  auto dequantization = _geometry ? _geometry->positionDequantization() :
+                                    nullptr;
+  if (!dequantization) {
+    return world;
+  }
+
+  Matrix result;
+  dequantization->multiplyToRef(world, result);
+  return result;
+}
+
 Mesh* Mesh::setIndices(const IndicesArray& indices, size_t totalVertices)
 {
   if (!_geometry) {
@@ -643,6 +720,17 @@ Mesh* Mesh::setIndices(const IndicesArray& indices, size_t totalVertices)
   return this;
 }
 
+Mesh* Mesh::setIndices(const Uint16Array& indices, size_t totalVertices)
+{
+  if (!_geometry) {
+    return setIndices(VertexData::ToIndicesArray(indices), totalVertices);
+  }
+
+  _geometry->setIndices(indices, totalVertices);
+
+  return this;
+}
+
 Mesh& Mesh::toLeftHanded()
 {
   if (!_geometry) {
@@ -670,7 +758,7 @@ void Mesh::_bind(SubMesh* subMesh, Effect* effect, unsigned int fillMode)
         indexToBind = nullptr;
         break;
       case Material::WireFrameFillMode:
-        indexToBind = subMesh->getLinesIndexBuffer(getIndices(), engine);
+        indexToBind = subMesh->getLinesIndexBuffer(getIndicesView(), engine);
         break;
       default:
       case Material::TriangleFillMode:
@@ -826,9 +914,9 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, int fillMode,
   unsigned int offset         = 0;
   unsigned int instancesCount = 0;
 
-  auto world = getWorldMatrix();
+  auto world = _applyPositionDequantization(*getWorldMatrix());
   if (batch->renderSelf[subMesh->_id]) {
-    world->copyToArray(_instancesData, offset);
+    world.copyToArray(_instancesData, offset);
     offset += 16;
     instancesCount++;
   }
@@ -837,7 +925,8 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, int fillMode,
     for (size_t instanceIndex = 0; instanceIndex < visibleInstances.size();
          ++instanceIndex) {
       InstancedMesh* instance = visibleInstances[instanceIndex];
-      instance->getWorldMatrix()->copyToArray(_instancesData, offset);
+      _applyPositionDequantization(*instance->getWorldMatrix())
+        .copyToArray(_instancesData, offset);
       offset += 16;
       ++instancesCount;
     }
@@ -891,7 +980,8 @@ Mesh& Mesh::_processRendering(SubMesh* subMesh, Effect* effect, int fillMode,
     if (batch->renderSelf[subMesh->_id]) {
       // Draw
       if (onBeforeDraw) {
-        onBeforeDraw(false, *getWorldMatrix(), effectiveMaterial);
+        onBeforeDraw(false, _applyPositionDequantization(*getWorldMatrix()),
+                     effectiveMaterial);
       }
 
       _draw(subMesh, fillMode, _overridenInstanceCount);
@@ -900,9 +990,9 @@ Mesh& Mesh::_processRendering(SubMesh* subMesh, Effect* effect, int fillMode,
     if (!batch->visibleInstances[subMesh->_id].empty()) {
       for (auto& instance : batch->visibleInstances[subMesh->_id]) {
         // World
-        Matrix* world = instance->getWorldMatrix();
+        auto world = _applyPositionDequantization(*instance->getWorldMatrix());
         if (onBeforeDraw) {
-          onBeforeDraw(true, *world, effectiveMaterial);
+          onBeforeDraw(true, world, effectiveMaterial);
         }
 
         // Draw
@@ -982,13 +1072,13 @@ Mesh& Mesh::render(SubMesh* subMesh, bool enableAlphaMode)
                                              effectiveMaterial->fillMode());
   _bind(subMesh, effect, fillMode);
 
-  auto _world = getWorldMatrix();
+  auto _world = _applyPositionDequantization(*getWorldMatrix());
 
   if (effectiveMaterial->storeEffectOnSubMeshes) {
-    effectiveMaterial->bindForSubMesh(_world, this, subMesh);
+    effectiveMaterial->bindForSubMesh(&_world, this, subMesh);
   }
   else {
-    effectiveMaterial->bind(_world, this);
+    effectiveMaterial->bind(&_world, this);
   }
 
   // Alpha mode
@@ -1097,6 +1187,32 @@ Mesh& Mesh::_checkDelayState()
 Mesh& Mesh::_queueLoad(Mesh* mesh, Scene* scene)
 {
   scene->_addPendingData(mesh);
+  scene->geometryStreaming().queueLoad(
+    mesh,
+    [this, scene](const Json::value& parsedData, VertexData* vertexData) {
+      // The delay loading function then only parses the sub meshes
+      if (vertexData) {
+        vertexData->applyToMesh(this, false);
+      }
+      if (_delayLoadingFunction) {
+        _delayLoadingFunction(parsedData, this);
+      }
+
+      for (auto& instance : instances) {
+        instance->_syncSubMeshes();
+      }
+
+      delayLoadState = EngineConstants::DELAYLOADSTATE_LOADED;
+      _delayInfoKinds.clear();
+      scene->_removePendingData(this);
+    },
+    [this, scene](const std::string& msg) {
+      // Not retried, the mesh is not rendered
+      BABYLON_LOG_ERROR("Mesh", msg);
+      delayLoadState = EngineConstants::DELAYLOADSTATE_LOADED;
+      scene->_removePendingData(this);
+    });
+
   return *this;
 }
 
@@ -1251,6 +1367,14 @@ Mesh* Mesh::clone(const std::string& iName, Node* newParent,
 
 void Mesh::dispose(bool /*doNotRecurse*/)
 {
+  if (delayLoadState == EngineConstants::DELAYLOADSTATE_LOADING) {
+    getScene()->geometryStreaming().cancelLoad(this);
+    getScene()->_removePendingData(this);
+  }
+  if (getScene()->simplificationQueue) {
+    getScene()->simplificationQueue->cancelTasks(this);
+  }
+
   setMorphTargetManager(nullptr);
 
   if (_geometry) {
@@ -1564,20 +1688,121 @@ Mesh& Mesh::synchronizeInstances()
   return *this;
 }
 
-/*void Mesh::simplify(
-  const std::vector<ISimplificationSettings*>& settings,
+Mesh& Mesh::simplify(
+  const std::vector<ISimplificationSettings>& settings,
   bool parallelProcessing, SimplificationType simplificationType,
-  std::function<void(Mesh* mesh, int submeshIndex)>& successCallback)
-{
-  settings(nullptr);
-  std::cout << parallelProcessing << simplificationType;
-  successCallback(nullptr, 0);
-}*/
+  const std::function<void(Mesh* mesh, int submeshIndex)>& successCallback)
+{
+  ISimplificationTask task;
+  task.settings           = settings;
+  task.simplificationType = simplificationType;
+  task.mesh               = this;
+  task.parallelProcessing = parallelProcessing;
+  task.successCallback    = [this, successCallback]() {
+    if (!successCallback) {
+      return;
+    }
+    // The submeshes are simplified together, all the triangles being one
+    // submesh when the mesh has none
+    const auto subMeshCount = std::max(subMeshes.size(), size_t(1));
+    for (size_t i = 0; i < subMeshCount; ++i) {
+      successCallback(this, static_cast<int>(i));
+    }
+  };
+  getScene()->getSimplificationQueue().addTask(task);
+  return *this;
+}
 
 void Mesh::optimizeIndices(
-  const std::function<void(Mesh* mesh)>& successCallback)
-{
-  successCallback(nullptr);
+  const std::function<void(Mesh* mesh)>& successCallback,
+  bool optimizeOverdraw)
+{
+  auto indices             = getIndices();
+  const auto totalVertices = getTotalVertices();
+  if (!_geometry || indices.empty() || totalVertices == 0) {
+    if (successCallback) {
+      successCallback(this);
+    }
+    return;
+  }
+
+  struct SubMeshRange {
+    Mesh* mesh;
+    unsigned int materialIndex;
+    unsigned int verticesStart;
+    size_t verticesCount;
+    unsigned int indexStart;
+    size_t indexCount;
+  }; // end of struct SubMeshRange
+
+  // Submeshes of the meshes of the geometry, recreated once the indices are
+  // set
+  std::vector<SubMeshRange> subMeshRanges;
+  bool remapVertices = true;
+  for (auto mesh : _geometry->meshes()) {
+    remapVertices = remapVertices && !mesh->morphTargetManager();
+    for (const auto& subMesh : mesh->subMeshes) {
+      subMeshRanges.emplace_back(SubMeshRange{
+        mesh, subMesh->materialIndex, subMesh->verticesStart,
+        subMesh->verticesCount, subMesh->indexStart, subMesh->indexCount});
+    }
+  }
+
+  const auto positions = getVerticesData(VertexBuffer::PositionKind);
+  for (const auto& range : subMeshRanges) {
+    if (range.mesh != this) {
+      continue;
+    }
+    const auto before = IndexOptimizer::AnalyzeVertexCache(
+      indices, range.indexStart, range.indexCount);
+    IndexOptimizer::OptimizeVertexCache(indices, range.indexStart,
+                                        range.indexCount);
+    if (optimizeOverdraw) {
+      IndexOptimizer::OptimizeOverdraw(indices, range.indexStart,
+                                       range.indexCount, positions);
+    }
+    const auto after = IndexOptimizer::AnalyzeVertexCache(
+      indices, range.indexStart, range.indexCount);
+    BABYLON_LOG_DEBUG("Mesh", name, " indices ", range.indexStart, "-",
+                      range.indexStart + range.indexCount, ": ACMR ",
+                      before.acmr, " -> ", after.acmr, ", ATVR ", before.atvr,
+                      " -> ", after.atvr);
+  }
+
+  // Vertices in first use order
+  const auto kinds = getVerticesDataKinds();
+  for (auto kind : kinds) {
+    remapVertices = remapVertices && !getVertexBuffer(kind)->isShared();
+  }
+  if (remapVertices) {
+    const auto remap
+      = IndexOptimizer::OptimizeVertexFetch(indices, totalVertices);
+    _geometry->remapVertices(remap);
+  }
+
+  setIndices(indices, totalVertices);
+
+  for (auto mesh : _geometry->meshes()) {
+    mesh->releaseSubMeshes();
+  }
+  for (auto& range : subMeshRanges) {
+    if (remapVertices && range.indexCount > 0) {
+      const auto first = indices.begin() + range.indexStart;
+      const auto extents
+        = std::minmax_element(first, first + range.indexCount);
+      range.verticesStart = *extents.first;
+      range.verticesCount = *extents.second - *extents.first + 1;
+    }
+    SubMesh::New(range.materialIndex, range.verticesStart, range.verticesCount,
+                 range.indexStart, range.indexCount, range.mesh);
+  }
+  if (isFacetDataEnabled()) {
+    updateFacetData();
+  }
+
+  if (successCallback) {
+    successCallback(this);
+  }
 }
 
 void Mesh::_syncGeometryWithMorphTargetManager()
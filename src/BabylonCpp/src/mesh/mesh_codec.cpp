@@ -0,0 +1,483 @@
+#include <babylon/mesh/mesh_codec.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define BABYLON_MESH_CODEC_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+// Vertex buffer: magic, stride and vertex count, then the blocks
+constexpr size_t VertexHeaderSize = 12;
+// Index buffer: magic and index count, then one code byte per triangle and the
+// explicit vertices
+constexpr size_t IndexHeaderSize = 8;
+// Number of vertices of a block, the size of a byte plane group
+constexpr size_t BlockSize = 16;
+// Size of a group of 16 bytes stored with 0, 2, 4 or 8 bits per byte
+constexpr std::array<size_t, 4> GroupSizes{{0, 4, 8, 16}};
+// Number of edges of the edge FIFO searched for a shared edge
+constexpr size_t EdgeFifoSize = 15;
+
+template <typename T>
+T read(const uint8_t* data)
+{
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return value;
+}
+
+template <typename T>
+void write(Uint8Array& data, size_t offset, T value)
+{
+  std::memcpy(&data[offset], &value, sizeof(T));
+}
+
+uint32_t zigzag(uint32_t value)
+{
+  return (value << 1) ^ (0u - (value >> 31));
+}
+
+uint32_t unzigzag(uint32_t value)
+{
+  return (value >> 1) ^ (0u - (value & 1));
+}
+
+// Rounds the mantissa of the bits of a float to mantissaBits bits
+uint32_t roundMantissa(uint32_t bits, unsigned int mantissaBits)
+{
+  static constexpr uint32_t ExponentMask = 0x7f800000u;
+  if (mantissaBits >= 23 || (bits & ExponentMask) == ExponentMask) {
+    return bits;
+  }
+
+  const unsigned int dropped = 23 - mantissaBits;
+  const uint32_t mask        = (1u << dropped) - 1;
+  const uint32_t rounded     = (bits + (1u << (dropped - 1))) & ~mask;
+  // Values rounded up to infinity are truncated instead
+  return ((rounded & ExponentMask) == ExponentMask) ? (bits & ~mask) : rounded;
+}
+
+// Appends a group of 16 bytes with the smallest number of bits per byte,
+// returns the mode of the group
+unsigned int encodeGroup(const uint8_t* group, Uint8Array& result)
+{
+  const auto maximum = *std::max_element(group, group + BlockSize);
+  if (maximum == 0) {
+    return 0;
+  }
+  else if (maximum < 4) {
+    for (size_t i = 0; i < BlockSize; i += 4) {
+      result.emplace_back(static_cast<uint8_t>(
+        group[i] | (group[i + 1] << 2) | (group[i + 2] << 4)
+        | (group[i + 3] << 6)));
+    }
+    return 1;
+  }
+  else if (maximum < 16) {
+    for (size_t i = 0; i < BlockSize; i += 2) {
+      result.emplace_back(static_cast<uint8_t>(group[i] | (group[i + 1] << 4)));
+    }
+    return 2;
+  }
+  result.insert(result.end(), group, group + BlockSize);
+  return 3;
+}
+
+#ifdef BABYLON_MESH_CODEC_SSE2
+
+__m128i decodeGroup(const uint8_t* data, unsigned int mode)
+{
+  switch (mode) {
+    case 1: {
+      // Element 4i + j holds the bits 2j of byte i
+      const auto x    = _mm_cvtsi32_si128(read<int32_t>(data));
+      const auto mask = _mm_set1_epi8(3);
+      const auto v0   = _mm_and_si128(x, mask);
+      const auto v1   = _mm_and_si128(_mm_srli_epi16(x, 2), mask);
+      const auto v2   = _mm_and_si128(_mm_srli_epi16(x, 4), mask);
+      const auto v3   = _mm_and_si128(_mm_srli_epi16(x, 6), mask);
+      return _mm_unpacklo_epi16(_mm_unpacklo_epi8(v0, v1),
+                                _mm_unpacklo_epi8(v2, v3));
+    }
+    case 2: {
+      // Element 2i + j holds the bits 4j of byte i
+      const auto x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data));
+      const auto mask = _mm_set1_epi8(15);
+      return _mm_unpacklo_epi8(_mm_and_si128(x, mask),
+                               _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+    }
+    case 3:
+      return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    default:
+      return _mm_setzero_si128();
+  }
+}
+
+// Unzigzags and accumulates 4 deltas
+__m128i decodeDeltas(__m128i z, __m128i& last)
+{
+  const auto sign = _mm_sub_epi32(_mm_setzero_si128(),
+                                  _mm_and_si128(z, _mm_set1_epi32(1)));
+  auto d          = _mm_xor_si128(_mm_srli_epi32(z, 1), sign);
+  d = _mm_add_epi32(d, _mm_slli_si128(d, 4));
+  d = _mm_add_epi32(d, _mm_slli_si128(d, 8));
+  d = _mm_add_epi32(d, last);
+  last = _mm_shuffle_epi32(d, _MM_SHUFFLE(3, 3, 3, 3));
+  return d;
+}
+
+#else
+
+void decodeGroup(const uint8_t* data, unsigned int mode, uint8_t* group)
+{
+  switch (mode) {
+    case 1:
+      for (size_t i = 0; i < BlockSize; ++i) {
+        group[i] = (data[i / 4] >> (2 * (i % 4))) & 3;
+      }
+      break;
+    case 2:
+      for (size_t i = 0; i < BlockSize; ++i) {
+        group[i] = (data[i / 2] >> (4 * (i % 2))) & 15;
+      }
+      break;
+    case 3:
+      std::memcpy(group, data, BlockSize);
+      break;
+    default:
+      std::memset(group, 0, BlockSize);
+      break;
+  }
+}
+
+#endif
+
+// Decodes the values of a component for a block of vertices, returns the end
+// of its data, nullptr when the data is truncated
+const uint8_t* decodeComponent(const uint8_t* data, const uint8_t* end,
+                               uint32_t& last, uint32_t* values)
+{
+  if (data == end) {
+    return nullptr;
+  }
+
+  const unsigned int header = *data++;
+  size_t size               = 0;
+  for (unsigned int plane = 0; plane < 4; ++plane) {
+    size += GroupSizes[(header >> (2 * plane)) & 3];
+  }
+  if (static_cast<size_t>(end - data) < size) {
+    return nullptr;
+  }
+
+#ifdef BABYLON_MESH_CODEC_SSE2
+  __m128i planes[4];
+  for (unsigned int plane = 0; plane < 4; ++plane) {
+    const auto mode = (header >> (2 * plane)) & 3;
+    planes[plane]   = decodeGroup(data, mode);
+    data += GroupSizes[mode];
+  }
+
+  // Transposes the byte planes to 32 bits values
+  const auto p01lo = _mm_unpacklo_epi8(planes[0], planes[1]);
+  const auto p01hi = _mm_unpackhi_epi8(planes[0], planes[1]);
+  const auto p23lo = _mm_unpacklo_epi8(planes[2], planes[3]);
+  const auto p23hi = _mm_unpackhi_epi8(planes[2], planes[3]);
+
+  auto previous = _mm_set1_epi32(static_cast<int>(last));
+  const __m128i z[4]
+    = {_mm_unpacklo_epi16(p01lo, p23lo), _mm_unpackhi_epi16(p01lo, p23lo),
+       _mm_unpacklo_epi16(p01hi, p23hi), _mm_unpackhi_epi16(p01hi, p23hi)};
+  for (size_t i = 0; i < 4; ++i) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(values + i * 4),
+                     decodeDeltas(z[i], previous));
+  }
+  last = values[BlockSize - 1];
+#else
+  std::array<uint8_t, 4 * BlockSize> planes;
+  for (unsigned int plane = 0; plane < 4; ++plane) {
+    const auto mode = (header >> (2 * plane)) & 3;
+    decodeGroup(data, mode, &planes[plane * BlockSize]);
+    data += GroupSizes[mode];
+  }
+
+  for (size_t i = 0; i < BlockSize; ++i) {
+    const uint32_t z
+      = static_cast<uint32_t>(planes[i])
+        | (static_cast<uint32_t>(planes[BlockSize + i]) << 8)
+        | (static_cast<uint32_t>(planes[2 * BlockSize + i]) << 16)
+        | (static_cast<uint32_t>(planes[3 * BlockSize + i]) << 24);
+    last += unzigzag(z);
+    values[i] = last;
+  }
+#endif
+
+  return data;
+}
+
+void writeVarint(uint32_t value, Uint8Array& result)
+{
+  while (value >= 0x80) {
+    result.emplace_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  result.emplace_back(static_cast<uint8_t>(value));
+}
+
+bool readVarint(const uint8_t*& data, const uint8_t* end, uint32_t& value)
+{
+  value = 0;
+  for (unsigned int shift = 0; shift < 35 && data < end; shift += 7) {
+    const auto byte = *data++;
+    value |= static_cast<uint32_t>(byte & 0x7f) << shift;
+    if (byte < 0x80) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief State shared by the index buffer encoder and decoder.
+ */
+struct IndexCodecState {
+
+  IndexCodecState() : edgeOffset{0}, next{0}, last{0}
+  {
+    edges.fill({~0u, ~0u});
+  }
+
+  // Returns the edge pushed i triangles edges ago
+  const std::pair<uint32_t, uint32_t>& edge(size_t i) const
+  {
+    return edges[(edgeOffset + edges.size() - 1 - i) % edges.size()];
+  }
+
+  // Pushes the edges of a triangle, in the order of the triangles sharing them
+  void pushTriangle(uint32_t a, uint32_t b, uint32_t c)
+  {
+    for (const auto& edge : {std::make_pair(b, a), std::make_pair(c, b),
+                             std::make_pair(a, c)}) {
+      edges[edgeOffset] = edge;
+      edgeOffset        = (edgeOffset + 1) % edges.size();
+    }
+  }
+
+  std::array<std::pair<uint32_t, uint32_t>, 16> edges;
+  size_t edgeOffset;
+  // Next new vertex, last explicit vertex
+  uint32_t next;
+  uint32_t last;
+
+}; // end of struct IndexCodecState
+
+} // end of anonymous namespace
+
+constexpr uint8_t MeshCodec::VertexBufferMagic;
+constexpr uint8_t MeshCodec::IndexBufferMagic;
+
+Uint8Array MeshCodec::EncodeVertexBuffer(const Float32Array& vertices,
+                                         size_t stride,
+                                         unsigned int mantissaBits)
+{
+  if (stride == 0 || vertices.size() % stride != 0
+      || vertices.size() > std::numeric_limits<uint32_t>::max()) {
+    return Uint8Array();
+  }
+
+  const size_t vertexCount = vertices.size() / stride;
+  Uint8Array result(VertexHeaderSize, 0);
+  result[0] = VertexBufferMagic;
+  write<uint32_t>(result, 4, static_cast<uint32_t>(stride));
+  write<uint32_t>(result, 8, static_cast<uint32_t>(vertexCount));
+
+  std::vector<uint32_t> last(stride, 0);
+  std::array<uint8_t, 4 * BlockSize> planes;
+  for (size_t first = 0; first < vertexCount; first += BlockSize) {
+    const auto count = std::min(BlockSize, vertexCount - first);
+    for (size_t component = 0; component < stride; ++component) {
+      planes.fill(0);
+      for (size_t i = 0; i < count; ++i) {
+        const auto value = roundMantissa(
+          read<uint32_t>(reinterpret_cast<const uint8_t*>(
+            &vertices[(first + i) * stride + component])),
+          mantissaBits);
+        const auto z    = zigzag(value - last[component]);
+        last[component] = value;
+        for (size_t plane = 0; plane < 4; ++plane) {
+          planes[plane * BlockSize + i] = (z >> (8 * plane)) & 0xff;
+        }
+      }
+
+      const auto headerOffset = result.size();
+      result.emplace_back(0);
+      unsigned int header = 0;
+      for (unsigned int plane = 0; plane < 4; ++plane) {
+        header |= encodeGroup(&planes[plane * BlockSize], result)
+                  << (2 * plane);
+      }
+      result[headerOffset] = static_cast<uint8_t>(header);
+    }
+  }
+
+  return result;
+}
+
+bool MeshCodec::DecodeVertexBuffer(const uint8_t* data, size_t size,
+                                   Float32Array& vertices)
+{
+  if (!data || size < VertexHeaderSize || data[0] != VertexBufferMagic) {
+    return false;
+  }
+
+  const size_t stride      = read<uint32_t>(data + 4);
+  const size_t vertexCount = read<uint32_t>(data + 8);
+  const auto end           = data + size;
+  // Each component of a block takes at least its header byte
+  const auto blockCount = (vertexCount + BlockSize - 1) / BlockSize;
+  if (stride == 0
+      || (size - VertexHeaderSize) / stride < blockCount) {
+    return false;
+  }
+
+  vertices.resize(vertexCount * stride);
+  data += VertexHeaderSize;
+  std::vector<uint32_t> last(stride, 0);
+  std::array<uint32_t, BlockSize> values;
+  for (size_t first = 0; first < vertexCount; first += BlockSize) {
+    const auto count = std::min(BlockSize, vertexCount - first);
+    for (size_t component = 0; component < stride; ++component) {
+      data = decodeComponent(data, end, last[component], values.data());
+      if (!data) {
+        return false;
+      }
+      auto output = &vertices[first * stride + component];
+      for (size_t i = 0; i < count; ++i, output += stride) {
+        std::memcpy(output, &values[i], sizeof(float));
+      }
+    }
+  }
+
+  return data == end;
+}
+
+Uint8Array MeshCodec::EncodeIndexBuffer(const IndicesArray& indices)
+{
+  if (indices.size() % 3 != 0
+      || indices.size() > std::numeric_limits<uint32_t>::max()) {
+    return Uint8Array();
+  }
+
+  const size_t triangleCount = indices.size() / 3;
+  Uint8Array result(IndexHeaderSize + triangleCount, 0);
+  result[0] = IndexBufferMagic;
+  write<uint32_t>(result, 4, static_cast<uint32_t>(indices.size()));
+
+  IndexCodecState state;
+  // Returns 0 for the next new vertex, 1 for an explicit vertex
+  const auto encodeVertex = [&state, &result](uint32_t vertex) -> uint8_t {
+    if (vertex == state.next) {
+      ++state.next;
+      return 0;
+    }
+    writeVarint(zigzag(vertex - state.last), result);
+    state.last = vertex;
+    return 1;
+  };
+
+  for (size_t t = 0; t < triangleCount; ++t) {
+    std::array<uint32_t, 3> triangle{
+      {indices[t * 3], indices[t * 3 + 1], indices[t * 3 + 2]}};
+
+    // Look for an edge shared with one of the last triangles, the triangle is
+    // rotated so that the edge comes first
+    size_t edge = EdgeFifoSize;
+    for (size_t i = 0; i < EdgeFifoSize && edge == EdgeFifoSize; ++i) {
+      for (size_t r = 0; r < 3; ++r) {
+        if (state.edge(i).first == triangle[r]
+            && state.edge(i).second == triangle[(r + 1) % 3]) {
+          std::rotate(triangle.begin(), triangle.begin() + r, triangle.end());
+          edge = i;
+          break;
+        }
+      }
+    }
+
+    uint8_t code = 0;
+    if (edge < EdgeFifoSize) {
+      code = static_cast<uint8_t>((edge << 4) | encodeVertex(triangle[2]));
+    }
+    else {
+      code = 0xf0;
+      for (size_t i = 0; i < 3; ++i) {
+        code = static_cast<uint8_t>(code | (encodeVertex(triangle[i]) << i));
+      }
+    }
+    result[IndexHeaderSize + t] = code;
+    state.pushTriangle(triangle[0], triangle[1], triangle[2]);
+  }
+
+  return result;
+}
+
+bool MeshCodec::DecodeIndexBuffer(const uint8_t* data, size_t size,
+                                  IndicesArray& indices)
+{
+  if (!data || size < IndexHeaderSize || data[0] != IndexBufferMagic) {
+    return false;
+  }
+
+  const size_t indexCount    = read<uint32_t>(data + 4);
+  const size_t triangleCount = indexCount / 3;
+  if (indexCount % 3 != 0 || size - IndexHeaderSize < triangleCount) {
+    return false;
+  }
+
+  indices.resize(indexCount);
+  const auto codes = data + IndexHeaderSize;
+  const auto end   = data + size;
+  auto explicits   = codes + triangleCount;
+
+  IndexCodecState state;
+  const auto decodeVertex
+    = [&state, &explicits, end](bool isExplicit, uint32_t& vertex) {
+        if (!isExplicit) {
+          vertex = state.next++;
+          return true;
+        }
+        uint32_t delta = 0;
+        if (!readVarint(explicits, end, delta)) {
+          return false;
+        }
+        vertex = state.last += unzigzag(delta);
+        return true;
+      };
+
+  for (size_t t = 0; t < triangleCount; ++t) {
+    const auto code = codes[t];
+    auto triangle   = &indices[t * 3];
+    if ((code >> 4) < EdgeFifoSize) {
+      const auto& edge = state.edge(code >> 4);
+      triangle[0]      = edge.first;
+      triangle[1]      = edge.second;
+      if (!decodeVertex(code & 1, triangle[2])) {
+        return false;
+      }
+    }
+    else {
+      for (size_t i = 0; i < 3; ++i) {
+        if (!decodeVertex((code >> i) & 1, triangle[i])) {
+          return false;
+        }
+      }
+    }
+    state.pushTriangle(triangle[0], triangle[1], triangle[2]);
+  }
+
+  return explicits == end;
+}
+
+} // end of namespace BABYLON
@@ -3,8 +3,9 @@
 namespace BABYLON {
 
 DecimationTriangle::DecimationTriangle(
-  const std::vector<DecimationVertex>& _vertices)
-    : vertices{_vertices}
+  const std::array<uint32_t, 3>& _vertices,
+  const std::array<uint32_t, 3>& _originalOffsets)
+    : deleted{false}, vertices{_vertices}, originalOffsets{_originalOffsets}
 {
 }
 
@@ -12,4 +13,4 @@ DecimationTriangle::~DecimationTriangle()
 {
 }
 
-} // end of namespace BABYLON
\ No newline at end of file
+} // end of namespace BABYLON
@@ -3,11 +3,11 @@
 namespace BABYLON {
 
 DecimationVertex::DecimationVertex(const Vector3& _position, int _id)
-    : position{_position},
-      id{_id},
-      isBorder{true},
-      triangleStart{0},
-      triangleCount{0}
+    : position{_position}
+    , id{_id}
+    , isBorder{false}
+    , isLocked{false}
+    , deleted{false}
 {
 }
 DecimationVertex::~DecimationVertex()
@@ -0,0 +1,822 @@
+#include <babylon/mesh/simplification/quadratic_error_simplification.h>
+
+#include <babylon/core/hash.h>
+#include <babylon/math/quaternion.h>
+#include <babylon/math/vector3.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/simplification/decimation_triangle.h>
+#include <babylon/mesh/simplification/decimation_vertex.h>
+#include <babylon/mesh/simplification/isimplification_settings.h>
+#include <babylon/mesh/simplification/quadratic_matrix.h>
+#include <babylon/mesh/sub_mesh.h>
+#include <babylon/mesh/vertex_data.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Vertex attributes of the simplified geometry, with their number of
+// components
+const std::array<std::pair<Float32Array VertexData::*, size_t>, 14> Attributes{
+  {{&VertexData::positions, 3},
+   {&VertexData::normals, 3},
+   {&VertexData::tangents, 4},
+   {&VertexData::uvs, 2},
+   {&VertexData::uvs2, 2},
+   {&VertexData::uvs3, 2},
+   {&VertexData::uvs4, 2},
+   {&VertexData::uvs5, 2},
+   {&VertexData::uvs6, 2},
+   {&VertexData::colors, 4},
+   {&VertexData::matricesIndices, 4},
+   {&VertexData::matricesWeights, 4},
+   {&VertexData::matricesIndicesExtra, 4},
+   {&VertexData::matricesWeightsExtra, 4}}};
+
+// Smallest cosine of the angle between the normals of a triangle before and
+// after a collapse
+constexpr float MinNormalCosine = 0.25f;
+
+/**
+ * @brief Error of an attribute of an original vertex against the linear
+ * fields of the attribute over its triangles, weighted by their areas.
+ */
+struct AttributeQuadric {
+  AttributeQuadric() : b{{0.f, 0.f, 0.f, 0.f}}, c{0.f}
+  {
+  }
+
+  void addInPlace(const AttributeQuadric& other)
+  {
+    a.addInPlace(other.a);
+    for (size_t i = 0; i < 4; ++i) {
+      b[i] += other.b[i];
+    }
+    c += other.c;
+  }
+
+  float error(const Vector3& point, float value) const
+  {
+    const float field = b[0] * point.x + b[1] * point.y + b[2] * point.z + b[3];
+    return a.vertexError(point) - 2.f * value * field + c * value * value;
+  }
+
+  QuadraticMatrix a;
+  std::array<float, 4> b;
+  float c;
+}; // end of struct AttributeQuadric
+
+/**
+ * @brief An attribute component whose error is part of the collapse cost.
+ */
+struct AttributeComponent {
+  const float* values;
+  size_t stride;
+  float weight;
+}; // end of struct AttributeComponent
+
+uint64_t edgeKey(uint32_t v0, uint32_t v1)
+{
+  return (v0 < v1) ? (static_cast<uint64_t>(v0) << 32) | v1 :
+                     (static_cast<uint64_t>(v1) << 32) | v0;
+}
+
+/**
+ * @brief Returns the index of the first item equal to each item.
+ */
+template <typename HashFunction, typename EqualFunction>
+std::vector<uint32_t> findDuplicates(size_t count, const HashFunction& hash,
+                                     const EqualFunction& equal)
+{
+  std::vector<uint32_t> firsts(count);
+  std::unordered_map<uint64_t, std::vector<uint32_t>> buckets;
+  buckets.reserve(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    auto& bucket = buckets[hash(i)];
+    firsts[i]    = i;
+    for (auto j : bucket) {
+      if (equal(i, j)) {
+        firsts[i] = j;
+        break;
+      }
+    }
+    if (firsts[i] == i) {
+      bucket.emplace_back(i);
+    }
+  }
+  return firsts;
+}
+
+/**
+ * @brief Half edge collapse simplification of the triangles of a submesh.
+ */
+class Decimator {
+
+public:
+  Decimator(const VertexData& vertexData, float normalWeight, float uvWeight,
+            float borderWeight)
+      : _vertexData{vertexData}
+      , _borderWeight{borderWeight}
+      , _triangleCount{0}
+  {
+    if (!vertexData.normals.empty()) {
+      for (size_t i = 0; i < 3; ++i) {
+        _components.emplace_back(
+          AttributeComponent{vertexData.normals.data() + i, 3, normalWeight});
+      }
+    }
+    if (!vertexData.uvs.empty()) {
+      for (size_t i = 0; i < 2; ++i) {
+        _components.emplace_back(
+          AttributeComponent{vertexData.uvs.data() + i, 2, uvWeight});
+      }
+    }
+  }
+
+  /**
+   * @brief Builds the vertices, the triangles and the quadrics of the given
+   * range of indices. The original vertices with the same attributes are
+   * merged when weld is true.
+   */
+  void build(size_t indexStart, size_t indexCount, bool weld)
+  {
+    const auto& indices      = _vertexData.indices;
+    const auto& positions    = _vertexData.positions;
+    const size_t vertexCount = positions.size() / 3;
+    indexStart               = std::min(indexStart, indices.size());
+    indexCount = std::min(indexCount, indices.size() - indexStart) / 3 * 3;
+
+    // Original vertices of the range
+    std::vector<int32_t> localIndices(vertexCount, -1);
+    std::vector<uint32_t> locals;
+    for (size_t i = indexStart; i < indexStart + indexCount; ++i) {
+      const auto index = static_cast<uint32_t>(indices[i]);
+      if (index < vertexCount && localIndices[index] < 0) {
+        localIndices[index] = static_cast<int32_t>(locals.size());
+        locals.emplace_back(index);
+      }
+    }
+
+    // Original vertices kept, the first of each set of equal vertices when
+    // welded
+    std::vector<uint32_t> firsts(locals.size());
+    if (weld) {
+      firsts = findDuplicates(
+        locals.size(),
+        [&](uint32_t i) {
+          uint64_t hash = 0;
+          for (const auto& attribute : Attributes) {
+            const auto& values = _vertexData.*attribute.first;
+            if (values.size() >= vertexCount * attribute.second) {
+              hash = Hash64(values.data() + locals[i] * attribute.second,
+                            attribute.second * sizeof(float), hash);
+            }
+          }
+          return hash;
+        },
+        [&](uint32_t i, uint32_t j) {
+          return _sameAttributes(locals[i], locals[j]);
+        });
+    }
+    else {
+      std::iota(firsts.begin(), firsts.end(), 0);
+    }
+    std::vector<uint32_t> localWedges(locals.size());
+    for (size_t i = 0; i < locals.size(); ++i) {
+      if (firsts[i] == i) {
+        localWedges[i] = static_cast<uint32_t>(_wedges.size());
+        _wedges.emplace_back(locals[i]);
+      }
+      else {
+        localWedges[i] = localWedges[firsts[i]];
+      }
+    }
+
+    // Decimation vertices, shared by the original vertices at the same
+    // position
+    const auto positionFirsts = findDuplicates(
+      _wedges.size(),
+      [&](uint32_t i) {
+        return Hash64(positions.data() + _wedges[i] * 3, 3 * sizeof(float));
+      },
+      [&](uint32_t i, uint32_t j) {
+        return std::equal(positions.begin() + _wedges[i] * 3,
+                          positions.begin() + _wedges[i] * 3 + 3,
+                          positions.begin() + _wedges[j] * 3);
+      });
+    _wedgeVertices.resize(_wedges.size());
+    Vector3 minimum(std::numeric_limits<float>::max(),
+                    std::numeric_limits<float>::max(),
+                    std::numeric_limits<float>::max());
+    Vector3 maximum = -minimum;
+    for (size_t i = 0; i < _wedges.size(); ++i) {
+      if (positionFirsts[i] != i) {
+        _wedgeVertices[i] = _wedgeVertices[positionFirsts[i]];
+        _vertices[_wedgeVertices[i]].originalOffsets.emplace_back(
+          static_cast<uint32_t>(i));
+        continue;
+      }
+      const auto* p = positions.data() + _wedges[i] * 3;
+      const Vector3 position(p[0], p[1], p[2]);
+      minimum.minimizeInPlace(position);
+      maximum.maximizeInPlace(position);
+      _wedgeVertices[i] = static_cast<uint32_t>(_vertices.size());
+      _vertices.emplace_back(position, static_cast<int>(_vertices.size()));
+      _vertices.back().originalOffsets.emplace_back(static_cast<uint32_t>(i));
+    }
+
+    // Positions scaled to a unit box, so that the weights of the errors do
+    // not depend on the size of the mesh
+    const auto extent = maximum.subtract(minimum);
+    const float size  = std::max(extent.x, std::max(extent.y, extent.z));
+    const float scale = (size > 0.f) ? 1.f / size : 1.f;
+    for (auto& vertex : _vertices) {
+      vertex.updatePosition(vertex.position.subtract(minimum).scale(scale));
+    }
+
+    // Triangles, the degenerate ones being dropped
+    for (size_t i = indexStart; i < indexStart + indexCount; i += 3) {
+      std::array<uint32_t, 3> vertices, originalOffsets;
+      bool valid = true;
+      for (size_t j = 0; j < 3 && valid; ++j) {
+        const auto index = static_cast<uint32_t>(indices[i + j]);
+        valid = index < vertexCount;
+        if (valid) {
+          originalOffsets[j] = localWedges[localIndices[index]];
+          vertices[j]        = _wedgeVertices[originalOffsets[j]];
+        }
+      }
+      if (!valid || vertices[0] == vertices[1] || vertices[1] == vertices[2]
+          || vertices[2] == vertices[0]) {
+        continue;
+      }
+      const auto id = static_cast<uint32_t>(_triangles.size());
+      _triangles.emplace_back(vertices, originalOffsets);
+      for (auto vertex : vertices) {
+        _vertices[vertex].triangles.emplace_back(id);
+      }
+    }
+    _triangleCount = _triangles.size();
+
+    _buildQuadrics();
+  }
+
+  /**
+   * @brief Collapses the edges, cheapest first, until the number of triangles
+   * is at most targetCount or no edge can be collapsed.
+   */
+  void run(size_t targetCount)
+  {
+    using Collapse = std::tuple<float, uint32_t, uint32_t>;
+    std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>>
+      heap;
+    const auto push = [&](uint32_t from, uint32_t to) {
+      float cost = 0.f;
+      if (_evaluate(from, to, cost)) {
+        heap.emplace(cost, from, to);
+      }
+    };
+
+    // The collapses rejected by a pass may be valid once the mesh around them
+    // changed, the edges left being queued again until no edge collapses
+    bool collapsed = true;
+    std::unordered_set<uint64_t> edges;
+    std::vector<uint32_t> ring;
+    while (_triangleCount > targetCount && collapsed) {
+      collapsed = false;
+      edges.clear();
+      for (const auto& triangle : _triangles) {
+        for (size_t i = 0; i < 3 && !triangle.deleted; ++i) {
+          const auto v0 = triangle.vertices[i];
+          const auto v1 = triangle.vertices[(i + 1) % 3];
+          if (edges.insert(edgeKey(v0, v1)).second) {
+            push(v0, v1);
+            push(v1, v0);
+          }
+        }
+      }
+
+      while (_triangleCount > targetCount && !heap.empty()) {
+        float cost = 0.f, newCost = 0.f;
+        uint32_t from = 0, to = 0;
+        std::tie(cost, from, to) = heap.top();
+        heap.pop();
+        // The costs of the collapses queued before a change of the mesh
+        // around them are outdated
+        if (!_evaluate(from, to, newCost)) {
+          continue;
+        }
+        if (newCost > cost) {
+          heap.emplace(newCost, from, to);
+          continue;
+        }
+        _collapse(from, to);
+        collapsed = true;
+
+        _neighbors(to, ring);
+        for (auto vertex : ring) {
+          push(to, vertex);
+          push(vertex, to);
+        }
+      }
+      heap = decltype(heap)();
+    }
+  }
+
+  /**
+   * @brief Appends the triangles left and their original vertices to the
+   * given vertex data.
+   */
+  void append(VertexData& output) const
+  {
+    const size_t vertexCount = _vertexData.positions.size() / 3;
+    const auto vertexStart
+      = static_cast<uint32_t>(output.positions.size() / 3);
+    std::vector<int32_t> outputIndices(_wedges.size(), -1);
+    std::vector<uint32_t> outputWedges;
+    for (const auto& triangle : _triangles) {
+      if (triangle.deleted) {
+        continue;
+      }
+      for (auto wedge : triangle.originalOffsets) {
+        if (outputIndices[wedge] < 0) {
+          outputIndices[wedge] = static_cast<int32_t>(outputWedges.size());
+          outputWedges.emplace_back(wedge);
+        }
+        output.indices.emplace_back(
+          vertexStart + static_cast<uint32_t>(outputIndices[wedge]));
+      }
+    }
+
+    for (const auto& attribute : Attributes) {
+      const auto& values = _vertexData.*attribute.first;
+      const auto stride  = attribute.second;
+      if (values.size() < vertexCount * stride || values.empty()) {
+        continue;
+      }
+      auto& outputValues = output.*attribute.first;
+      outputValues.reserve(outputValues.size() + outputWedges.size() * stride);
+      for (auto wedge : outputWedges) {
+        const auto offset = _wedges[wedge] * stride;
+        outputValues.insert(outputValues.end(), values.begin() + offset,
+                            values.begin() + offset + stride);
+      }
+    }
+  }
+
+private:
+  bool _sameAttributes(uint32_t v0, uint32_t v1) const
+  {
+    const size_t vertexCount = _vertexData.positions.size() / 3;
+    for (const auto& attribute : Attributes) {
+      const auto& values = _vertexData.*attribute.first;
+      const auto stride  = attribute.second;
+      if (values.size() >= vertexCount * stride
+          && !std::equal(values.begin() + v0 * stride,
+                         values.begin() + v0 * stride + stride,
+                         values.begin() + v1 * stride)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  float _attribute(uint32_t wedge, size_t component) const
+  {
+    const auto& attribute = _components[component];
+    return attribute.values[_wedges[wedge] * attribute.stride];
+  }
+
+  AttributeQuadric& _attributeQuadric(uint32_t wedge, size_t component)
+  {
+    return _attributeQuadrics[wedge * _components.size() + component];
+  }
+
+  void _addPlane(DecimationVertex& vertex, const Vector3& normal,
+                 const Vector3& point, float weight)
+  {
+    const float s = std::sqrt(weight);
+    vertex.q.addInPlace(QuadraticMatrix::FromData(
+      normal.x * s, normal.y * s, normal.z * s,
+      -Vector3::Dot(normal, point) * s));
+  }
+
+  void _buildQuadrics()
+  {
+    struct EdgeInfo {
+      uint32_t triangleCount;
+      std::array<uint32_t, 2> originalOffsets;
+      bool isSeam;
+    }; // end of struct EdgeInfo
+
+    // Borders, seams and non manifold edges
+    std::unordered_map<uint64_t, EdgeInfo> edges;
+    edges.reserve(_triangles.size() * 2);
+    for (const auto& triangle : _triangles) {
+      for (size_t i = 0; i < 3; ++i) {
+        const size_t j = (i + 1) % 3;
+        auto ends      = std::make_pair(triangle.originalOffsets[i],
+                                        triangle.originalOffsets[j]);
+        if (triangle.vertices[i] > triangle.vertices[j]) {
+          std::swap(ends.first, ends.second);
+        }
+        auto& edge
+          = edges[edgeKey(triangle.vertices[i], triangle.vertices[j])];
+        if (edge.triangleCount++ == 0) {
+          edge.originalOffsets = {{ends.first, ends.second}};
+          edge.isSeam          = false;
+        }
+        else if (edge.originalOffsets[0] != ends.first
+                 || edge.originalOffsets[1] != ends.second) {
+          edge.isSeam = true;
+        }
+        if (edge.triangleCount > 2) {
+          _vertices[triangle.vertices[i]].isLocked = true;
+          _vertices[triangle.vertices[j]].isLocked = true;
+        }
+      }
+    }
+
+    _attributeQuadrics.resize(_wedges.size() * _components.size());
+    for (auto& triangle : _triangles) {
+      const auto& p0 = _vertices[triangle.vertices[0]].position;
+      const auto& p1 = _vertices[triangle.vertices[1]].position;
+      const auto& p2 = _vertices[triangle.vertices[2]].position;
+      const auto e1  = p1.subtract(p0);
+      const auto e2  = p2.subtract(p0);
+      const auto n   = Vector3::Cross(e1, e2);
+      const float doubleArea = n.length();
+      if (doubleArea <= 0.f) {
+        triangle.normal = Vector3::Zero();
+        continue;
+      }
+      triangle.normal  = n.scale(1.f / doubleArea);
+      const float area = doubleArea * 0.5f;
+
+      // Planes of the triangle
+      for (auto vertex : triangle.vertices) {
+        _addPlane(_vertices[vertex], triangle.normal, p0, area);
+      }
+
+      // Planes perpendicular to the triangle through its borders and seams,
+      // keeping them in place
+      for (size_t i = 0; i < 3; ++i) {
+        const auto v0    = triangle.vertices[i];
+        const auto v1    = triangle.vertices[(i + 1) % 3];
+        const auto& edge = edges[edgeKey(v0, v1)];
+        if (edge.triangleCount != 1 && !edge.isSeam) {
+          continue;
+        }
+        if (edge.triangleCount == 1) {
+          _vertices[v0].isBorder = true;
+          _vertices[v1].isBorder = true;
+        }
+        const auto& q0     = _vertices[v0].position;
+        const auto side    = _vertices[v1].position.subtract(q0);
+        auto normal        = Vector3::Cross(side, triangle.normal);
+        const float length = normal.length();
+        if (length > 0.f) {
+          normal.scaleInPlace(1.f / length);
+          const float weight = _borderWeight * side.lengthSquared();
+          _addPlane(_vertices[v0], normal, q0, weight);
+          _addPlane(_vertices[v1], normal, q0, weight);
+        }
+      }
+
+      // Linear fields of the attributes over the triangle, the gradient g
+      // and offset d of a field f(p) = g.p + d being solved from the
+      // attributes of the corners
+      const float inverse = 1.f / (doubleArea * doubleArea);
+      const auto g1       = Vector3::Cross(e2, n).scale(inverse);
+      const auto g2       = Vector3::Cross(n, e1).scale(inverse);
+      for (size_t k = 0; k < _components.size(); ++k) {
+        const float s0 = _attribute(triangle.originalOffsets[0], k);
+        const float s1 = _attribute(triangle.originalOffsets[1], k);
+        const float s2 = _attribute(triangle.originalOffsets[2], k);
+        const auto g   = g1.scale(s1 - s0).add(g2.scale(s2 - s0));
+        const float d  = s0 - Vector3::Dot(g, p0);
+        const float s  = std::sqrt(area);
+        AttributeQuadric quadric;
+        quadric.a = QuadraticMatrix::FromData(g.x * s, g.y * s, g.z * s, d * s);
+        quadric.b = {{g.x * area, g.y * area, g.z * area, d * area}};
+        quadric.c = area;
+        for (auto wedge : triangle.originalOffsets) {
+          _attributeQuadric(wedge, k).addInPlace(quadric);
+        }
+      }
+    }
+  }
+
+  static size_t _corner(const DecimationTriangle& triangle, uint32_t vertex)
+  {
+    size_t i = 0;
+    while (i < 3 && triangle.vertices[i] != vertex) {
+      ++i;
+    }
+    return i;
+  }
+
+  /**
+   * @brief Removes the deleted triangles of the triangles of a vertex.
+   */
+  void _compactTriangles(DecimationVertex& vertex)
+  {
+    auto& triangles = vertex.triangles;
+    triangles.erase(std::remove_if(triangles.begin(), triangles.end(),
+                                   [this](uint32_t triangle) {
+                                     return _triangles[triangle].deleted;
+                                   }),
+                    triangles.end());
+  }
+
+  void _neighbors(uint32_t vertex, std::vector<uint32_t>& neighbors)
+  {
+    neighbors.clear();
+    _compactTriangles(_vertices[vertex]);
+    for (auto triangle : _vertices[vertex].triangles) {
+      for (auto neighbor : _triangles[triangle].vertices) {
+        if (neighbor != vertex
+            && std::find(neighbors.begin(), neighbors.end(), neighbor)
+                 == neighbors.end()) {
+          neighbors.emplace_back(neighbor);
+        }
+      }
+    }
+  }
+
+  bool _mapWedge(uint32_t fromWedge, uint32_t toWedge)
+  {
+    for (const auto& wedges : _wedgeMap) {
+      if (wedges.first == fromWedge) {
+        return wedges.second == toWedge;
+      }
+    }
+    _wedgeMap.emplace_back(fromWedge, toWedge);
+    return true;
+  }
+
+  uint32_t _mappedWedge(uint32_t fromWedge) const
+  {
+    for (const auto& wedges : _wedgeMap) {
+      if (wedges.first == fromWedge) {
+        return wedges.second;
+      }
+    }
+    return std::numeric_limits<uint32_t>::max();
+  }
+
+  /**
+   * @brief Checks the collapse of vertex from onto vertex to, and computes
+   * its cost. The original vertices of from are mapped to the ones of to
+   * across the triangles of the edge, a collapse across a seam leaving
+   * original vertices of from unmapped or mapped twice.
+   */
+  bool _evaluate(uint32_t from, uint32_t to, float& cost)
+  {
+    auto& a       = _vertices[from];
+    const auto& b = _vertices[to];
+    if (a.deleted || a.isLocked || b.deleted) {
+      return false;
+    }
+
+    _compactTriangles(a);
+    _wedgeMap.clear();
+    size_t sharedCount = 0;
+    for (auto t : a.triangles) {
+      const auto& triangle = _triangles[t];
+      const auto j         = _corner(triangle, to);
+      if (j < 3) {
+        ++sharedCount;
+        if (!_mapWedge(triangle.originalOffsets[_corner(triangle, from)],
+                       triangle.originalOffsets[j])) {
+          return false;
+        }
+      }
+    }
+    // Borders only collapse along themselves
+    if (sharedCount == 0 || (a.isBorder && sharedCount != 1)) {
+      return false;
+    }
+    for (auto t : a.triangles) {
+      const auto& triangle = _triangles[t];
+      if (_mappedWedge(triangle.originalOffsets[_corner(triangle, from)])
+          == std::numeric_limits<uint32_t>::max()) {
+        return false;
+      }
+    }
+
+    // The vertices neighbor of both ends are the ones of the triangles of
+    // the edge, the mesh staying manifold
+    _neighbors(from, _fromNeighbors);
+    _neighbors(to, _toNeighbors);
+    size_t commonCount = 0;
+    for (auto neighbor : _fromNeighbors) {
+      if (std::find(_toNeighbors.begin(), _toNeighbors.end(), neighbor)
+          != _toNeighbors.end()) {
+        ++commonCount;
+      }
+    }
+    if (commonCount != sharedCount) {
+      return false;
+    }
+
+    // Flipped triangles
+    for (auto t : a.triangles) {
+      const auto& triangle = _triangles[t];
+      if (_corner(triangle, to) < 3) {
+        continue;
+      }
+      const auto i   = _corner(triangle, from);
+      const auto& p0 = _vertices[triangle.vertices[(i + 1) % 3]].position;
+      const auto& p1 = _vertices[triangle.vertices[(i + 2) % 3]].position;
+      const auto e   = p1.subtract(p0);
+      const auto n0  = Vector3::Cross(e, a.position.subtract(p0));
+      const auto n1  = Vector3::Cross(e, b.position.subtract(p0));
+      const float l0 = n0.length();
+      if (l0 > 0.f
+          && Vector3::Dot(n0, n1) <= MinNormalCosine * l0 * n1.length()) {
+        return false;
+      }
+    }
+
+    cost = a.q.vertexError(b.position) + b.q.vertexError(b.position);
+    for (const auto& wedges : _wedgeMap) {
+      for (size_t k = 0; k < _components.size(); ++k) {
+        const float value = _attribute(wedges.second, k);
+        const float error
+          = _attributeQuadric(wedges.first, k).error(b.position, value)
+            + _attributeQuadric(wedges.second, k).error(b.position, value);
+        cost += _components[k].weight * error;
+      }
+    }
+    cost = std::max(cost, 0.f);
+    return true;
+  }
+
+  /**
+   * @brief Collapses vertex from onto vertex to, the last evaluated collapse.
+   */
+  void _collapse(uint32_t from, uint32_t to)
+  {
+    auto& a = _vertices[from];
+    auto& b = _vertices[to];
+    for (auto t : a.triangles) {
+      auto& triangle = _triangles[t];
+      if (_corner(triangle, to) < 3) {
+        triangle.deleted = true;
+        --_triangleCount;
+        continue;
+      }
+      const auto i                = _corner(triangle, from);
+      triangle.vertices[i]        = to;
+      triangle.originalOffsets[i] = _mappedWedge(triangle.originalOffsets[i]);
+      b.triangles.emplace_back(t);
+    }
+
+    b.q.addInPlace(a.q);
+    for (const auto& wedges : _wedgeMap) {
+      for (size_t k = 0; k < _components.size(); ++k) {
+        _attributeQuadric(wedges.second, k)
+          .addInPlace(_attributeQuadric(wedges.first, k));
+      }
+    }
+    b.isBorder = b.isBorder || a.isBorder;
+    a.deleted  = true;
+    a.triangles.clear();
+  }
+
+private:
+  const VertexData& _vertexData;
+  float _borderWeight;
+  std::vector<AttributeComponent> _components;
+  // Original vertices kept, and their decimation vertices
+  std::vector<uint32_t> _wedges;
+  std::vector<uint32_t> _wedgeVertices;
+  std::vector<AttributeQuadric> _attributeQuadrics;
+  std::vector<DecimationVertex> _vertices;
+  std::vector<DecimationTriangle> _triangles;
+  size_t _triangleCount;
+  // Scratch data of the evaluation of a collapse
+  std::vector<std::pair<uint32_t, uint32_t>> _wedgeMap;
+  std::vector<uint32_t> _fromNeighbors;
+  std::vector<uint32_t> _toNeighbors;
+
+}; // end of class Decimator
+
+} // end of anonymous namespace
+
+QuadraticErrorSimplification::QuadraticErrorSimplification(Mesh* mesh)
+    : normalWeight{0.05f}
+    , uvWeight{0.5f}
+    , borderWeight{10.f}
+    , _mesh{mesh}
+    , _vertexData{VertexData::ExtractFromMesh(mesh, false, true)}
+{
+  for (const auto& subMesh : mesh->subMeshes) {
+    _subMeshes.emplace_back(SimplifiedGeometry::SubMeshRange{
+      subMesh->materialIndex, subMesh->verticesStart, subMesh->verticesCount,
+      subMesh->indexStart, subMesh->indexCount});
+  }
+  if (_subMeshes.empty() && _vertexData) {
+    _subMeshes.emplace_back(SimplifiedGeometry::SubMeshRange{
+      0, 0, _vertexData->positions.size() / 3, 0,
+      _vertexData->indices.size()});
+  }
+}
+
+QuadraticErrorSimplification::QuadraticErrorSimplification(
+  std::unique_ptr<VertexData>&& vertexData,
+  const std::vector<SimplifiedGeometry::SubMeshRange>& subMeshes)
+    : normalWeight{0.05f}
+    , uvWeight{0.5f}
+    , borderWeight{10.f}
+    , _mesh{nullptr}
+    , _vertexData{std::move(vertexData)}
+    , _subMeshes{subMeshes}
+{
+  if (_subMeshes.empty() && _vertexData) {
+    _subMeshes.emplace_back(SimplifiedGeometry::SubMeshRange{
+      0, 0, _vertexData->positions.size() / 3, 0,
+      _vertexData->indices.size()});
+  }
+}
+
+QuadraticErrorSimplification::~QuadraticErrorSimplification()
+{
+}
+
+SimplifiedGeometry QuadraticErrorSimplification::simplifyGeometry(
+  const ISimplificationSettings& settings) const
+{
+  SimplifiedGeometry geometry;
+  geometry.vertexData = std::make_unique<VertexData>();
+  if (!_vertexData) {
+    return geometry;
+  }
+
+  // The submeshes are simplified one by one, their borders being kept
+  const float quality = std::max(0.f, std::min(settings.quality, 1.f));
+  auto& output        = *geometry.vertexData;
+  for (const auto& subMesh : _subMeshes) {
+    SimplifiedGeometry::SubMeshRange range;
+    range.materialIndex = subMesh.materialIndex;
+    range.verticesStart
+      = static_cast<unsigned int>(output.positions.size() / 3);
+    range.indexStart    = static_cast<unsigned int>(output.indices.size());
+
+    Decimator decimator(*_vertexData, normalWeight, uvWeight, borderWeight);
+    decimator.build(subMesh.indexStart, subMesh.indexCount,
+                    settings.optimizeMesh);
+    decimator.run(static_cast<size_t>(
+      std::ceil(quality * static_cast<float>(subMesh.indexCount / 3))));
+    decimator.append(output);
+
+    range.verticesCount = output.positions.size() / 3 - range.verticesStart;
+    range.indexCount    = output.indices.size() - range.indexStart;
+    geometry.subMeshes.emplace_back(range);
+  }
+
+  return geometry;
+}
+
+Mesh* QuadraticErrorSimplification::createMesh(
+  const ISimplificationSettings& /*settings*/, SimplifiedGeometry& geometry)
+{
+  if (!_mesh || !geometry.vertexData) {
+    return nullptr;
+  }
+
+  auto mesh = Mesh::New(_mesh->name + "Decimated", _mesh->getScene(),
+                        _mesh->parent());
+  geometry.vertexData->applyToMesh(mesh);
+  mesh->setMaterial(_mesh->getMaterial());
+  mesh->position().copyFrom(_mesh->position());
+  mesh->rotation().copyFrom(_mesh->rotation());
+  mesh->scaling().copyFrom(_mesh->scaling());
+  if (_mesh->rotationQuaternionSet()) {
+    mesh->setRotationQuaternion(_mesh->rotationQuaternion());
+  }
+  mesh->isVisible        = false;
+  mesh->renderingGroupId = _mesh->renderingGroupId;
+
+  mesh->releaseSubMeshes();
+  for (const auto& range : geometry.subMeshes) {
+    SubMesh::New(range.materialIndex, range.verticesStart, range.verticesCount,
+                 range.indexStart, range.indexCount, mesh);
+  }
+
+  return mesh;
+}
+
+void QuadraticErrorSimplification::simplify(
+  const ISimplificationSettings& settings,
+  const std::function<void(Mesh* mesh)>& successCallback)
+{
+  auto geometry = simplifyGeometry(settings);
+  auto mesh     = createMesh(settings, geometry);
+  if (successCallback) {
+    successCallback(mesh);
+  }
+}
+
+} // end of namespace BABYLON
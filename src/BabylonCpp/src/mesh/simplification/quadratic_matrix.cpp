@@ -1,5 +1,7 @@
 #include <babylon/mesh/simplification/quadratic_matrix.h>
 
+#include <babylon/math/vector3.h>
+
 namespace BABYLON {
 
 QuadraticMatrix::QuadraticMatrix()
@@ -52,6 +54,14 @@ QuadraticMatrix QuadraticMatrix::add(const QuadraticMatrix& matrix)
   return m;
 }
 
+float QuadraticMatrix::vertexError(const Vector3& point) const
+{
+  const float x = point.x, y = point.y, z = point.z;
+  return data[0] * x * x + 2.f * data[1] * x * y + 2.f * data[2] * x * z
+         + 2.f * data[3] * x + data[4] * y * y + 2.f * data[5] * y * z
+         + 2.f * data[6] * y + data[7] * z * z + 2.f * data[8] * z + data[9];
+}
+
 QuadraticMatrix QuadraticMatrix::FromData(float a, float b, float c, float d)
 {
   return QuadraticMatrix(QuadraticMatrix::DataFromNumbers(a, b, c, d));
@@ -1,50 +1,176 @@
 #include <babylon/mesh/simplification/simplification_queue.h>
 
+#include <babylon/core/worker_pool.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/simplification/quadratic_error_simplification.h>
 #include <babylon/mesh/simplification/simplification_settings.h>
+#include <babylon/mesh/vertex_data.h>
 
 namespace BABYLON {
 
-SimplificationQueue::SimplificationQueue() : running{false}
+SimplificationQueue::SimplificationQueue(size_t workerCount)
+    : running{false}
+    , maxConcurrentTasks{2}
+    , maxMeshesPerFrame{2}
+    , _nextTaskId{0}
+    , _stopping{false}
+    , _tasks{
+        std::make_unique<WorkerTaskGroup>(WorkerPool::Create(workerCount))}
 {
 }
 
 SimplificationQueue::~SimplificationQueue()
 {
+  // Waits for the levels being simplified, the queued ones being skipped
+  _stopping = true;
+  _tasks.reset();
 }
 
 void SimplificationQueue::addTask(const ISimplificationTask& task)
 {
   _simplificationQueue.emplace(task);
+  running = true;
 }
 
 void SimplificationQueue::executeNext()
 {
   if (!_simplificationQueue.empty()) {
-    running                         = true;
-    const ISimplificationTask& task = _simplificationQueue.front();
+    running                        = true;
+    const ISimplificationTask task = _simplificationQueue.front();
     _simplificationQueue.pop();
     runSimplification(task);
   }
   else {
-    running = false;
+    running = !_runningTasks.empty();
   }
 }
 
-void SimplificationQueue::runSimplification(const ISimplificationTask& /*task*/)
+void SimplificationQueue::runSimplification(const ISimplificationTask& task)
 {
-  // TODO IMPLEMENT
-  // if (task.parallelProcessing)
-  //  std::cout << "";
+  if (!task.mesh || task.settings.empty()) {
+    if (task.successCallback) {
+      task.successCallback();
+    }
+    return;
+  }
+
+  // The geometry of the mesh is copied on the rendering thread
+  const auto taskId = _nextTaskId++;
+  RunningTask runningTask;
+  runningTask.task           = task;
+  runningTask.simplifier     = getSimplifier(task);
+  runningTask.completedCount = 0;
+  auto simplifier            = runningTask.simplifier;
+  _runningTasks.emplace(taskId, std::move(runningTask));
+
+  const auto simplify = [this, taskId, simplifier](
+                          const ISimplificationSettings& settings,
+                          size_t settingsIndex) {
+    if (_stopping) {
+      return;
+    }
+    SimplificationResult result;
+    result.taskId        = taskId;
+    result.settingsIndex = settingsIndex;
+    result.geometry      = simplifier->simplifyGeometry(settings);
+    _completed.push(std::move(result));
+  };
+
+  // One worker task per level when processed in parallel, one worker task
+  // for all the levels otherwise
+  if (task.parallelProcessing) {
+    for (size_t i = 0; i < task.settings.size(); ++i) {
+      const auto settings = task.settings[i];
+      _tasks->send([simplify, settings, i]() { simplify(settings, i); });
+    }
+  }
+  else {
+    const auto settings = task.settings;
+    _tasks->send([simplify, settings]() {
+      for (size_t i = 0; i < settings.size(); ++i) {
+        simplify(settings[i], i);
+      }
+    });
+  }
+}
+
+void SimplificationQueue::update()
+{
+  // Simplified levels
+  SimplificationResult result;
+  size_t meshCount = 0;
+  while ((maxMeshesPerFrame == 0 || meshCount < maxMeshesPerFrame)
+         && _completed.tryAndPop(result)) {
+    auto it = _runningTasks.find(result.taskId);
+    if (it == _runningTasks.end()) {
+      continue;
+    }
+    auto& runningTask    = it->second;
+    const auto& settings = runningTask.task.settings[result.settingsIndex];
+    auto mesh = runningTask.simplifier->createMesh(settings, result.geometry);
+    if (mesh) {
+      runningTask.task.mesh->addLODLevel(settings.distance, mesh);
+      mesh->isVisible = true;
+    }
+    ++meshCount;
+
+    if (++runningTask.completedCount == runningTask.task.settings.size()) {
+      const auto successCallback = runningTask.task.successCallback;
+      _runningTasks.erase(it);
+      if (successCallback) {
+        successCallback();
+      }
+    }
+  }
+
+  // Queued tasks
+  while (!_simplificationQueue.empty()
+         && _runningTasks.size() < maxConcurrentTasks) {
+    executeNext();
+  }
+  running = !_simplificationQueue.empty() || !_runningTasks.empty();
+}
+
+void SimplificationQueue::cancelTasks(Mesh* mesh)
+{
+  // The levels being simplified are dropped once completed
+  for (auto it = _runningTasks.begin(); it != _runningTasks.end();) {
+    if (it->second.task.mesh == mesh) {
+      it = _runningTasks.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+
+  std::queue<ISimplificationTask> queued;
+  while (!_simplificationQueue.empty()) {
+    if (_simplificationQueue.front().mesh != mesh) {
+      queued.emplace(std::move(_simplificationQueue.front()));
+    }
+    _simplificationQueue.pop();
+  }
+  _simplificationQueue.swap(queued);
+  running = !_simplificationQueue.empty() || !_runningTasks.empty();
+}
+
+size_t SimplificationQueue::pendingCount() const
+{
+  return _simplificationQueue.size() + _runningTasks.size();
+}
+
+size_t SimplificationQueue::workerCount() const
+{
+  return _tasks->workerCount();
 }
 
-ISimplifier* SimplificationQueue::getSimplifier(const ISimplificationTask& task)
+std::unique_ptr<ISimplifier>
+SimplificationQueue::getSimplifier(const ISimplificationTask& task)
 {
   switch (task.simplificationType) {
     case SimplificationType::QUADRATIC:
     default:
-      // TODO FIXME
-      return nullptr;
-      // return new QuadraticErrorSimplification(task.mesh);
+      return std::make_unique<QuadraticErrorSimplification>(task.mesh);
   }
 }
 
@@ -152,11 +152,11 @@ SubMesh& SubMesh::refreshBoundingInfo()
     return *this;
   }
 
-  auto indices = _renderingMesh->getIndices();
   MinMax extend;
 
   // Is this the only submesh?
-  if (indexStart == 0 && indexCount == indices.size()) {
+  if (indexStart == 0
+      && indexCount == _renderingMesh->getIndicesView().size()) {
     // the rendering mesh's bounding info can be used, it is the standard
     // submesh for all indices.
     extend.min = _renderingMesh->getBoundingInfo()->minimum;
@@ -164,7 +164,7 @@ SubMesh& SubMesh::refreshBoundingInfo()
   }
   else {
     extend = Tools::ExtractMinAndMaxIndexed(
-      data, indices, indexStart, indexCount,
+      data, _renderingMesh->getIndices(), indexStart, indexCount,
       _renderingMesh->geometry()->boundingBias());
   }
   _boundingInfo = std::make_unique<BoundingInfo>(extend.min, extend.max);
@@ -204,7 +204,7 @@ SubMesh& SubMesh::render(bool enableAlphaMode)
   return *this;
 }
 
-GL::IGLBuffer* SubMesh::getLinesIndexBuffer(const Uint32Array& indices,
+GL::IGLBuffer* SubMesh::getLinesIndexBuffer(const IndicesView& indices,
                                             Engine* engine)
 {
   if (!_linesIndexBuffer) {
@@ -230,7 +230,7 @@ bool SubMesh::canIntersects(const Ray& ray) const
 
 std::unique_ptr<IntersectionInfo>
 SubMesh::intersects(Ray& ray, const std::vector<Vector3>& positions,
-                    const Uint32Array& indices, bool fastCheck)
+                    const IndicesView& indices, bool fastCheck)
 {
 
   std::unique_ptr<IntersectionInfo> intersectInfo = nullptr;
@@ -334,10 +334,10 @@ SubMesh* SubMesh::CreateFromIndices(unsigned int materialIndex,
 
   auto _renderingMesh
     = renderingMesh ? renderingMesh : static_cast<Mesh*>(mesh);
-  auto indices = _renderingMesh->getIndices();
+  auto indices = _renderingMesh->getIndicesView();
 
   for (size_t index = startIndex; index < startIndex + indexCount; ++index) {
-    auto& vertexIndex = indices[index];
+    auto vertexIndex = indices[index];
 
     if (vertexIndex < minVertexIndex) {
       minVertexIndex = vertexIndex;
@@ -1,5 +1,6 @@
 #include <babylon/mesh/vertex_buffer.h>
 
+#include <babylon/core/hash.h>
 #include <babylon/engine/engine.h>
 #include <babylon/mesh/buffer.h>
 
@@ -47,6 +48,16 @@ constexpr const char* VertexBuffer::World3KindChars;
 constexpr const char* VertexBuffer::CellInfoKindChars;
 constexpr const char* VertexBuffer::OptionsKindChars;
 
+constexpr unsigned int VertexBuffer::BYTE;
+constexpr unsigned int VertexBuffer::UNSIGNED_BYTE;
+constexpr unsigned int VertexBuffer::SHORT;
+constexpr unsigned int VertexBuffer::UNSIGNED_SHORT;
+constexpr unsigned int VertexBuffer::INT;
+constexpr unsigned int VertexBuffer::UNSIGNED_INT;
+constexpr unsigned int VertexBuffer::FLOAT;
+constexpr unsigned int VertexBuffer::HALF_FLOAT;
+constexpr unsigned int VertexBuffer::INT_2_10_10_10_REV;
+
 VertexBuffer::VertexBuffer(Engine* engine, const Float32Array& data,
                            unsigned int kind, bool updatable,
                            bool postponeInternalCreation, int stride,
@@ -62,6 +73,12 @@ VertexBuffer::VertexBuffer(Engine* engine, const Float32Array& data,
 
   _offset = (offset != -1) ? static_cast<unsigned int>(offset) : 0;
   _size   = (size != -1) ? size : _stride;
+
+  _type       = VertexBuffer::FLOAT;
+  _normalized = false;
+  _byteStride   = _stride * 4;
+  _byteOffset   = static_cast<int>(_offset * 4);
+  _sharedBuffer = nullptr;
 }
 
 VertexBuffer::VertexBuffer(Engine* /*engine*/, Buffer* buffer,
@@ -76,6 +93,53 @@ VertexBuffer::VertexBuffer(Engine* /*engine*/, Buffer* buffer,
 
   _offset = (offset != -1) ? static_cast<unsigned int>(offset) : 0;
   _size   = (size != -1) ? size : _stride;
+
+  _type       = VertexBuffer::FLOAT;
+  _normalized = false;
+  _byteStride   = _stride * 4;
+  _byteOffset   = static_cast<int>(_offset * 4);
+  _sharedBuffer = nullptr;
+}
+
+VertexBuffer::VertexBuffer(std::unique_ptr<Buffer>&& buffer, unsigned int kind,
+                           int size, unsigned int type, bool normalized,
+                           int byteOffset)
+    : _ownedBuffer{std::move(buffer)}
+    , _buffer{nullptr}
+    , _kind{kind}
+    , _offset{0}
+    , _size{size}
+    , _ownsBuffer{true}
+    , _type{type}
+    , _normalized{normalized}
+    , _byteOffset{byteOffset}
+    , _sharedBuffer{nullptr}
+{
+  // The CPU side data keeps the float layout of the kind
+  _stride     = _ownedBuffer->getStrideSize();
+  _byteStride = _ownedBuffer->getByteStride();
+}
+
+VertexBuffer::VertexBuffer(Engine* engine, const Float32Array& data,
+                           Buffer* sharedBuffer, unsigned int kind, int size,
+                           unsigned int type, bool normalized, int byteOffset)
+    : _ownedBuffer{nullptr}
+    , _buffer{nullptr}
+    , _kind{kind}
+    , _offset{0}
+    , _size{size}
+    , _ownsBuffer{true}
+    , _type{type}
+    , _normalized{normalized}
+    , _byteOffset{byteOffset}
+    , _sharedBuffer{sharedBuffer}
+{
+  _stride = VertexBuffer::KindToStride(kind);
+  _stride = (_stride == -1) ? size : _stride;
+
+  // CPU side only, the GPU data lives in the shared buffer
+  _ownedBuffer = std::make_unique<Buffer>(engine, data, false, _stride, true);
+  _byteStride  = sharedBuffer->getByteStride();
 }
 
 VertexBuffer::~VertexBuffer()
@@ -182,9 +246,14 @@ Buffer* VertexBuffer::_getBuffer() const
   }
 }
 
+Buffer* VertexBuffer::_getGPUBuffer() const
+{
+  return _sharedBuffer ? _sharedBuffer : _getBuffer();
+}
+
 bool VertexBuffer::isUpdatable() const
 {
-  return _getBuffer()->isUpdatable();
+  return _getGPUBuffer()->isUpdatable();
 }
 
 Float32Array& VertexBuffer::getData()
@@ -194,7 +263,12 @@ Float32Array& VertexBuffer::getData()
 
 GL::IGLBuffer* VertexBuffer::getBuffer()
 {
-  return _getBuffer()->getBuffer();
+  return _getGPUBuffer()->getBuffer();
+}
+
+bool VertexBuffer::isShared() const
+{
+  return _sharedBuffer != nullptr;
 }
 
 int VertexBuffer::getStrideSize() const
@@ -214,29 +288,67 @@ int VertexBuffer::getSize() const
 
 bool VertexBuffer::getIsInstanced() const
 {
-  return _getBuffer()->getIsInstanced();
+  return _getGPUBuffer()->getIsInstanced();
+}
+
+unsigned int VertexBuffer::getDataType() const
+{
+  return _type;
+}
+
+bool VertexBuffer::getNormalized() const
+{
+  return _normalized;
+}
+
+int VertexBuffer::getByteStride() const
+{
+  return _byteStride;
+}
+
+int VertexBuffer::getByteOffset() const
+{
+  return _byteOffset;
+}
+
+bool VertexBuffer::hasSameLayout(const VertexBuffer& other) const
+{
+  return _kind == other._kind && _stride == other._stride
+         && _offset == other._offset && _size == other._size
+         && _type == other._type && _normalized == other._normalized
+         && isUpdatable() == other.isUpdatable()
+         && getIsInstanced() == other.getIsInstanced();
+}
+
+uint64_t VertexBuffer::getLayoutHash() const
+{
+  const std::array<uint32_t, 8> layout{{
+    _kind, static_cast<uint32_t>(_stride), _offset,
+    static_cast<uint32_t>(_size), _type, _normalized ? 1u : 0u,
+    isUpdatable() ? 1u : 0u, getIsInstanced() ? 1u : 0u}};
+  return Hash64(layout.data(), layout.size() * sizeof(uint32_t));
 }
 
 // Methods
 GL::IGLBuffer* VertexBuffer::create()
 {
-  return _getBuffer()->create();
+  return _getGPUBuffer()->create();
 }
 
 GL::IGLBuffer* VertexBuffer::create(const Float32Array& data)
 {
-  return _getBuffer()->create(data);
+  return _getGPUBuffer()->create(data);
 }
 
 GL::IGLBuffer* VertexBuffer::update(const Float32Array& data)
 {
-  return _getBuffer()->update(data);
+  return _getGPUBuffer()->update(data);
 }
 
 GL::IGLBuffer* VertexBuffer::updateDirectly(const Float32Array& data,
                                             int offset)
 {
-  return _getBuffer()->updateDirectly(data, offset);
+  return _getGPUBuffer()->updateDirectly(data, offset);
 }
 
 void VertexBuffer::dispose(bool /*doNotRecurse*/)
@@ -1,19 +1,29 @@
 #include <babylon/mesh/vertex_data.h>
 
 #include <babylon/babylon_stl_util.h>
+#include <babylon/core/hash.h>
 #include <babylon/core/json.h>
 #include <babylon/engine/engine.h>
 #include <babylon/math/axis.h>
+#include <babylon/math/matrix.h>
+#include <babylon/math/scalar.h>
 #include <babylon/math/vector2.h>
 #include <babylon/math/vector3.h>
 #include <babylon/mesh/facet_parameters.h>
 #include <babylon/mesh/geometry.h>
 #include <babylon/mesh/vertex_buffer.h>
 #include <babylon/mesh/vertex_data_options.h>
+#include <babylon/tools/derived_asset_cache.h>
 #include <babylon/tools/tools.h>
 
 namespace BABYLON {
 
+namespace {
+
+const DerivedAssetCache::Step NormalsStep{"normals", 1};
+
+} // end of anonymous namespace
+
 VertexData::VertexData()
 {
 }
@@ -2479,6 +2489,27 @@ void VertexData::ComputeNormals(const Float32Array& positions,
     normals.resize(positions.size());
   }
 
+  // The normals of large meshes are cached
+  auto& cache = DerivedAssetCache::Instance();
+  const auto inputSize
+    = positions.size() * sizeof(float) + indices.size() * sizeof(uint32_t);
+  const bool useCache
+    = normals.size() == positions.size() && cache.caches(inputSize);
+  uint64_t inputHash = 0;
+  if (useCache) {
+    inputHash
+      = Hash64(indices.data(), indices.size() * sizeof(uint32_t),
+               Hash64(positions.data(), positions.size() * sizeof(float)));
+    Uint8Array blob;
+    size_t offset = 0;
+    if (cache.load(NormalsStep, inputHash, blob)
+        && DerivedAssetCache::Read(blob, offset, normals)
+        && normals.size() == positions.size()) {
+      return;
+    }
+    normals.resize(positions.size());
+  }
+
   unsigned int index = 0;
 
   // temp Vector3
@@ -2529,6 +2560,12 @@ void VertexData::ComputeNormals(const Float32Array& positions,
     normals[index * 3 + 1] = vertexNormali1.y;
     normals[index * 3 + 2] = vertexNormali1.z;
   }
+
+  if (useCache) {
+    Uint8Array blob;
+    DerivedAssetCache::Append(blob, normals, 3);
+    cache.store(NormalsStep, inputHash, blob);
+  }
 }
 
 void VertexData::ComputeNormals(const Float32Array& positions,
@@ -2821,88 +2858,222 @@ void VertexData::ImportVertexData(const Json::value& parsedVertexData,
                                   Geometry* geometry)
 {
   auto vertexData = std::make_unique<VertexData>();
+  ImportVertexData(parsedVertexData, *vertexData, geometry);
+}
+
+void VertexData::ImportVertexData(const Json::value& parsedVertexData,
+                                  VertexData& vertexData, Geometry* geometry)
+{
+  ImportVertexData(parsedVertexData, vertexData);
+
+  geometry->setAllVerticesData(
+    &vertexData, Json::GetBool(parsedVertexData, "updatable", false));
+}
 
-  // positions
-  Float32Array positions = Json::ToArray<float>(parsedVertexData, "positions");
-  if (parsedVertexData.contains("positions")) {
-    vertexData->set(positions, VertexBuffer::PositionKind);
+void VertexData::ImportVertexData(const Json::value& parsedVertexData,
+                                  VertexData& vertexData)
+{
+  // Float attributes
+  static const std::array<std::pair<const char*, Float32Array VertexData::*>,
+                          12>
+    attributes{{
+      {"positions", &VertexData::positions},
+      {"normals", &VertexData::normals},
+      {"tangents", &VertexData::tangents},
+      {"uvs", &VertexData::uvs},
+      {"uv2s", &VertexData::uvs2},
+      {"uv3s", &VertexData::uvs3},
+      {"uv4s", &VertexData::uvs4},
+      {"uv5s", &VertexData::uvs5},
+      {"uv6s", &VertexData::uvs6},
+      {"colors", &VertexData::colors},
+      {"matricesIndices", &VertexData::matricesIndices},
+      {"matricesWeights", &VertexData::matricesWeights},
+    }};
+  for (const auto& attribute : attributes) {
+    auto& data = vertexData.*(attribute.second);
+    if (data.empty() && parsedVertexData.contains(attribute.first)) {
+      data = Json::ToArray<float>(parsedVertexData, attribute.first);
+    }
   }
 
-  // normals
-  if (parsedVertexData.contains("normals")) {
-    vertexData->set(Json::ToArray<float>(parsedVertexData, "normals"),
-                    VertexBuffer::NormalKind);
+  // colors, converted once from Color3 to Color4
+  const auto vertexCount = vertexData.positions.size() / 3;
+  if (!vertexData.colors.empty()
+      && vertexData.colors.size() != vertexCount * 4) {
+    vertexData.colors = Color4::CheckColors4(vertexData.colors, vertexCount);
   }
 
-  // tangents
-  if (parsedVertexData.contains("tangents")) {
-    vertexData->set(Json::ToArray<float>(parsedVertexData, "tangents"),
-                    VertexBuffer::TangentKind);
+  // indices
+  if (vertexData.indices.empty() && parsedVertexData.contains("indices")) {
+    vertexData.indices = Json::ToArray<uint32_t>(parsedVertexData, "indices");
   }
+}
 
-  // uvs
-  if (parsedVertexData.contains("uvs")) {
-    vertexData->set(Json::ToArray<float>(parsedVertexData, "uvs"),
-                    VertexBuffer::UVKind);
+bool VertexData::CanUse16BitIndices(const IndicesArray& indices,
+                                    size_t totalVertices)
+{
+  static constexpr size_t MaxUint16Index = 65535;
+  // Only a larger mesh is trusted, the vertex count can be stale when the
+  // indices are set before the vertices
+  if (totalVertices > MaxUint16Index + 1) {
+    return false;
+  }
+  return std::none_of(indices.begin(), indices.end(), [](uint32_t index) {
+    return index > MaxUint16Index;
+  });
+}
+
+Uint16Array VertexData::ToUint16Indices(const IndicesArray& indices)
+{
+  Uint16Array result(indices.size());
+  std::transform(indices.begin(), indices.end(), result.begin(),
+                 [](uint32_t index) { return static_cast<uint16_t>(index); });
+  return result;
+}
+
+IndicesArray VertexData::ToIndicesArray(const Uint16Array& indices)
+{
+  return IndicesArray(indices.begin(), indices.end());
+}
+
+Uint32Array VertexData::QuantizePositions(const Float32Array& positions,
+                                          Matrix& dequantization)
+{
+  const size_t vertexCount = positions.size() / 3;
+  if (vertexCount == 0) {
+    dequantization = Matrix::Identity();
+    return Uint32Array();
   }
 
-  // uv2s
-  if (parsedVertexData.contains("uv2s")) {
-    vertexData->set(Json::ToArray<float>(parsedVertexData, "uv2s"),
-                    VertexBuffer::UV2Kind);
+  // Bounds of the positions
+  auto minimum = Vector3(positions[0], positions[1], positions[2]);
+  auto maximum = minimum;
+  for (size_t i = 1; i < vertexCount; ++i) {
+    const Vector3 position(positions[i * 3 + 0], positions[i * 3 + 1],
+                           positions[i * 3 + 2]);
+    minimum.minimizeInPlace(position);
+    maximum.maximizeInPlace(position);
   }
 
-  // uv3s
-  if (parsedVertexData.contains("uv3s")) {
-    vertexData->set(Json::ToArray<float>(parsedVertexData, "uv3s"),
-                    VertexBuffer::UV3Kind);
+  const auto center = (minimum + maximum).scale(0.5f);
+  const auto extent = (maximum - minimum).scale(0.5f);
+  auto scale        = std::max(extent.x, std::max(extent.y, extent.z));
+  if (scale <= 0.f) {
+    scale = 1.f;
   }
 
-  // uv4s
-  if (parsedVertexData.contains("uv4s")) {
-    vertexData->set(Json::ToArray<float>(parsedVertexData, "uv4s"),
-                    VertexBuffer::UV4Kind);
+  const auto quantize = [](float value) {
+    const auto clamped = std::min(1.f, std::max(-1.f, value));
+    const auto snorm = static_cast<int16_t>(std::round(clamped * 32767.f));
+    return static_cast<uint32_t>(static_cast<uint16_t>(snorm));
+  };
+
+  Uint32Array result(vertexCount * 2);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    const auto x = quantize((positions[i * 3 + 0] - center.x) / scale);
+    const auto y = quantize((positions[i * 3 + 1] - center.y) / scale);
+    const auto z = quantize((positions[i * 3 + 2] - center.z) / scale);
+    result[i * 2 + 0] = x | (y << 16);
+    result[i * 2 + 1] = z;
   }
 
-  // uv5s
-  if (parsedVertexData.contains("uv5s")) {
-    vertexData->set(Json::ToArray<float>(parsedVertexData, "uv5s"),
-                    VertexBuffer::UV5Kind);
+  dequantization
+    = Matrix::Scaling(scale, scale, scale)
+        .multiply(Matrix::Translation(center.x, center.y, center.z));
+
+  return result;
+}
+
+Uint32Array VertexData::PackNormals(const Float32Array& normals,
+                                    size_t components)
+{
+  const auto snorm = [](float value, float range, uint32_t mask) {
+    const auto clamped = std::min(1.f, std::max(-1.f, value));
+    return static_cast<uint32_t>(
+             static_cast<int32_t>(std::round(clamped * range)))
+           & mask;
+  };
+
+  const size_t vertexCount = components > 0 ? normals.size() / components : 0;
+  Uint32Array result(vertexCount);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    const auto offset = i * components;
+    uint32_t packed   = snorm(normals[offset + 0], 511.f, 0x3ff)
+                      | (snorm(normals[offset + 1], 511.f, 0x3ff) << 10)
+                      | (snorm(normals[offset + 2], 511.f, 0x3ff) << 20);
+    if (components > 3) {
+      packed |= snorm(normals[offset + 3], 1.f, 0x3) << 30;
+    }
+    result[i] = packed;
   }
 
-  // uv6s
-  if (parsedVertexData.contains("uv6s")) {
-    vertexData->set(Json::ToArray<float>(parsedVertexData, "uv6s"),
-                    VertexBuffer::UV6Kind);
+  return result;
+}
+
+Uint32Array VertexData::PackHalfFloats(const Float32Array& data,
+                                       size_t components)
+{
+  const size_t vertexCount    = components > 0 ? data.size() / components : 0;
+  const size_t wordsPerVertex = (components + 1) / 2;
+  Uint32Array result(vertexCount * wordsPerVertex, 0);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    for (size_t c = 0; c < components; ++c) {
+      const uint32_t half = Scalar::ToHalfFloat(data[i * components + c]);
+      result[i * wordsPerVertex + c / 2] |= half << ((c % 2) * 16);
+    }
   }
 
-  // colors
-  if (parsedVertexData.contains("colors")) {
-    const Float32Array colors
-      = Json::ToArray<float>(parsedVertexData, "colors");
-    vertexData->set(Color4::CheckColors4(colors, positions.size() / 3),
-                    VertexBuffer::ColorKind);
+  return result;
+}
+
+Uint32Array VertexData::PackUnorm16(const Float32Array& data, size_t components)
+{
+  const size_t vertexCount    = components > 0 ? data.size() / components : 0;
+  const size_t wordsPerVertex = (components + 1) / 2;
+  Uint32Array result(vertexCount * wordsPerVertex, 0);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    for (size_t c = 0; c < components; ++c) {
+      const auto clamped
+        = std::min(1.f, std::max(0.f, data[i * components + c]));
+      const auto value = static_cast<uint32_t>(std::round(clamped * 65535.f));
+      result[i * wordsPerVertex + c / 2] |= value << ((c % 2) * 16);
+    }
   }
 
-  // matricesIndices
-  if (parsedVertexData.contains("matricesIndices")) {
-    vertexData->set(Json::ToArray<float>(parsedVertexData, "matricesIndices"),
-                    VertexBuffer::MatricesIndicesKind);
+  return result;
+}
+
+Uint32Array VertexData::Interleave(const std::vector<Uint32Array>& attributes,
+                                   size_t totalVertices,
+                                   std::vector<size_t>& wordOffsets)
+{
+  wordOffsets.clear();
+  if (totalVertices == 0) {
+    return Uint32Array();
   }
 
-  // matricesWeights
-  if (parsedVertexData.contains("matricesWeights")) {
-    vertexData->set(Json::ToArray<float>(parsedVertexData, "matricesWeights"),
-                    VertexBuffer::MatricesWeightsKind);
+  size_t wordsPerVertex = 0;
+  for (const auto& attribute : attributes) {
+    if (attribute.empty() || attribute.size() % totalVertices != 0) {
+      wordOffsets.clear();
+      return Uint32Array();
+    }
+    wordOffsets.emplace_back(wordsPerVertex);
+    wordsPerVertex += attribute.size() / totalVertices;
   }
 
-  // indices
-  if (parsedVertexData.contains("indices")) {
-    vertexData->indices = Json::ToArray<uint32_t>(parsedVertexData, "indices");
+  Uint32Array result(totalVertices * wordsPerVertex);
+  for (size_t a = 0; a < attributes.size(); ++a) {
+    const auto& attribute     = attributes[a];
+    const auto attributeWords = attribute.size() / totalVertices;
+    for (size_t i = 0; i < totalVertices; ++i) {
+      std::copy_n(attribute.begin() + i * attributeWords, attributeWords,
+                  result.begin() + i * wordsPerVertex + wordOffsets[a]);
+    }
   }
 
-  geometry->setAllVerticesData(
-    vertexData.get(), Json::GetBool(parsedVertexData, "updatable", false));
+  return result;
 }
 
 } // end of namespace BABYLON
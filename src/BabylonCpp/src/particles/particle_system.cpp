@@ -93,6 +93,9 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity,
   _vertexBuffers[VertexBuffer::PositionKindChars] = std::move(positions);
   _vertexBuffers[VertexBuffer::ColorKindChars]    = std::move(colors);
   _vertexBuffers["options"]                       = std::move(options);
+  for (auto& item : _vertexBuffers) {
+    _vertexBufferBindings[item.first] = item.second.get();
+  }
 
   // Default behaviors
   startDirectionFunction
@@ -412,11 +415,7 @@ size_t ParticleSystem::render()
   }
 
   // VBOs
-  std::unordered_map<std::string, VertexBuffer*> vertexBuffersTmp;
-  for (auto& item : _vertexBuffers) {
-    vertexBuffersTmp[item.first] = item.second.get();
-  }
-  engine->bindBuffers(vertexBuffersTmp, _indexBuffer.get(), effect);
+  engine->bindBuffers(_vertexBufferBindings, _indexBuffer.get(), effect);
 
   // Draw order
   if (blendMode == ParticleSystem::BLENDMODE_ONEONE) {
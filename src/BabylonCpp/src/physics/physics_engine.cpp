@@ -166,4 +166,15 @@ bool PhysicsEngine::isInitialized() const
   return _initialized;
 }
 
+size_t PhysicsEngine::getImpostorsCount() const
+{
+  return _impostors.size();
+}
+
+size_t PhysicsEngine::getMemorySize() const
+{
+  return _impostors.size() * sizeof(PhysicsImpostor)
+         + _joints.size() * sizeof(PhysicsImpostorJoint);
+}
+
 } // end of namespace BABYLON
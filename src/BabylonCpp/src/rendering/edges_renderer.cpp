@@ -1,16 +1,103 @@
 #include <babylon/rendering/edges_renderer.h>
 
 #include <babylon/cameras/camera.h>
+#include <babylon/core/hash.h>
+#include <babylon/core/worker_pool.h>
 #include <babylon/engine/engine.h>
 #include <babylon/engine/scene.h>
 #include <babylon/materials/shader_material.h>
 #include <babylon/materials/shader_material_options.h>
+#include <babylon/math/math_tools.h>
 #include <babylon/mesh/abstract_mesh.h>
 #include <babylon/mesh/vertex_buffer.h>
-#include <babylon/rendering/face_adjacencies.h>
+#include <babylon/tools/derived_asset_cache.h>
 
 namespace BABYLON {
 
+namespace {
+
+const DerivedAssetCache::Step EdgesLinesStep{"edgeslines", 2};
+
+constexpr uint32_t InvalidVertex = std::numeric_limits<uint32_t>::max();
+
+/**
+ * @brief Returns the key of an edge, the same in both directions.
+ */
+uint64_t edgeKey(uint32_t a, uint32_t b)
+{
+  return (a < b) ? (static_cast<uint64_t>(a) << 32) | b :
+                   (static_cast<uint64_t>(b) << 32) | a;
+}
+
+/**
+ * @brief Returns the key of a cell of a grid, different cells possibly having
+ * the same key.
+ */
+uint64_t cellKey(int64_t x, int64_t y, int64_t z)
+{
+  return static_cast<uint64_t>(x * 73856093)
+         ^ static_cast<uint64_t>(y * 19349663)
+         ^ static_cast<uint64_t>(z * 83492791);
+}
+
+/**
+ * @brief Welds the vertices at the same position within epsilon.
+ * @returns The welded vertex of each vertex.
+ */
+Uint32Array weldVertices(span<const float> positions, float epsilon)
+{
+  // The welded vertices are stored in a grid of cells twice as large as
+  // epsilon, the ones within epsilon of a vertex being in the 2 x 2 x 2 cells
+  // around it
+  const size_t vertexCount = positions.size() / 3;
+  Uint32Array welded(vertexCount);
+  std::vector<Vector3> weldedPositions;
+  Uint32Array nextInCell;
+  std::unordered_map<uint64_t, uint32_t> cells;
+  cells.reserve(vertexCount);
+  std::array<int64_t, 3> cell, neighbor;
+  for (size_t i = 0; i < vertexCount; ++i) {
+    const Vector3 position(positions[i * 3], positions[i * 3 + 1],
+                           positions[i * 3 + 2]);
+    for (size_t axis = 0; axis < 3; ++axis) {
+      const auto coordinate = positions[i * 3 + axis] / (2.f * epsilon);
+      const auto floor      = std::floor(coordinate);
+      cell[axis]            = static_cast<int64_t>(floor);
+      neighbor[axis]        = (coordinate - floor < 0.5f) ? -1 : 1;
+    }
+    auto vertex = InvalidVertex;
+    for (size_t n = 0; n < 8 && vertex == InvalidVertex; ++n) {
+      const auto it
+        = cells.find(cellKey(cell[0] + ((n & 1) ? neighbor[0] : 0),
+                             cell[1] + ((n & 2) ? neighbor[1] : 0),
+                             cell[2] + ((n & 4) ? neighbor[2] : 0)));
+      if (it == cells.end()) {
+        continue;
+      }
+      for (auto other = it->second; other != InvalidVertex;
+           other = nextInCell[other]) {
+        if (weldedPositions[other].equalsWithEpsilon(position, epsilon)) {
+          vertex = other;
+          break;
+        }
+      }
+    }
+    if (vertex == InvalidVertex) {
+      vertex = static_cast<uint32_t>(weldedPositions.size());
+      weldedPositions.emplace_back(position);
+      auto& head = cells.emplace(cellKey(cell[0], cell[1], cell[2]),
+                                 InvalidVertex).first->second;
+      nextInCell.emplace_back(head);
+      head = vertex;
+    }
+    welded[i] = vertex;
+  }
+
+  return welded;
+}
+
+} // end of anonymous namespace
+
 EdgesRenderer::EdgesRenderer(AbstractMesh* source, float epsilon,
                              bool checkVerticesInsteadOfIndices)
     : edgesWidthScalerForOrthographic{1000.f}
@@ -20,6 +107,8 @@ EdgesRenderer::EdgesRenderer(AbstractMesh* source, float epsilon,
     , _lineShader{nullptr}
     , _ib{nullptr}
     , _checkVerticesInsteadOfIndices{checkVerticesInsteadOfIndices}
+    , _isGeometryDirty{false}
+    , _adjacenciesHash{0}
 {
   _prepareResources();
   _generateEdgesLines();
@@ -49,273 +138,201 @@ void EdgesRenderer::_prepareResources()
 
 void EdgesRenderer::dispose(bool /*doNotRecurse*/)
 {
-  if (_buffers.find(VertexBuffer::PositionKind) != _buffers.end()) {
-    auto& buffer = _buffers[VertexBuffer::PositionKind];
-    if (buffer) {
-      buffer->dispose();
-      _buffers.erase(VertexBuffer::PositionKind);
-    }
-  }
+  _releaseBuffers();
+  _lineShader->dispose();
+}
 
-  if (_buffers.find(VertexBuffer::NormalKind) != _buffers.end()) {
-    auto& buffer = _buffers[VertexBuffer::NormalKind];
-    if (buffer) {
-      buffer->dispose();
-      _buffers.erase(VertexBuffer::NormalKind);
+void EdgesRenderer::_releaseBuffers()
+{
+  for (auto& item : _buffers) {
+    if (item.second) {
+      item.second->dispose();
     }
   }
 
   _buffers.clear();
   _bufferPtrs.clear();
 
-  _source->getScene()->getEngine()->_releaseBuffer(_ib.get());
-  _lineShader->dispose();
+  if (_ib) {
+    _source->getScene()->getEngine()->_releaseBuffer(_ib.get());
+    _ib.reset(nullptr);
+  }
 }
 
-int EdgesRenderer::_processEdgeForAdjacencies(unsigned int pa, unsigned int pb,
-                                              unsigned int p0, unsigned int p1,
-                                              unsigned int p2)
+void EdgesRenderer::_markGeometryDirty()
 {
-  if ((pa == p0 && pb == p1) || (pa == p1 && pb == p0)) {
-    return 0;
-  }
-
-  if ((pa == p1 && pb == p2) || (pa == p2 && pb == p1)) {
-    return 1;
-  }
-
-  if ((pa == p2 && pb == p0) || (pa == p0 && pb == p2)) {
-    return 2;
-  }
-
-  return -1;
+  _isGeometryDirty = true;
 }
 
-int EdgesRenderer::_processEdgeForAdjacenciesWithVertices(const Vector3& pa,
-                                                          const Vector3& pb,
-                                                          const Vector3& p0,
-                                                          const Vector3& p1,
-                                                          const Vector3& p2)
+Int32Array
+EdgesRenderer::BuildFaceAdjacencies(span<const float> positions,
+                                    const IndicesView& indices,
+                                    bool checkVerticesInsteadOfIndices)
 {
-  if ((pa.equalsWithEpsilon(p0) && pb.equalsWithEpsilon(p1))
-      || (pa.equalsWithEpsilon(p1) && pb.equalsWithEpsilon(p0))) {
-    return 0;
-  }
+  const size_t faceCount = indices.size() / 3;
+  Int32Array adjacencies(faceCount * 3, -1);
 
-  if ((pa.equalsWithEpsilon(p1) && pb.equalsWithEpsilon(p2))
-      || (pa.equalsWithEpsilon(p2) && pb.equalsWithEpsilon(p1))) {
-    return 1;
+  Uint32Array welded;
+  if (checkVerticesInsteadOfIndices) {
+    welded = weldVertices(positions, MathTools::Epsilon);
   }
-
-  if ((pa.equalsWithEpsilon(p2) && pb.equalsWithEpsilon(p0))
-      || (pa.equalsWithEpsilon(p0) && pb.equalsWithEpsilon(p2))) {
-    return 2;
+  const auto vertex = [&](size_t index) {
+    return checkVerticesInsteadOfIndices ? welded[indices[index]] :
+                                           indices[index];
+  };
+
+  // Each edge waits for the next face sharing it, then both are adjacent
+  std::unordered_map<uint64_t, size_t> openEdges;
+  openEdges.reserve(faceCount * 3 / 2);
+  for (size_t face = 0; face < faceCount; ++face) {
+    for (size_t i = 0; i < 3; ++i) {
+      const auto edge = face * 3 + i;
+      const auto key  = edgeKey(vertex(edge), vertex(face * 3 + (i + 1) % 3));
+      auto it         = openEdges.find(key);
+      if (it == openEdges.end()) {
+        openEdges.emplace(key, edge);
+      }
+      else if (it->second / 3 != face) {
+        adjacencies[edge]       = static_cast<int32_t>(it->second / 3);
+        adjacencies[it->second] = static_cast<int32_t>(face);
+        openEdges.erase(it);
+      }
+    }
   }
 
-  return -1;
+  return adjacencies;
 }
 
-void EdgesRenderer::_checkEdge(unsigned int faceIndex, int edge,
-                               std::vector<Vector3> faceNormals,
-                               const Vector3& p0, const Vector3& p1)
+void EdgesRenderer::_addLine(const Vector3& p0, const Vector3& p1)
 {
-  auto needToCreateLine = false;
-
-  if (edge == -1) {
-    needToCreateLine = true;
-  }
-  else {
-    auto dotProduct = Vector3::Dot(faceNormals[faceIndex],
-                                   faceNormals[static_cast<size_t>(edge)]);
-    needToCreateLine = dotProduct < _epsilon;
-  }
-
-  if (needToCreateLine) {
-    auto offset = static_cast<int32_t>(_linesPositions.size() / 3);
-    auto normal = p0.subtract(p1);
-    normal.normalize();
-
-    // Positions
-    _linesPositions.emplace_back(p0.x);
-    _linesPositions.emplace_back(p0.y);
-    _linesPositions.emplace_back(p0.z);
-
-    _linesPositions.emplace_back(p0.x);
-    _linesPositions.emplace_back(p0.y);
-    _linesPositions.emplace_back(p0.z);
-
-    _linesPositions.emplace_back(p1.x);
-    _linesPositions.emplace_back(p1.y);
-    _linesPositions.emplace_back(p1.z);
-
-    _linesPositions.emplace_back(p1.x);
-    _linesPositions.emplace_back(p1.y);
-    _linesPositions.emplace_back(p1.z);
-
-    // Normals
-    _linesNormals.emplace_back(p1.x);
-    _linesNormals.emplace_back(p1.y);
-    _linesNormals.emplace_back(p1.z);
-    _linesNormals.emplace_back(-1.f);
-
-    _linesNormals.emplace_back(p1.x);
-    _linesNormals.emplace_back(p1.y);
-    _linesNormals.emplace_back(p1.z);
-    _linesNormals.emplace_back(1.f);
-
-    _linesNormals.emplace_back(p0.x);
-    _linesNormals.emplace_back(p0.y);
-    _linesNormals.emplace_back(p0.z);
-    _linesNormals.emplace_back(-1.f);
-
-    _linesNormals.emplace_back(p0.x);
-    _linesNormals.emplace_back(p0.y);
-    _linesNormals.emplace_back(p0.z);
-    _linesNormals.emplace_back(1.f);
-
-    // Indices
-    _linesIndices.emplace_back(offset + 0);
-    _linesIndices.emplace_back(offset + 1);
-    _linesIndices.emplace_back(offset + 2);
-    _linesIndices.emplace_back(offset + 0);
-    _linesIndices.emplace_back(offset + 2);
-    _linesIndices.emplace_back(offset + 3);
-  }
+  auto offset = static_cast<uint32_t>(_linesPositions.size() / 3);
+
+  // Positions
+  _linesPositions.insert(_linesPositions.end(),
+                         {p0.x, p0.y, p0.z, p0.x, p0.y, p0.z, //
+                          p1.x, p1.y, p1.z, p1.x, p1.y, p1.z});
+
+  // Normals
+  _linesNormals.insert(_linesNormals.end(),
+                       {p1.x, p1.y, p1.z, -1.f, p1.x, p1.y, p1.z, 1.f, //
+                        p0.x, p0.y, p0.z, -1.f, p0.x, p0.y, p0.z, 1.f});
+
+  // Indices
+  _linesIndices.insert(_linesIndices.end(),
+                       {offset + 0, offset + 1, offset + 2, offset + 0,
+                        offset + 2, offset + 3});
 }
 
-void EdgesRenderer::_generateEdgesLines()
+void EdgesRenderer::_computeEdgesLines(span<const float> positions,
+                                       const IndicesView& indices)
 {
-  auto positions = _source->getVerticesData(VertexBuffer::PositionKind);
-  auto indices   = _source->getIndices();
-
-  // First let's find adjacencies
-  std::vector<FaceAdjacencies> adjacencies;
-  std::vector<Vector3> faceNormals;
-  FaceAdjacencies faceAdjacencies;
-
-  // Prepare faces
-  for (unsigned int index = 0; index < indices.size(); index += 3) {
-    FaceAdjacencies _faceAdjacencies;
-    unsigned int p0Index = indices[index + 0];
-    unsigned int p1Index = indices[index + 1];
-    unsigned int p2Index = indices[index + 2];
-
-    _faceAdjacencies.p0
-      = Vector3(positions[p0Index * 3 + 0], positions[p0Index * 3 + 1],
-                positions[p0Index * 3 + 2]);
-    _faceAdjacencies.p1
-      = Vector3(positions[p1Index * 3 + 0], positions[p1Index * 3 + 1],
-                positions[p1Index * 3 + 2]);
-    _faceAdjacencies.p2
-      = Vector3(positions[p2Index * 3 + 0], positions[p2Index * 3 + 1],
-                positions[p2Index * 3 + 2]);
-    auto faceNormal
-      = Vector3::Cross(_faceAdjacencies.p1.subtract(_faceAdjacencies.p0),
-                       _faceAdjacencies.p2.subtract(_faceAdjacencies.p1));
-
-    faceNormal.normalize();
-
-    faceNormals.emplace_back(faceNormal);
-    adjacencies.emplace_back(_faceAdjacencies);
+  const size_t faceCount = indices.size() / 3;
+
+  // The adjacencies are kept while the indices, and the positions when
+  // checking vertices, are the same
+  auto adjacenciesHash = Hash64(indices.data(), indices.byteSize(),
+                                _checkVerticesInsteadOfIndices ? 1 : 0);
+  if (_checkVerticesInsteadOfIndices) {
+    adjacenciesHash = Hash64(positions.data(), positions.size() * sizeof(float),
+                             adjacenciesHash);
+  }
+  if (_faceAdjacencies.size() != faceCount * 3
+      || _adjacenciesHash != adjacenciesHash) {
+    _faceAdjacencies = BuildFaceAdjacencies(positions, indices,
+                                            _checkVerticesInsteadOfIndices);
+    _adjacenciesHash = adjacenciesHash;
   }
 
-  // Scan
-  for (unsigned int index = 0; index < adjacencies.size(); ++index) {
-    faceAdjacencies = adjacencies[index];
-
-    for (unsigned int otherIndex = index + 1; otherIndex < adjacencies.size();
-         ++otherIndex) {
-      auto& otherFaceAdjacencies = adjacencies[otherIndex];
-
-      if (faceAdjacencies.edgesConnectedCount == 3) { // Full
-        break;
+  const auto position = [&](size_t index) {
+    const auto offset = static_cast<size_t>(indices[index]) * 3;
+    return Vector3(positions[offset], positions[offset + 1],
+                   positions[offset + 2]);
+  };
+
+  // Face normals, the faces of large meshes being processed on the shared
+  // worker pool
+  auto& pool = *WorkerPool::Shared();
+  std::vector<Vector3> faceNormals(faceCount);
+  pool.parallelFor(faceCount, FacesPerTask, [&](size_t first, size_t last) {
+    for (auto face = first; face < last; ++face) {
+      const auto p0 = position(face * 3);
+      const auto p1 = position(face * 3 + 1);
+      const auto p2 = position(face * 3 + 2);
+      faceNormals[face]
+        = Vector3::Cross(p1.subtract(p0), p2.subtract(p1)).normalize();
+    }
+  });
+
+  // We need a line when a face has no adjacency on a specific edge or if the
+  // adjacency has an angle greater than epsilon, the line of an edge shared
+  // by two faces being created by the first one
+  Uint8Array needLines(faceCount * 3, 0);
+  pool.parallelFor(faceCount, FacesPerTask, [&](size_t first, size_t last) {
+    for (auto edge = first * 3; edge < last * 3; ++edge) {
+      const auto otherFace = _faceAdjacencies[edge];
+      if (otherFace == -1) {
+        needLines[edge] = 1;
       }
-
-      if (otherFaceAdjacencies.edgesConnectedCount == 3) { // Full
-        continue;
+      else if (static_cast<size_t>(otherFace) > edge / 3) {
+        const auto dotProduct = Vector3::Dot(
+          faceNormals[edge / 3], faceNormals[static_cast<size_t>(otherFace)]);
+        needLines[edge] = (dotProduct < _epsilon) ? 1 : 0;
       }
+    }
+  });
 
-      auto otherP0 = indices[otherIndex * 3 + 0];
-      auto otherP1 = indices[otherIndex * 3 + 1];
-      auto otherP2 = indices[otherIndex * 3 + 2];
-
-      for (unsigned int edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
-        int otherEdgeIndex = 0;
-
-        if (edgeIndex >= faceAdjacencies.edges.size()) {
-          continue;
-        }
-
-        switch (edgeIndex) {
-          case 0:
-            if (_checkVerticesInsteadOfIndices) {
-              otherEdgeIndex = _processEdgeForAdjacenciesWithVertices(
-                faceAdjacencies.p0, faceAdjacencies.p1, otherFaceAdjacencies.p0,
-                otherFaceAdjacencies.p1, otherFaceAdjacencies.p2);
-            }
-            else {
-              otherEdgeIndex = _processEdgeForAdjacencies(
-                indices[index * 3], indices[index * 3 + 1], otherP0, otherP1,
-                otherP2);
-            }
-            break;
-          case 1:
-            if (_checkVerticesInsteadOfIndices) {
-              otherEdgeIndex = _processEdgeForAdjacenciesWithVertices(
-                faceAdjacencies.p1, faceAdjacencies.p2, otherFaceAdjacencies.p0,
-                otherFaceAdjacencies.p1, otherFaceAdjacencies.p2);
-            }
-            else {
-              otherEdgeIndex = _processEdgeForAdjacencies(
-                indices[index * 3 + 1], indices[index * 3 + 2], otherP0,
-                otherP1, otherP2);
-            }
-            break;
-          case 2:
-          default:
-            if (_checkVerticesInsteadOfIndices) {
-              otherEdgeIndex = _processEdgeForAdjacenciesWithVertices(
-                faceAdjacencies.p2, faceAdjacencies.p0, otherFaceAdjacencies.p0,
-                otherFaceAdjacencies.p1, otherFaceAdjacencies.p2);
-            }
-            else {
-              otherEdgeIndex = _processEdgeForAdjacencies(
-                indices[index * 3 + 2], indices[index * 3], otherP0, otherP1,
-                otherP2);
-            }
-        }
-
-        if (otherEdgeIndex == -1) {
-          continue;
-        }
-
-        faceAdjacencies.edges[edgeIndex] = static_cast<int>(otherIndex);
-        otherFaceAdjacencies.edges[static_cast<size_t>(otherEdgeIndex)]
-          = static_cast<int>(index);
-
-        ++faceAdjacencies.edgesConnectedCount;
-        ++otherFaceAdjacencies.edgesConnectedCount;
-
-        if (faceAdjacencies.edgesConnectedCount == 3) {
-          break;
-        }
-      }
+  // Create lines
+  for (size_t edge = 0; edge < needLines.size(); ++edge) {
+    if (needLines[edge]) {
+      const auto face = edge / 3;
+      _addLine(position(edge), position(face * 3 + (edge + 1) % 3));
     }
   }
+}
 
-  // Create lines
-  for (unsigned index = 0; index < adjacencies.size(); ++index) {
-    // We need a line when a face has no adjacency on a specific edge or if all
-    // the adjacencies has an angle greater than epsilon
-    const auto& current = adjacencies[index];
-
-    _checkEdge(index, current.edges[0], faceNormals, current.p0, current.p1);
-    _checkEdge(index, current.edges[1], faceNormals, current.p1, current.p2);
-    _checkEdge(index, current.edges[2], faceNormals, current.p2, current.p0);
+void EdgesRenderer::_generateEdgesLines()
+{
+  auto positions = _source->getVerticesDataView(VertexBuffer::PositionKind);
+  auto indices   = _source->getIndicesView();
+
+  _isGeometryDirty = false;
+  _linesPositions.clear();
+  _linesNormals.clear();
+  _linesIndices.clear();
+
+  // The edges lines of large meshes are cached
+  auto& cache = DerivedAssetCache::Instance();
+  if (cache.caches(positions.size() * sizeof(float) + indices.byteSize())) {
+    const auto settings = Hash64(&_epsilon, sizeof(float),
+                                 _checkVerticesInsteadOfIndices ? 1 : 0);
+    const auto inputHash
+      = Hash64(indices.data(), indices.byteSize(),
+               Hash64(positions.data(), positions.size() * sizeof(float),
+                      settings));
+    Uint8Array blob;
+    size_t offset = 0;
+    if (!cache.load(EdgesLinesStep, inputHash, blob)
+        || !DerivedAssetCache::Read(blob, offset, _linesPositions)
+        || !DerivedAssetCache::Read(blob, offset, _linesNormals)
+        || !DerivedAssetCache::Read(blob, offset, _linesIndices)) {
+      _linesPositions.clear();
+      _linesNormals.clear();
+      _linesIndices.clear();
+      _computeEdgesLines(positions, indices);
+      blob.clear();
+      DerivedAssetCache::Append(blob, _linesPositions, 3);
+      DerivedAssetCache::Append(blob, _linesNormals, 4);
+      DerivedAssetCache::Append(blob, _linesIndices);
+      cache.store(EdgesLinesStep, inputHash, blob);
+    }
+  }
+  else {
+    _computeEdgesLines(positions, indices);
   }
 
   // Merge into a single mesh
   auto engine = _source->getScene()->getEngine();
+  _releaseBuffers();
 
   _buffers[VertexBuffer::PositionKind] = std::make_unique<VertexBuffer>(
     engine, _linesPositions, VertexBuffer::PositionKind, false);
@@ -337,6 +354,10 @@ void EdgesRenderer::render()
     return;
   }
 
+  if (_isGeometryDirty) {
+    _generateEdgesLines();
+  }
+
   auto scene  = _source->getScene();
   auto engine = scene->getEngine();
   _lineShader->_preBind();
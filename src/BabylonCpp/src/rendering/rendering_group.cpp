@@ -2,6 +2,7 @@
 
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
+#include <babylon/core/frame_arena.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/culling/bounding_sphere.h>
 #include <babylon/engine/engine.h>
@@ -142,7 +143,7 @@ void RenderingGroup::renderOpaqueSorted(const std::vector<SubMesh*>& subMeshes)
 {
   return RenderingGroup::renderSorted(subMeshes, _opaqueSortCompareFn,
                                       _scene->activeCamera->globalPosition(),
-                                      false);
+                                      false, &_scene->frameArena());
 }
 
 void RenderingGroup::renderAlphaTestSorted(
@@ -150,7 +151,7 @@ void RenderingGroup::renderAlphaTestSorted(
 {
   return RenderingGroup::renderSorted(subMeshes, _alphaTestSortCompareFn,
                                       _scene->activeCamera->globalPosition(),
-                                      false);
+                                      false, &_scene->frameArena());
 }
 
 void RenderingGroup::renderTransparentSorted(
@@ -158,13 +159,13 @@ void RenderingGroup::renderTransparentSorted(
 {
   return RenderingGroup::renderSorted(subMeshes, _transparentSortCompareFn,
                                       _scene->activeCamera->globalPosition(),
-                                      true);
+                                      true, &_scene->frameArena());
 }
 
 void RenderingGroup::renderSorted(
   const std::vector<SubMesh*>& subMeshes,
   const std::function<int(SubMesh* a, SubMesh* b)>& sortCompareFn,
-  const Vector3& cameraPosition, bool transparent)
+  const Vector3& cameraPosition, bool transparent, FrameArena* frameArena)
 {
   for (auto& subMesh : subMeshes) {
     subMesh->_alphaIndex = subMesh->getMesh()->alphaIndex;
@@ -174,7 +175,9 @@ void RenderingGroup::renderSorted(
           .length();
   }
 
-  auto sortedArray = subMeshes;
+  arena_vector<SubMesh*> sortedArray{
+    FrameArenaAllocator<SubMesh*>{frameArena}};
+  sortedArray.assign(subMeshes.begin(), subMeshes.end());
 
   // sort using a custom function object
   std::sort(
@@ -0,0 +1,121 @@
+#include <babylon/tools/async_image_loader.h>
+
+#include <babylon/core/mapped_file.h>
+#include <babylon/core/worker_pool.h>
+#include <babylon/interfaces/igl_rendering_context.h>
+#include <babylon/utils/stb_image.h>
+
+namespace BABYLON {
+
+AsyncImageLoader::AsyncImageLoader(size_t workerCount)
+    : _pendingCount{0}
+    , _tasks{
+        std::make_unique<WorkerTaskGroup>(WorkerPool::Create(workerCount))}
+{
+}
+
+AsyncImageLoader::~AsyncImageLoader()
+{
+  // Waits for the queued images to be decoded
+  _tasks.reset();
+}
+
+void AsyncImageLoader::loadImage(const std::string& url, const OnLoad& onLoad,
+                                 const OnError& onError, bool flipVertically)
+{
+  ++_pendingCount;
+
+  _tasks->send([this, url, onLoad, onError, flipVertically]() {
+    LoadResult result;
+    DecodeImage(url, result.image, result.error, flipVertically);
+    result.onLoad  = onLoad;
+    result.onError = onError;
+    _completed.push(std::move(result));
+  });
+}
+
+size_t AsyncImageLoader::processCompleted(size_t byteBudget)
+{
+  size_t bytes = 0;
+  LoadResult result;
+  while ((byteBudget == 0 || bytes < byteBudget)
+         && _completed.tryAndPop(result)) {
+    --_pendingCount;
+    bytes += result.image.data.size();
+    if (result.error.empty()) {
+      if (result.onLoad) {
+        result.onLoad(result.image);
+      }
+    }
+    else if (result.onError) {
+      result.onError(result.error);
+    }
+  }
+
+  return bytes;
+}
+
+size_t AsyncImageLoader::pendingCount() const
+{
+  return _pendingCount;
+}
+
+size_t AsyncImageLoader::workerCount() const
+{
+  return _tasks->workerCount();
+}
+
+bool AsyncImageLoader::DecodeImage(const std::string& url, Image& image,
+                                   std::string& error, bool flipVertically)
+{
+  MappedFile file(url);
+  if (!file.isOpen() || file.size() == 0) {
+    error = "Error loading image from file " + url;
+    return false;
+  }
+
+  if (!DecodeImage(file.data(), file.size(), image, error, flipVertically)) {
+    error += " from file " + url;
+    return false;
+  }
+
+  return true;
+}
+
+bool AsyncImageLoader::DecodeImage(const uint8_t* buffer, size_t size,
+                                   Image& image, std::string& error,
+                                   bool flipVertically)
+{
+  if (size == 0
+      || size > static_cast<size_t>(std::numeric_limits<int>::max())) {
+    error = "Error decoding image";
+    return false;
+  }
+
+  // The vertical flip of stb_image is a global setting, the rows are flipped
+  // below instead
+  int w = 0, h = 0, n = 0;
+  auto data = stbi_load_from_memory(buffer, static_cast<int>(size), &w, &h, &n,
+                                    STBI_rgb_alpha);
+  if (!data) {
+    error = "Error decoding image";
+    return false;
+  }
+
+  n     = STBI_rgb_alpha;
+  image = Image(data, w * h * n, w, h, n, GL::RGBA);
+  stbi_image_free(data);
+
+  if (flipVertically) {
+    const auto rowSize = static_cast<size_t>(w * n);
+    auto* pixels       = image.data.data();
+    for (int y = 0; y < h / 2; ++y) {
+      std::swap_ranges(pixels + y * rowSize, pixels + (y + 1) * rowSize,
+                       pixels + (h - 1 - y) * rowSize);
+    }
+  }
+
+  return true;
+}
+
+} // end of namespace BABYLON
@@ -6,31 +6,209 @@
 namespace BABYLON {
 namespace Internals {
 
-DDSInfo DDSTools::GetDDSInfo(const Uint8Array& arrayBuffer)
+bool DDSTools::GetDDSInfo(const Uint8Array& arrayBuffer, DDSInfo& info)
 {
-  Int32Array header(
-    reinterpret_cast<const int*>(arrayBuffer.data()),
-    reinterpret_cast<const int*>(arrayBuffer.data() + DDS::headerLengthInt));
+  Int32Array header(DDS::headerLengthInt + DDS::dx10HeaderLengthInt, 0);
+  if (arrayBuffer.size() < DDS::headerLengthInt * sizeof(int32_t)) {
+    BABYLON_LOG_ERROR("DDSTools", "Invalid DDS header");
+    return false;
+  }
+  std::memcpy(header.data(), arrayBuffer.data(),
+              std::min(arrayBuffer.size(), header.size() * sizeof(int32_t)));
+
+  if (header[off_magic] != DDS_MAGIC) {
+    BABYLON_LOG_ERROR("DDSTools", "Invalid magic number in DDS header");
+    return false;
+  }
 
-  int mipmapCount = 1;
+  info.width       = header[off_width];
+  info.height      = header[off_height];
+  info.mipmapCount = 1;
   if (header[off_flags] & DDSD_MIPMAPCOUNT) {
-    mipmapCount = std::max(1, header[off_mipmapCount]);
-  }
-
-  return {// width
-          header[off_width],
-          // height
-          header[off_height],
-          // mipmapCount
-          mipmapCount,
-          // isFourCC
-          (header[off_pfFlags] & DDPF_FOURCC) == DDPF_FOURCC,
-          // isRGB
-          (header[off_pfFlags] & DDPF_RGB) == DDPF_RGB,
-          // isLuminance
-          (header[off_pfFlags] & DDPF_LUMINANCE) == DDPF_LUMINANCE,
-          // isCube
-          (header[off_caps2] & DDSCAPS2_CUBEMAP) == DDSCAPS2_CUBEMAP};
+    info.mipmapCount = std::max(1, header[off_mipmapCount]);
+  }
+  info.isFourCC    = (header[off_pfFlags] & DDPF_FOURCC) == DDPF_FOURCC;
+  info.isRGB       = (header[off_pfFlags] & DDPF_RGB) == DDPF_RGB;
+  info.isLuminance = (header[off_pfFlags] & DDPF_LUMINANCE) == DDPF_LUMINANCE;
+  info.isCube = (header[off_caps2] & DDSCAPS2_CUBEMAP) == DDSCAPS2_CUBEMAP;
+  info.internalFormat = 0;
+  info.blockBytes     = 0;
+  info.bitsPerPixel   = header[off_RGBbpp];
+  info.dataOffset     = static_cast<size_t>(header[off_size]) + 4;
+
+  if (info.width <= 0 || info.height <= 0) {
+    BABYLON_LOG_ERROR("DDSTools", "Invalid size in DDS header");
+    return false;
+  }
+
+  if (info.isFourCC) {
+    if (!GetCompressedFormat(header, info)) {
+      return false;
+    }
+  }
+  else if (info.isRGB) {
+    if (info.bitsPerPixel != 24 && info.bitsPerPixel != 32) {
+      BABYLON_LOG_ERROR("DDSTools", "Unsupported RGB bit count: ",
+                        info.bitsPerPixel);
+      return false;
+    }
+  }
+  else if (!info.isLuminance) {
+    BABYLON_LOG_ERROR("DDSTools",
+                      "Unsupported format, must contain a FourCC code");
+    return false;
+  }
+
+  // Levels below 1x1 are ignored
+  int maxMipmapCount = 1;
+  for (int size = std::max(info.width, info.height); size > 1; size >>= 1) {
+    ++maxMipmapCount;
+  }
+  info.mipmapCount = std::min(info.mipmapCount, maxMipmapCount);
+
+  // All the levels of all the faces must be present
+  size_t faceLength = 0;
+  int width = info.width, height = info.height;
+  for (int i = 0; i < info.mipmapCount; ++i) {
+    faceLength += GetLevelLength(info, width, height);
+    width  = std::max(1, width >> 1);
+    height = std::max(1, height >> 1);
+  }
+  const size_t faces = info.isCube ? 6 : 1;
+  if (info.dataOffset + faceLength * faces > arrayBuffer.size()) {
+    BABYLON_LOG_ERROR("DDSTools", "Truncated DDS file");
+    return false;
+  }
+
+  return true;
+}
+
+bool DDSTools::GetCompressedFormat(const Int32Array& header, DDSInfo& info)
+{
+  const auto fourCC = static_cast<unsigned int>(header[off_pfFourCC]);
+  switch (fourCC) {
+    case DDS::FOURCC_DXT1:
+      info.blockBytes     = 8;
+      info.internalFormat = GL::COMPRESSED_RGBA_S3TC_DXT1_EXT;
+      break;
+    case DDS::FOURCC_DXT3:
+      info.blockBytes     = 16;
+      info.internalFormat = GL::COMPRESSED_RGBA_S3TC_DXT3_EXT;
+      break;
+    case DDS::FOURCC_DXT5:
+      info.blockBytes     = 16;
+      info.internalFormat = GL::COMPRESSED_RGBA_S3TC_DXT5_EXT;
+      break;
+    case DDS::FOURCC_ATI1:
+    case DDS::FOURCC_BC4U:
+      info.blockBytes     = 8;
+      info.internalFormat = GL::COMPRESSED_RED_RGTC1;
+      break;
+    case DDS::FOURCC_BC4S:
+      info.blockBytes     = 8;
+      info.internalFormat = GL::COMPRESSED_SIGNED_RED_RGTC1;
+      break;
+    case DDS::FOURCC_ATI2:
+    case DDS::FOURCC_BC5U:
+      info.blockBytes     = 16;
+      info.internalFormat = GL::COMPRESSED_RG_RGTC2;
+      break;
+    case DDS::FOURCC_BC5S:
+      info.blockBytes     = 16;
+      info.internalFormat = GL::COMPRESSED_SIGNED_RG_RGTC2;
+      break;
+    case DDS::FOURCC_DX10:
+      return GetDX10Format(header, info);
+    default:
+      BABYLON_LOG_ERROR("DDSTools", "Unsupported FourCC code: ",
+                        Int32ToFourCC(header[off_pfFourCC]));
+      return false;
+  }
+
+  return true;
+}
+
+bool DDSTools::GetDX10Format(const Int32Array& header, DDSInfo& info)
+{
+  info.dataOffset += DDS::dx10HeaderLengthInt * sizeof(int32_t);
+  if (header[off_miscFlag] & DDS_RESOURCE_MISC_TEXTURECUBE) {
+    info.isCube = true;
+  }
+  if (header[off_arraySize] > 1) {
+    BABYLON_LOG_ERROR("DDSTools", "Texture arrays are not supported");
+    return false;
+  }
+
+  switch (header[off_dxgiFormat]) {
+    case DXGI_FORMAT_BC1_UNORM:
+      info.blockBytes     = 8;
+      info.internalFormat = GL::COMPRESSED_RGBA_S3TC_DXT1_EXT;
+      break;
+    case DXGI_FORMAT_BC1_UNORM_SRGB:
+      info.blockBytes     = 8;
+      info.internalFormat = GL::COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT;
+      break;
+    case DXGI_FORMAT_BC2_UNORM:
+      info.blockBytes     = 16;
+      info.internalFormat = GL::COMPRESSED_RGBA_S3TC_DXT3_EXT;
+      break;
+    case DXGI_FORMAT_BC2_UNORM_SRGB:
+      info.blockBytes     = 16;
+      info.internalFormat = GL::COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT;
+      break;
+    case DXGI_FORMAT_BC3_UNORM:
+      info.blockBytes     = 16;
+      info.internalFormat = GL::COMPRESSED_RGBA_S3TC_DXT5_EXT;
+      break;
+    case DXGI_FORMAT_BC3_UNORM_SRGB:
+      info.blockBytes     = 16;
+      info.internalFormat = GL::COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT;
+      break;
+    case DXGI_FORMAT_BC4_UNORM:
+      info.blockBytes     = 8;
+      info.internalFormat = GL::COMPRESSED_RED_RGTC1;
+      break;
+    case DXGI_FORMAT_BC4_SNORM:
+      info.blockBytes     = 8;
+      info.internalFormat = GL::COMPRESSED_SIGNED_RED_RGTC1;
+      break;
+    case DXGI_FORMAT_BC5_UNORM:
+      info.blockBytes     = 16;
+      info.internalFormat = GL::COMPRESSED_RG_RGTC2;
+      break;
+    case DXGI_FORMAT_BC5_SNORM:
+      info.blockBytes     = 16;
+      info.internalFormat = GL::COMPRESSED_SIGNED_RG_RGTC2;
+      break;
+    case DXGI_FORMAT_BC7_UNORM:
+      info.blockBytes     = 16;
+      info.internalFormat = GL::COMPRESSED_RGBA_BPTC_UNORM;
+      break;
+    case DXGI_FORMAT_BC7_UNORM_SRGB:
+      info.blockBytes     = 16;
+      info.internalFormat = GL::COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
+      break;
+    default:
+      BABYLON_LOG_ERROR("DDSTools", "Unsupported DXGI format: ",
+                        header[off_dxgiFormat]);
+      return false;
+  }
+
+  return true;
+}
+
+size_t DDSTools::GetLevelLength(const DDSInfo& info, int width, int height)
+{
+  const auto w = static_cast<size_t>(width);
+  const auto h = static_cast<size_t>(height);
+  if (info.internalFormat != 0) {
+    return ((w + 3) / 4) * ((h + 3) / 4)
+           * static_cast<size_t>(info.blockBytes);
+  }
+  if (info.isRGB) {
+    return w * h * static_cast<size_t>(info.bitsPerPixel / 8);
+  }
+  return w * h;
 }
 
 Uint8Array DDSTools::GetRGBAArrayBuffer(float width, float height,
@@ -38,7 +216,7 @@ Uint8Array DDSTools::GetRGBAArrayBuffer(float width, float height,
                                         const Uint8Array& arrayBuffer)
 {
   Uint8Array byteArray(dataLength);
-  Uint8Array srcData(arrayBuffer);
+  const auto& srcData = arrayBuffer;
   size_t index = 0;
   for (float y = height - 1; y >= 0; --y) {
     for (float x = 0; x < width; ++x) {
@@ -59,7 +237,7 @@ Uint8Array DDSTools::GetRGBArrayBuffer(float width, float height,
                                        const Uint8Array& arrayBuffer)
 {
   Uint8Array byteArray(dataLength);
-  Uint8Array srcData(arrayBuffer);
+  const auto& srcData = arrayBuffer;
   size_t index = 0;
   for (float y = height - 1; y >= 0; --y) {
     for (float x = 0; x < width; ++x) {
@@ -80,7 +258,7 @@ Uint8Array DDSTools::GetLuminanceArrayBuffer(float width, float height,
                                              const Uint8Array& arrayBuffer)
 {
   Uint8Array byteArray(dataLength);
-  Uint8Array srcData(arrayBuffer);
+  const auto& srcData = arrayBuffer;
   size_t index = 0;
   for (float y = height - 1; y >= 0; --y) {
     for (float x = 0; x < width; ++x) {
@@ -93,119 +271,69 @@ Uint8Array DDSTools::GetLuminanceArrayBuffer(float width, float height,
   return byteArray;
 }
 
-void DDSTools::UploadDDSLevels(GL::IGLRenderingContext* gl,
-                               const Uint8Array& arrayBuffer, DDSInfo& info,
-                               bool loadMipmaps, unsigned int faces)
+size_t DDSTools::UploadDDSLevels(GL::IGLRenderingContext* gl,
+                                 const Uint8Array& arrayBuffer,
+                                 const DDSInfo& info, bool loadMipmaps,
+                                 unsigned int faces)
 {
-  Int32Array header(
-    reinterpret_cast<const int*>(arrayBuffer.data()),
-    reinterpret_cast<const int*>(arrayBuffer.data() + DDS::headerLengthInt));
-  Uint8Array byteArray;
-  int blockBytes              = 0;
-  unsigned int internalFormat = 0;
-  float width = 0.f, height = 0.f;
-  size_t dataOffset = 0, dataLength = 0;
+  const int mipmapCount = loadMipmaps ? info.mipmapCount : 1;
+  size_t dataOffset     = info.dataOffset;
+  size_t uploaded       = 0;
 
-  if (header[off_magic] != DDS_MAGIC) {
-    BABYLON_LOG_ERROR("DDSTools", "Invalid magic number in DDS header");
-    return;
-  }
+  // Rows of the uncompressed levels are tightly packed
+  gl->pixelStorei(GL::UNPACK_ALIGNMENT, 1);
 
-  if (!info.isFourCC && !info.isRGB && !info.isLuminance) {
-    BABYLON_LOG_ERROR("DDSTools",
-                      "Unsupported format, must contain a FourCC code");
-    return;
-  }
-
-  if (info.isFourCC) {
-    const auto fourCC = header[off_pfFourCC];
-    switch (fourCC) {
-      case DDS::FOURCC_DXT1:
-        blockBytes     = 8;
-        internalFormat = RGB_S3TC_DXT1_Format;
-        break;
-      case DDS::FOURCC_DXT3:
-        blockBytes     = 16;
-        internalFormat = RGBA_S3TC_DXT3_Format;
-        break;
-      case DDS::FOURCC_DXT5:
-        blockBytes     = 16;
-        internalFormat = RGBA_S3TC_DXT5_Format;
-        break;
-      default:
-        BABYLON_LOG_ERROR("DDSTools", "Unsupported FourCC code: ",
-                          Int32ToFourCC(fourCC));
-        return;
-    }
-  }
-
-  int mipmapCount = 1;
-  if (header[off_flags] & DDSD_MIPMAPCOUNT && loadMipmaps) {
-    mipmapCount = std::max(1, header[off_mipmapCount]);
-  }
+  for (unsigned int face = 0; face < faces; ++face) {
+    const GL::GLenum sampler = (faces == 1) ?
+                                 GL::TEXTURE_2D :
+                                 (GL::TEXTURE_CUBE_MAP_POSITIVE_X + face);
 
-  auto bpp = header[off_RGBbpp];
+    int width  = info.width;
+    int height = info.height;
 
-  for (unsigned int face = 0; face < faces; ++face) {
-    auto sampler = (faces == 1) ? GL::TEXTURE_2D :
-                                  (GL::TEXTURE_CUBE_MAP_POSITIVE_X + face);
-
-    width      = header[off_width];
-    height     = header[off_height];
-    dataOffset = static_cast<size_t>(header[off_size] + 4);
-
-    for (int i = 0; i < mipmapCount; ++i) {
-      if (info.isRGB) {
-        if (bpp == 24) {
-          dataLength = static_cast<size_t>(width * height * 3);
-          byteArray  = DDSTools::GetRGBArrayBuffer(width, height, dataOffset,
-                                                  dataLength, arrayBuffer);
-          gl->texImage2D(sampler, i, GL::RGB, static_cast<int>(width),
-                         static_cast<int>(height), 0, GL::RGB,
+    // The faces are stored one after the other with all their levels
+    for (int i = 0; i < info.mipmapCount; ++i) {
+      const auto dataLength = GetLevelLength(info, width, height);
+      if (i < mipmapCount) {
+        if (info.internalFormat != 0) {
+          // Uploaded as is, the blocks are decoded by the GPU
+          const auto data = arrayBuffer.data() + dataOffset;
+          gl->compressedTexImage2D(sampler, i, info.internalFormat, width,
+                                   height, 0,
+                                   Uint8Array(data, data + dataLength));
+        }
+        else if (info.isRGB && info.bitsPerPixel == 24) {
+          auto byteArray = DDSTools::GetRGBArrayBuffer(
+            static_cast<float>(width), static_cast<float>(height), dataOffset,
+            dataLength, arrayBuffer);
+          gl->texImage2D(sampler, i, GL::RGB, width, height, 0, GL::RGB,
                          GL::UNSIGNED_BYTE, byteArray);
         }
-        else { // 32
-          dataLength = static_cast<size_t>(width * height * 4);
-          byteArray  = DDSTools::GetRGBAArrayBuffer(width, height, dataOffset,
-                                                   dataLength, arrayBuffer);
-          gl->texImage2D(sampler, i, GL::RGBA, static_cast<int>(width),
-                         static_cast<int>(height), 0, GL::RGBA,
+        else if (info.isRGB) {
+          auto byteArray = DDSTools::GetRGBAArrayBuffer(
+            static_cast<float>(width), static_cast<float>(height), dataOffset,
+            dataLength, arrayBuffer);
+          gl->texImage2D(sampler, i, GL::RGBA, width, height, 0, GL::RGBA,
                          GL::UNSIGNED_BYTE, byteArray);
         }
-      }
-      else if (info.isLuminance) {
-        int unpackAlignment   = gl->getParameteri(GL::UNPACK_ALIGNMENT);
-        float unpaddedRowSize = width;
-        float paddedRowSize
-          = std::floor((width + unpackAlignment - 1) / unpackAlignment)
-            * unpackAlignment;
-        dataLength
-          = static_cast<size_t>(paddedRowSize * (height - 1) + unpaddedRowSize);
-
-        byteArray = DDSTools::GetLuminanceArrayBuffer(width, height, dataOffset,
-                                                      dataLength, arrayBuffer);
-        gl->texImage2D(sampler, i, GL::LUMINANCE, static_cast<int>(width),
-                       static_cast<int>(height), 0, GL::LUMINANCE,
-                       GL::UNSIGNED_BYTE, byteArray);
-      }
-      else {
-        dataLength = static_cast<size_t>(
-          std::max(4.f, width) / 4 * std::max(4.f, height) / 4 * blockBytes);
-        byteArray = Uint8Array(
-          reinterpret_cast<const int*>(arrayBuffer.data() + dataOffset),
-          reinterpret_cast<const int*>(arrayBuffer.data() + dataLength));
-        gl->compressedTexImage2D(sampler, i, internalFormat,
-                                 static_cast<int>(width),
-                                 static_cast<int>(height), 0, byteArray);
+        else {
+          auto byteArray = DDSTools::GetLuminanceArrayBuffer(
+            static_cast<float>(width), static_cast<float>(height), dataOffset,
+            dataLength, arrayBuffer);
+          gl->texImage2D(sampler, i, GL::LUMINANCE, width, height, 0,
+                         GL::LUMINANCE, GL::UNSIGNED_BYTE, byteArray);
+        }
+        uploaded += dataLength;
       }
       dataOffset += dataLength;
-      width *= 0.5f;
-      height *= 0.5f;
-
-      width  = std::max(1.f, width);
-      height = std::max(1.f, height);
+      width  = std::max(1, width >> 1);
+      height = std::max(1, height >> 1);
     }
   }
+
+  gl->pixelStorei(GL::UNPACK_ALIGNMENT, 4);
+
+  return uploaded;
 }
 
 } // end of namespace Internals
@@ -0,0 +1,193 @@
+#include <babylon/tools/derived_asset_cache.h>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/core/hash.h>
+#include <babylon/core/logging.h>
+#include <babylon/core/mapped_file.h>
+#include <babylon/mesh/mesh_codec.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Header of the blob files: magic, step version, input hash, blob size and
+// blob hash
+constexpr size_t HeaderSize = 2 * sizeof(uint32_t) + 3 * sizeof(uint64_t);
+
+} // end of anonymous namespace
+
+DerivedAssetCache& DerivedAssetCache::Instance()
+{
+  static DerivedAssetCache cacheInstance;
+  return cacheInstance;
+}
+
+DerivedAssetCache::DerivedAssetCache()
+    : _minimumInputSize{1 << 20}, _hits{0}, _misses{0}
+{
+}
+
+DerivedAssetCache::~DerivedAssetCache()
+{
+}
+
+void DerivedAssetCache::setDirectory(const std::string& directory)
+{
+  _directory = directory;
+#ifdef __unix__
+  if (!_directory.empty() && !Filesystem::isDirectory(_directory)) {
+    Filesystem::createDirectory(_directory);
+  }
+#endif
+}
+
+const std::string& DerivedAssetCache::directory() const
+{
+  return _directory;
+}
+
+bool DerivedAssetCache::isEnabled() const
+{
+  return !_directory.empty();
+}
+
+void DerivedAssetCache::setMinimumInputSize(size_t size)
+{
+  _minimumInputSize = size;
+}
+
+size_t DerivedAssetCache::minimumInputSize() const
+{
+  return _minimumInputSize;
+}
+
+bool DerivedAssetCache::caches(size_t inputSize) const
+{
+  return isEnabled() && inputSize >= _minimumInputSize;
+}
+
+bool DerivedAssetCache::load(const Step& step, uint64_t inputHash,
+                             Uint8Array& blob)
+{
+  if (!isEnabled()) {
+    return false;
+  }
+
+  MappedFile file(path(step, inputHash));
+  Uint8Array header;
+  if (file.isOpen() && file.size() >= HeaderSize) {
+    header.assign(file.data(), file.data() + HeaderSize);
+  }
+
+  size_t offset    = 0;
+  uint32_t magic   = 0;
+  uint32_t version = 0;
+  uint64_t hash = 0, size = 0, blobHash = 0;
+  if (!Read(header, offset, magic) || !Read(header, offset, version)
+      || !Read(header, offset, hash) || !Read(header, offset, size)
+      || !Read(header, offset, blobHash) || magic != Magic
+      || version != step.version || hash != inputHash
+      || size != file.size() - HeaderSize
+      || Hash64(file.data() + HeaderSize, size) != blobHash) {
+    ++_misses;
+    return false;
+  }
+
+  blob.assign(file.data() + HeaderSize, file.data() + file.size());
+  ++_hits;
+  return true;
+}
+
+bool DerivedAssetCache::store(const Step& step, uint64_t inputHash,
+                              const Uint8Array& blob)
+{
+  if (!isEnabled()) {
+    return false;
+  }
+
+  Uint8Array data;
+  data.reserve(HeaderSize + blob.size());
+  Append(data, Magic);
+  Append(data, step.version);
+  Append(data, inputHash);
+  Append(data, static_cast<uint64_t>(blob.size()));
+  Append(data, Hash64(blob.data(), blob.size()));
+  data.insert(data.end(), blob.begin(), blob.end());
+
+  const auto filePath = path(step, inputHash);
+  if (!Filesystem::writeFileAtomically(filePath, data.data(), data.size())) {
+    BABYLON_LOG_ERROR("DerivedAssetCache", "Error writing file ", filePath);
+    return false;
+  }
+
+  return true;
+}
+
+std::string DerivedAssetCache::path(const Step& step, uint64_t inputHash) const
+{
+  std::ostringstream fileName;
+  fileName << step.name << "-" << std::hex << std::setw(16)
+           << std::setfill('0') << inputHash << ".bin";
+  return Filesystem::joinPath(_directory, fileName.str());
+}
+
+size_t DerivedAssetCache::hits() const
+{
+  return _hits;
+}
+
+size_t DerivedAssetCache::misses() const
+{
+  return _misses;
+}
+
+void DerivedAssetCache::Append(Uint8Array& blob, const Float32Array& values,
+                               size_t stride)
+{
+  const auto encoded = MeshCodec::EncodeVertexBuffer(values, stride);
+  Append(blob, static_cast<uint64_t>(encoded.size()));
+  blob.insert(blob.end(), encoded.begin(), encoded.end());
+}
+
+void DerivedAssetCache::Append(Uint8Array& blob, const Uint32Array& values)
+{
+  Append(blob, static_cast<uint64_t>(values.size()));
+  const auto offset = blob.size();
+  blob.resize(offset + values.size() * sizeof(uint32_t));
+  if (!values.empty()) {
+    std::memcpy(blob.data() + offset, values.data(),
+                values.size() * sizeof(uint32_t));
+  }
+}
+
+bool DerivedAssetCache::Read(const Uint8Array& blob, size_t& offset,
+                             Float32Array& values)
+{
+  uint64_t size = 0;
+  if (!Read(blob, offset, size) || blob.size() - offset < size
+      || !MeshCodec::DecodeVertexBuffer(blob.data() + offset,
+                                        static_cast<size_t>(size), values)) {
+    return false;
+  }
+  offset += static_cast<size_t>(size);
+  return true;
+}
+
+bool DerivedAssetCache::Read(const Uint8Array& blob, size_t& offset,
+                             Uint32Array& values)
+{
+  uint64_t count = 0;
+  if (!Read(blob, offset, count)
+      || (blob.size() - offset) / sizeof(uint32_t) < count) {
+    return false;
+  }
+  values.resize(static_cast<size_t>(count));
+  if (count > 0) {
+    std::memcpy(values.data(), blob.data() + offset,
+                values.size() * sizeof(uint32_t));
+  }
+  offset += values.size() * sizeof(uint32_t);
+  return true;
+}
+
+} // end of namespace BABYLON
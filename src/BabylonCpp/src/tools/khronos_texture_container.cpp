@@ -0,0 +1,163 @@
+#include <babylon/tools/khronos_texture_container.h>
+
+#include <babylon/core/logging.h>
+#include <babylon/interfaces/igl_rendering_context.h>
+
+namespace BABYLON {
+
+constexpr size_t KhronosTextureContainer::HEADER_LEN;
+constexpr unsigned int KhronosTextureContainer::COMPRESSED_2D;
+constexpr unsigned int KhronosTextureContainer::COMPRESSED_3D;
+constexpr unsigned int KhronosTextureContainer::TEX_2D;
+constexpr unsigned int KhronosTextureContainer::TEX_3D;
+
+KhronosTextureContainer::KhronosTextureContainer(
+  const Uint8Array& _arrayBuffer, unsigned int facesExpected)
+    : arrayBuffer{_arrayBuffer}
+    , isInvalid{true}
+    , glType{0}
+    , glTypeSize{0}
+    , glFormat{0}
+    , glInternalFormat{0}
+    , glBaseInternalFormat{0}
+    , pixelWidth{0}
+    , pixelHeight{0}
+    , pixelDepth{0}
+    , numberOfArrayElements{0}
+    , numberOfFaces{0}
+    , numberOfMipmapLevels{0}
+    , bytesOfKeyValueData{0}
+    , loadType{COMPRESSED_2D}
+    , _swapBytes{false}
+{
+  // Test that it is a ktx formatted file, based on the first 12 bytes
+  static const std::array<uint8_t, 12> identifier{
+    {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A}};
+  if (arrayBuffer.size() < HEADER_LEN
+      || !std::equal(identifier.begin(), identifier.end(),
+                     arrayBuffer.begin())) {
+    BABYLON_LOG_ERROR("KhronosTextureContainer",
+                      "texture missing KTX identifier");
+    return;
+  }
+
+  // The endianness field reads 0x04030201 when it matches the platform
+  _swapBytes = (_readUint32(12) == 0x01020304);
+
+  glType                = _readUint32(16);
+  glTypeSize            = _readUint32(20);
+  glFormat              = _readUint32(24);
+  glInternalFormat      = _readUint32(28);
+  glBaseInternalFormat  = _readUint32(32);
+  pixelWidth            = _readUint32(36);
+  pixelHeight           = _readUint32(40);
+  pixelDepth            = _readUint32(44);
+  numberOfArrayElements = _readUint32(48);
+  numberOfFaces         = _readUint32(52);
+  numberOfMipmapLevels  = std::max(1u, _readUint32(56));
+  bytesOfKeyValueData   = _readUint32(60);
+
+  if (glType != 0) {
+    BABYLON_LOG_ERROR("KhronosTextureContainer",
+                      "only compressed formats currently supported");
+    return;
+  }
+
+  if (pixelWidth == 0 || pixelHeight == 0 || pixelDepth != 0) {
+    BABYLON_LOG_ERROR("KhronosTextureContainer",
+                      "only 2D textures currently supported");
+    return;
+  }
+
+  if (numberOfArrayElements != 0) {
+    BABYLON_LOG_ERROR("KhronosTextureContainer",
+                      "texture arrays not currently supported");
+    return;
+  }
+
+  if (numberOfFaces != facesExpected) {
+    BABYLON_LOG_ERROR("KhronosTextureContainer", "number of faces expected ",
+                      facesExpected, ", but found ", numberOfFaces);
+    return;
+  }
+
+  if (!_validateLevels()) {
+    BABYLON_LOG_ERROR("KhronosTextureContainer", "truncated KTX file");
+    return;
+  }
+
+  loadType  = COMPRESSED_2D;
+  isInvalid = false;
+}
+
+KhronosTextureContainer::~KhronosTextureContainer()
+{
+}
+
+uint32_t KhronosTextureContainer::_readUint32(size_t offset) const
+{
+  uint32_t value;
+  std::memcpy(&value, arrayBuffer.data() + offset, sizeof(value));
+  if (_swapBytes) {
+    value = ((value & 0xff) << 24) | ((value & 0xff00) << 8)
+            | ((value >> 8) & 0xff00) | (value >> 24);
+  }
+  return value;
+}
+
+bool KhronosTextureContainer::_validateLevels()
+{
+  size_t dataOffset = HEADER_LEN + bytesOfKeyValueData;
+  for (unsigned int level = 0; level < numberOfMipmapLevels; ++level) {
+    if (dataOffset + 4 > arrayBuffer.size()) {
+      return false;
+    }
+    // Each face is padded to 4 bytes
+    const size_t imageSize = _readUint32(dataOffset);
+    dataOffset += 4 + ((imageSize + 3) & ~size_t(3)) * numberOfFaces;
+    if (dataOffset > arrayBuffer.size()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+size_t KhronosTextureContainer::uploadLevels(GL::IGLRenderingContext* gl,
+                                             bool loadMipmaps) const
+{
+  if (isInvalid) {
+    return 0;
+  }
+
+  size_t dataOffset = HEADER_LEN + bytesOfKeyValueData;
+  int width         = static_cast<int>(pixelWidth);
+  int height        = static_cast<int>(pixelHeight);
+  size_t uploaded   = 0;
+
+  const auto mipmapCount = loadMipmaps ? numberOfMipmapLevels : 1;
+  for (unsigned int level = 0; level < mipmapCount; ++level) {
+    // Size of a single face for non array cube textures
+    const size_t imageSize = _readUint32(dataOffset);
+    dataOffset += 4;
+
+    for (unsigned int face = 0; face < numberOfFaces; ++face) {
+      const GL::GLenum sampler = (numberOfFaces == 1) ?
+                                   GL::TEXTURE_2D :
+                                   (GL::TEXTURE_CUBE_MAP_POSITIVE_X + face);
+      const auto data = arrayBuffer.data() + dataOffset;
+      gl->compressedTexImage2D(sampler, static_cast<int>(level),
+                               glInternalFormat, width, height, 0,
+                               Uint8Array(data, data + imageSize));
+      uploaded += imageSize;
+      dataOffset += (imageSize + 3) & ~size_t(3);
+    }
+
+    width  = std::max(1, width >> 1);
+    height = std::max(1, height >> 1);
+  }
+
+  return uploaded;
+}
+
+} // end of namespace BABYLON
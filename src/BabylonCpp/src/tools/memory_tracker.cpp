@@ -0,0 +1,180 @@
+#include <babylon/tools/memory_tracker.h>
+
+namespace BABYLON {
+
+size_t MemorySnapshot::bytesOf(MemoryCategory category) const
+{
+  return bytes[static_cast<size_t>(category)];
+}
+
+size_t MemorySnapshot::objectsOf(MemoryCategory category) const
+{
+  return objects[static_cast<size_t>(category)];
+}
+
+size_t MemorySnapshot::totalBytes() const
+{
+  size_t total = 0;
+  for (auto categoryBytes : bytes) {
+    total += categoryBytes;
+  }
+  return total;
+}
+
+MemoryTracker::MemoryTracker() : _totalBudget{0}, _overTotalBudget{false}
+{
+  for (size_t i = 0; i < MemoryCategoryCount; ++i) {
+    _bytes[i]      = 0;
+    _objects[i]    = 0;
+    _budgets[i]    = 0;
+    _overBudget[i] = false;
+  }
+}
+
+MemoryTracker::~MemoryTracker()
+{
+}
+
+const char* MemoryTracker::CategoryName(MemoryCategory category)
+{
+  switch (category) {
+    case MemoryCategory::VertexBuffers:
+      return "VertexBuffers";
+    case MemoryCategory::IndexBuffers:
+      return "IndexBuffers";
+    case MemoryCategory::UniformBuffers:
+      return "UniformBuffers";
+    case MemoryCategory::Textures:
+      return "Textures";
+    case MemoryCategory::RenderTargets:
+      return "RenderTargets";
+    case MemoryCategory::Effects:
+      return "Effects";
+    case MemoryCategory::CpuVertexData:
+      return "CpuVertexData";
+    case MemoryCategory::Physics:
+      return "Physics";
+  }
+  return "Unknown";
+}
+
+size_t MemoryTracker::_index(MemoryCategory category)
+{
+  return static_cast<size_t>(category);
+}
+
+void MemoryTracker::allocate(MemoryCategory category, size_t bytes)
+{
+  _bytes[_index(category)] += bytes;
+  ++_objects[_index(category)];
+}
+
+void MemoryTracker::release(MemoryCategory category, size_t bytes)
+{
+  auto& categoryBytes   = _bytes[_index(category)];
+  auto& categoryObjects = _objects[_index(category)];
+
+  // Clamp to zero, resources created before tracking started may be released
+  size_t current = categoryBytes.load();
+  while (!categoryBytes.compare_exchange_weak(
+    current, current > bytes ? current - bytes : 0)) {
+  }
+  size_t count = categoryObjects.load();
+  while (count > 0
+         && !categoryObjects.compare_exchange_weak(count, count - 1)) {
+  }
+}
+
+void MemoryTracker::setUsage(MemoryCategory category, size_t bytes,
+                             size_t objects)
+{
+  _bytes[_index(category)]   = bytes;
+  _objects[_index(category)] = objects;
+}
+
+size_t MemoryTracker::bytes(MemoryCategory category) const
+{
+  return _bytes[_index(category)];
+}
+
+size_t MemoryTracker::objects(MemoryCategory category) const
+{
+  return _objects[_index(category)];
+}
+
+size_t MemoryTracker::totalBytes() const
+{
+  size_t total = 0;
+  for (const auto& categoryBytes : _bytes) {
+    total += categoryBytes;
+  }
+  return total;
+}
+
+void MemoryTracker::setBudget(MemoryCategory category, size_t bytes)
+{
+  _budgets[_index(category)]    = bytes;
+  _overBudget[_index(category)] = false;
+}
+
+size_t MemoryTracker::budget(MemoryCategory category) const
+{
+  return _budgets[_index(category)];
+}
+
+void MemoryTracker::setTotalBudget(size_t bytes)
+{
+  _totalBudget     = bytes;
+  _overTotalBudget = false;
+}
+
+size_t MemoryTracker::totalBudget() const
+{
+  return _totalBudget;
+}
+
+bool MemoryTracker::hasBudgets() const
+{
+  return (_totalBudget > 0)
+         || std::any_of(_budgets.begin(), _budgets.end(),
+                        [](size_t budget) { return budget > 0; });
+}
+
+MemorySnapshot MemoryTracker::snapshot(int renderId) const
+{
+  MemorySnapshot result;
+  result.renderId = renderId;
+  for (size_t i = 0; i < MemoryCategoryCount; ++i) {
+    result.bytes[i]   = _bytes[i];
+    result.objects[i] = _objects[i];
+  }
+  return result;
+}
+
+void MemoryTracker::checkBudgets(const MemorySnapshot& snapshot)
+{
+  for (size_t i = 0; i < MemoryCategoryCount; ++i) {
+    const bool overBudget
+      = (_budgets[i] > 0) && (snapshot.bytes[i] > _budgets[i]);
+    if (overBudget && !_overBudget[i]) {
+      MemoryBudgetInfo info{static_cast<MemoryCategory>(i), _budgets[i],
+                            snapshot.bytes[i]};
+      onBudgetExceededObservable.notifyObservers(&info);
+    }
+    _overBudget[i] = overBudget;
+  }
+
+  const auto total = snapshot.totalBytes();
+  const bool overTotalBudget = (_totalBudget > 0) && (total > _totalBudget);
+  if (overTotalBudget && !_overTotalBudget) {
+    auto largest = std::max_element(snapshot.bytes.begin(),
+                                     snapshot.bytes.end());
+    MemoryBudgetInfo info{
+      static_cast<MemoryCategory>(largest - snapshot.bytes.begin()),
+      _totalBudget, total};
+    onBudgetExceededObservable.notifyObservers(&info);
+  }
+  _overTotalBudget = overTotalBudget;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,462 @@
+#include <babylon/tools/mipmap_generator.h>
+
+#include <babylon/core/worker_pool.h>
+#include <babylon/math/scalar.h>
+
+// SIMD
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+#include <babylon/math/simd/float32x4.h>
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+// Smaller levels are filtered on the calling thread
+constexpr int PixelsPerTask = 16384;
+
+// Half width of the Kaiser filter in destination pixels, and its shape
+constexpr float KaiserWidth = 3.f;
+constexpr float KaiserAlpha = 4.f;
+
+// Level with 4 float channels per pixel, the rows are 16 bytes aligned
+struct FloatImage {
+  int width  = 0;
+  int height = 0;
+  std::vector<float> data;
+
+  FloatImage(int iWidth, int iHeight)
+      : width{iWidth}
+      , height{iHeight}
+      , data(static_cast<size_t>(iWidth * iHeight) * 4)
+  {
+  }
+
+  float* row(int y)
+  {
+    return data.data() + static_cast<size_t>(y * width) * 4;
+  }
+
+  const float* row(int y) const
+  {
+    return data.data() + static_cast<size_t>(y * width) * 4;
+  }
+}; // end of struct FloatImage
+
+// Source pixels and weights of each destination pixel along an axis
+struct FilterTaps {
+  int tapCount = 0;
+  std::vector<int> indices;
+  std::vector<float> weights;
+}; // end of struct FilterTaps
+
+float besselI0(float x)
+{
+  float sum = 1.f, term = 1.f;
+  for (int k = 1; k < 16; ++k) {
+    const float t = x / (2.f * k);
+    term *= t * t;
+    sum += term;
+  }
+  return sum;
+}
+
+float kaiserSinc(float t)
+{
+  if (std::abs(t) >= KaiserWidth) {
+    return 0.f;
+  }
+  const float x      = t / KaiserWidth;
+  const float window = besselI0(KaiserAlpha * std::sqrt(1.f - x * x))
+                       / besselI0(KaiserAlpha);
+  const float pt = Math::PI * t;
+  return (std::abs(t) < 1e-5f) ? window : window * std::sin(pt) / pt;
+}
+
+FilterTaps computeTaps(int srcSize, int dstSize, MipmapFilter filter)
+{
+  FilterTaps taps;
+  if (srcSize == dstSize) {
+    taps.tapCount = 1;
+    for (int x = 0; x < dstSize; ++x) {
+      taps.indices.emplace_back(x);
+      taps.weights.emplace_back(1.f);
+    }
+    return taps;
+  }
+
+  // Support of a destination pixel in source pixels
+  const float scale   = static_cast<float>(srcSize) / dstSize;
+  const float support = (filter == MipmapFilter::BOX) ? 0.5f * scale :
+                                                        KaiserWidth * scale;
+  taps.tapCount = static_cast<int>(std::ceil(2.f * support)) + 1;
+  taps.indices.resize(static_cast<size_t>(dstSize * taps.tapCount));
+  taps.weights.resize(taps.indices.size());
+
+  for (int x = 0; x < dstSize; ++x) {
+    const float center = (x + 0.5f) * scale;
+    const int first    = static_cast<int>(std::floor(center - support));
+    float sum          = 0.f;
+    for (int k = 0; k < taps.tapCount; ++k) {
+      const int i  = first + k;
+      float weight = 0.f;
+      if (filter == MipmapFilter::BOX) {
+        weight = std::max(0.f, std::min(i + 1.f, center + support)
+                                 - std::max(static_cast<float>(i),
+                                            center - support));
+      }
+      else {
+        weight = kaiserSinc((i + 0.5f - center) / scale);
+      }
+      // The edge pixels are repeated outside of the image
+      const auto tap    = static_cast<size_t>(x * taps.tapCount + k);
+      taps.indices[tap] = std::min(std::max(i, 0), srcSize - 1);
+      taps.weights[tap] = weight;
+      sum += weight;
+    }
+    for (int k = 0; k < taps.tapCount; ++k) {
+      taps.weights[static_cast<size_t>(x * taps.tapCount + k)] /= sum;
+    }
+  }
+
+  return taps;
+}
+
+// dst[x] = sum of the weighted source pixels of the row
+void filterRow(const float* src, const FilterTaps& taps, int dstWidth,
+               float* dst)
+{
+  for (int x = 0; x < dstWidth; ++x) {
+    const int* indices   = taps.indices.data() + x * taps.tapCount;
+    const float* weights = taps.weights.data() + x * taps.tapCount;
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+    SIMD::Float32x4 sum(0.f);
+    for (int k = 0; k < taps.tapCount; ++k) {
+      sum += SIMD::Float32x4(src + indices[k] * 4) * weights[k];
+    }
+    _mm_store_ps(dst + x * 4, sum.xmm);
+#else
+    float sum[4] = {0.f, 0.f, 0.f, 0.f};
+    for (int k = 0; k < taps.tapCount; ++k) {
+      const float* pixel = src + indices[k] * 4;
+      for (int ch = 0; ch < 4; ++ch) {
+        sum[ch] += pixel[ch] * weights[k];
+      }
+    }
+    std::copy(sum, sum + 4, dst + x * 4);
+#endif
+  }
+}
+
+// dst += weight * src over a row of 4 channels pixels
+void accumulateRow(const float* src, float weight, int width, float* dst)
+{
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+  const SIMD::Float32x4 w(weight);
+  for (int i = 0; i < width * 4; i += 4) {
+    SIMD::Float32x4 sum(dst + i);
+    sum += SIMD::Float32x4(src + i) * w;
+    _mm_store_ps(dst + i, sum.xmm);
+  }
+#else
+  for (int i = 0; i < width * 4; ++i) {
+    dst[i] += src[i] * weight;
+  }
+#endif
+}
+
+const float* sRGBToLinearTable()
+{
+  static const auto table = []() {
+    std::array<float, 256> values;
+    for (size_t i = 0; i < values.size(); ++i) {
+      const float c = i / 255.f;
+      values[i]     = (c <= 0.04045f) ? c / 12.92f :
+                                    std::pow((c + 0.055f) / 1.055f, 2.4f);
+    }
+    return values;
+  }();
+  return table.data();
+}
+
+inline float linearToSRGB(float value)
+{
+  return (value <= 0.0031308f) ? value * 12.92f :
+                                 1.055f * std::pow(value, 1.f / 2.4f) - 0.055f;
+}
+
+inline uint8_t toUnorm8(float value)
+{
+  return static_cast<uint8_t>(
+    std::min(std::max(value, 0.f), 1.f) * 255.f + 0.5f);
+}
+
+// Index of the alpha channel, -1 without alpha
+inline int alphaChannel(int channelCount)
+{
+  return (channelCount == 2 || channelCount == 4) ? channelCount - 1 : -1;
+}
+
+void decodeRows(const uint8_t* src, int width, int first, int last,
+                int channelCount, MipmapFormat format, bool sRGB,
+                FloatImage& dst)
+{
+  const int alpha       = alphaChannel(channelCount);
+  const auto* toLinear  = sRGBToLinearTable();
+  const auto pixelBytes = static_cast<size_t>(channelCount)
+                          * MipmapGenerator::GetBytesPerPixel(format) / 4;
+  for (int y = first; y < last; ++y) {
+    const auto* in = src + static_cast<size_t>(y * width) * pixelBytes;
+    float* out     = dst.row(y);
+    for (int x = 0; x < width; ++x, in += pixelBytes, out += 4) {
+      out[0] = out[1] = out[2] = 0.f;
+      out[3]                   = 1.f;
+      for (int ch = 0; ch < channelCount; ++ch) {
+        switch (format) {
+          case MipmapFormat::RGBA8:
+            out[ch] = (sRGB && ch != alpha) ? toLinear[in[ch]] :
+                                              in[ch] / 255.f;
+            break;
+          case MipmapFormat::RGBA16F: {
+            uint16_t half;
+            std::memcpy(&half, in + ch * 2, sizeof(half));
+            out[ch] = Scalar::FromHalfFloat(half);
+          } break;
+          case MipmapFormat::RGBA32F:
+            std::memcpy(out + ch, in + ch * 4, sizeof(float));
+            break;
+        }
+      }
+    }
+  }
+}
+
+void encodeRows(const FloatImage& src, int first, int last, int channelCount,
+                MipmapFormat format, bool sRGB, float alphaScale, uint8_t* dst)
+{
+  const int alpha       = alphaChannel(channelCount);
+  const auto pixelBytes = static_cast<size_t>(channelCount)
+                          * MipmapGenerator::GetBytesPerPixel(format) / 4;
+  for (int y = first; y < last; ++y) {
+    const float* in = src.row(y);
+    auto* out       = dst + static_cast<size_t>(y * src.width) * pixelBytes;
+    for (int x = 0; x < src.width; ++x, in += 4, out += pixelBytes) {
+      for (int ch = 0; ch < channelCount; ++ch) {
+        float value = in[ch];
+        if (ch == alpha && alphaScale != 1.f) {
+          value = std::min(value * alphaScale, 1.f);
+        }
+        switch (format) {
+          case MipmapFormat::RGBA8:
+            out[ch]
+              = toUnorm8((sRGB && ch != alpha) ? linearToSRGB(value) : value);
+            break;
+          case MipmapFormat::RGBA16F: {
+            const auto half = Scalar::ToHalfFloat(value);
+            std::memcpy(out + ch * 2, &half, sizeof(half));
+          } break;
+          case MipmapFormat::RGBA32F:
+            std::memcpy(out + ch * 4, &value, sizeof(float));
+            break;
+        }
+      }
+    }
+  }
+}
+
+// Fraction of the pixels with an alpha above the cutoff
+float alphaCoverage(const FloatImage& image, int alpha, float cutoff,
+                    float scale)
+{
+  size_t covered = 0;
+  for (size_t i = static_cast<size_t>(alpha); i < image.data.size(); i += 4) {
+    if (image.data[i] * scale >= cutoff) {
+      ++covered;
+    }
+  }
+  return static_cast<float>(covered) / (image.data.size() / 4);
+}
+
+// Smallest scale of the alpha of the level reaching the coverage of the base
+// level
+float alphaCoverageScale(const FloatImage& image, int alpha, float cutoff,
+                         float coverage)
+{
+  float minScale = 0.f, maxScale = 4.f;
+  for (int iteration = 0; iteration < 16; ++iteration) {
+    const float scale = 0.5f * (minScale + maxScale);
+    if (alphaCoverage(image, alpha, cutoff, scale) < coverage) {
+      minScale = scale;
+    }
+    else {
+      maxScale = scale;
+    }
+  }
+  return maxScale;
+}
+
+} // end of anonymous namespace
+
+MipmapGenerator::MipmapGenerator(size_t workerCount)
+    : _pool{WorkerPool::Create(workerCount)}
+{
+}
+
+MipmapGenerator::MipmapGenerator(std::shared_ptr<WorkerPool> pool)
+    : _pool{std::move(pool)}
+{
+}
+
+MipmapGenerator::~MipmapGenerator()
+{
+}
+
+std::vector<Uint8Array> MipmapGenerator::generate(const Uint8Array& data,
+                                                  int width, int height,
+                                                  MipmapFormat format,
+                                                  const MipmapOptions& options)
+{
+  if (data.size()
+      < static_cast<size_t>(width * height) * GetBytesPerPixel(format)) {
+    return {};
+  }
+
+  return _generate(data.data(), width, height, 4, format, options);
+}
+
+std::vector<Image> MipmapGenerator::generate(const Image& image,
+                                             const MipmapOptions& options)
+{
+  std::vector<Image> mips;
+  if (!image.valid() || image.depth > 4
+      || image.data.size()
+           < static_cast<size_t>(image.width * image.height * image.depth)) {
+    return mips;
+  }
+
+  auto levels = _generate(image.data.data(), image.width, image.height,
+                          image.depth, MipmapFormat::RGBA8, options);
+  mips.reserve(levels.size());
+  int width = image.width, height = image.height;
+  for (auto& level : levels) {
+    width  = std::max(width / 2, 1);
+    height = std::max(height / 2, 1);
+    mips.emplace_back(std::move(level), width, height, image.depth,
+                      image.mode);
+  }
+
+  return mips;
+}
+
+std::vector<Uint8Array> MipmapGenerator::_generate(const uint8_t* data,
+                                                   int width, int height,
+                                                   int channelCount,
+                                                   MipmapFormat format,
+                                                   const MipmapOptions& options)
+{
+  std::vector<Uint8Array> levels;
+  const auto levelCount = GetLevelCount(width, height);
+  if (levelCount <= 1) {
+    return levels;
+  }
+  levels.reserve(levelCount - 1);
+
+  const auto pixelBytes
+    = static_cast<size_t>(channelCount) * GetBytesPerPixel(format) / 4;
+  const bool sRGB = options.sRGB && (format == MipmapFormat::RGBA8);
+  const int alpha = options.preserveAlphaCoverage ? alphaChannel(channelCount) :
+                                                    -1;
+
+  FloatImage current(width, height);
+  _parallelFor(height, PixelsPerTask / width, [&](int first, int last) {
+    decodeRows(data, width, first, last, channelCount, format, sRGB, current);
+  });
+  const float coverage
+    = (alpha >= 0) ? alphaCoverage(current, alpha, options.alphaCutoff, 1.f) :
+                     0.f;
+
+  for (unsigned int level = 1; level < levelCount; ++level) {
+    const int dstWidth  = std::max(current.width / 2, 1);
+    const int dstHeight = std::max(current.height / 2, 1);
+    const auto rowTaps  = computeTaps(current.width, dstWidth, options.filter);
+    const auto columnTaps
+      = computeTaps(current.height, dstHeight, options.filter);
+
+    // Separable filter, the rows then the columns
+    FloatImage rows(dstWidth, current.height);
+    _parallelFor(current.height, PixelsPerTask / current.width,
+                 [&](int first, int last) {
+                   for (int y = first; y < last; ++y) {
+                     filterRow(current.row(y), rowTaps, dstWidth, rows.row(y));
+                   }
+                 });
+    FloatImage next(dstWidth, dstHeight);
+    _parallelFor(dstHeight, PixelsPerTask / dstWidth, [&](int first, int last) {
+      for (int y = first; y < last; ++y) {
+        for (int k = 0; k < columnTaps.tapCount; ++k) {
+          const auto tap = static_cast<size_t>(y * columnTaps.tapCount + k);
+          accumulateRow(rows.row(columnTaps.indices[tap]),
+                        columnTaps.weights[tap], dstWidth, next.row(y));
+        }
+      }
+    });
+
+    // The next level is filtered from the unscaled alpha
+    const float alphaScale
+      = (alpha >= 0 && coverage > 0.f) ?
+          alphaCoverageScale(next, alpha, options.alphaCutoff, coverage) :
+          1.f;
+
+    Uint8Array levelData(static_cast<size_t>(dstWidth * dstHeight)
+                         * pixelBytes);
+    _parallelFor(dstHeight, PixelsPerTask / dstWidth, [&](int first, int last) {
+      encodeRows(next, first, last, channelCount, format, sRGB, alphaScale,
+                 levelData.data());
+    });
+    levels.emplace_back(std::move(levelData));
+
+    current = std::move(next);
+  }
+
+  return levels;
+}
+
+void MipmapGenerator::_parallelFor(
+  int count, int itemsPerTask,
+  const std::function<void(int first, int last)>& func)
+{
+  _pool->parallelFor(static_cast<size_t>(count),
+                     static_cast<size_t>(std::max(itemsPerTask, 1)),
+                     [&func](size_t first, size_t last) {
+                       func(static_cast<int>(first), static_cast<int>(last));
+                     });
+}
+
+size_t MipmapGenerator::workerCount() const
+{
+  return _pool->workerCount();
+}
+
+unsigned int MipmapGenerator::GetLevelCount(int width, int height)
+{
+  unsigned int levelCount = 1;
+  for (int size = std::max(width, height); size > 1; size >>= 1) {
+    ++levelCount;
+  }
+  return levelCount;
+}
+
+size_t MipmapGenerator::GetBytesPerPixel(MipmapFormat format)
+{
+  switch (format) {
+    case MipmapFormat::RGBA8:
+      return 4;
+    case MipmapFormat::RGBA16F:
+      return 8;
+    case MipmapFormat::RGBA32F:
+      return 16;
+  }
+  return 4;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,1017 @@
+#include <babylon/tools/scene_snapshot.h>
+
+#include <babylon/animations/animatable.h>
+#include <babylon/animations/animation.h>
+#include <babylon/babylon_stl_util.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/cameras/arc_rotate_camera.h>
+#include <babylon/engine/scene.h>
+#include <babylon/lights/hemispheric_light.h>
+#include <babylon/lights/ishadow_light.h>
+#include <babylon/materials/multi_material.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/math/quaternion.h>
+#include <babylon/mesh/geometry.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/physics/physics_impostor.h>
+
+namespace BABYLON {
+
+constexpr uint32_t SceneSnapshot::Magic;
+constexpr uint32_t SceneSnapshot::Version;
+constexpr uint32_t SceneSnapshot::NoId;
+
+namespace {
+
+// Flags of the node records
+constexpr uint8_t Enabled       = 0x01;
+constexpr uint8_t Visible       = 0x02;
+constexpr uint8_t HasQuaternion = 0x04;
+constexpr uint8_t HasPhysics    = 0x08;
+constexpr uint8_t HasGeometry   = 0x10;
+constexpr uint8_t HasRotation   = 0x20;
+constexpr uint8_t IsArcRotate   = 0x40;
+constexpr uint8_t IsShadowLight = 0x02;
+constexpr uint8_t IsHemispheric = 0x04;
+
+// Flags of the material records
+constexpr uint8_t IsStandard      = 0x01;
+constexpr uint8_t BackFaceCulling = 0x02;
+
+// Flags of the animatable records
+constexpr uint8_t Loop    = 0x01;
+constexpr uint8_t Paused  = 0x02;
+constexpr uint8_t Started = 0x04;
+
+// Finds the node with the given unique id and id, or else the node at the
+// given index when it has the given id
+template <typename T>
+T* findNode(const std::vector<std::unique_ptr<T>>& nodes, size_t index,
+            unsigned int uniqueId, const string_view& id)
+{
+  if (index < nodes.size() && nodes[index]->uniqueId == uniqueId
+      && nodes[index]->id == id) {
+    return nodes[index].get();
+  }
+  for (auto& node : nodes) {
+    if (node->uniqueId == uniqueId && node->id == id) {
+      return node.get();
+    }
+  }
+  if (index < nodes.size() && nodes[index]->id == id) {
+    return nodes[index].get();
+  }
+  return nullptr;
+}
+
+// Finds the object at the given index when it has the given id, or else the
+// first object with the given id
+template <typename T>
+T* findObject(const std::vector<std::unique_ptr<T>>& objects, size_t index,
+              const string_view& id)
+{
+  if (index < objects.size() && objects[index]->id == id) {
+    return objects[index].get();
+  }
+  for (auto& object : objects) {
+    if (object->id == id) {
+      return object.get();
+    }
+  }
+  return nullptr;
+}
+
+template <typename T>
+uint32_t indexOf(const std::vector<std::unique_ptr<T>>& objects,
+                 const T* object)
+{
+  for (size_t i = 0; i < objects.size(); ++i) {
+    if (objects[i].get() == object) {
+      return static_cast<uint32_t>(i);
+    }
+  }
+  return SceneSnapshot::NoId;
+}
+
+} // end of anonymous namespace
+
+SceneSnapshot::SceneSnapshot(Uint8Array* buffer, const uint8_t* data,
+                             size_t size)
+    : _buffer{buffer}, _data{data}, _size{size}, _offset{0}, _valid{true}
+{
+}
+
+void SceneSnapshot::Capture(Scene* scene, Uint8Array& buffer)
+{
+  buffer.clear();
+  auto snapshot = Writer(buffer);
+  SnapshotHeader header;
+  header.animationTime  = static_cast<int>(scene->_animationTime);
+  header.activeCameraId = scene->activeCamera ? scene->activeCamera->uniqueId :
+                                                NoId;
+  snapshot.write(header);
+  snapshot._captureMeshes(scene);
+  snapshot._captureCameras(scene);
+  snapshot._captureLights(scene);
+  snapshot._captureMaterials(scene);
+  snapshot._captureSkeletons(scene);
+  snapshot._captureAnimatables(scene);
+}
+
+bool SceneSnapshot::Restore(Scene* scene, const uint8_t* data, size_t size)
+{
+  // Validate the whole snapshot before touching the scene
+  if (!Validate(data, size)) {
+    return false;
+  }
+
+  auto snapshot = Reader(data, size);
+  snapshot._restore(scene, true);
+  return true;
+}
+
+bool SceneSnapshot::Validate(const uint8_t* data, size_t size)
+{
+  if (!data) {
+    return false;
+  }
+
+  auto snapshot = Reader(data, size);
+  snapshot._restore(nullptr, false);
+  return snapshot.isValid() && snapshot.isAtEnd();
+}
+
+SceneSnapshot SceneSnapshot::Writer(Uint8Array& buffer)
+{
+  return SceneSnapshot(&buffer, nullptr, 0);
+}
+
+SceneSnapshot SceneSnapshot::Reader(const uint8_t* data, size_t size)
+{
+  return SceneSnapshot(nullptr, data, data ? size : 0);
+}
+
+void SceneSnapshot::write(const SnapshotHeader& header)
+{
+  _write(Magic);
+  _write(Version);
+  _write(static_cast<int32_t>(header.animationTime));
+  _write(static_cast<uint32_t>(header.activeCameraId));
+}
+
+void SceneSnapshot::writeCount(uint32_t count)
+{
+  _write(count);
+}
+
+void SceneSnapshot::write(const SnapshotMesh& mesh)
+{
+  uint8_t flags = 0;
+  flags |= mesh.enabled ? Enabled : 0;
+  flags |= mesh.visible ? Visible : 0;
+  flags |= mesh.hasRotationQuaternion ? HasQuaternion : 0;
+  flags |= mesh.hasPhysics ? HasPhysics : 0;
+  flags |= mesh.hasGeometry ? HasGeometry : 0;
+  _write(static_cast<uint32_t>(mesh.uniqueId));
+  _write(mesh.id);
+  _write(flags);
+  _write(mesh.visibility);
+  _write(mesh.position);
+  _write(mesh.rotation);
+  if (mesh.hasRotationQuaternion) {
+    _write(mesh.rotationQuaternion);
+  }
+  _write(mesh.scaling);
+  if (mesh.hasGeometry) {
+    _write(mesh.geometryIndex);
+    _write(mesh.geometryId);
+  }
+  _write(static_cast<uint8_t>(mesh.materialKind));
+  if (mesh.materialKind != SnapshotMaterialKind::None) {
+    _write(mesh.materialIndex);
+    _write(mesh.materialId);
+  }
+  if (mesh.hasPhysics) {
+    _write(mesh.mass);
+    _write(mesh.linearVelocity);
+    _write(mesh.angularVelocity);
+  }
+}
+
+void SceneSnapshot::write(const SnapshotCamera& camera)
+{
+  uint8_t flags = 0;
+  flags |= camera.enabled ? Enabled : 0;
+  flags |= camera.hasRotation ? HasRotation : 0;
+  flags |= camera.hasRotationQuaternion ? HasQuaternion : 0;
+  flags |= camera.isArcRotate ? IsArcRotate : 0;
+  _write(static_cast<uint32_t>(camera.uniqueId));
+  _write(camera.id);
+  _write(flags);
+  _write(camera.position);
+  _write(camera.upVector);
+  _write(camera.fov);
+  _write(camera.minZ);
+  _write(camera.maxZ);
+  _write(static_cast<uint32_t>(camera.mode));
+  if (camera.hasRotation) {
+    _write(camera.rotation);
+  }
+  if (camera.hasRotationQuaternion) {
+    _write(camera.rotationQuaternion);
+  }
+  if (camera.isArcRotate) {
+    _write(camera.alpha);
+    _write(camera.beta);
+    _write(camera.radius);
+    _write(camera.target);
+  }
+}
+
+void SceneSnapshot::write(const SnapshotLight& light)
+{
+  uint8_t flags = 0;
+  flags |= light.enabled ? Enabled : 0;
+  flags |= light.isShadowLight ? IsShadowLight : 0;
+  flags |= light.isHemispheric ? IsHemispheric : 0;
+  _write(static_cast<uint32_t>(light.uniqueId));
+  _write(light.id);
+  _write(flags);
+  _write(light.diffuse);
+  _write(light.specular);
+  _write(light.intensity);
+  _write(light.range);
+  if (light.isShadowLight) {
+    _write(light.position);
+    _write(light.direction);
+  }
+  if (light.isHemispheric) {
+    _write(light.direction);
+    _write(light.groundColor);
+  }
+}
+
+void SceneSnapshot::write(const SnapshotMaterial& material)
+{
+  uint8_t flags = 0;
+  flags |= material.isStandard ? IsStandard : 0;
+  flags |= material.backFaceCulling ? BackFaceCulling : 0;
+  _write(material.id);
+  _write(flags);
+  _write(material.alpha);
+  _write(static_cast<int32_t>(material.alphaMode));
+  _write(static_cast<int32_t>(material.sideOrientation));
+  if (material.isStandard) {
+    _write(material.ambientColor);
+    _write(material.diffuseColor);
+    _write(material.specularColor);
+    _write(material.emissiveColor);
+    _write(material.specularPower);
+  }
+}
+
+bool SceneSnapshot::read(SnapshotHeader& header)
+{
+  if (_read<uint32_t>() != Magic || _read<uint32_t>() != Version) {
+    _valid = false;
+    return false;
+  }
+  header.animationTime  = _read<int32_t>();
+  header.activeCameraId = _read<uint32_t>();
+  return _valid;
+}
+
+uint32_t SceneSnapshot::readCount()
+{
+  return _read<uint32_t>();
+}
+
+bool SceneSnapshot::read(SnapshotMesh& mesh)
+{
+  mesh.uniqueId = _read<uint32_t>();
+  _read(mesh.id);
+  const auto flags           = _read<uint8_t>();
+  mesh.enabled               = (flags & Enabled) != 0;
+  mesh.visible               = (flags & Visible) != 0;
+  mesh.hasRotationQuaternion = (flags & HasQuaternion) != 0;
+  mesh.hasPhysics            = (flags & HasPhysics) != 0;
+  mesh.hasGeometry           = (flags & HasGeometry) != 0;
+  mesh.visibility            = _read<float>();
+  _read(mesh.position);
+  _read(mesh.rotation);
+  if (mesh.hasRotationQuaternion) {
+    _read(mesh.rotationQuaternion);
+  }
+  _read(mesh.scaling);
+  if (mesh.hasGeometry) {
+    mesh.geometryIndex = _read<uint32_t>();
+    _read(mesh.geometryId);
+  }
+  const auto materialKind = _read<uint8_t>();
+  if (materialKind > static_cast<uint8_t>(SnapshotMaterialKind::Multi)) {
+    _valid = false;
+    return false;
+  }
+  mesh.materialKind = static_cast<SnapshotMaterialKind>(materialKind);
+  if (mesh.materialKind != SnapshotMaterialKind::None) {
+    mesh.materialIndex = _read<uint32_t>();
+    _read(mesh.materialId);
+  }
+  if (mesh.hasPhysics) {
+    mesh.mass = _read<float>();
+    _read(mesh.linearVelocity);
+    _read(mesh.angularVelocity);
+  }
+  return _valid;
+}
+
+bool SceneSnapshot::read(SnapshotCamera& camera)
+{
+  camera.uniqueId = _read<uint32_t>();
+  _read(camera.id);
+  const auto flags             = _read<uint8_t>();
+  camera.enabled               = (flags & Enabled) != 0;
+  camera.hasRotation           = (flags & HasRotation) != 0;
+  camera.hasRotationQuaternion = (flags & HasQuaternion) != 0;
+  camera.isArcRotate           = (flags & IsArcRotate) != 0;
+  _read(camera.position);
+  _read(camera.upVector);
+  camera.fov  = _read<float>();
+  camera.minZ = _read<float>();
+  camera.maxZ = _read<float>();
+  camera.mode = _read<uint32_t>();
+  if (camera.hasRotation) {
+    _read(camera.rotation);
+  }
+  if (camera.hasRotationQuaternion) {
+    _read(camera.rotationQuaternion);
+  }
+  if (camera.isArcRotate) {
+    camera.alpha  = _read<float>();
+    camera.beta   = _read<float>();
+    camera.radius = _read<float>();
+    _read(camera.target);
+  }
+  return _valid;
+}
+
+bool SceneSnapshot::read(SnapshotLight& light)
+{
+  light.uniqueId = _read<uint32_t>();
+  _read(light.id);
+  const auto flags    = _read<uint8_t>();
+  light.enabled       = (flags & Enabled) != 0;
+  light.isShadowLight = (flags & IsShadowLight) != 0;
+  light.isHemispheric = (flags & IsHemispheric) != 0;
+  _read(light.diffuse);
+  _read(light.specular);
+  light.intensity = _read<float>();
+  light.range     = _read<float>();
+  if (light.isShadowLight) {
+    _read(light.position);
+    _read(light.direction);
+  }
+  if (light.isHemispheric) {
+    _read(light.direction);
+    _read(light.groundColor);
+  }
+  return _valid;
+}
+
+bool SceneSnapshot::read(SnapshotMaterial& material)
+{
+  _read(material.id);
+  const auto flags         = _read<uint8_t>();
+  material.isStandard      = (flags & IsStandard) != 0;
+  material.backFaceCulling = (flags & BackFaceCulling) != 0;
+  material.alpha           = _read<float>();
+  material.alphaMode       = _read<int32_t>();
+  material.sideOrientation = _read<int32_t>();
+  if (material.isStandard) {
+    _read(material.ambientColor);
+    _read(material.diffuseColor);
+    _read(material.specularColor);
+    _read(material.emissiveColor);
+    material.specularPower = _read<float>();
+  }
+  return _valid;
+}
+
+void SceneSnapshot::write(const SnapshotSkeleton& skeleton)
+{
+  _write(skeleton.id);
+  _write(skeleton.boneCount);
+}
+
+void SceneSnapshot::write(const SnapshotBone& bone)
+{
+  for (auto value : bone.localMatrix) {
+    _write(value);
+  }
+}
+
+void SceneSnapshot::write(const SnapshotAnimatable& animatable)
+{
+  uint8_t flags = 0;
+  flags |= animatable.loopAnimation ? Loop : 0;
+  flags |= animatable.paused ? Paused : 0;
+  flags |= animatable.started ? Started : 0;
+  _write(static_cast<uint32_t>(animatable.targetId));
+  _write(flags);
+  _write(static_cast<int32_t>(animatable.fromFrame));
+  _write(static_cast<int32_t>(animatable.toFrame));
+  _write(animatable.speedRatio);
+  _write(animatable.localDelayOffset);
+  _write(animatable.pausedDelay);
+  _write(animatable.animationCount);
+}
+
+void SceneSnapshot::write(const SnapshotAnimation& animation)
+{
+  _write(static_cast<int32_t>(animation.currentFrame));
+  _write(static_cast<uint8_t>(animation.stopped ? 1 : 0));
+  _write(animation.blendingFactor);
+}
+
+bool SceneSnapshot::read(SnapshotSkeleton& skeleton)
+{
+  _read(skeleton.id);
+  skeleton.boneCount = _read<uint32_t>();
+  return _valid;
+}
+
+bool SceneSnapshot::read(SnapshotBone& bone)
+{
+  for (auto& value : bone.localMatrix) {
+    value = _read<float>();
+  }
+  return _valid;
+}
+
+bool SceneSnapshot::read(SnapshotAnimatable& animatable)
+{
+  animatable.targetId         = _read<uint32_t>();
+  const auto flags            = _read<uint8_t>();
+  animatable.loopAnimation    = (flags & Loop) != 0;
+  animatable.paused           = (flags & Paused) != 0;
+  animatable.started          = (flags & Started) != 0;
+  animatable.fromFrame        = _read<int32_t>();
+  animatable.toFrame          = _read<int32_t>();
+  animatable.speedRatio       = _read<float>();
+  animatable.localDelayOffset = _read<int64_t>();
+  animatable.pausedDelay      = _read<int64_t>();
+  animatable.animationCount   = _read<uint32_t>();
+  return _valid;
+}
+
+bool SceneSnapshot::read(SnapshotAnimation& animation)
+{
+  animation.currentFrame   = _read<int32_t>();
+  animation.stopped        = _read<uint8_t>() != 0;
+  animation.blendingFactor = _read<float>();
+  return _valid;
+}
+
+bool SceneSnapshot::isValid() const
+{
+  return _valid;
+}
+
+bool SceneSnapshot::isAtEnd() const
+{
+  return _offset == _size;
+}
+
+template <typename T>
+void SceneSnapshot::_write(T value)
+{
+  const auto offset = _buffer->size();
+  _buffer->resize(offset + sizeof(T));
+  std::memcpy(_buffer->data() + offset, &value, sizeof(T));
+}
+
+void SceneSnapshot::_write(const string_view& value)
+{
+  _write(static_cast<uint32_t>(value.size()));
+  if (value.empty()) {
+    return;
+  }
+  const auto offset = _buffer->size();
+  _buffer->resize(offset + value.size());
+  std::memcpy(_buffer->data() + offset, value.data(), value.size());
+}
+
+void SceneSnapshot::_write(const Vector3& value)
+{
+  _write(value.x);
+  _write(value.y);
+  _write(value.z);
+}
+
+void SceneSnapshot::_write(const Quaternion& value)
+{
+  _write(value.x);
+  _write(value.y);
+  _write(value.z);
+  _write(value.w);
+}
+
+void SceneSnapshot::_write(const Color3& value)
+{
+  _write(value.r);
+  _write(value.g);
+  _write(value.b);
+}
+
+template <typename T>
+T SceneSnapshot::_read()
+{
+  T value{};
+  if (!_valid || _size - _offset < sizeof(T)) {
+    _valid = false;
+    return value;
+  }
+  std::memcpy(&value, _data + _offset, sizeof(T));
+  _offset += sizeof(T);
+  return value;
+}
+
+void SceneSnapshot::_read(string_view& value)
+{
+  const auto length = _read<uint32_t>();
+  if (!_valid || _size - _offset < length) {
+    _valid = false;
+    value  = string_view();
+    return;
+  }
+  value = string_view(reinterpret_cast<const char*>(_data + _offset), length);
+  _offset += length;
+}
+
+void SceneSnapshot::_read(Vector3& value)
+{
+  value.x = _read<float>();
+  value.y = _read<float>();
+  value.z = _read<float>();
+}
+
+void SceneSnapshot::_read(Quaternion& value)
+{
+  value.x = _read<float>();
+  value.y = _read<float>();
+  value.z = _read<float>();
+  value.w = _read<float>();
+}
+
+void SceneSnapshot::_read(Color3& value)
+{
+  value.r = _read<float>();
+  value.g = _read<float>();
+  value.b = _read<float>();
+}
+
+void SceneSnapshot::_captureMeshes(Scene* scene)
+{
+  writeCount(static_cast<uint32_t>(scene->meshes.size()));
+  SnapshotMesh record;
+  for (auto& mesh : scene->meshes) {
+    record.uniqueId   = mesh->uniqueId;
+    record.id         = mesh->id;
+    record.enabled    = mesh->isEnabled(false);
+    record.visible    = mesh->isVisible;
+    record.visibility = mesh->visibility;
+    record.position.copyFrom(mesh->position());
+    record.rotation.copyFrom(mesh->rotation());
+    record.hasRotationQuaternion = mesh->rotationQuaternionSet();
+    if (record.hasRotationQuaternion) {
+      record.rotationQuaternion.copyFrom(mesh->rotationQuaternion());
+    }
+    record.scaling.copyFrom(mesh->scaling());
+    // Geometry reference
+    auto _mesh         = dynamic_cast<Mesh*>(mesh.get());
+    auto geometry      = _mesh ? _mesh->geometry() : nullptr;
+    record.hasGeometry = (geometry != nullptr);
+    if (geometry) {
+      record.geometryIndex = indexOf(scene->getGeometries(), geometry);
+      record.geometryId    = geometry->id;
+    }
+    // Material reference
+    auto material      = mesh->material();
+    auto multiMaterial = dynamic_cast<MultiMaterial*>(material);
+    if (multiMaterial) {
+      record.materialKind  = SnapshotMaterialKind::Multi;
+      record.materialIndex = indexOf(scene->multiMaterials, multiMaterial);
+      record.materialId    = material->id;
+    }
+    else if (material) {
+      record.materialKind  = SnapshotMaterialKind::Single;
+      record.materialIndex = indexOf(scene->materials, material);
+      record.materialId    = material->id;
+    }
+    else {
+      record.materialKind = SnapshotMaterialKind::None;
+    }
+    // Physics body
+    auto& impostor    = mesh->physicsImpostor;
+    record.hasPhysics = (impostor != nullptr);
+    if (impostor) {
+      record.mass = impostor->getParam("mass");
+      record.linearVelocity.copyFrom(impostor->getLinearVelocity());
+      record.angularVelocity.copyFrom(impostor->getAngularVelocity());
+    }
+    write(record);
+  }
+}
+
+void SceneSnapshot::_restoreMeshes(Scene* scene, bool apply)
+{
+  SnapshotMesh record;
+  const auto count = readCount();
+  for (uint32_t i = 0; i < count && read(record); ++i) {
+    if (!apply) {
+      continue;
+    }
+
+    auto mesh = findNode(scene->meshes, i, record.uniqueId, record.id);
+    if (!mesh) {
+      continue;
+    }
+    if (mesh->isEnabled(false) != record.enabled) {
+      mesh->setEnabled(record.enabled);
+    }
+    mesh->isVisible  = record.visible;
+    mesh->visibility = record.visibility;
+    mesh->position().copyFrom(record.position);
+    mesh->rotation().copyFrom(record.rotation);
+    if (record.hasRotationQuaternion) {
+      mesh->setRotationQuaternion(record.rotationQuaternion);
+    }
+    else if (mesh->rotationQuaternionSet()) {
+      mesh->resetRotationQuaternion();
+    }
+    mesh->scaling().copyFrom(record.scaling);
+    // Geometry reference
+    auto _mesh = dynamic_cast<Mesh*>(mesh);
+    if (_mesh && record.hasGeometry) {
+      auto geometry = findObject(scene->getGeometries(), record.geometryIndex,
+                                 record.geometryId);
+      if (geometry && _mesh->geometry() != geometry) {
+        geometry->applyToMesh(_mesh);
+      }
+    }
+    // Material reference
+    Material* material = nullptr;
+    if (record.materialKind == SnapshotMaterialKind::Single) {
+      material = findObject(scene->materials, record.materialIndex,
+                            record.materialId);
+    }
+    else if (record.materialKind == SnapshotMaterialKind::Multi) {
+      material = findObject(scene->multiMaterials, record.materialIndex,
+                            record.materialId);
+    }
+    if (material || record.materialKind == SnapshotMaterialKind::None) {
+      mesh->setMaterial(material);
+    }
+    // Physics body, whose transform is synchronized with the one of the mesh
+    // before the next physics step
+    auto& impostor = mesh->physicsImpostor;
+    if (impostor && record.hasPhysics) {
+      if (!stl_util::almost_equal(impostor->getParam("mass"), record.mass)) {
+        impostor->setParam("mass", record.mass);
+        impostor->setMass(record.mass);
+      }
+      impostor->setLinearVelocity(record.linearVelocity);
+      impostor->setAngularVelocity(record.angularVelocity);
+    }
+  }
+}
+
+void SceneSnapshot::_captureCameras(Scene* scene)
+{
+  writeCount(static_cast<uint32_t>(scene->cameras.size()));
+  SnapshotCamera record;
+  for (auto& camera : scene->cameras) {
+    auto targetCamera    = dynamic_cast<TargetCamera*>(camera.get());
+    auto arcRotateCamera = dynamic_cast<ArcRotateCamera*>(camera.get());
+    record.uniqueId      = camera->uniqueId;
+    record.id            = camera->id;
+    record.enabled       = camera->isEnabled(false);
+    record.position.copyFrom(camera->position);
+    record.upVector.copyFrom(camera->upVector);
+    record.fov         = camera->fov;
+    record.minZ        = camera->minZ;
+    record.maxZ        = camera->maxZ;
+    record.mode        = camera->mode;
+    record.hasRotation = targetCamera && targetCamera->rotation;
+    if (record.hasRotation) {
+      record.rotation.copyFrom(*targetCamera->rotation);
+    }
+    record.hasRotationQuaternion
+      = targetCamera && targetCamera->rotationQuaternion;
+    if (record.hasRotationQuaternion) {
+      record.rotationQuaternion.copyFrom(*targetCamera->rotationQuaternion);
+    }
+    record.isArcRotate = (arcRotateCamera != nullptr);
+    if (arcRotateCamera) {
+      record.alpha  = arcRotateCamera->alpha;
+      record.beta   = arcRotateCamera->beta;
+      record.radius = arcRotateCamera->radius;
+      record.target.copyFrom(arcRotateCamera->target());
+    }
+    write(record);
+  }
+}
+
+void SceneSnapshot::_restoreCameras(Scene* scene, bool apply)
+{
+  SnapshotCamera record;
+  const auto count = readCount();
+  for (uint32_t i = 0; i < count && read(record); ++i) {
+    if (!apply) {
+      continue;
+    }
+
+    auto camera = findNode(scene->cameras, i, record.uniqueId, record.id);
+    if (!camera) {
+      continue;
+    }
+    if (camera->isEnabled(false) != record.enabled) {
+      camera->setEnabled(record.enabled);
+    }
+    camera->position.copyFrom(record.position);
+    camera->upVector.copyFrom(record.upVector);
+    camera->fov       = record.fov;
+    camera->minZ      = record.minZ;
+    camera->maxZ      = record.maxZ;
+    camera->mode      = record.mode;
+    auto targetCamera = dynamic_cast<TargetCamera*>(camera);
+    if (targetCamera && targetCamera->rotation && record.hasRotation) {
+      targetCamera->rotation->copyFrom(record.rotation);
+    }
+    if (targetCamera && targetCamera->rotationQuaternion
+        && record.hasRotationQuaternion) {
+      targetCamera->rotationQuaternion->copyFrom(record.rotationQuaternion);
+    }
+    auto arcRotateCamera = dynamic_cast<ArcRotateCamera*>(camera);
+    if (arcRotateCamera && record.isArcRotate) {
+      arcRotateCamera->alpha  = record.alpha;
+      arcRotateCamera->beta   = record.beta;
+      arcRotateCamera->radius = record.radius;
+      arcRotateCamera->target().copyFrom(record.target);
+    }
+  }
+}
+
+void SceneSnapshot::_captureLights(Scene* scene)
+{
+  writeCount(static_cast<uint32_t>(scene->lights.size()));
+  SnapshotLight record;
+  for (auto& light : scene->lights) {
+    auto shadowLight      = dynamic_cast<IShadowLight*>(light.get());
+    auto hemisphericLight = dynamic_cast<HemisphericLight*>(light.get());
+    record.uniqueId       = light->uniqueId;
+    record.id             = light->id;
+    record.enabled        = light->isEnabled(false);
+    record.diffuse.copyFrom(light->diffuse);
+    record.specular.copyFrom(light->specular);
+    record.intensity     = light->intensity;
+    record.range         = light->range;
+    record.isShadowLight = (shadowLight != nullptr);
+    record.isHemispheric = (hemisphericLight != nullptr);
+    if (shadowLight) {
+      record.position.copyFrom(shadowLight->position);
+      record.direction.copyFrom(shadowLight->direction);
+    }
+    if (hemisphericLight) {
+      record.direction.copyFrom(hemisphericLight->direction);
+      record.groundColor.copyFrom(hemisphericLight->groundColor);
+    }
+    write(record);
+  }
+}
+
+void SceneSnapshot::_restoreLights(Scene* scene, bool apply)
+{
+  SnapshotLight record;
+  const auto count = readCount();
+  for (uint32_t i = 0; i < count && read(record); ++i) {
+    if (!apply) {
+      continue;
+    }
+
+    auto light = findNode(scene->lights, i, record.uniqueId, record.id);
+    if (!light) {
+      continue;
+    }
+    if (light->isEnabled(false) != record.enabled) {
+      light->setEnabled(record.enabled);
+    }
+    light->diffuse.copyFrom(record.diffuse);
+    light->specular.copyFrom(record.specular);
+    light->intensity = record.intensity;
+    light->range     = record.range;
+    auto shadowLight = dynamic_cast<IShadowLight*>(light);
+    if (shadowLight && record.isShadowLight) {
+      shadowLight->position.copyFrom(record.position);
+      shadowLight->direction.copyFrom(record.direction);
+    }
+    auto hemisphericLight = dynamic_cast<HemisphericLight*>(light);
+    if (hemisphericLight && record.isHemispheric) {
+      hemisphericLight->direction.copyFrom(record.direction);
+      hemisphericLight->groundColor.copyFrom(record.groundColor);
+    }
+  }
+}
+
+void SceneSnapshot::_captureMaterials(Scene* scene)
+{
+  writeCount(static_cast<uint32_t>(scene->materials.size()));
+  SnapshotMaterial record;
+  for (auto& material : scene->materials) {
+    auto standardMaterial  = dynamic_cast<StandardMaterial*>(material.get());
+    record.id              = material->id;
+    record.backFaceCulling = material->backFaceCulling();
+    record.alpha           = material->alpha;
+    record.alphaMode       = material->alphaMode;
+    record.sideOrientation = material->sideOrientation;
+    record.isStandard      = (standardMaterial != nullptr);
+    if (standardMaterial) {
+      record.ambientColor.copyFrom(standardMaterial->ambientColor);
+      record.diffuseColor.copyFrom(standardMaterial->diffuseColor);
+      record.specularColor.copyFrom(standardMaterial->specularColor);
+      record.emissiveColor.copyFrom(standardMaterial->emissiveColor);
+      record.specularPower = standardMaterial->specularPower;
+    }
+    write(record);
+  }
+}
+
+void SceneSnapshot::_restoreMaterials(Scene* scene, bool apply)
+{
+  SnapshotMaterial record;
+  const auto count = readCount();
+  for (uint32_t i = 0; i < count && read(record); ++i) {
+    if (!apply) {
+      continue;
+    }
+
+    auto material = findObject(scene->materials, i, record.id);
+    if (!material) {
+      continue;
+    }
+    material->alpha           = record.alpha;
+    material->alphaMode       = record.alphaMode;
+    material->sideOrientation = record.sideOrientation;
+    if (material->backFaceCulling() != record.backFaceCulling) {
+      material->setBackFaceCulling(record.backFaceCulling);
+    }
+    auto standardMaterial = dynamic_cast<StandardMaterial*>(material);
+    if (standardMaterial && record.isStandard) {
+      standardMaterial->ambientColor.copyFrom(record.ambientColor);
+      standardMaterial->diffuseColor.copyFrom(record.diffuseColor);
+      standardMaterial->specularColor.copyFrom(record.specularColor);
+      standardMaterial->emissiveColor.copyFrom(record.emissiveColor);
+      standardMaterial->specularPower = record.specularPower;
+    }
+  }
+}
+
+void SceneSnapshot::_captureSkeletons(Scene* scene)
+{
+  writeCount(static_cast<uint32_t>(scene->skeletons.size()));
+  SnapshotSkeleton record;
+  SnapshotBone boneRecord;
+  for (auto& skeleton : scene->skeletons) {
+    record.id        = skeleton->id;
+    record.boneCount = static_cast<uint32_t>(skeleton->bones.size());
+    write(record);
+    for (auto& bone : skeleton->bones) {
+      boneRecord.localMatrix = bone->getLocalMatrix().m;
+      write(boneRecord);
+    }
+  }
+}
+
+void SceneSnapshot::_restoreSkeletons(Scene* scene, bool apply)
+{
+  SnapshotSkeleton record;
+  SnapshotBone boneRecord;
+  const auto count = readCount();
+  for (uint32_t i = 0; i < count && read(record); ++i) {
+    Skeleton* skeleton = nullptr;
+    if (apply) {
+      skeleton = findObject(scene->skeletons, i, record.id);
+      if (skeleton && skeleton->bones.size() != record.boneCount) {
+        skeleton = nullptr;
+      }
+    }
+    for (uint32_t b = 0; b < record.boneCount && read(boneRecord); ++b) {
+      if (!skeleton) {
+        continue;
+      }
+      auto& bone   = skeleton->bones[b];
+      auto& matrix = bone->getLocalMatrix();
+      matrix.m     = boneRecord.localMatrix;
+      matrix._markAsUpdated();
+      bone->markAsDirty();
+    }
+    if (skeleton && _valid) {
+      skeleton->_markAsDirty();
+    }
+  }
+}
+
+void SceneSnapshot::_captureAnimatables(Scene* scene)
+{
+  writeCount(static_cast<uint32_t>(scene->_activeAnimatables.size()));
+  SnapshotAnimatable record;
+  SnapshotAnimation animationRecord;
+  for (auto animatable : scene->_activeAnimatables) {
+    auto node               = dynamic_cast<Node*>(animatable->target);
+    record.targetId         = node ? node->uniqueId : NoId;
+    record.loopAnimation    = animatable->loopAnimation;
+    record.paused           = animatable->_paused;
+    record.started          = animatable->animationStarted;
+    record.fromFrame        = animatable->fromFrame;
+    record.toFrame          = animatable->toFrame;
+    record.speedRatio       = animatable->speedRatio;
+    record.localDelayOffset = animatable->_localDelayOffset.count();
+    record.pausedDelay      = animatable->_pausedDelay.count();
+    record.animationCount
+      = static_cast<uint32_t>(animatable->_animations.size());
+    write(record);
+    for (auto animation : animatable->_animations) {
+      animationRecord.currentFrame   = animation->currentFrame;
+      animationRecord.stopped        = animation->_stopped;
+      animationRecord.blendingFactor = animation->_blendingFactor;
+      write(animationRecord);
+    }
+  }
+}
+
+void SceneSnapshot::_restoreAnimatables(Scene* scene, bool apply)
+{
+  SnapshotAnimatable record;
+  SnapshotAnimation animationRecord;
+  const auto count = readCount();
+  for (uint32_t i = 0; i < count && read(record); ++i) {
+    // Animatables are matched by index, and must target the same node
+    Animatable* animatable = nullptr;
+    if (apply && i < scene->_activeAnimatables.size()) {
+      animatable = scene->_activeAnimatables[i];
+      auto node  = dynamic_cast<Node*>(animatable->target);
+      if ((node ? node->uniqueId : NoId) != record.targetId
+          || animatable->_animations.size() != record.animationCount) {
+        animatable = nullptr;
+      }
+    }
+    if (animatable) {
+      animatable->loopAnimation     = record.loopAnimation;
+      animatable->_paused           = record.paused;
+      animatable->animationStarted  = record.started;
+      animatable->fromFrame         = record.fromFrame;
+      animatable->toFrame           = record.toFrame;
+      animatable->speedRatio        = record.speedRatio;
+      animatable->_localDelayOffset = millisecond_t(record.localDelayOffset);
+      animatable->_pausedDelay      = millisecond_t(record.pausedDelay);
+    }
+    for (uint32_t a = 0; a < record.animationCount && read(animationRecord);
+         ++a) {
+      if (!animatable) {
+        continue;
+      }
+      auto animation             = animatable->_animations[a];
+      animation->currentFrame    = animationRecord.currentFrame;
+      animation->_stopped        = animationRecord.stopped;
+      animation->_blendingFactor = animationRecord.blendingFactor;
+    }
+  }
+}
+
+void SceneSnapshot::_restore(Scene* scene, bool apply)
+{
+  SnapshotHeader header;
+  if (!read(header)) {
+    return;
+  }
+  _restoreMeshes(scene, apply);
+  _restoreCameras(scene, apply);
+  _restoreLights(scene, apply);
+  _restoreMaterials(scene, apply);
+  _restoreSkeletons(scene, apply);
+  _restoreAnimatables(scene, apply);
+  if (!apply || !_valid) {
+    return;
+  }
+
+  scene->_animationTime = header.animationTime;
+  for (auto& camera : scene->cameras) {
+    if (camera->uniqueId == header.activeCameraId) {
+      scene->activeCamera = camera.get();
+      break;
+    }
+  }
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,889 @@
+#include <babylon/tools/texture_compressor.h>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/core/hash.h>
+#include <babylon/core/logging.h>
+#include <babylon/core/mapped_file.h>
+#include <babylon/core/worker_pool.h>
+#include <babylon/interfaces/igl_rendering_context.h>
+#include <babylon/tools/async_image_loader.h>
+#include <babylon/tools/dds.h>
+#include <babylon/tools/mipmap_generator.h>
+
+// SIMD
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+#include <babylon/math/simd/float32x4.h>
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+// Changed with the encoders so that previously cached files are not used
+constexpr uint64_t CacheVersion = 1;
+
+// Approximate number of blocks compressed by a worker task
+constexpr int BlocksPerTask = 1024;
+
+// Interpolation weights of the 4 bits BC7 indices
+constexpr int BC7Weights[16]
+  = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+// 4x4 block of RGBA pixels, stored one channel after the other
+struct PixelBlock {
+  alignas(16) float c[4][16];
+}; // end of struct PixelBlock
+
+// Writes values LSB first into a zeroed block
+struct BitWriter {
+  uint8_t* data;
+  size_t pos;
+
+  void write(uint32_t value, int count)
+  {
+    for (int i = 0; i < count; ++i, ++pos) {
+      if ((value >> i) & 1) {
+        data[pos >> 3] |= static_cast<uint8_t>(1 << (pos & 7));
+      }
+    }
+  }
+}; // end of struct BitWriter
+
+inline float clamp255(float value)
+{
+  return std::min(std::max(value, 0.f), 255.f);
+}
+
+// t = dot(p - origin, axis) over the first channelCount channels
+void project(const PixelBlock& block, const float* origin, const float* axis,
+             int channelCount, float* t)
+{
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+  for (int i = 0; i < 16; i += 4) {
+    SIMD::Float32x4 sum(0.f);
+    for (int ch = 0; ch < channelCount; ++ch) {
+      const auto d = SIMD::Float32x4(block.c[ch] + i) - origin[ch];
+      sum += d * SIMD::Float32x4(axis[ch]);
+    }
+    _mm_store_ps(t + i, sum.xmm);
+  }
+#else
+  for (int i = 0; i < 16; ++i) {
+    float sum = 0.f;
+    for (int ch = 0; ch < channelCount; ++ch) {
+      sum += (block.c[ch][i] - origin[ch]) * axis[ch];
+    }
+    t[i] = sum;
+  }
+#endif
+}
+
+// Mean and principal axis of the pixels with a non zero weight, the axis is
+// null for a flat block
+void principalAxis(const PixelBlock& block, const float* weights,
+                   int channelCount, float* mean, float* axis)
+{
+  float total = 0.f;
+  for (int ch = 0; ch < 4; ++ch) {
+    mean[ch] = 0.f;
+    axis[ch] = 0.f;
+  }
+  for (int i = 0; i < 16; ++i) {
+    total += weights[i];
+    for (int ch = 0; ch < channelCount; ++ch) {
+      mean[ch] += weights[i] * block.c[ch][i];
+    }
+  }
+  if (total <= 0.f) {
+    return;
+  }
+  for (int ch = 0; ch < channelCount; ++ch) {
+    mean[ch] /= total;
+  }
+
+  float covariance[4][4] = {};
+  for (int i = 0; i < 16; ++i) {
+    float d[4];
+    for (int ch = 0; ch < channelCount; ++ch) {
+      d[ch] = block.c[ch][i] - mean[ch];
+    }
+    for (int a = 0; a < channelCount; ++a) {
+      for (int b = 0; b <= a; ++b) {
+        covariance[a][b] += weights[i] * d[a] * d[b];
+      }
+    }
+  }
+
+  // Power iteration from the channel with the largest variance
+  int largest = 0;
+  for (int a = 0; a < channelCount; ++a) {
+    for (int b = a + 1; b < channelCount; ++b) {
+      covariance[a][b] = covariance[b][a];
+    }
+    if (covariance[a][a] > covariance[largest][largest]) {
+      largest = a;
+    }
+  }
+  for (int ch = 0; ch < channelCount; ++ch) {
+    axis[ch] = covariance[ch][largest];
+  }
+  for (int iteration = 0; iteration < 8; ++iteration) {
+    float next[4] = {};
+    float norm    = 0.f;
+    for (int a = 0; a < channelCount; ++a) {
+      for (int b = 0; b < channelCount; ++b) {
+        next[a] += covariance[a][b] * axis[b];
+      }
+      norm = std::max(norm, std::abs(next[a]));
+    }
+    if (norm <= 0.f) {
+      break;
+    }
+    for (int ch = 0; ch < channelCount; ++ch) {
+      axis[ch] = next[ch] / norm;
+    }
+  }
+
+  float length = 0.f;
+  for (int ch = 0; ch < channelCount; ++ch) {
+    length += axis[ch] * axis[ch];
+  }
+  length = std::sqrt(length);
+  for (int ch = 0; ch < channelCount; ++ch) {
+    axis[ch] = (length > 0.f) ? axis[ch] / length : 0.f;
+  }
+}
+
+// Endpoints spanning the projection of the pixels on their principal axis
+void fitEndpoints(const PixelBlock& block, const float* weights,
+                  int channelCount, float* e0, float* e1)
+{
+  float mean[4], axis[4];
+  principalAxis(block, weights, channelCount, mean, axis);
+
+  alignas(16) float t[16];
+  project(block, mean, axis, channelCount, t);
+  float tMin = 0.f, tMax = 0.f;
+  for (int i = 0; i < 16; ++i) {
+    if (weights[i] > 0.f) {
+      tMin = std::min(tMin, t[i]);
+      tMax = std::max(tMax, t[i]);
+    }
+  }
+
+  for (int ch = 0; ch < channelCount; ++ch) {
+    e0[ch] = clamp255(mean[ch] + tMin * axis[ch]);
+    e1[ch] = clamp255(mean[ch] + tMax * axis[ch]);
+  }
+}
+
+// Endpoints minimizing the squared error of the pixels interpolated at s
+void leastSquares(const PixelBlock& block, const float* weights,
+                  const float* s, int channelCount, float* e0, float* e1)
+{
+  float a = 0.f, b = 0.f, c = 0.f;
+  float x0[4] = {}, x1[4] = {};
+  for (int i = 0; i < 16; ++i) {
+    const float w  = weights[i];
+    const float s1 = s[i], s0 = 1.f - s[i];
+    a += w * s0 * s0;
+    b += w * s0 * s1;
+    c += w * s1 * s1;
+    for (int ch = 0; ch < channelCount; ++ch) {
+      x0[ch] += w * s0 * block.c[ch][i];
+      x1[ch] += w * s1 * block.c[ch][i];
+    }
+  }
+
+  const float det = a * c - b * b;
+  if (std::abs(det) < 1e-6f) {
+    return;
+  }
+  for (int ch = 0; ch < channelCount; ++ch) {
+    e0[ch] = clamp255((c * x0[ch] - b * x1[ch]) / det);
+    e1[ch] = clamp255((a * x1[ch] - b * x0[ch]) / det);
+  }
+}
+
+uint16_t toRGB565(const float* color, float* expanded)
+{
+  const auto r = static_cast<uint16_t>(color[0] * 31.f / 255.f + 0.5f);
+  const auto g = static_cast<uint16_t>(color[1] * 63.f / 255.f + 0.5f);
+  const auto b = static_cast<uint16_t>(color[2] * 31.f / 255.f + 0.5f);
+  expanded[0] = static_cast<float>((r << 3) | (r >> 2));
+  expanded[1] = static_cast<float>((g << 2) | (g >> 4));
+  expanded[2] = static_cast<float>((b << 3) | (b >> 2));
+  return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+// Selects the palette entries e0 + (e1 - e0) * q / steps of the pixels
+float fitColorIndices(const PixelBlock& block, const float* weights,
+                      const float* e0, const float* e1, int steps, int* q)
+{
+  float axis[3];
+  float length2 = 0.f;
+  for (int ch = 0; ch < 3; ++ch) {
+    axis[ch] = e1[ch] - e0[ch];
+    length2 += axis[ch] * axis[ch];
+  }
+  for (int ch = 0; ch < 3; ++ch) {
+    axis[ch] = (length2 > 0.f) ? axis[ch] / length2 : 0.f;
+  }
+
+  alignas(16) float t[16];
+  project(block, e0, axis, 3, t);
+
+  float error = 0.f;
+  for (int i = 0; i < 16; ++i) {
+    q[i] = std::min(std::max(static_cast<int>(t[i] * steps + 0.5f), 0), steps);
+    const float s = static_cast<float>(q[i]) / steps;
+    for (int ch = 0; ch < 3; ++ch) {
+      const float d = e0[ch] + (e1[ch] - e0[ch]) * s - block.c[ch][i];
+      error += weights[i] * d * d;
+    }
+  }
+
+  return error;
+}
+
+// BC1 color block, with punch through alpha when allowed
+void compressColorBlock(const PixelBlock& block, bool punchThrough,
+                        uint8_t* dst)
+{
+  float weights[16];
+  bool hasTransparent = false;
+  bool hasOpaque      = false;
+  for (int i = 0; i < 16; ++i) {
+    const bool transparent = punchThrough && block.c[3][i] < 128.f;
+    weights[i]             = transparent ? 0.f : 1.f;
+    hasTransparent         = hasTransparent || transparent;
+    hasOpaque              = hasOpaque || !transparent;
+  }
+
+  uint16_t c0 = 0, c1 = 0;
+  int q[16]   = {};
+  // 3 colors and transparent black when color0 <= color1, 4 colors otherwise
+  const int steps = hasTransparent ? 2 : 3;
+  if (hasOpaque) {
+    float e0[3], e1[3], q0[3], q1[3];
+    fitEndpoints(block, weights, 3, e0, e1);
+    c0               = toRGB565(e0, q0);
+    c1               = toRGB565(e1, q1);
+    float bestError  = fitColorIndices(block, weights, q0, q1, steps, q);
+
+    // Refine the endpoints from the selected indices
+    float s[16];
+    for (int i = 0; i < 16; ++i) {
+      s[i] = static_cast<float>(q[i]) / steps;
+    }
+    leastSquares(block, weights, s, 3, e0, e1);
+    int refinedQ[16];
+    const auto refined0 = toRGB565(e0, q0);
+    const auto refined1 = toRGB565(e1, q1);
+    const float error
+      = fitColorIndices(block, weights, q0, q1, steps, refinedQ);
+    if (error < bestError) {
+      c0 = refined0;
+      c1 = refined1;
+      std::copy(refinedQ, refinedQ + 16, q);
+    }
+  }
+
+  uint32_t indices = 0;
+  if (!hasTransparent) {
+    if (c0 < c1) {
+      std::swap(c0, c1);
+      for (auto& index : q) {
+        index = 3 - index;
+      }
+    }
+    static const uint32_t codes[4] = {0, 2, 3, 1};
+    for (int i = 0; i < 16; ++i) {
+      indices |= (c0 == c1 ? 0 : codes[q[i]]) << (2 * i);
+    }
+  }
+  else {
+    if (c0 > c1) {
+      std::swap(c0, c1);
+      for (auto& index : q) {
+        index = 2 - index;
+      }
+    }
+    static const uint32_t codes[3] = {0, 2, 1};
+    for (int i = 0; i < 16; ++i) {
+      indices |= (weights[i] > 0.f ? codes[q[i]] : 3) << (2 * i);
+    }
+  }
+
+  dst[0] = static_cast<uint8_t>(c0 & 0xff);
+  dst[1] = static_cast<uint8_t>(c0 >> 8);
+  dst[2] = static_cast<uint8_t>(c1 & 0xff);
+  dst[3] = static_cast<uint8_t>(c1 >> 8);
+  for (int i = 0; i < 4; ++i) {
+    dst[4 + i] = static_cast<uint8_t>((indices >> (8 * i)) & 0xff);
+  }
+}
+
+// BC4 block of a single channel, also the alpha block of BC3
+void compressChannelBlock(const float* values, uint8_t* dst)
+{
+  float minValue = values[0], maxValue = values[0];
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+  SIMD::Float32x4 minimum(values), maximum(values);
+  for (int i = 4; i < 16; i += 4) {
+    const SIMD::Float32x4 v(values + i);
+    minimum.xmm = minimum.min(v).xmm;
+    maximum.xmm = maximum.max(v).xmm;
+  }
+  for (int lane = 0; lane < 4; ++lane) {
+    minValue
+      = std::min(minValue, SIMD::Float32x4::extractLane(minimum.xmm, lane));
+    maxValue
+      = std::max(maxValue, SIMD::Float32x4::extractLane(maximum.xmm, lane));
+  }
+#else
+  for (int i = 1; i < 16; ++i) {
+    minValue = std::min(minValue, values[i]);
+    maxValue = std::max(maxValue, values[i]);
+  }
+#endif
+
+  // 8 interpolated values when a0 > a1
+  const auto a0 = static_cast<int>(maxValue + 0.5f);
+  const auto a1 = static_cast<int>(minValue + 0.5f);
+  dst[0]        = static_cast<uint8_t>(a0);
+  dst[1]        = static_cast<uint8_t>(a1);
+
+  uint64_t indices = 0;
+  if (a0 > a1) {
+    static const uint64_t codes[8] = {1, 7, 6, 5, 4, 3, 2, 0};
+    const float scale              = 7.f / static_cast<float>(a0 - a1);
+    for (int i = 0; i < 16; ++i) {
+      const auto k = std::min(
+        std::max(static_cast<int>((values[i] - a1) * scale + 0.5f), 0), 7);
+      indices |= codes[k] << (3 * i);
+    }
+  }
+
+  for (int i = 0; i < 6; ++i) {
+    dst[2 + i] = static_cast<uint8_t>((indices >> (8 * i)) & 0xff);
+  }
+}
+
+// Mode 6 endpoint, 7 bits per channel and a shared p-bit
+void quantizeBC7Endpoint(const float* endpoint, int* q, int& pBit,
+                         float* expanded)
+{
+  float bestError = std::numeric_limits<float>::max();
+  for (int p = 0; p < 2; ++p) {
+    int candidate[4];
+    float error = 0.f;
+    for (int ch = 0; ch < 4; ++ch) {
+      candidate[ch] = std::min(
+        std::max(static_cast<int>((endpoint[ch] - p) * 0.5f + 0.5f), 0), 127);
+      const float d = static_cast<float>(candidate[ch] * 2 + p) - endpoint[ch];
+      error += d * d;
+    }
+    if (error < bestError) {
+      bestError = error;
+      pBit      = p;
+      std::copy(candidate, candidate + 4, q);
+    }
+  }
+  for (int ch = 0; ch < 4; ++ch) {
+    expanded[ch] = static_cast<float>(q[ch] * 2 + pBit);
+  }
+}
+
+float fitBC7Indices(const PixelBlock& block, const float* e0, const float* e1,
+                    int* indices)
+{
+  float axis[4];
+  float length2 = 0.f;
+  for (int ch = 0; ch < 4; ++ch) {
+    axis[ch] = e1[ch] - e0[ch];
+    length2 += axis[ch] * axis[ch];
+  }
+  for (int ch = 0; ch < 4; ++ch) {
+    axis[ch] = (length2 > 0.f) ? axis[ch] / length2 : 0.f;
+  }
+
+  alignas(16) float t[16];
+  project(block, e0, axis, 4, t);
+
+  float error = 0.f;
+  for (int i = 0; i < 16; ++i) {
+    // The weights are close to uniform, the neighbours of the rounded index
+    // are checked against the decoded colors
+    const int rounded
+      = std::min(std::max(static_cast<int>(t[i] * 15.f + 0.5f), 0), 15);
+    float bestError = std::numeric_limits<float>::max();
+    for (int k = std::max(rounded - 1, 0); k <= std::min(rounded + 1, 15);
+         ++k) {
+      float candidateError = 0.f;
+      for (int ch = 0; ch < 4; ++ch) {
+        const int decoded = ((64 - BC7Weights[k]) * static_cast<int>(e0[ch])
+                             + BC7Weights[k] * static_cast<int>(e1[ch]) + 32)
+                            >> 6;
+        const float d = static_cast<float>(decoded) - block.c[ch][i];
+        candidateError += d * d;
+      }
+      if (candidateError < bestError) {
+        bestError  = candidateError;
+        indices[i] = k;
+      }
+    }
+    error += bestError;
+  }
+
+  return error;
+}
+
+// BC7 mode 6 block
+void compressBC7Block(const PixelBlock& block, uint8_t* dst)
+{
+  static const float weights[16] = {1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f,
+                                    1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f};
+
+  float e0[4], e1[4], x0[4], x1[4];
+  int q0[4], q1[4], p0 = 0, p1 = 0, indices[16];
+  fitEndpoints(block, weights, 4, e0, e1);
+  quantizeBC7Endpoint(e0, q0, p0, x0);
+  quantizeBC7Endpoint(e1, q1, p1, x1);
+  float bestError = fitBC7Indices(block, x0, x1, indices);
+
+  // Refine the endpoints from the selected indices
+  float s[16];
+  for (int i = 0; i < 16; ++i) {
+    s[i] = BC7Weights[indices[i]] / 64.f;
+  }
+  leastSquares(block, weights, s, 4, e0, e1);
+  int r0[4], r1[4], rp0 = 0, rp1 = 0, refinedIndices[16];
+  quantizeBC7Endpoint(e0, r0, rp0, x0);
+  quantizeBC7Endpoint(e1, r1, rp1, x1);
+  if (fitBC7Indices(block, x0, x1, refinedIndices) < bestError) {
+    std::copy(r0, r0 + 4, q0);
+    std::copy(r1, r1 + 4, q1);
+    std::copy(refinedIndices, refinedIndices + 16, indices);
+    p0 = rp0;
+    p1 = rp1;
+  }
+
+  // The most significant bit of the first index is implicitly 0
+  if (indices[0] & 8) {
+    std::swap(q0, q1);
+    std::swap(p0, p1);
+    for (auto& index : indices) {
+      index = 15 - index;
+    }
+  }
+
+  std::fill(dst, dst + 16, uint8_t(0));
+  BitWriter writer{dst, 0};
+  writer.write(1 << 6, 7);
+  for (int ch = 0; ch < 4; ++ch) {
+    writer.write(static_cast<uint32_t>(q0[ch]), 7);
+    writer.write(static_cast<uint32_t>(q1[ch]), 7);
+  }
+  writer.write(static_cast<uint32_t>(p0), 1);
+  writer.write(static_cast<uint32_t>(p1), 1);
+  writer.write(static_cast<uint32_t>(indices[0]), 3);
+  for (int i = 1; i < 16; ++i) {
+    writer.write(static_cast<uint32_t>(indices[i]), 4);
+  }
+}
+
+bool hasAlpha(const Image& image)
+{
+  if (image.depth < 4) {
+    return false;
+  }
+  for (size_t i = 3; i < image.data.size(); i += 4) {
+    if (image.data[i] < 255) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // end of anonymous namespace
+
+TextureCompressor::TextureCompressor(size_t workerCount)
+    : TextureCompressor{WorkerPool::Create(workerCount)}
+{
+}
+
+TextureCompressor::TextureCompressor(std::shared_ptr<WorkerPool> pool)
+    : cacheDirectory{"texture_cache"}
+    , _mipmapGenerator{pool}
+    , _tasks{std::make_unique<WorkerTaskGroup>(pool)}
+{
+}
+
+TextureCompressor::~TextureCompressor()
+{
+  // Waits for the queued files to be written
+  _tasks.reset();
+}
+
+CompressedTexture TextureCompressor::compress(const Image& image,
+                                              BlockCompressionFormat format,
+                                              bool generateMipmaps)
+{
+  return _compress(image, format, generateMipmaps, mipmapOptions);
+}
+
+CompressedTexture TextureCompressor::_compress(const Image& image,
+                                               BlockCompressionFormat format,
+                                               bool generateMipmaps,
+                                               const MipmapOptions& options)
+{
+  CompressedTexture texture;
+  texture.format = format;
+  texture.width  = image.width;
+  texture.height = image.height;
+
+  std::vector<const Image*> levels{&image};
+  std::vector<Image> mips;
+  if (generateMipmaps) {
+    mips = _mipmapGenerator.generate(image, options);
+    for (const auto& mip : mips) {
+      levels.emplace_back(&mip);
+    }
+  }
+
+  // Rows of blocks of all the levels, compressed in ranges of about
+  // BlocksPerTask blocks
+  struct BlockRows {
+    const Image* image;
+    int firstRow;
+    int lastRow;
+    uint8_t* dst;
+  };
+  const auto blockBytes = GetBlockBytes(format);
+  std::vector<BlockRows> tasks;
+  texture.levels.resize(levels.size());
+  for (size_t level = 0; level < levels.size(); ++level) {
+    const auto* levelImage = levels[level];
+    const int blocksX      = (levelImage->width + 3) / 4;
+    const int blocksY      = (levelImage->height + 3) / 4;
+    texture.levels[level].resize(static_cast<size_t>(blocksX * blocksY)
+                                 * blockBytes);
+
+    const int rowsPerTask = std::max(BlocksPerTask / blocksX, 1);
+    for (int row = 0; row < blocksY; row += rowsPerTask) {
+      const int lastRow = std::min(row + rowsPerTask, blocksY);
+      auto dst          = texture.levels[level].data()
+                 + static_cast<size_t>(row * blocksX) * blockBytes;
+      tasks.push_back({levelImage, row, lastRow, dst});
+    }
+  }
+
+  _tasks->pool().parallelFor(
+    tasks.size(), 1, [&tasks, format](size_t first, size_t last) {
+      for (size_t i = first; i < last; ++i) {
+        const auto& task = tasks[i];
+        _compressBlocks(*task.image, format, task.firstRow, task.lastRow,
+                        task.dst);
+      }
+    });
+
+  return texture;
+}
+
+std::string TextureCompressor::compressFile(const std::string& url,
+                                            bool highQuality,
+                                            bool flipVertically)
+{
+  const auto path
+    = _cachePath(url, highQuality, flipVertically, mipmapOptions);
+  if (path.empty()) {
+    return path;
+  }
+
+  // Waits for a compression of the same file queued by compressFileAsync(),
+  // and claims the path so that the file is not written twice
+  {
+    std::unique_lock<std::mutex> lock(_compressingMutex);
+    _compressed.wait(lock, [this, &path]() {
+      return _compressing.find(path) == _compressing.end();
+    });
+    if (MappedFile(path).isOpen()) {
+      return path;
+    }
+    _compressing.emplace(path);
+  }
+  const auto compressed
+    = _compressFile(url, path, highQuality, flipVertically, mipmapOptions);
+  _finishCompression(path);
+
+  return compressed ? path : "";
+}
+
+std::string TextureCompressor::compressFileAsync(const std::string& url,
+                                                 bool highQuality,
+                                                 bool flipVertically)
+{
+  const auto path
+    = _cachePath(url, highQuality, flipVertically, mipmapOptions);
+  if (path.empty() || MappedFile(path).isOpen()) {
+    return path;
+  }
+
+  // Queued once, the settings being copied for the worker
+  {
+    std::lock_guard<std::mutex> lock(_compressingMutex);
+    if (!_compressing.emplace(path).second) {
+      return "";
+    }
+  }
+  const auto options = mipmapOptions;
+  _tasks->send([this, url, path, highQuality, flipVertically, options]() {
+    _compressFile(url, path, highQuality, flipVertically, options);
+    _finishCompression(path);
+  });
+
+  return "";
+}
+
+size_t TextureCompressor::pendingCount() const
+{
+  std::lock_guard<std::mutex> lock(_compressingMutex);
+  return _compressing.size();
+}
+
+void TextureCompressor::_finishCompression(const std::string& path)
+{
+  {
+    std::lock_guard<std::mutex> lock(_compressingMutex);
+    _compressing.erase(path);
+  }
+  _compressed.notify_all();
+}
+
+std::string TextureCompressor::_cachePath(const std::string& url,
+                                          bool highQuality,
+                                          bool flipVertically,
+                                          const MipmapOptions& options) const
+{
+  MappedFile source(url);
+  if (!source.isOpen()) {
+    BABYLON_LOG_ERROR("TextureCompressor", "Error loading image from file ",
+                      url);
+    return "";
+  }
+
+  // The cache key covers the source content and the compression settings
+  const auto alphaCutoff
+    = static_cast<uint64_t>(options.alphaCutoff * 255.f + 0.5f) & 0xff;
+  const uint64_t settings
+    = (CacheVersion << 16) | (alphaCutoff << 8)
+      | (static_cast<uint64_t>(options.filter) << 5)
+      | (options.preserveAlphaCoverage ? 16u : 0u)
+      | (options.sRGB ? 8u : 0u) | (highQuality ? 2u : 0u)
+      | (flipVertically ? 1u : 0u);
+  std::ostringstream fileName;
+  fileName << std::hex << std::setw(16) << std::setfill('0')
+           << Hash64(source.data(), source.size(), settings) << ".dds";
+  return Filesystem::joinPath(cacheDirectory, fileName.str());
+}
+
+bool TextureCompressor::_compressFile(const std::string& url,
+                                      const std::string& path,
+                                      bool highQuality, bool flipVertically,
+                                      const MipmapOptions& options)
+{
+  Image image;
+  std::string error;
+  if (!AsyncImageLoader::DecodeImage(url, image, error, flipVertically)) {
+    BABYLON_LOG_ERROR("TextureCompressor", error);
+    return false;
+  }
+
+  const auto format = highQuality ? BlockCompressionFormat::BC7 :
+                                    hasAlpha(image) ?
+                                    BlockCompressionFormat::BC3 :
+                                    BlockCompressionFormat::BC1;
+  const auto dds = ToDDS(_compress(image, format, true, options));
+
+#ifdef __unix__
+  if (!cacheDirectory.empty() && !Filesystem::isDirectory(cacheDirectory)) {
+    Filesystem::createDirectory(cacheDirectory);
+  }
+#endif
+
+  if (!Filesystem::writeFileAtomically(path, dds.data(), dds.size())) {
+    BABYLON_LOG_ERROR("TextureCompressor", "Error writing file ", path);
+    return false;
+  }
+
+  return true;
+}
+
+size_t TextureCompressor::workerCount() const
+{
+  return _tasks->workerCount();
+}
+
+size_t TextureCompressor::GetBlockBytes(BlockCompressionFormat format)
+{
+  return (format == BlockCompressionFormat::BC1
+          || format == BlockCompressionFormat::BC4) ?
+           8 :
+           16;
+}
+
+unsigned int TextureCompressor::GetInternalFormat(BlockCompressionFormat format)
+{
+  switch (format) {
+    case BlockCompressionFormat::BC1:
+      return GL::COMPRESSED_RGBA_S3TC_DXT1_EXT;
+    case BlockCompressionFormat::BC3:
+      return GL::COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    case BlockCompressionFormat::BC4:
+      return GL::COMPRESSED_RED_RGTC1;
+    case BlockCompressionFormat::BC5:
+      return GL::COMPRESSED_RG_RGTC2;
+    case BlockCompressionFormat::BC7:
+      return GL::COMPRESSED_RGBA_BPTC_UNORM;
+  }
+  return 0;
+}
+
+void TextureCompressor::CompressBlock(const uint8_t* rgba,
+                                      BlockCompressionFormat format,
+                                      uint8_t* dst)
+{
+  PixelBlock block;
+  for (int i = 0; i < 16; ++i) {
+    for (int ch = 0; ch < 4; ++ch) {
+      block.c[ch][i] = rgba[i * 4 + ch];
+    }
+  }
+
+  switch (format) {
+    case BlockCompressionFormat::BC1:
+      compressColorBlock(block, true, dst);
+      break;
+    case BlockCompressionFormat::BC3:
+      compressChannelBlock(block.c[3], dst);
+      compressColorBlock(block, false, dst + 8);
+      break;
+    case BlockCompressionFormat::BC4:
+      compressChannelBlock(block.c[0], dst);
+      break;
+    case BlockCompressionFormat::BC5:
+      compressChannelBlock(block.c[0], dst);
+      compressChannelBlock(block.c[1], dst + 8);
+      break;
+    case BlockCompressionFormat::BC7:
+      compressBC7Block(block, dst);
+      break;
+  }
+}
+
+Uint8Array TextureCompressor::CompressImage(const Image& image,
+                                            BlockCompressionFormat format)
+{
+  const int blocksX = (image.width + 3) / 4;
+  const int blocksY = (image.height + 3) / 4;
+  Uint8Array data(static_cast<size_t>(blocksX * blocksY)
+                  * GetBlockBytes(format));
+  _compressBlocks(image, format, 0, blocksY, data.data());
+  return data;
+}
+
+void TextureCompressor::_compressBlocks(const Image& image,
+                                        BlockCompressionFormat format,
+                                        int firstBlockRow, int lastBlockRow,
+                                        uint8_t* dst)
+{
+  const int blocksX     = (image.width + 3) / 4;
+  const auto blockBytes = GetBlockBytes(format);
+  const int depth       = image.depth;
+  uint8_t rgba[64];
+
+  for (int by = firstBlockRow; by < lastBlockRow; ++by) {
+    for (int bx = 0; bx < blocksX; ++bx) {
+      // Edge pixels are repeated in the blocks crossing the image border
+      for (int y = 0; y < 4; ++y) {
+        const int sy = std::min(by * 4 + y, image.height - 1);
+        for (int x = 0; x < 4; ++x) {
+          const int sx   = std::min(bx * 4 + x, image.width - 1);
+          const auto src = image.data.data() + (sy * image.width + sx) * depth;
+          auto pixel     = rgba + (y * 4 + x) * 4;
+          pixel[0]       = src[0];
+          pixel[1]       = (depth > 1) ? src[1] : src[0];
+          pixel[2]       = (depth > 2) ? src[2] : src[0];
+          pixel[3]       = (depth > 3) ? src[3] : 255;
+        }
+      }
+      CompressBlock(rgba, format, dst);
+      dst += blockBytes;
+    }
+  }
+}
+
+Uint8Array TextureCompressor::ToDDS(const CompressedTexture& texture)
+{
+  using namespace Internals;
+
+  const bool isDX10 = (texture.format == BlockCompressionFormat::BC7);
+  const size_t headerLength
+    = (DDS::headerLengthInt + (isDX10 ? DDS::dx10HeaderLengthInt : 0))
+      * sizeof(int32_t);
+  Int32Array header(headerLength / sizeof(int32_t), 0);
+  header[off_magic]  = DDS_MAGIC;
+  header[off_size]   = 124;
+  header[off_flags]  = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT
+                      | DDSD_MIPMAPCOUNT | DDSD_LINEARSIZE;
+  header[off_height] = texture.height;
+  header[off_width]  = texture.width;
+  header[off_pitchOrLinearSize]
+    = texture.levels.empty() ? 0 : static_cast<int>(texture.levels[0].size());
+  header[off_mipmapCount] = static_cast<int>(texture.levels.size());
+  header[off_pfSize]      = 32;
+  header[off_pfFlags]     = DDPF_FOURCC;
+  header[off_caps1]       = DDSCAPS_TEXTURE;
+  if (texture.levels.size() > 1) {
+    header[off_caps1] |= DDSCAPS_COMPLEX | DDSCAPS_MIPMAP;
+  }
+
+  unsigned int fourCC = DDS::FOURCC_DX10;
+  switch (texture.format) {
+    case BlockCompressionFormat::BC1:
+      fourCC = DDS::FOURCC_DXT1;
+      break;
+    case BlockCompressionFormat::BC3:
+      fourCC = DDS::FOURCC_DXT5;
+      break;
+    case BlockCompressionFormat::BC4:
+      fourCC = DDS::FOURCC_ATI1;
+      break;
+    case BlockCompressionFormat::BC5:
+      fourCC = DDS::FOURCC_ATI2;
+      break;
+    case BlockCompressionFormat::BC7:
+      header[off_dxgiFormat]        = DXGI_FORMAT_BC7_UNORM;
+      header[off_resourceDimension] = 3; // Texture 2D
+      header[off_arraySize]         = 1;
+      break;
+  }
+  header[off_pfFourCC] = static_cast<int>(fourCC);
+
+  size_t dataLength = 0;
+  for (const auto& level : texture.levels) {
+    dataLength += level.size();
+  }
+
+  Uint8Array dds(headerLength + dataLength);
+  std::memcpy(dds.data(), header.data(), headerLength);
+  auto dst = dds.data() + headerLength;
+  for (const auto& level : texture.levels) {
+    dst = std::copy(level.begin(), level.end(), dst);
+  }
+
+  return dds;
+}
+
+} // end of namespace BABYLON
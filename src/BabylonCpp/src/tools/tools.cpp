@@ -16,6 +16,8 @@
 #pragma GCC diagnostic pop
 #endif
 
+#include <babylon/core/logging.h>
+#include <babylon/core/mapped_file.h>
 #include <babylon/core/random.h>
 #include <babylon/interfaces/igl_rendering_context.h>
 #include <babylon/math/vector3.h>
@@ -175,10 +177,20 @@ void Tools::LoadImage(
 }
 
 void Tools::LoadFile(
-  const std::string& /*url*/,
-  const std::function<void(const std::string& text)>& /*callback*/,
+  const std::string& url,
+  const std::function<void(const std::string& text)>& callback,
   const std::function<void()>& /*progressCallBack*/, bool /*useArrayBuffer*/)
 {
+  MappedFile file(url);
+  if (!file.isOpen()) {
+    BABYLON_LOG_ERROR("Tools", "Error loading file ", url);
+    return;
+  }
+
+  if (callback) {
+    const auto data = reinterpret_cast<const char*>(file.data());
+    callback(std::string(data, data + file.size()));
+  }
 }
 
 void Tools::CheckExtends(Vector3& v, Vector3& min, Vector3& max)
@@ -45,3 +45,31 @@ TEST(TestFilesystem, removeExtension)
   EXPECT_EQ(Filesystem::removeExtension("job.sh"), "job");
   EXPECT_EQ(Filesystem::removeExtension("winhelp.exe"), "winhelp");
 }
+
+TEST(TestFilesystem, writeFileAtomically)
+{
+  using namespace BABYLON;
+
+  // Writers of the same file from several threads each write a whole file
+  const auto path
+    = Filesystem::joinPath(::testing::TempDir(), std::string("atomic.bin"));
+  std::vector<std::string> contents;
+  for (char c = 'a'; c < 'e'; ++c) {
+    contents.emplace_back(std::string(100000, c));
+  }
+  std::vector<std::thread> writers;
+  for (const auto& content : contents) {
+    writers.emplace_back([&path, &content]() {
+      EXPECT_TRUE(Filesystem::writeFileAtomically(path, content.data(),
+                                                  content.size()));
+    });
+  }
+  for (auto& writer : writers) {
+    writer.join();
+  }
+  EXPECT_THAT(contents,
+              ::testing::Contains(Filesystem::readFileContents(path.c_str())));
+
+  EXPECT_FALSE(
+    Filesystem::writeFileAtomically("/nonexistent/directory/file", "x", 1));
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/frame_arena.h>
+
+TEST(TestFrameArena, AllocateAligned)
+{
+  using namespace BABYLON;
+  FrameArena arena(256);
+  auto a = arena.allocate(3, 1);
+  auto b = arena.allocate(sizeof(double), alignof(double));
+  EXPECT_NE(a, nullptr);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % alignof(double), 0);
+  EXPECT_EQ(arena.allocationCount(), 2);
+  EXPECT_EQ(arena.bytesAllocated(), 3 + sizeof(double));
+}
+
+TEST(TestFrameArena, ResetMergesBlocks)
+{
+  using namespace BABYLON;
+  FrameArena arena(128);
+  for (unsigned int i = 0; i < 8; ++i) {
+    arena.allocate(100);
+  }
+  const auto capacity = arena.capacity();
+  EXPECT_GE(capacity, 800);
+  arena.reset();
+  EXPECT_EQ(arena.allocationCount(), 0);
+  EXPECT_EQ(arena.bytesAllocated(), 0);
+  EXPECT_EQ(arena.capacity(), capacity);
+  // The whole previous frame now fits in the first block
+  auto first = reinterpret_cast<std::uintptr_t>(arena.allocate(100));
+  for (unsigned int i = 1; i < 8; ++i) {
+    auto ptr = reinterpret_cast<std::uintptr_t>(arena.allocate(100));
+    EXPECT_GT(ptr, first);
+    EXPECT_LT(ptr, first + capacity);
+  }
+  EXPECT_EQ(arena.capacity(), capacity);
+}
+
+TEST(TestFrameArena, DeallocateLastAllocation)
+{
+  using namespace BABYLON;
+  FrameArena arena;
+  auto a = arena.allocate(64, 16);
+  arena.deallocate(a, 64);
+  auto b = arena.allocate(64, 16);
+  EXPECT_EQ(a, b);
+}
+
+TEST(TestFrameArena, ArenaVector)
+{
+  using namespace BABYLON;
+  FrameArena arena;
+  arena_vector<int> values{FrameArenaAllocator<int>{&arena}};
+  for (int i = 0; i < 1000; ++i) {
+    values.emplace_back(i);
+  }
+  EXPECT_EQ(values.size(), 1000);
+  EXPECT_EQ(values[999], 999);
+  EXPECT_GT(arena.allocationCount(), 0);
+
+  // Default constructed allocator falls back to the heap
+  arena_vector<int> heapValues{1, 2, 3};
+  EXPECT_EQ(heapValues.get_allocator().arena(), nullptr);
+  EXPECT_EQ(heapValues.size(), 3);
+}
@@ -0,0 +1,25 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/hash.h>
+
+TEST(TestHash, Hash64)
+{
+  using namespace BABYLON;
+  // Reference values of xxHash64 with a zero seed
+  EXPECT_EQ(Hash64("", 0), 0xEF46DB3751D8E999ULL);
+  EXPECT_EQ(Hash64("abc", 3), 0x44BC2CF5AD770999ULL);
+  const char* text = "Nobody inspects the spammish repetition";
+  EXPECT_EQ(Hash64(text, 39), 0xFBCEA83C8A378BF1ULL);
+
+  // The seed changes the hash
+  EXPECT_NE(Hash64(text, 39, 1), Hash64(text, 39));
+
+  // Vertex data
+  const std::vector<float> a{0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f};
+  auto b = a;
+  EXPECT_EQ(Hash64(a.data(), a.size() * sizeof(float)),
+            Hash64(b.data(), b.size() * sizeof(float)));
+  b[8] = 8.5f;
+  EXPECT_NE(Hash64(a.data(), a.size() * sizeof(float)),
+            Hash64(b.data(), b.size() * sizeof(float)));
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/json.h>
+#include <babylon/core/json_reader.h>
+
+namespace {
+
+// Parses the arrays of a "floats" key straight into a buffer
+class FloatArrayBuilder : public BABYLON::JsonDomBuilder {
+
+public:
+  FloatArrayBuilder(BABYLON::Json::value& root) : JsonDomBuilder{root}
+  {
+  }
+
+  BABYLON::Float32Array* floatArray() override
+  {
+    return (currentKey() == "floats") ? &floats : nullptr;
+  }
+
+  BABYLON::Uint32Array* uint32Array() override
+  {
+    return (currentKey() == "indices") ? &indices : nullptr;
+  }
+
+  BABYLON::Float32Array floats;
+  BABYLON::Uint32Array indices;
+
+}; // end of class FloatArrayBuilder
+
+} // end of anonymous namespace
+
+TEST(TestJsonReader, Parse)
+{
+  using namespace BABYLON;
+
+  const std::string json = R"( {
+    "string": "a\"b\\c\/\n\u00e9\ud83d\ude00",
+    "numbers": [0, -0.5, 12, 1.25e2, 3E-2, 1234567890123456789012, 0.1],
+    "literals": [true, false, null],
+    "nested": {"array": [[], {}], "empty": ""}
+  } trailing)";
+
+  Json::value parsedData;
+  ASSERT_EQ(Json::Parse(parsedData, json.data(), json.size()), "");
+
+  Json::value expected;
+  ASSERT_EQ(picojson::parse(expected, json), "");
+  EXPECT_EQ(parsedData.serialize(), expected.serialize());
+  EXPECT_EQ(Json::GetString(parsedData, "string"),
+            "a\"b\\c/\n\xc3\xa9\xf0\x9f\x98\x80");
+  EXPECT_EQ(Json::ToArray<double>(parsedData, "numbers"),
+            std::vector<double>(
+              {0., -0.5, 12., 125., 0.03, 1234567890123456789012., 0.1}));
+}
+
+TEST(TestJsonReader, Numbers)
+{
+  using namespace BABYLON;
+
+  // Same conversion as strtod
+  const std::vector<std::string> numbers{
+    "0.1",      "3.14159265358979", "-2.5e-7",
+    "1e22",     "1e23",             "9007199254740993",
+    "4.9e-324", "0.000001234",      "1.7976931348623157e308",
+    "-1E+5",    "123.456e-3",       "123456789012345678"};
+  for (const auto& number : numbers) {
+    Json::value parsedData;
+    ASSERT_EQ(Json::Parse(parsedData, number.data(), number.size()), "");
+    EXPECT_EQ(parsedData.get<double>(), std::strtod(number.c_str(), nullptr))
+      << number;
+  }
+
+  // Invalid numbers and numbers not held by Json::value
+  for (const std::string number : {"-", "1.", ".5", "1e", "1e999"}) {
+    Json::value parsedData;
+    EXPECT_NE(Json::Parse(parsedData, number.data(), number.size()), "")
+      << number;
+  }
+}
+
+TEST(TestJsonReader, TypedArrays)
+{
+  using namespace BABYLON;
+
+  const std::string json = R"({
+    "floats": [0.5, -1, 2e1],
+    "indices": [0, 1, 2, 65536],
+    "other": [1, 2]
+  })";
+
+  Json::value parsedData;
+  FloatArrayBuilder builder(parsedData);
+  ASSERT_EQ(JsonReader(json.data(), json.size()).parse(builder), "");
+  EXPECT_EQ(builder.floats, Float32Array({0.5f, -1.f, 20.f}));
+  EXPECT_EQ(builder.indices, Uint32Array({0, 1, 2, 65536}));
+  EXPECT_FALSE(parsedData.contains("floats"));
+  EXPECT_FALSE(parsedData.contains("indices"));
+  EXPECT_EQ(Json::ToArray<int>(parsedData, "other"), std::vector<int>({1, 2}));
+}
+
+TEST(TestJsonReader, TypedArraysFallback)
+{
+  using namespace BABYLON;
+
+  // Arrays holding anything else than numbers are built as Json::values
+  const std::string json
+    = R"({"floats": [1, "two"], "indices": [-1], "empty": []})";
+
+  Json::value parsedData;
+  FloatArrayBuilder builder(parsedData);
+  ASSERT_EQ(JsonReader(json.data(), json.size()).parse(builder), "");
+  EXPECT_TRUE(builder.floats.empty());
+  EXPECT_TRUE(builder.indices.empty());
+  EXPECT_EQ(Json::GetArray(parsedData, "floats").size(), 2);
+  EXPECT_EQ(Json::GetArray(parsedData, "indices").size(), 1);
+  EXPECT_TRUE(Json::GetArray(parsedData, "empty").empty());
+
+  // Indices which are not integers
+  const std::string fractions = R"({"indices": [0, 1.5]})";
+  Json::value parsedFractions;
+  FloatArrayBuilder fractionsBuilder(parsedFractions);
+  ASSERT_EQ(
+    JsonReader(fractions.data(), fractions.size()).parse(fractionsBuilder), "");
+  EXPECT_TRUE(fractionsBuilder.indices.empty());
+  EXPECT_EQ(Json::GetArray(parsedFractions, "indices").size(), 2);
+}
+
+TEST(TestJsonReader, Errors)
+{
+  using namespace BABYLON;
+
+  for (const std::string json :
+       {"", "{", "[1,]", "{\"a\" 1}", "{\"a\": 1,}", "\"a\x01\"", "\"\\x\"",
+        "\"\\ud800\"", "nul", "[1 2]"}) {
+    Json::value parsedData;
+    EXPECT_NE(Json::Parse(parsedData, json.data(), json.size()), "") << json;
+  }
+
+  // Error location
+  const std::string json = "{\n  \"a\": 1,\n  \"b\": x\n}";
+  Json::value parsedData;
+  EXPECT_EQ(Json::Parse(parsedData, json.data(), json.size()),
+            "syntax error at line 3 near: x");
+
+  // Nesting
+  const std::string nested(JsonReader::MaxDepth + 1, '[');
+  EXPECT_NE(Json::Parse(parsedData, nested.data(), nested.size()), "");
+}
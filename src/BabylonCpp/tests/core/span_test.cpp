@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/span.h>
+#include <babylon/mesh/indices_view.h>
+
+TEST(TestSpan, VertexAccess)
+{
+  using namespace BABYLON;
+  Float32Array positions{0.f, 1.f, 2.f, 3.f, 4.f, 5.f};
+  span<float> view(positions, 3);
+  EXPECT_EQ(view.size(), 6);
+  EXPECT_EQ(view.vertexCount(), 2);
+  EXPECT_EQ(view.at(1, 2), 5.f);
+
+  // Writes go to the underlying storage
+  view.at(0, 1) = 10.f;
+  EXPECT_EQ(positions[1], 10.f);
+
+  span<const float> readOnly = view;
+  EXPECT_EQ(readOnly.data(), positions.data());
+  EXPECT_EQ(readOnly.stride(), 3);
+  EXPECT_EQ(readOnly.toVector(), positions);
+
+  span<const float> empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.vertexCount(), 0);
+}
+
+TEST(TestSpan, IndicesView)
+{
+  using namespace BABYLON;
+  const Uint16Array indices16{0, 1, 2, 2, 1, 3};
+  const Uint32Array indices32{0, 1, 2, 2, 1, 70000};
+
+  IndicesView view16(indices16);
+  EXPECT_TRUE(view16.is16Bits());
+  EXPECT_EQ(view16.size(), 6);
+  EXPECT_EQ(view16[5], 3);
+  EXPECT_EQ(view16.toArray(), Uint32Array({0, 1, 2, 2, 1, 3}));
+
+  IndicesView view32(indices32);
+  EXPECT_FALSE(view32.is16Bits());
+  EXPECT_EQ(view32[5], 70000);
+  EXPECT_EQ(view32.toArray(), indices32);
+}
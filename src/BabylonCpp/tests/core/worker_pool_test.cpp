@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/worker_pool.h>
+
+TEST(TestWorkerPool, Shared)
+{
+  using namespace BABYLON;
+  EXPECT_EQ(WorkerPool::Shared(), WorkerPool::Shared());
+  EXPECT_EQ(WorkerPool::Create(0), WorkerPool::Shared());
+  EXPECT_EQ(WorkerPool::Shared()->workerCount(),
+            WorkerPool::DefaultWorkerCount());
+  EXPECT_EQ(WorkerPool::Create(3)->workerCount(), 3);
+}
+
+TEST(TestWorkerPool, ParallelFor)
+{
+  using namespace BABYLON;
+  WorkerPool pool(3);
+
+  // Each item is processed once, in ranges of at most 7 items
+  std::vector<std::atomic<int>> counts(1000);
+  for (auto& count : counts) {
+    count = 0;
+  }
+  pool.parallelFor(counts.size(), 7, [&counts](size_t first, size_t last) {
+    EXPECT_LE(last - first, 7u);
+    for (size_t i = first; i < last; ++i) {
+      ++counts[i];
+    }
+  });
+  for (const auto& count : counts) {
+    EXPECT_EQ(count, 1);
+  }
+
+  size_t calls = 0;
+  pool.parallelFor(0, 1, [&calls](size_t, size_t) { ++calls; });
+  EXPECT_EQ(calls, 0u);
+}
+
+TEST(TestWorkerPool, Run)
+{
+  using namespace BABYLON;
+  WorkerPool pool(3);
+
+  // Each task is run once
+  std::vector<std::atomic<int>> counts(100);
+  std::vector<WorkerPool::Task> tasks;
+  for (auto& count : counts) {
+    count = 0;
+    tasks.emplace_back([&count]() { ++count; });
+  }
+  pool.run(tasks);
+  for (const auto& count : counts) {
+    EXPECT_EQ(count, 1);
+  }
+}
+
+TEST(TestWorkerPool, NestedParallelFor)
+{
+  using namespace BABYLON;
+  // Parallel loops run from all the workers of the pool do not wait for
+  // tasks queued behind them
+  WorkerPool pool(2);
+  std::atomic<size_t> sum{0};
+  pool.parallelFor(8, 1, [&](size_t, size_t) {
+    pool.parallelFor(100, 1, [&](size_t first, size_t last) {
+      sum += last - first;
+    });
+  });
+  EXPECT_EQ(sum, 800u);
+}
+
+TEST(TestWorkerPool, TaskGroup)
+{
+  using namespace BABYLON;
+  auto pool = WorkerPool::Create(2);
+  std::atomic<int> count{0};
+  {
+    WorkerTaskGroup tasks(pool);
+    EXPECT_EQ(tasks.workerCount(), 2u);
+    for (int i = 0; i < 16; ++i) {
+      tasks.send([&count]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ++count;
+      });
+    }
+    // The group waits for its tasks when destroyed
+  }
+  EXPECT_EQ(count, 16);
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/json.h>
+#include <babylon/loading/plugins/babylon/babylon_binary_file.h>
+#include <babylon/mesh/vertex_data.h>
+
+namespace {
+
+const char* SceneJson = R"({
+  "geometries": {
+    "vertexData": [{
+      "id": "triangle",
+      "updatable": true,
+      "positions": [0, 0, 0, 1, 0, 0, 0, 1, 0],
+      "colors": [1, 0, 0, 0, 1, 0, 0, 0, 1],
+      "indices": [0, 1, 2]
+    }]
+  },
+  "meshes": [{
+    "id": "mesh",
+    "name": "mesh",
+    "positions": [0, 0, 0, 0.5, 0, 0, 0, 0.25, 0],
+    "normals": [0, 0, 1, 0, 0, 1, 0, 0, 1],
+    "uvs2": [0, 0, 1, 0, 0, 1],
+    "indices": [2, 1, 0],
+    "subMeshes": [{"materialIndex": 0}]
+  }]
+})";
+
+} // end of anonymous namespace
+
+TEST(TestBabylonBinaryFile, FromBabylon)
+{
+  using namespace BABYLON;
+
+  const auto data = BabylonBinaryFile::FromBabylon(SceneJson);
+  BabylonBinaryFile file(data);
+  ASSERT_TRUE(file.isValid());
+  EXPECT_EQ(file.blobCount(), 7);
+
+  // The blobs are aligned, the indices are not floats
+  for (size_t i = 0; i < file.blobCount(); ++i) {
+    size_t count       = 0;
+    const auto floats  = file.blobData(i, BinaryBlobType::FLOAT32, count);
+    const auto indices = file.blobData(i, BinaryBlobType::UINT32, count);
+    const auto blob    = floats ? floats : indices;
+    ASSERT_NE(blob, nullptr);
+    EXPECT_EQ((blob - reinterpret_cast<const uint8_t*>(data.data()))
+                % BabylonBinaryFile::Alignment,
+              0);
+  }
+
+  Json::value parsedData;
+  ASSERT_TRUE(Json::Parse(parsedData, file.sceneGraph().c_str()).empty());
+  const auto geometries
+    = Json::GetArray(parsedData.get("geometries"), "vertexData");
+  ASSERT_EQ(geometries.size(), 2);
+
+  // Vertex data geometry, the colors have 4 components
+  EXPECT_FALSE(geometries[0].contains("positions"));
+  EXPECT_TRUE(Json::GetBool(geometries[0], "updatable"));
+  auto vertexData = file.getVertexData(geometries[0]);
+  ASSERT_NE(vertexData, nullptr);
+  EXPECT_EQ(vertexData->positions,
+            Float32Array({0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f}));
+  EXPECT_EQ(vertexData->colors.size(), 12);
+  EXPECT_EQ(vertexData->colors[3], 1.f);
+  EXPECT_EQ(vertexData->indices, IndicesArray({0, 1, 2}));
+
+  // Inline mesh geometry, converted to a vertex data geometry
+  const auto mesh = Json::GetArray(parsedData, "meshes")[0];
+  EXPECT_EQ(Json::GetString(mesh, "geometryId"), "mesh_geometry");
+  EXPECT_FALSE(mesh.contains("positions"));
+  EXPECT_TRUE(mesh.contains("subMeshes"));
+  EXPECT_EQ(Json::GetString(geometries[1], "id"), "mesh_geometry");
+  vertexData = file.getVertexData(geometries[1]);
+  ASSERT_NE(vertexData, nullptr);
+  EXPECT_EQ(vertexData->positions[3], 0.5f);
+  EXPECT_EQ(vertexData->positions[7], 0.25f);
+  EXPECT_EQ(vertexData->normals.size(), 9);
+  EXPECT_EQ(vertexData->uvs2, Float32Array({0.f, 0.f, 1.f, 0.f, 0.f, 1.f}));
+  EXPECT_TRUE(vertexData->uvs.empty());
+  EXPECT_EQ(vertexData->indices, IndicesArray({2, 1, 0}));
+}
+
+TEST(TestBabylonBinaryFile, EncodedBlobs)
+{
+  using namespace BABYLON;
+
+  const auto data = BabylonBinaryFile::FromBabylon(SceneJson, true);
+  BabylonBinaryFile file(data);
+  ASSERT_TRUE(file.isValid());
+  EXPECT_EQ(file.blobCount(), 7);
+  size_t count = 0;
+  EXPECT_EQ(file.blobData(0, BinaryBlobType::FLOAT32, count), nullptr);
+  EXPECT_NE(file.blobData(0, BinaryBlobType::ENCODED_FLOAT32, count), nullptr);
+
+  // The vertex data is the same as the one of the raw blobs
+  const auto rawData = BabylonBinaryFile::FromBabylon(SceneJson);
+  BabylonBinaryFile rawFile(rawData);
+  Json::value parsedData;
+  ASSERT_TRUE(Json::Parse(parsedData, file.sceneGraph().c_str()).empty());
+  for (const auto& geometry :
+       Json::GetArray(parsedData.get("geometries"), "vertexData")) {
+    const auto vertexData    = file.getVertexData(geometry);
+    const auto rawVertexData = rawFile.getVertexData(geometry);
+    ASSERT_NE(vertexData, nullptr);
+    ASSERT_NE(rawVertexData, nullptr);
+    EXPECT_EQ(vertexData->positions, rawVertexData->positions);
+    EXPECT_EQ(vertexData->normals, rawVertexData->normals);
+    EXPECT_EQ(vertexData->colors, rawVertexData->colors);
+    EXPECT_EQ(vertexData->uvs2, rawVertexData->uvs2);
+    EXPECT_EQ(vertexData->indices, rawVertexData->indices);
+  }
+}
+
+TEST(TestBabylonBinaryFile, Invalid)
+{
+  using namespace BABYLON;
+
+  EXPECT_TRUE(BabylonBinaryFile::FromBabylon("{").empty());
+  EXPECT_FALSE(BabylonBinaryFile(std::string(SceneJson)).isValid());
+
+  // Truncated file
+  auto data = BabylonBinaryFile::FromBabylon(SceneJson);
+  EXPECT_FALSE(BabylonBinaryFile(data.substr(0, data.size() - 16)).isValid());
+
+  // Blob outside of the file
+  BabylonBinaryFile file(data);
+  size_t count = 0;
+  EXPECT_EQ(file.blobData(file.blobCount(), BinaryBlobType::FLOAT32, count),
+            nullptr);
+  const uint64_t blobTableOffset
+    = *reinterpret_cast<const uint64_t*>(&data[16]);
+  data[blobTableOffset + 8 + 7] = '\x01';
+  EXPECT_FALSE(BabylonBinaryFile(data).isValid());
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <babylon/interfaces/igl_rendering_context.h>
+#include <babylon/materials/textures/texture_cache.h>
+
+TEST(TestTextureCache, UrlHit)
+{
+  using namespace BABYLON;
+  GL::IGLTexture texture(1);
+  texture.samplingMode = 3;
+  TextureCache cache;
+  cache.addUrl("a.png", &texture);
+
+  EXPECT_EQ(cache.getByUrl("a.png", false, 3, false), &texture);
+  // Any sampling mode is accepted when none is requested
+  EXPECT_EQ(cache.getByUrl("a.png", false, 0, false), &texture);
+  // Other settings or urls are separate textures
+  EXPECT_EQ(cache.getByUrl("a.png", true, 3, false), nullptr);
+  EXPECT_EQ(cache.getByUrl("a.png", false, 3, true), nullptr);
+  EXPECT_EQ(cache.getByUrl("a.png", false, 1, false), nullptr);
+  EXPECT_EQ(cache.getByUrl("b.png", false, 3, false), nullptr);
+}
+
+TEST(TestTextureCache, ContentHit)
+{
+  using namespace BABYLON;
+  GL::IGLTexture texture(1), copy(2), flipped(3);
+  for (auto item : {&texture, &copy, &flipped}) {
+    item->_contentHash = 42;
+  }
+  flipped.invertY = true;
+  TextureCache cache;
+
+  // The first texture with a content is registered, the copies share it
+  EXPECT_EQ(cache.getOrAddContent(&texture), nullptr);
+  EXPECT_EQ(cache.getOrAddContent(&copy), &texture);
+  EXPECT_EQ(cache.getOrAddContent(&flipped), nullptr);
+  EXPECT_EQ(cache.getOrAddContent(&copy), &texture);
+}
+
+TEST(TestTextureCache, Remove)
+{
+  using namespace BABYLON;
+  GL::IGLTexture texture(1), copy(2), other(3);
+  texture._contentHash = copy._contentHash = 42;
+  TextureCache cache;
+  cache.addUrl("a.png", &texture);
+  cache.addUrl("b.png", &other);
+  EXPECT_EQ(cache.getOrAddContent(&texture), nullptr);
+  // A copy under another name shares the loaded texture
+  cache.addUrl("copy.png", &texture);
+  cache.addUrl("a.png", &other);
+
+  // Released textures are removed under all their urls and their content
+  cache.remove(&texture);
+  EXPECT_EQ(cache.getByUrl("copy.png", false, 0, false), nullptr);
+  EXPECT_EQ(cache.getByUrl("a.png", false, 0, false), &other);
+  EXPECT_EQ(cache.getByUrl("b.png", false, 0, false), &other);
+  EXPECT_EQ(cache.getOrAddContent(&copy), nullptr);
+  cache.remove(&other);
+  EXPECT_EQ(cache.getByUrl("a.png", false, 0, false), nullptr);
+  EXPECT_EQ(cache.getByUrl("b.png", false, 0, false), nullptr);
+}
@@ -0,0 +1,21 @@
+#include <gtest/gtest.h>
+
+#include <babylon/materials/textures/texture_streaming_manager.h>
+
+TEST(TestTextureStreamingManager, GetRequiredMipLevel)
+{
+  using namespace BABYLON;
+  // 1024x512 texture, 11 mip levels
+  EXPECT_EQ(TextureStreamingManager::GetRequiredMipLevel(1024, 512, 2048.f, 11),
+            0);
+  EXPECT_EQ(TextureStreamingManager::GetRequiredMipLevel(1024, 512, 1024.f, 11),
+            0);
+  EXPECT_EQ(TextureStreamingManager::GetRequiredMipLevel(1024, 512, 600.f, 11),
+            0);
+  EXPECT_EQ(TextureStreamingManager::GetRequiredMipLevel(1024, 512, 256.f, 11),
+            2);
+  EXPECT_EQ(TextureStreamingManager::GetRequiredMipLevel(1024, 512, 0.5f, 11),
+            10);
+  EXPECT_EQ(TextureStreamingManager::GetRequiredMipLevel(1024, 512, 0.f, 11),
+            10);
+}
@@ -0,0 +1,57 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/mesh/geometry_deduplicator.h>
+#include <babylon/mesh/vertex_buffer.h>
+
+TEST(TestGeometryDeduplicator, VertexBufferLayout)
+{
+  using namespace BABYLON;
+  // CPU side vertex buffers, not uploaded
+  const auto createVertexBuffer = [](bool updatable, int stride) {
+    return std::make_unique<VertexBuffer>(nullptr, Float32Array(),
+                                          VertexBuffer::UVKind, updatable,
+                                          true, stride);
+  };
+
+  // Identical layouts are merged
+  auto uvs      = createVertexBuffer(false, 2);
+  auto otherUVs = createVertexBuffer(false, 2);
+  EXPECT_TRUE(uvs->hasSameLayout(*otherUVs));
+  EXPECT_EQ(uvs->getLayoutHash(), otherUVs->getLayoutHash());
+
+  // Updatable buffers are not interchangeable with static ones
+  auto updatableUVs = createVertexBuffer(true, 2);
+  EXPECT_FALSE(uvs->hasSameLayout(*updatableUVs));
+  EXPECT_FALSE(updatableUVs->hasSameLayout(*uvs));
+  EXPECT_NE(uvs->getLayoutHash(), updatableUVs->getLayoutHash());
+
+  // Neither are buffers of another stride
+  auto paddedUVs = createVertexBuffer(false, 4);
+  EXPECT_FALSE(uvs->hasSameLayout(*paddedUVs));
+  EXPECT_NE(uvs->getLayoutHash(), paddedUVs->getLayoutHash());
+}
+
+TEST(TestGeometryDeduplicator, FindInstanceSources)
+{
+  using namespace BABYLON;
+  InstanceRenderingKey key;
+  key.subMeshes = {{{0, 0, 36, 0, 24}}};
+
+  auto hidden       = key;
+  hidden.visibility = 0.5f;
+  auto otherLayer      = key;
+  otherLayer.layerMask = 0x10000000;
+  auto shadowed           = key;
+  shadowed.receiveShadows = true;
+  auto split      = key;
+  split.subMeshes = {{{0, 0, 18, 0, 24}}, {{1, 18, 18, 0, 24}}};
+
+  // Only the meshes with the same render settings as a previous mesh become
+  // instances of it
+  const std::vector<InstanceRenderingKey> keys{
+    key, hidden, key, otherLayer, shadowed, split, hidden, split};
+  EXPECT_THAT(GeometryDeduplicator::FindInstanceSources(keys),
+              ::testing::ElementsAre(-1, -1, 0, -1, -1, -1, 1, 5));
+  EXPECT_TRUE(GeometryDeduplicator::FindInstanceSources({}).empty());
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+
+#include <babylon/loading/plugins/babylon/babylon_binary_file.h>
+#include <babylon/mesh/geometry_streaming_manager.h>
+#include <babylon/mesh/vertex_data.h>
+
+namespace {
+
+// Delay loading file of an incremental scene
+const char* GeometryJson = R"({
+  "positions": [0, 0, 0, 1, 0, 0, 0, 1, 0],
+  "normals": [0, 0, 1, 0, 0, 1, 0, 0, 1],
+  "uvs": [0, 0, 1, 0, 0, 1],
+  "indices": [0, 1, 2]
+})";
+
+void writeFile(const std::string& filename, const std::string& data)
+{
+  std::ofstream file(filename, std::ios::binary);
+  file.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+} // end of anonymous namespace
+
+TEST(TestGeometryStreamingManager, ReadJsonFile)
+{
+  using namespace BABYLON;
+
+  const std::string filename = "geometry_streaming_test.babylongeometrydata";
+  writeFile(filename, GeometryJson);
+
+  Json::value parsedData;
+  std::unique_ptr<VertexData> vertexData;
+  std::string error;
+  EXPECT_TRUE(GeometryStreamingManager::ReadFile(filename, parsedData,
+                                                 vertexData, error));
+  std::remove(filename.c_str());
+
+  EXPECT_TRUE(error.empty());
+  EXPECT_EQ(vertexData, nullptr);
+  EXPECT_EQ(Json::ToArray<float>(parsedData, "positions").size(), 9);
+  EXPECT_EQ(Json::ToArray<uint32_t>(parsedData, "indices").size(), 3);
+}
+
+TEST(TestGeometryStreamingManager, ReadBinaryFile)
+{
+  using namespace BABYLON;
+
+  const std::string filename = "geometry_streaming_test.babylonbin";
+  writeFile(filename, BabylonBinaryFile::FromBabylon(GeometryJson));
+
+  Json::value parsedData;
+  std::unique_ptr<VertexData> vertexData;
+  std::string error;
+  EXPECT_TRUE(GeometryStreamingManager::ReadFile(filename, parsedData,
+                                                 vertexData, error));
+  std::remove(filename.c_str());
+
+  // The vertex data is read from the blobs
+  EXPECT_TRUE(error.empty());
+  EXPECT_FALSE(parsedData.contains("positions"));
+  ASSERT_NE(vertexData, nullptr);
+  EXPECT_EQ(vertexData->positions,
+            Float32Array({0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f}));
+  EXPECT_EQ(vertexData->normals.size(), 9);
+  EXPECT_EQ(vertexData->uvs.size(), 6);
+  EXPECT_EQ(vertexData->indices, IndicesArray({0, 1, 2}));
+}
+
+TEST(TestGeometryStreamingManager, ReadMissingFile)
+{
+  using namespace BABYLON;
+
+  Json::value parsedData;
+  std::unique_ptr<VertexData> vertexData;
+  std::string error;
+  EXPECT_FALSE(GeometryStreamingManager::ReadFile(
+    "geometry_streaming_test.missing", parsedData, vertexData, error));
+  EXPECT_FALSE(error.empty());
+}
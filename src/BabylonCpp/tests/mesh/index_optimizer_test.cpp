@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <babylon/mesh/index_optimizer.h>
+#include <babylon/mesh/vertex_data.h>
+#include <babylon/mesh/vertex_data_options.h>
+
+namespace {
+
+/**
+ * @brief Returns the triangles of indices, sorted.
+ */
+std::vector<std::array<uint32_t, 3>>
+sortedTriangles(const BABYLON::IndicesArray& indices)
+{
+  std::vector<std::array<uint32_t, 3>> triangles;
+  for (size_t i = 0; i < indices.size(); i += 3) {
+    triangles.push_back({{indices[i], indices[i + 1], indices[i + 2]}});
+  }
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+
+/**
+ * @brief Returns a ground whose triangles are shuffled.
+ */
+std::unique_ptr<BABYLON::VertexData> shuffledGround()
+{
+  BABYLON::GroundOptions options(32);
+  auto ground                = BABYLON::VertexData::CreateGround(options);
+  auto& indices              = ground->indices;
+  const size_t triangleCount = indices.size() / 3;
+  std::mt19937 generator(42);
+  for (size_t i = triangleCount - 1; i > 0; --i) {
+    const auto j = std::uniform_int_distribution<size_t>(0, i)(generator);
+    std::swap_ranges(indices.begin() + i * 3, indices.begin() + i * 3 + 3,
+                     indices.begin() + j * 3);
+  }
+  return ground;
+}
+
+} // end of anonymous namespace
+
+TEST(TestIndexOptimizer, AnalyzeVertexCache)
+{
+  using namespace BABYLON;
+  // Two triangles of a quad transform its 4 vertices once
+  const IndicesArray indices{0, 1, 2, 0, 2, 3};
+  const auto statistics
+    = IndexOptimizer::AnalyzeVertexCache(indices, 0, indices.size());
+  EXPECT_EQ(statistics.transformedVertices, 4u);
+  EXPECT_FLOAT_EQ(statistics.acmr, 2.f);
+  EXPECT_FLOAT_EQ(statistics.atvr, 1.f);
+
+  // A cache of 3 vertices misses the vertex 0 of the second triangle
+  const IndicesArray strip{0, 1, 2, 3, 4, 5, 0, 5, 6};
+  EXPECT_EQ(
+    IndexOptimizer::AnalyzeVertexCache(strip, 0, strip.size(), 3)
+      .transformedVertices,
+    8u);
+}
+
+TEST(TestIndexOptimizer, OptimizeVertexCache)
+{
+  using namespace BABYLON;
+  auto ground          = shuffledGround();
+  auto indices         = ground->indices;
+  const auto triangles = sortedTriangles(indices);
+  const auto before
+    = IndexOptimizer::AnalyzeVertexCache(indices, 0, indices.size());
+
+  IndexOptimizer::OptimizeVertexCache(indices, 0, indices.size());
+  EXPECT_EQ(sortedTriangles(indices), triangles);
+  const auto after
+    = IndexOptimizer::AnalyzeVertexCache(indices, 0, indices.size());
+  EXPECT_GT(before.acmr, 2.f);
+  EXPECT_LT(after.acmr, 0.8f);
+  EXPECT_LT(after.atvr, 1.4f);
+
+  // Overdraw optimization keeps most of the vertex cache efficiency
+  IndexOptimizer::OptimizeOverdraw(indices, 0, indices.size(),
+                                   ground->positions);
+  EXPECT_EQ(sortedTriangles(indices), triangles);
+  EXPECT_LT(
+    IndexOptimizer::AnalyzeVertexCache(indices, 0, indices.size()).acmr,
+    after.acmr * 1.2f);
+}
+
+TEST(TestIndexOptimizer, OptimizeRange)
+{
+  using namespace BABYLON;
+  auto ground             = shuffledGround();
+  auto indices            = ground->indices;
+  const size_t indexCount = indices.size() / 2 / 3 * 3;
+  IndexOptimizer::OptimizeVertexCache(indices, indexCount, indexCount);
+  EXPECT_TRUE(std::equal(indices.begin(), indices.begin() + indexCount,
+                         ground->indices.begin()));
+  EXPECT_LT(
+    IndexOptimizer::AnalyzeVertexCache(indices, indexCount, indexCount).acmr,
+    IndexOptimizer::AnalyzeVertexCache(ground->indices, indexCount, indexCount)
+      .acmr);
+}
+
+TEST(TestIndexOptimizer, OptimizeVertexFetch)
+{
+  using namespace BABYLON;
+  auto ground              = shuffledGround();
+  auto indices             = ground->indices;
+  auto positions           = ground->positions;
+  const size_t vertexCount = positions.size() / 3;
+  // An unused vertex is kept
+  positions.insert(positions.end(), {1.f, 2.f, 3.f});
+
+  const auto remap
+    = IndexOptimizer::OptimizeVertexFetch(indices, vertexCount + 1);
+  IndexOptimizer::RemapVertexBuffer(positions, 3, remap);
+  ASSERT_EQ(remap.size(), vertexCount + 1);
+  EXPECT_EQ(remap.back(), vertexCount);
+  EXPECT_EQ(positions.back(), 3.f);
+
+  // Vertices are numbered by first use, and triangles keep their positions
+  uint32_t next = 0;
+  for (size_t i = 0; i < indices.size(); ++i) {
+    EXPECT_LE(indices[i], next);
+    next = std::max(next, indices[i] + 1);
+    for (size_t j = 0; j < 3; ++j) {
+      EXPECT_EQ(positions[indices[i] * 3 + j],
+                ground->positions[ground->indices[i] * 3 + j]);
+    }
+  }
+}
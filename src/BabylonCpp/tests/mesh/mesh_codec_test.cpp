@@ -0,0 +1,128 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/mesh/mesh_codec.h>
+
+namespace {
+
+// Positions and indices of a grid of n x n vertices
+void createGrid(size_t n, BABYLON::Float32Array& positions,
+                BABYLON::IndicesArray& indices)
+{
+  for (size_t y = 0; y < n; ++y) {
+    for (size_t x = 0; x < n; ++x) {
+      positions.insert(positions.end(),
+                       {static_cast<float>(x) * 0.1f, 0.5f,
+                        static_cast<float>(y) * -0.1f});
+    }
+  }
+  const auto n32 = static_cast<uint32_t>(n);
+  for (uint32_t y = 0; y + 1 < n32; ++y) {
+    for (uint32_t x = 0; x + 1 < n32; ++x) {
+      const uint32_t i = y * n32 + x;
+      indices.insert(indices.end(),
+                     {i, i + n32, i + 1, i + 1, i + n32, i + n32 + 1});
+    }
+  }
+}
+
+// Rotates a triangle so that its smallest index comes first
+std::array<uint32_t, 3> normalized(const uint32_t* triangle)
+{
+  std::array<uint32_t, 3> result{{triangle[0], triangle[1], triangle[2]}};
+  std::rotate(result.begin(),
+              std::min_element(result.begin(), result.end()), result.end());
+  return result;
+}
+
+} // end of anonymous namespace
+
+TEST(TestMeshCodec, VertexBuffer)
+{
+  using namespace BABYLON;
+  Float32Array positions;
+  IndicesArray indices;
+  createGrid(33, positions, indices);
+  // Values which do not fit in small deltas
+  positions[5]  = -1e30f;
+  positions[40] = std::numeric_limits<float>::infinity();
+
+  // Lossless
+  auto encoded = MeshCodec::EncodeVertexBuffer(positions, 3);
+  ASSERT_FALSE(encoded.empty());
+  EXPECT_LT(encoded.size(), positions.size() * sizeof(float) / 2);
+  Float32Array decoded;
+  ASSERT_TRUE(
+    MeshCodec::DecodeVertexBuffer(encoded.data(), encoded.size(), decoded));
+  ASSERT_EQ(decoded.size(), positions.size());
+  EXPECT_EQ(std::memcmp(decoded.data(), positions.data(),
+                        positions.size() * sizeof(float)),
+            0);
+
+  // Rounded mantissa
+  Float32Array uvs{0.123456f, 0.654321f, 1.f, 0.3333333f, 0.f};
+  encoded = MeshCodec::EncodeVertexBuffer(uvs, 1, 10);
+  ASSERT_TRUE(
+    MeshCodec::DecodeVertexBuffer(encoded.data(), encoded.size(), decoded));
+  ASSERT_EQ(decoded.size(), uvs.size());
+  for (size_t i = 0; i < uvs.size(); ++i) {
+    EXPECT_NEAR(decoded[i], uvs[i], 1e-3f);
+  }
+  EXPECT_EQ(decoded[2], 1.f);
+
+  // Empty buffer, invalid stride
+  encoded = MeshCodec::EncodeVertexBuffer(Float32Array(), 4);
+  EXPECT_TRUE(
+    MeshCodec::DecodeVertexBuffer(encoded.data(), encoded.size(), decoded));
+  EXPECT_TRUE(decoded.empty());
+  EXPECT_TRUE(MeshCodec::EncodeVertexBuffer(uvs, 2).empty());
+}
+
+TEST(TestMeshCodec, IndexBuffer)
+{
+  using namespace BABYLON;
+  Float32Array positions;
+  IndicesArray indices;
+  createGrid(33, positions, indices);
+  // A triangle far from the others, and a degenerate one
+  indices.insert(indices.end(), {1000000, 3, 70000, 5, 5, 5});
+
+  auto encoded = MeshCodec::EncodeIndexBuffer(indices);
+  ASSERT_FALSE(encoded.empty());
+  EXPECT_LT(encoded.size(), indices.size() * sizeof(uint32_t) / 4);
+  IndicesArray decoded;
+  ASSERT_TRUE(
+    MeshCodec::DecodeIndexBuffer(encoded.data(), encoded.size(), decoded));
+  ASSERT_EQ(decoded.size(), indices.size());
+  // Same triangles, in the same order and with the same winding
+  for (size_t i = 0; i < indices.size(); i += 3) {
+    EXPECT_EQ(normalized(&decoded[i]), normalized(&indices[i]));
+  }
+
+  EXPECT_TRUE(MeshCodec::EncodeIndexBuffer(IndicesArray{0, 1}).empty());
+}
+
+TEST(TestMeshCodec, Invalid)
+{
+  using namespace BABYLON;
+  Float32Array positions;
+  IndicesArray indices;
+  createGrid(9, positions, indices);
+
+  Float32Array vertices;
+  auto encoded = MeshCodec::EncodeVertexBuffer(positions, 3);
+  for (size_t size = 0; size < encoded.size(); ++size) {
+    EXPECT_FALSE(MeshCodec::DecodeVertexBuffer(encoded.data(), size, vertices));
+  }
+  EXPECT_FALSE(MeshCodec::DecodeVertexBuffer(nullptr, 0, vertices));
+
+  IndicesArray decoded;
+  encoded = MeshCodec::EncodeIndexBuffer(indices);
+  for (size_t size = 0; size < encoded.size(); ++size) {
+    EXPECT_FALSE(MeshCodec::DecodeIndexBuffer(encoded.data(), size, decoded));
+  }
+  // A vertex buffer is not an index buffer
+  encoded = MeshCodec::EncodeVertexBuffer(positions, 3);
+  EXPECT_FALSE(
+    MeshCodec::DecodeIndexBuffer(encoded.data(), encoded.size(), decoded));
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <babylon/math/vector3.h>
+#include <babylon/math/vector4.h>
+#include <babylon/mesh/simplification/quadratic_error_simplification.h>
+#include <babylon/mesh/simplification/simplification_settings.h>
+#include <babylon/mesh/vertex_data.h>
+#include <babylon/mesh/vertex_data_options.h>
+
+namespace {
+
+void expectValid(const BABYLON::VertexData& vertexData)
+{
+  const size_t vertexCount = vertexData.positions.size() / 3;
+  EXPECT_EQ(vertexData.normals.size(), vertexCount * 3);
+  EXPECT_EQ(vertexData.uvs.size(), vertexCount * 2);
+  EXPECT_EQ(vertexData.indices.size() % 3, 0u);
+  for (auto index : vertexData.indices) {
+    EXPECT_LT(index, vertexCount);
+  }
+}
+
+void bounds(const BABYLON::Float32Array& positions, BABYLON::Vector3& minimum,
+            BABYLON::Vector3& maximum)
+{
+  minimum = BABYLON::Vector3(positions[0], positions[1], positions[2]);
+  maximum = minimum;
+  for (size_t i = 0; i < positions.size(); i += 3) {
+    const BABYLON::Vector3 position(positions[i], positions[i + 1],
+                                    positions[i + 2]);
+    minimum.minimizeInPlace(position);
+    maximum.maximizeInPlace(position);
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestQuadraticErrorSimplification, FlatGround)
+{
+  using namespace BABYLON;
+  GroundOptions options(10);
+  auto ground      = VertexData::CreateGround(options);
+  const auto input = ground->positions;
+  QuadraticErrorSimplification simplification(std::move(ground));
+
+  // A flat ground is simplified down to the two triangles of its corners
+  auto simplified = simplification.simplifyGeometry(
+    SimplificationSettings(0.01f, 0.f, true));
+  ASSERT_TRUE(simplified.vertexData);
+  expectValid(*simplified.vertexData);
+  EXPECT_EQ(simplified.vertexData->indices.size(), 6u);
+  EXPECT_EQ(simplified.vertexData->positions.size(), 12u);
+  Vector3 expectedMinimum, expectedMaximum, minimum, maximum;
+  bounds(input, expectedMinimum, expectedMaximum);
+  bounds(simplified.vertexData->positions, minimum, maximum);
+  EXPECT_TRUE(minimum.equals(expectedMinimum));
+  EXPECT_TRUE(maximum.equals(expectedMaximum));
+
+  ASSERT_EQ(simplified.subMeshes.size(), 1u);
+  EXPECT_EQ(simplified.subMeshes[0].verticesCount, 4u);
+  EXPECT_EQ(simplified.subMeshes[0].indexCount, 6u);
+}
+
+TEST(TestQuadraticErrorSimplification, Sphere)
+{
+  using namespace BABYLON;
+  SphereOptions options(2.f);
+  options.segments          = 16;
+  auto sphere               = VertexData::CreateSphere(options);
+  const auto triangleCount = sphere->indices.size() / 3;
+  QuadraticErrorSimplification simplification(std::move(sphere));
+
+  size_t previousCount = triangleCount + 1;
+  for (float quality : {1.f, 0.5f, 0.25f}) {
+    auto simplified = simplification.simplifyGeometry(
+      SimplificationSettings(quality, 0.f, true));
+    ASSERT_TRUE(simplified.vertexData);
+    expectValid(*simplified.vertexData);
+    const auto count = simplified.vertexData->indices.size() / 3;
+    EXPECT_LE(count, static_cast<size_t>(quality * triangleCount) + 1);
+    EXPECT_GT(count, triangleCount / 8);
+    EXPECT_LT(count, previousCount);
+    previousCount = count;
+
+    // The vertices kept are on the sphere
+    const auto& positions = simplified.vertexData->positions;
+    for (size_t i = 0; i < positions.size(); i += 3) {
+      const Vector3 position(positions[i], positions[i + 1], positions[i + 2]);
+      EXPECT_NEAR(position.length(), 1.f, 1e-4f);
+    }
+  }
+}
+
+TEST(TestQuadraticErrorSimplification, SubMeshes)
+{
+  using namespace BABYLON;
+  GroundOptions options(8);
+  auto ground              = VertexData::CreateGround(options);
+  const size_t indexCount  = ground->indices.size();
+  const size_t vertexCount = ground->positions.size() / 3;
+  std::vector<SimplifiedGeometry::SubMeshRange> subMeshes{
+    {0, 0, vertexCount, 0, indexCount / 2},
+    {1, 0, vertexCount, static_cast<unsigned int>(indexCount / 2),
+     indexCount / 2}};
+  QuadraticErrorSimplification simplification(std::move(ground), subMeshes);
+
+  auto simplified = simplification.simplifyGeometry(
+    SimplificationSettings(0.02f, 0.f, true));
+  ASSERT_TRUE(simplified.vertexData);
+  expectValid(*simplified.vertexData);
+  ASSERT_EQ(simplified.subMeshes.size(), 2u);
+  size_t verticesStart = 0, indexStart = 0;
+  for (unsigned int i = 0; i < 2; ++i) {
+    const auto& range = simplified.subMeshes[i];
+    EXPECT_EQ(range.materialIndex, i);
+    EXPECT_EQ(range.verticesStart, verticesStart);
+    EXPECT_EQ(range.indexStart, indexStart);
+    EXPECT_EQ(range.indexCount, 6u);
+    for (size_t j = range.indexStart; j < range.indexStart + range.indexCount;
+         ++j) {
+      EXPECT_GE(simplified.vertexData->indices[j], range.verticesStart);
+      EXPECT_LT(simplified.vertexData->indices[j],
+                range.verticesStart + range.verticesCount);
+    }
+    verticesStart += range.verticesCount;
+    indexStart += range.indexCount;
+  }
+  EXPECT_EQ(indexStart, simplified.vertexData->indices.size());
+}
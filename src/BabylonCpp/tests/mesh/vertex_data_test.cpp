@@ -1,6 +1,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <babylon/core/json.h>
+#include <babylon/math/matrix.h>
+#include <babylon/math/scalar.h>
+#include <babylon/math/vector3.h>
 #include <babylon/mesh/geometry.h>
 #include <babylon/mesh/vertex_data.h>
 #include <babylon/mesh/vertex_data_options.h>
@@ -287,3 +291,131 @@ TEST(TestVertexData, CreateTiledGround)
   EXPECT_THAT(tiledGround->normals, ::testing::ContainerEq(expectedNormals));
   EXPECT_THAT(tiledGround->uvs, ::testing::ContainerEq(expectedUVs));
 }
+
+TEST(TestVertexData, ImportVertexData)
+{
+  using namespace BABYLON;
+  Json::value parsedVertexData;
+  const auto err = Json::Parse(parsedVertexData, R"({
+    "positions": [0, 0, 0, 1, 0, 0, 0, 1, 0],
+    "normals": [0, 0, 1, 0, 0, 1, 0, 0, 1],
+    "colors": [1, 0, 0, 0, 1, 0, 0, 0, 1],
+    "indices": [0, 1, 2]
+  })");
+  ASSERT_TRUE(err.empty());
+  // The arrays already parsed are kept, the others are imported
+  VertexData vertexData;
+  vertexData.positions = {0.f, 0.f, 0.f, 2.f, 0.f, 0.f, 0.f, 2.f, 0.f};
+  VertexData::ImportVertexData(parsedVertexData, vertexData);
+  EXPECT_EQ(vertexData.positions[3], 2.f);
+  EXPECT_THAT(vertexData.normals,
+              ::testing::ElementsAre(0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 0.f, 0.f,
+                                     1.f));
+  EXPECT_THAT(vertexData.indices, ::testing::ElementsAre(0, 1, 2));
+  // Color3 values are converted to Color4, only once
+  ASSERT_EQ(vertexData.colors.size(), 12);
+  EXPECT_EQ(vertexData.colors[3], 1.f);
+  VertexData::ImportVertexData(parsedVertexData, vertexData);
+  EXPECT_EQ(vertexData.colors.size(), 12);
+}
+
+TEST(TestVertexData, Use16BitIndices)
+{
+  using namespace BABYLON;
+  // Indices below 65536 always fit
+  IndicesArray smallIndices{0, 1, 2, 2, 1, 65535};
+  EXPECT_TRUE(VertexData::CanUse16BitIndices(smallIndices));
+  // Large indices need 32 bits
+  IndicesArray largeIndices{0, 1, 65536};
+  EXPECT_FALSE(VertexData::CanUse16BitIndices(largeIndices));
+  EXPECT_FALSE(VertexData::CanUse16BitIndices(largeIndices, 65537));
+  EXPECT_TRUE(VertexData::CanUse16BitIndices(smallIndices, 65536));
+  // A stale vertex count does not hide large indices
+  EXPECT_FALSE(VertexData::CanUse16BitIndices(largeIndices, 3));
+  // Meshes with more than 65536 vertices are not scanned
+  EXPECT_FALSE(VertexData::CanUse16BitIndices(smallIndices, 65537));
+  // Round trip
+  auto indices16 = VertexData::ToUint16Indices(smallIndices);
+  EXPECT_THAT(indices16, ::testing::ElementsAre(0, 1, 2, 2, 1, 65535));
+  EXPECT_THAT(VertexData::ToIndicesArray(indices16),
+              ::testing::ContainerEq(smallIndices));
+}
+
+TEST(TestVertexData, Quantization)
+{
+  using namespace BABYLON;
+  // Positions
+  Float32Array positions{-1.f, 0.f, 2.f, 3.f, 1.f, 4.f};
+  Matrix dequantization;
+  auto quantizedPositions
+    = VertexData::QuantizePositions(positions, dequantization);
+  ASSERT_EQ(quantizedPositions.size(), 4);
+  for (size_t i = 0; i < 2; ++i) {
+    const auto x = static_cast<int16_t>(quantizedPositions[i * 2] & 0xffff);
+    const auto y = static_cast<int16_t>(quantizedPositions[i * 2] >> 16);
+    const auto z = static_cast<int16_t>(quantizedPositions[i * 2 + 1]);
+    auto position = Vector3::TransformCoordinates(
+      Vector3(x / 32767.f, y / 32767.f, z / 32767.f), dequantization);
+    EXPECT_NEAR(position.x, positions[i * 3 + 0], 1e-3f);
+    EXPECT_NEAR(position.y, positions[i * 3 + 1], 1e-3f);
+    EXPECT_NEAR(position.z, positions[i * 3 + 2], 1e-3f);
+  }
+
+  // Normals and tangents
+  Float32Array tangents{1.f, 0.f, 0.f, -1.f};
+  auto packedTangents = VertexData::PackNormals(tangents, 4);
+  ASSERT_EQ(packedTangents.size(), 1);
+  EXPECT_EQ(packedTangents[0], 0x1ffu | (0x3u << 30));
+
+  // Half floats, padded to an even number of components
+  Float32Array uvs{0.5f, -2.f, 1.f};
+  auto packedUVs = VertexData::PackHalfFloats(uvs, 3);
+  ASSERT_EQ(packedUVs.size(), 2);
+  EXPECT_EQ(packedUVs[0], 0x3800u | (0xc000u << 16));
+  EXPECT_EQ(packedUVs[1], 0x3c00u);
+  EXPECT_FLOAT_EQ(Scalar::FromHalfFloat(Scalar::ToHalfFloat(0.25f)), 0.25f);
+
+  // Normalized unsigned shorts
+  Float32Array colors{0.f, 1.f, 0.5f, 2.f};
+  auto packedColors = VertexData::PackUnorm16(colors, 4);
+  ASSERT_EQ(packedColors.size(), 2);
+  EXPECT_EQ(packedColors[0], 0xffffu << 16);
+  EXPECT_EQ(packedColors[1], 0x8000u | (0xffffu << 16));
+}
+
+TEST(TestVertexData, Interleave)
+{
+  using namespace BABYLON;
+  // Float positions, packed normals and half float uvs of two vertices
+  Float32Array positions{-1.f, 0.f, 2.f, 3.f, 1.f, 4.f};
+  Uint32Array positionWords(positions.size());
+  std::memcpy(positionWords.data(), positions.data(),
+              positions.size() * sizeof(float));
+  Float32Array normals{1.f, 0.f, 0.f, 0.f, 1.f, 0.f};
+  Float32Array uvs{0.f, 1.f, 0.5f, 0.25f};
+  std::vector<Uint32Array> attributes{positionWords,
+                                      VertexData::PackNormals(normals, 3),
+                                      VertexData::PackHalfFloats(uvs, 2)};
+
+  std::vector<size_t> wordOffsets;
+  auto interleaved = VertexData::Interleave(attributes, 2, wordOffsets);
+  EXPECT_THAT(wordOffsets, ::testing::ElementsAre(0, 3, 4));
+  ASSERT_EQ(interleaved.size(), 10);
+  for (size_t i = 0; i < 2; ++i) {
+    const auto vertex = interleaved.begin() + i * 5;
+    EXPECT_TRUE(std::equal(vertex, vertex + 3, positionWords.begin() + i * 3));
+    EXPECT_EQ(vertex[3], attributes[1][i]);
+    EXPECT_EQ(vertex[4], attributes[2][i]);
+  }
+
+  // The float data reads back from the interleaved words
+  float position[3];
+  std::memcpy(position, &interleaved[5], sizeof(position));
+  EXPECT_THAT(position, ::testing::ElementsAre(3.f, 1.f, 4.f));
+
+  // Attributes which do not cover the vertices are rejected
+  attributes.emplace_back(Uint32Array{1, 2, 3});
+  EXPECT_TRUE(VertexData::Interleave(attributes, 2, wordOffsets).empty());
+  EXPECT_TRUE(wordOffsets.empty());
+  EXPECT_TRUE(VertexData::Interleave(attributes, 0, wordOffsets).empty());
+}
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <babylon/mesh/vertex_data.h>
+#include <babylon/mesh/vertex_data_options.h>
+#include <babylon/rendering/edges_renderer.h>
+
+TEST(TestEdgesRenderer, BuildFaceAdjacencies)
+{
+  using namespace BABYLON;
+  // Two faces sharing the edge 2-0 of the first face and 0-2 of the second
+  const Float32Array positions{0.f, 0.f, 0.f, 1.f, 0.f, 0.f, //
+                               1.f, 1.f, 0.f, 0.f, 1.f, 0.f};
+  const IndicesArray indices{0, 1, 2, 0, 2, 3};
+  EXPECT_EQ(EdgesRenderer::BuildFaceAdjacencies(
+              positions, IndicesView(indices), false),
+            Int32Array({-1, -1, 1, 0, -1, -1}));
+
+  // An edge shared by 3 faces joins the first two ones
+  const IndicesArray fan{0, 1, 2, 2, 1, 3, 1, 2, 4};
+  EXPECT_EQ(
+    EdgesRenderer::BuildFaceAdjacencies(positions, IndicesView(fan), false),
+    Int32Array({-1, 1, -1, 0, -1, -1, -1, -1, -1}));
+}
+
+TEST(TestEdgesRenderer, BuildFaceAdjacenciesWithVertices)
+{
+  using namespace BABYLON;
+  // The faces of a box have their own vertices, so only the two faces of
+  // each side share indices
+  BoxOptions options(2.f);
+  auto box              = VertexData::CreateBox(options);
+  const auto byIndices  = EdgesRenderer::BuildFaceAdjacencies(
+    box->positions, IndicesView(box->indices), false);
+  const auto byVertices = EdgesRenderer::BuildFaceAdjacencies(
+    box->positions, IndicesView(box->indices), true);
+  ASSERT_EQ(byIndices.size(), box->indices.size());
+  ASSERT_EQ(byVertices.size(), box->indices.size());
+  EXPECT_EQ(std::count(byIndices.begin(), byIndices.end(), -1), 24);
+  EXPECT_EQ(std::count(byVertices.begin(), byVertices.end(), -1), 0);
+
+  // The positions within epsilon are welded, across the cells of the grid
+  Float32Array positions{0.f,     0.f, 0.f, 1.f,      0.f, 0.f, //
+                         1.f,     1.f, 0.f, -0.0004f, 0.f, 0.f, //
+                         1.0009f, 1.f, 0.f, 0.f,      1.f, 0.f};
+  const IndicesArray indices{0, 1, 2, 3, 4, 5};
+  EXPECT_EQ(EdgesRenderer::BuildFaceAdjacencies(
+              positions, IndicesView(indices), true),
+            Int32Array({-1, -1, 1, 0, -1, -1}));
+  positions[9] = -0.002f;
+  EXPECT_EQ(EdgesRenderer::BuildFaceAdjacencies(
+              positions, IndicesView(indices), true),
+            Int32Array({-1, -1, -1, -1, -1, -1}));
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <babylon/tools/async_image_loader.h>
+
+namespace {
+
+// Writes a 2x2 binary PPM image, the rows are red-green and blue-white
+std::string writeTestImage()
+{
+  const std::string path = "async_image_loader_test.ppm";
+  std::ofstream file(path, std::ios::binary);
+  file << "P6\n2 2\n255\n";
+  const unsigned char pixels[] = {255, 0,   0,   0,   255, 0,
+                                  0,   0,   255, 255, 255, 255};
+  file.write(reinterpret_cast<const char*>(pixels), sizeof(pixels));
+  return path;
+}
+
+} // end of anonymous namespace
+
+TEST(TestAsyncImageLoader, DecodeImage)
+{
+  using namespace BABYLON;
+  const auto path = writeTestImage();
+
+  Image image;
+  std::string error;
+  ASSERT_TRUE(AsyncImageLoader::DecodeImage(path, image, error, true));
+  EXPECT_EQ(image.width, 2);
+  EXPECT_EQ(image.height, 2);
+  EXPECT_EQ(image.depth, 4);
+  // Flipped vertically, the first row is blue-white
+  EXPECT_EQ(image.data,
+            Uint8Array({0, 0, 255, 255, 255, 255, 255, 255, //
+                        255, 0, 0, 255, 0, 255, 0, 255}));
+
+  EXPECT_FALSE(
+    AsyncImageLoader::DecodeImage("missing_image.png", image, error));
+  EXPECT_FALSE(error.empty());
+
+  std::remove(path.c_str());
+}
+
+TEST(TestAsyncImageLoader, LoadImage)
+{
+  using namespace BABYLON;
+  const auto path = writeTestImage();
+
+  AsyncImageLoader loader(2);
+  EXPECT_EQ(loader.workerCount(), 2);
+
+  size_t loaded = 0, failed = 0;
+  for (int i = 0; i < 4; ++i) {
+    loader.loadImage(path, [&](const Image& img) { loaded += img.width; },
+                     [&](const std::string&) { ++failed; });
+  }
+  loader.loadImage("missing_image.png", [&](const Image&) { ++loaded; },
+                   [&](const std::string&) { ++failed; });
+  EXPECT_EQ(loader.pendingCount(), 5);
+
+  // Callbacks only run on the thread processing the completed loads
+  while (loader.pendingCount() > 0) {
+    loader.processCompleted();
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(loaded, 8);
+  EXPECT_EQ(failed, 1);
+
+  std::remove(path.c_str());
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <babylon/interfaces/igl_rendering_context.h>
+#include <babylon/tools/dds.h>
+#include <babylon/tools/khronos_texture_container.h>
+
+namespace {
+
+void writeUint32(BABYLON::Uint8Array& buffer, size_t offset, uint32_t value)
+{
+  std::memcpy(buffer.data() + offset, &value, sizeof(value));
+}
+
+// Returns a DDS file with the given FourCC code and a zeroed mip chain
+BABYLON::Uint8Array createDDS(uint32_t fourCC, int width, int height,
+                              int mipmapCount, size_t dataLength,
+                              uint32_t dxgiFormat = 0, bool isCube = false)
+{
+  using namespace BABYLON::Internals;
+  const size_t headerLength = (dxgiFormat != 0) ? 148 : 128;
+  BABYLON::Uint8Array buffer(headerLength + dataLength, 0);
+  writeUint32(buffer, off_magic * 4, DDS_MAGIC);
+  writeUint32(buffer, off_size * 4, 124);
+  writeUint32(buffer, off_flags * 4, DDSD_MIPMAPCOUNT);
+  writeUint32(buffer, off_height * 4, static_cast<uint32_t>(height));
+  writeUint32(buffer, off_width * 4, static_cast<uint32_t>(width));
+  writeUint32(buffer, off_mipmapCount * 4, static_cast<uint32_t>(mipmapCount));
+  writeUint32(buffer, off_pfFlags * 4, DDPF_FOURCC);
+  writeUint32(buffer, off_pfFourCC * 4, fourCC);
+  writeUint32(buffer, off_caps2 * 4, isCube ? DDSCAPS2_CUBEMAP : 0);
+  if (dxgiFormat != 0) {
+    writeUint32(buffer, off_dxgiFormat * 4, dxgiFormat);
+    writeUint32(buffer, off_arraySize * 4, 1);
+  }
+  return buffer;
+}
+
+} // end of anonymous namespace
+
+TEST(TestDDSTools, GetDDSInfo)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Internals;
+
+  // 8x8, 4x4, 2x2 and 1x1 levels of 4, 1, 1 and 1 blocks
+  auto dxt1 = createDDS(DDS::FOURCC_DXT1, 8, 8, 4, 7 * 8);
+  DDSInfo info;
+  ASSERT_TRUE(DDSTools::GetDDSInfo(dxt1, info));
+  EXPECT_EQ(info.width, 8);
+  EXPECT_EQ(info.height, 8);
+  EXPECT_EQ(info.mipmapCount, 4);
+  EXPECT_TRUE(info.isFourCC);
+  EXPECT_FALSE(info.isCube);
+  EXPECT_EQ(info.internalFormat, GL::COMPRESSED_RGBA_S3TC_DXT1_EXT);
+  EXPECT_EQ(info.dataOffset, 128);
+  EXPECT_EQ(DDSTools::GetLevelLength(info, 8, 8), 32);
+  EXPECT_EQ(DDSTools::GetLevelLength(info, 2, 2), 8);
+
+  // Levels beyond 1x1 are ignored, missing levels are rejected
+  auto extraLevels = createDDS(DDS::FOURCC_DXT1, 8, 8, 10, 7 * 8);
+  ASSERT_TRUE(DDSTools::GetDDSInfo(extraLevels, info));
+  EXPECT_EQ(info.mipmapCount, 4);
+  auto truncated = createDDS(DDS::FOURCC_DXT5, 8, 8, 4, 7 * 8);
+  EXPECT_FALSE(DDSTools::GetDDSInfo(truncated, info));
+
+  // BC7 cube texture from the DX10 header extension
+  auto bc7 = createDDS(DDS::FOURCC_DX10, 4, 4, 1, 6 * 16,
+                       DXGI_FORMAT_BC7_UNORM, true);
+  ASSERT_TRUE(DDSTools::GetDDSInfo(bc7, info));
+  EXPECT_TRUE(info.isCube);
+  EXPECT_EQ(info.internalFormat, GL::COMPRESSED_RGBA_BPTC_UNORM);
+  EXPECT_EQ(info.dataOffset, 148);
+
+  auto bc5 = createDDS(DDS::FOURCC_ATI2, 4, 4, 1, 16);
+  ASSERT_TRUE(DDSTools::GetDDSInfo(bc5, info));
+  EXPECT_EQ(info.internalFormat, GL::COMPRESSED_RG_RGTC2);
+
+  auto unsupported = createDDS(FourCCToInt32<'A', 'B', 'C', 'D'>::value, 4, 4,
+                               1, 16);
+  EXPECT_FALSE(DDSTools::GetDDSInfo(unsupported, info));
+  EXPECT_FALSE(DDSTools::GetDDSInfo(Uint8Array(16, 0), info));
+}
+
+TEST(TestKhronosTextureContainer, Header)
+{
+  using namespace BABYLON;
+
+  // 4x4 BC3 texture with 3 levels of 1 block each
+  const uint8_t identifier[] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31,
+                                0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+  Uint8Array ktx(KhronosTextureContainer::HEADER_LEN + 3 * (4 + 16), 0);
+  std::copy(std::begin(identifier), std::end(identifier), ktx.begin());
+  writeUint32(ktx, 12, 0x04030201);
+  writeUint32(ktx, 28, GL::COMPRESSED_RGBA_S3TC_DXT5_EXT);
+  writeUint32(ktx, 36, 4);
+  writeUint32(ktx, 40, 4);
+  writeUint32(ktx, 52, 1);
+  writeUint32(ktx, 56, 3);
+  for (size_t level = 0; level < 3; ++level) {
+    writeUint32(ktx, KhronosTextureContainer::HEADER_LEN + level * 20, 16);
+  }
+
+  KhronosTextureContainer container(ktx, 1);
+  EXPECT_FALSE(container.isInvalid);
+  EXPECT_EQ(container.glInternalFormat, GL::COMPRESSED_RGBA_S3TC_DXT5_EXT);
+  EXPECT_EQ(container.pixelWidth, 4);
+  EXPECT_EQ(container.numberOfMipmapLevels, 3);
+
+  // A cube texture is expected to have 6 faces
+  KhronosTextureContainer cube(ktx, 6);
+  EXPECT_TRUE(cube.isInvalid);
+
+  ktx.resize(ktx.size() - 1);
+  KhronosTextureContainer truncated(ktx, 1);
+  EXPECT_TRUE(truncated.isInvalid);
+}
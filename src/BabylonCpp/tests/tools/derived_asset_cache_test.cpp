@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/mesh/vertex_data.h>
+#include <babylon/tools/derived_asset_cache.h>
+
+namespace {
+
+std::string cacheDirectory()
+{
+  return BABYLON::Filesystem::joinPath(::testing::TempDir(),
+                                       std::string("derived_asset_cache"));
+}
+
+} // end of anonymous namespace
+
+TEST(TestDerivedAssetCache, StoreAndLoad)
+{
+  using namespace BABYLON;
+  const DerivedAssetCache::Step step{"test", 2};
+  const uint64_t inputHash = 0x0123456789abcdef;
+
+  DerivedAssetCache cache;
+  EXPECT_FALSE(cache.isEnabled());
+  EXPECT_FALSE(cache.caches(1 << 30));
+  Uint8Array blob;
+  EXPECT_FALSE(cache.load(step, inputHash, blob));
+  EXPECT_EQ(cache.misses(), 0u);
+  cache.setDirectory(cacheDirectory());
+  cache.setMinimumInputSize(0);
+  EXPECT_TRUE(cache.caches(0));
+  Filesystem::removeFile(cache.path(step, inputHash));
+
+  EXPECT_FALSE(cache.load(step, inputHash, blob));
+
+  const Float32Array floats{0.f, 0.5f, 1.f, -1.f, 2.f, 3.f};
+  const Uint32Array integers{3, 1, 4, 1, 5};
+  DerivedAssetCache::Append(blob, 42.f);
+  DerivedAssetCache::Append(blob, floats, 3);
+  DerivedAssetCache::Append(blob, integers);
+  ASSERT_TRUE(cache.store(step, inputHash, blob));
+
+  Uint8Array loaded;
+  ASSERT_TRUE(cache.load(step, inputHash, loaded));
+  EXPECT_EQ(loaded, blob);
+  size_t offset = 0;
+  float value   = 0.f;
+  Float32Array loadedFloats;
+  Uint32Array loadedIntegers;
+  EXPECT_TRUE(DerivedAssetCache::Read(loaded, offset, value));
+  EXPECT_TRUE(DerivedAssetCache::Read(loaded, offset, loadedFloats));
+  EXPECT_TRUE(DerivedAssetCache::Read(loaded, offset, loadedIntegers));
+  EXPECT_EQ(offset, loaded.size());
+  EXPECT_EQ(value, 42.f);
+  EXPECT_EQ(loadedFloats, floats);
+  EXPECT_EQ(loadedIntegers, integers);
+  EXPECT_FALSE(DerivedAssetCache::Read(loaded, offset, value));
+
+  // Other versions and inputs are not found
+  EXPECT_FALSE(cache.load({"test", 3}, inputHash, loaded));
+  EXPECT_FALSE(cache.load(step, inputHash + 1, loaded));
+  EXPECT_EQ(cache.hits(), 1u);
+  EXPECT_EQ(cache.misses(), 3u);
+
+  // Corrupted blobs are not loaded
+  const auto path = cache.path(step, inputHash);
+  auto contents   = Filesystem::readFileContents(path.c_str());
+  contents.back() ^= 1;
+  ASSERT_TRUE(Filesystem::writeFileContents(path.c_str(), contents));
+  EXPECT_FALSE(cache.load(step, inputHash, loaded));
+  Filesystem::removeFile(path);
+}
+
+TEST(TestDerivedAssetCache, Normals)
+{
+  using namespace BABYLON;
+  // Two triangles of a quad
+  const Float32Array positions{0.f, 0.f, 0.f, 1.f, 0.f, 0.f,
+                               1.f, 1.f, 0.f, 0.f, 1.f, 0.f};
+  const Uint32Array indices{0, 1, 2, 0, 2, 3};
+  Float32Array expected;
+  VertexData::ComputeNormals(positions, indices, expected);
+
+  auto& cache                  = DerivedAssetCache::Instance();
+  const auto minimumInputSize = cache.minimumInputSize();
+  cache.setDirectory(cacheDirectory());
+  cache.setMinimumInputSize(0);
+  const auto hits = cache.hits();
+  for (int i = 0; i < 2; ++i) {
+    Float32Array normals;
+    VertexData::ComputeNormals(positions, indices, normals);
+    EXPECT_EQ(normals, expected);
+  }
+  EXPECT_GT(cache.hits(), hits);
+  cache.setDirectory("");
+  cache.setMinimumInputSize(minimumInputSize);
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <babylon/tools/memory_tracker.h>
+
+TEST(TestMemoryTracker, AllocateAndRelease)
+{
+  using namespace BABYLON;
+  MemoryTracker tracker;
+  tracker.allocate(MemoryCategory::VertexBuffers, 1024);
+  tracker.allocate(MemoryCategory::VertexBuffers, 512);
+  tracker.allocate(MemoryCategory::IndexBuffers, 256);
+  EXPECT_EQ(tracker.bytes(MemoryCategory::VertexBuffers), 1536);
+  EXPECT_EQ(tracker.objects(MemoryCategory::VertexBuffers), 2);
+  EXPECT_EQ(tracker.totalBytes(), 1792);
+
+  tracker.release(MemoryCategory::VertexBuffers, 1024);
+  EXPECT_EQ(tracker.bytes(MemoryCategory::VertexBuffers), 512);
+  EXPECT_EQ(tracker.objects(MemoryCategory::VertexBuffers), 1);
+
+  // Releasing more than tracked clamps to zero
+  tracker.release(MemoryCategory::IndexBuffers, 1024);
+  tracker.release(MemoryCategory::IndexBuffers, 1024);
+  EXPECT_EQ(tracker.bytes(MemoryCategory::IndexBuffers), 0);
+  EXPECT_EQ(tracker.objects(MemoryCategory::IndexBuffers), 0);
+}
+
+TEST(TestMemoryTracker, Snapshot)
+{
+  using namespace BABYLON;
+  MemoryTracker tracker;
+  tracker.setUsage(MemoryCategory::Textures, 4096, 2);
+  tracker.allocate(MemoryCategory::CpuVertexData, 100);
+  auto snapshot = tracker.snapshot(42);
+  EXPECT_EQ(snapshot.renderId, 42);
+  EXPECT_EQ(snapshot.bytesOf(MemoryCategory::Textures), 4096);
+  EXPECT_EQ(snapshot.objectsOf(MemoryCategory::Textures), 2);
+  EXPECT_EQ(snapshot.totalBytes(), 4196);
+  EXPECT_STREQ(MemoryTracker::CategoryName(MemoryCategory::RenderTargets),
+               "RenderTargets");
+}
+
+TEST(TestMemoryTracker, BudgetExceeded)
+{
+  using namespace BABYLON;
+  MemoryTracker tracker;
+  std::vector<MemoryBudgetInfo> notifications;
+  tracker.onBudgetExceededObservable.add(
+    [&notifications](MemoryBudgetInfo* info, BABYLON::EventState) {
+      notifications.emplace_back(*info);
+    });
+  tracker.setBudget(MemoryCategory::Textures, 1000);
+
+  tracker.setUsage(MemoryCategory::Textures, 500, 1);
+  tracker.checkBudgets(tracker.snapshot());
+  EXPECT_TRUE(notifications.empty());
+
+  tracker.setUsage(MemoryCategory::Textures, 1500, 2);
+  tracker.checkBudgets(tracker.snapshot());
+  tracker.checkBudgets(tracker.snapshot());
+  ASSERT_EQ(notifications.size(), 1);
+  EXPECT_EQ(notifications[0].category, MemoryCategory::Textures);
+  EXPECT_EQ(notifications[0].budget, 1000);
+  EXPECT_EQ(notifications[0].bytes, 1500);
+
+  // Going back under budget re-arms the notification
+  tracker.setUsage(MemoryCategory::Textures, 500, 1);
+  tracker.checkBudgets(tracker.snapshot());
+  tracker.setUsage(MemoryCategory::Textures, 2000, 3);
+  tracker.checkBudgets(tracker.snapshot());
+  EXPECT_EQ(notifications.size(), 2);
+}
+
+TEST(TestMemoryTracker, HasBudgets)
+{
+  using namespace BABYLON;
+  MemoryTracker tracker;
+  EXPECT_FALSE(tracker.hasBudgets());
+  tracker.setBudget(MemoryCategory::Textures, 1000);
+  EXPECT_TRUE(tracker.hasBudgets());
+  tracker.setBudget(MemoryCategory::Textures, 0);
+  EXPECT_FALSE(tracker.hasBudgets());
+  tracker.setTotalBudget(1000);
+  EXPECT_TRUE(tracker.hasBudgets());
+}
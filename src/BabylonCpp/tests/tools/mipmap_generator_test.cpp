@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <babylon/tools/mipmap_generator.h>
+
+TEST(TestMipmapGenerator, Box)
+{
+  using namespace BABYLON;
+  MipmapGenerator generator(1);
+
+  // 2x2, 1x1
+  Uint8Array data{
+    0,  0,  0,  0,  40, 40, 40, 40, // Row 0
+    20, 20, 20, 20, 60, 60, 60, 60, // Row 1
+  };
+  auto levels = generator.generate(data, 2, 2, MipmapFormat::RGBA8);
+  ASSERT_EQ(levels.size(), 1);
+  EXPECT_EQ(levels[0], Uint8Array({30, 30, 30, 30}));
+
+  // The pixels of odd sizes are covered by the box of their neighbours
+  Uint8Array odd{0, 0, 0, 255, 30, 0, 0, 255, 90, 0, 0, 255};
+  levels = generator.generate(odd, 3, 1, MipmapFormat::RGBA8);
+  ASSERT_EQ(levels.size(), 1);
+  EXPECT_EQ(levels[0], Uint8Array({40, 0, 0, 255}));
+
+  EXPECT_EQ(MipmapGenerator::GetLevelCount(1024, 512), 11);
+  EXPECT_EQ(MipmapGenerator::GetLevelCount(1, 1), 1);
+  EXPECT_TRUE(generator.generate(Uint8Array{1, 2, 3, 4}, 1, 1,
+                                 MipmapFormat::RGBA8)
+                .empty());
+}
+
+TEST(TestMipmapGenerator, SRGB)
+{
+  using namespace BABYLON;
+  MipmapGenerator generator(1);
+
+  // Black and white average to the linear mid gray, alpha stays linear
+  Uint8Array data{0, 0, 0, 0, 255, 255, 255, 255};
+  MipmapOptions options;
+  options.sRGB = true;
+  auto levels  = generator.generate(data, 2, 1, MipmapFormat::RGBA8, options);
+  ASSERT_EQ(levels.size(), 1);
+  EXPECT_EQ(levels[0], Uint8Array({188, 188, 188, 128}));
+
+  options.sRGB = false;
+  levels       = generator.generate(data, 2, 1, MipmapFormat::RGBA8, options);
+  EXPECT_EQ(levels[0], Uint8Array({128, 128, 128, 128}));
+}
+
+TEST(TestMipmapGenerator, FloatFormats)
+{
+  using namespace BABYLON;
+  MipmapGenerator generator(1);
+
+  const std::vector<float> pixels{0.f, 1.f, 2.f,  1.f, // Pixel 0
+                                  4.f, 3.f, 10.f, 0.f};
+  Uint8Array data(pixels.size() * sizeof(float));
+  std::memcpy(data.data(), pixels.data(), data.size());
+  auto levels = generator.generate(data, 1, 2, MipmapFormat::RGBA32F);
+  ASSERT_EQ(levels.size(), 1);
+  ASSERT_EQ(levels[0].size(), 4 * sizeof(float));
+  float mip[4];
+  std::memcpy(mip, levels[0].data(), sizeof(mip));
+  EXPECT_FLOAT_EQ(mip[0], 2.f);
+  EXPECT_FLOAT_EQ(mip[1], 2.f);
+  EXPECT_FLOAT_EQ(mip[2], 6.f);
+  EXPECT_FLOAT_EQ(mip[3], 0.5f);
+
+  // 1.0 and 3.0 as half floats
+  Uint8Array half{0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c,
+                  0x00, 0x42, 0x00, 0x42, 0x00, 0x42, 0x00, 0x42};
+  levels = generator.generate(half, 2, 1, MipmapFormat::RGBA16F);
+  ASSERT_EQ(levels.size(), 1);
+  // 2.0
+  EXPECT_EQ(levels[0], Uint8Array({0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
+                                   0x40}));
+}
+
+TEST(TestMipmapGenerator, AlphaCoverage)
+{
+  using namespace BABYLON;
+  MipmapGenerator generator(1);
+
+  // A quarter of the pixels pass the alpha test
+  Uint8Array data{
+    0, 0, 0, 255, 0, 0, 0, 0, // Row 0
+    0, 0, 0, 0,   0, 0, 0, 0, // Row 1
+  };
+  auto levels = generator.generate(data, 2, 2, MipmapFormat::RGBA8);
+  EXPECT_EQ(levels[0][3], 64);
+
+  MipmapOptions options;
+  options.preserveAlphaCoverage = true;
+  levels = generator.generate(data, 2, 2, MipmapFormat::RGBA8, options);
+  EXPECT_GE(levels[0][3], 128);
+}
+
+TEST(TestMipmapGenerator, Kaiser)
+{
+  using namespace BABYLON;
+  MipmapGenerator generator(1);
+
+  // The normalized filter keeps uniform images unchanged
+  Image image(Uint8Array(8 * 8 * 3, 77), 8, 8, 3, 0);
+  MipmapOptions options;
+  options.filter = MipmapFilter::KAISER;
+  auto mips      = generator.generate(image, options);
+  ASSERT_EQ(mips.size(), 3);
+  EXPECT_EQ(mips[0].width, 4);
+  EXPECT_EQ(mips[0].depth, 3);
+  EXPECT_EQ(mips[0].data, Uint8Array(4 * 4 * 3, 77));
+  EXPECT_EQ(mips[2].data, Uint8Array(3, 77));
+}
+
+TEST(TestMipmapGenerator, Workers)
+{
+  using namespace BABYLON;
+
+  // The rows of large levels are split over the workers
+  const int width = 300, height = 200;
+  Uint8Array data(static_cast<size_t>(width * height * 4));
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<uint8_t>((i * 7919) >> 3);
+  }
+  MipmapOptions options;
+  options.filter = MipmapFilter::KAISER;
+  options.sRGB   = true;
+
+  MipmapGenerator single(1), pool(4);
+  EXPECT_EQ(pool.workerCount(), 4);
+  const auto expected
+    = single.generate(data, width, height, MipmapFormat::RGBA8, options);
+  ASSERT_EQ(expected.size(), 8);
+  EXPECT_EQ(pool.generate(data, width, height, MipmapFormat::RGBA8, options),
+            expected);
+}
@@ -0,0 +1,299 @@
+#include <gtest/gtest.h>
+
+#include <babylon/tools/scene_snapshot.h>
+
+namespace {
+
+/**
+ * @brief Writes a snapshot of two meshes, an arc rotate camera, two
+ * materials, a skeleton of two bones and an animatable, without lights.
+ */
+BABYLON::Uint8Array writeSnapshot()
+{
+  using namespace BABYLON;
+  Uint8Array buffer;
+  auto snapshot = SceneSnapshot::Writer(buffer);
+
+  SnapshotHeader header;
+  header.animationTime  = 1250;
+  header.activeCameraId = 7;
+  snapshot.write(header);
+
+  snapshot.writeCount(2);
+  SnapshotMesh box;
+  box.uniqueId   = 3;
+  box.id         = "box";
+  box.visibility = 0.5f;
+  box.position.copyFromFloats(1.f, 2.f, 3.f);
+  box.rotation.copyFromFloats(0.f, 1.5f, 0.f);
+  box.scaling.copyFromFloats(2.f, 2.f, 2.f);
+  box.hasGeometry   = true;
+  box.geometryIndex = 0;
+  box.geometryId    = "boxGeometry";
+  box.materialKind  = SnapshotMaterialKind::Single;
+  box.materialIndex = 1;
+  box.materialId    = "red";
+  box.hasPhysics    = true;
+  box.mass          = 4.f;
+  box.linearVelocity.copyFromFloats(0.f, -9.8f, 0.f);
+  box.angularVelocity.copyFromFloats(0.f, 0.f, 1.f);
+  snapshot.write(box);
+  SnapshotMesh sphere;
+  sphere.uniqueId              = 4;
+  sphere.id                    = "box1";
+  sphere.enabled               = false;
+  sphere.visible               = false;
+  sphere.hasRotationQuaternion = true;
+  sphere.rotationQuaternion.copyFromFloats(0.f, 0.f, 0.6f, 0.8f);
+  sphere.scaling.copyFromFloats(1.f, 1.f, 1.f);
+  snapshot.write(sphere);
+
+  snapshot.writeCount(1);
+  SnapshotCamera camera;
+  camera.uniqueId = 7;
+  camera.id       = "camera";
+  camera.position.copyFromFloats(0.f, 5.f, -10.f);
+  camera.upVector.copyFromFloats(0.f, 1.f, 0.f);
+  camera.fov         = 0.8f;
+  camera.minZ        = 1.f;
+  camera.maxZ        = 1000.f;
+  camera.mode        = 1;
+  camera.hasRotation = true;
+  camera.rotation.copyFromFloats(0.1f, 0.2f, 0.3f);
+  camera.isArcRotate = true;
+  camera.alpha       = 1.f;
+  camera.beta        = 0.5f;
+  camera.radius      = 12.f;
+  camera.target.copyFromFloats(0.f, 1.f, 0.f);
+  snapshot.write(camera);
+
+  snapshot.writeCount(0);
+
+  snapshot.writeCount(2);
+  SnapshotMaterial shader;
+  shader.id              = "shader";
+  shader.backFaceCulling = false;
+  shader.alpha           = 0.25f;
+  shader.alphaMode       = 2;
+  shader.sideOrientation = 1;
+  snapshot.write(shader);
+  SnapshotMaterial red;
+  red.id         = "red";
+  red.isStandard = true;
+  red.ambientColor.copyFromFloats(0.1f, 0.1f, 0.1f);
+  red.diffuseColor.copyFromFloats(1.f, 0.f, 0.f);
+  red.specularColor.copyFromFloats(0.5f, 0.5f, 0.5f);
+  red.emissiveColor.copyFromFloats(0.f, 0.f, 0.2f);
+  red.specularPower = 64.f;
+  snapshot.write(red);
+
+  snapshot.writeCount(1);
+  SnapshotSkeleton skeleton;
+  skeleton.id        = "skeleton";
+  skeleton.boneCount = 2;
+  snapshot.write(skeleton);
+  SnapshotBone bone;
+  for (size_t i = 0; i < skeleton.boneCount; ++i) {
+    for (size_t j = 0; j < bone.localMatrix.size(); ++j) {
+      bone.localMatrix[j] = static_cast<float>(i * 16 + j);
+    }
+    snapshot.write(bone);
+  }
+
+  snapshot.writeCount(1);
+  SnapshotAnimatable animatable;
+  animatable.targetId         = 3;
+  animatable.loopAnimation    = true;
+  animatable.started          = true;
+  animatable.fromFrame        = 10;
+  animatable.toFrame          = 90;
+  animatable.speedRatio       = 2.f;
+  animatable.localDelayOffset = 1500;
+  animatable.pausedDelay      = -1;
+  animatable.animationCount   = 1;
+  snapshot.write(animatable);
+  SnapshotAnimation animation;
+  animation.currentFrame   = 42;
+  animation.stopped        = true;
+  animation.blendingFactor = 0.75f;
+  snapshot.write(animation);
+  return buffer;
+}
+
+} // end of anonymous namespace
+
+TEST(TestSceneSnapshot, RoundTrip)
+{
+  using namespace BABYLON;
+  const auto buffer = writeSnapshot();
+  EXPECT_TRUE(SceneSnapshot::Validate(buffer.data(), buffer.size()));
+  auto snapshot = SceneSnapshot::Reader(buffer.data(), buffer.size());
+
+  SnapshotHeader header;
+  ASSERT_TRUE(snapshot.read(header));
+  EXPECT_EQ(header.animationTime, 1250);
+  EXPECT_EQ(header.activeCameraId, 7u);
+
+  // Meshes
+  ASSERT_EQ(snapshot.readCount(), 2u);
+  SnapshotMesh mesh;
+  ASSERT_TRUE(snapshot.read(mesh));
+  EXPECT_EQ(mesh.uniqueId, 3u);
+  EXPECT_EQ(mesh.id, "box");
+  EXPECT_TRUE(mesh.enabled);
+  EXPECT_TRUE(mesh.visible);
+  EXPECT_FLOAT_EQ(mesh.visibility, 0.5f);
+  EXPECT_TRUE(mesh.position.equals(Vector3(1.f, 2.f, 3.f)));
+  EXPECT_TRUE(mesh.rotation.equals(Vector3(0.f, 1.5f, 0.f)));
+  EXPECT_FALSE(mesh.hasRotationQuaternion);
+  EXPECT_TRUE(mesh.scaling.equals(Vector3(2.f, 2.f, 2.f)));
+  EXPECT_TRUE(mesh.hasGeometry);
+  EXPECT_EQ(mesh.geometryIndex, 0u);
+  EXPECT_EQ(mesh.geometryId, "boxGeometry");
+  EXPECT_EQ(mesh.materialKind, SnapshotMaterialKind::Single);
+  EXPECT_EQ(mesh.materialIndex, 1u);
+  EXPECT_EQ(mesh.materialId, "red");
+  EXPECT_TRUE(mesh.hasPhysics);
+  EXPECT_FLOAT_EQ(mesh.mass, 4.f);
+  EXPECT_TRUE(mesh.linearVelocity.equals(Vector3(0.f, -9.8f, 0.f)));
+  EXPECT_TRUE(mesh.angularVelocity.equals(Vector3(0.f, 0.f, 1.f)));
+  // The ids are kept in full, not only their prefix nor their hash
+  ASSERT_TRUE(snapshot.read(mesh));
+  EXPECT_EQ(mesh.uniqueId, 4u);
+  EXPECT_EQ(mesh.id, "box1");
+  EXPECT_FALSE(mesh.enabled);
+  EXPECT_FALSE(mesh.visible);
+  EXPECT_TRUE(mesh.hasRotationQuaternion);
+  EXPECT_TRUE(
+    mesh.rotationQuaternion.equals(Quaternion(0.f, 0.f, 0.6f, 0.8f)));
+  EXPECT_FALSE(mesh.hasGeometry);
+  EXPECT_EQ(mesh.materialKind, SnapshotMaterialKind::None);
+  EXPECT_FALSE(mesh.hasPhysics);
+
+  // Cameras
+  ASSERT_EQ(snapshot.readCount(), 1u);
+  SnapshotCamera camera;
+  ASSERT_TRUE(snapshot.read(camera));
+  EXPECT_EQ(camera.uniqueId, 7u);
+  EXPECT_EQ(camera.id, "camera");
+  EXPECT_TRUE(camera.position.equals(Vector3(0.f, 5.f, -10.f)));
+  EXPECT_TRUE(camera.upVector.equals(Vector3(0.f, 1.f, 0.f)));
+  EXPECT_FLOAT_EQ(camera.fov, 0.8f);
+  EXPECT_FLOAT_EQ(camera.minZ, 1.f);
+  EXPECT_FLOAT_EQ(camera.maxZ, 1000.f);
+  EXPECT_EQ(camera.mode, 1u);
+  EXPECT_TRUE(camera.hasRotation);
+  EXPECT_TRUE(camera.rotation.equals(Vector3(0.1f, 0.2f, 0.3f)));
+  EXPECT_FALSE(camera.hasRotationQuaternion);
+  EXPECT_TRUE(camera.isArcRotate);
+  EXPECT_FLOAT_EQ(camera.alpha, 1.f);
+  EXPECT_FLOAT_EQ(camera.beta, 0.5f);
+  EXPECT_FLOAT_EQ(camera.radius, 12.f);
+  EXPECT_TRUE(camera.target.equals(Vector3(0.f, 1.f, 0.f)));
+
+  // Lights
+  EXPECT_EQ(snapshot.readCount(), 0u);
+
+  // Materials
+  ASSERT_EQ(snapshot.readCount(), 2u);
+  SnapshotMaterial material;
+  ASSERT_TRUE(snapshot.read(material));
+  EXPECT_EQ(material.id, "shader");
+  EXPECT_FALSE(material.backFaceCulling);
+  EXPECT_FLOAT_EQ(material.alpha, 0.25f);
+  EXPECT_EQ(material.alphaMode, 2);
+  EXPECT_EQ(material.sideOrientation, 1);
+  EXPECT_FALSE(material.isStandard);
+  ASSERT_TRUE(snapshot.read(material));
+  EXPECT_EQ(material.id, "red");
+  EXPECT_TRUE(material.backFaceCulling);
+  EXPECT_TRUE(material.isStandard);
+  EXPECT_TRUE(material.ambientColor.equals(Color3(0.1f, 0.1f, 0.1f)));
+  EXPECT_TRUE(material.diffuseColor.equals(Color3(1.f, 0.f, 0.f)));
+  EXPECT_TRUE(material.specularColor.equals(Color3(0.5f, 0.5f, 0.5f)));
+  EXPECT_TRUE(material.emissiveColor.equals(Color3(0.f, 0.f, 0.2f)));
+  EXPECT_FLOAT_EQ(material.specularPower, 64.f);
+
+  // Skeletons
+  ASSERT_EQ(snapshot.readCount(), 1u);
+  SnapshotSkeleton skeleton;
+  ASSERT_TRUE(snapshot.read(skeleton));
+  EXPECT_EQ(skeleton.id, "skeleton");
+  ASSERT_EQ(skeleton.boneCount, 2u);
+  SnapshotBone bone;
+  for (size_t i = 0; i < skeleton.boneCount; ++i) {
+    ASSERT_TRUE(snapshot.read(bone));
+    for (size_t j = 0; j < bone.localMatrix.size(); ++j) {
+      EXPECT_EQ(bone.localMatrix[j], static_cast<float>(i * 16 + j));
+    }
+  }
+
+  // Animatables
+  ASSERT_EQ(snapshot.readCount(), 1u);
+  SnapshotAnimatable animatable;
+  ASSERT_TRUE(snapshot.read(animatable));
+  EXPECT_EQ(animatable.targetId, 3u);
+  EXPECT_TRUE(animatable.loopAnimation);
+  EXPECT_FALSE(animatable.paused);
+  EXPECT_TRUE(animatable.started);
+  EXPECT_EQ(animatable.fromFrame, 10);
+  EXPECT_EQ(animatable.toFrame, 90);
+  EXPECT_FLOAT_EQ(animatable.speedRatio, 2.f);
+  EXPECT_EQ(animatable.localDelayOffset, 1500);
+  EXPECT_EQ(animatable.pausedDelay, -1);
+  ASSERT_EQ(animatable.animationCount, 1u);
+  SnapshotAnimation animation;
+  ASSERT_TRUE(snapshot.read(animation));
+  EXPECT_EQ(animation.currentFrame, 42);
+  EXPECT_TRUE(animation.stopped);
+  EXPECT_FLOAT_EQ(animation.blendingFactor, 0.75f);
+
+  EXPECT_TRUE(snapshot.isValid());
+  EXPECT_TRUE(snapshot.isAtEnd());
+}
+
+TEST(TestSceneSnapshot, Truncated)
+{
+  using namespace BABYLON;
+  const auto buffer = writeSnapshot();
+  for (size_t size = 0; size < buffer.size(); ++size) {
+    EXPECT_FALSE(SceneSnapshot::Validate(buffer.data(), size)) << size;
+  }
+  // Trailing bytes are rejected as well
+  auto padded = buffer;
+  padded.emplace_back(0);
+  EXPECT_FALSE(SceneSnapshot::Validate(padded.data(), padded.size()));
+  EXPECT_FALSE(SceneSnapshot::Validate(nullptr, 0));
+}
+
+TEST(TestSceneSnapshot, Corrupted)
+{
+  using namespace BABYLON;
+  const auto buffer = writeSnapshot();
+  const auto corrupt = [&buffer](size_t offset, uint32_t value) {
+    auto data = buffer;
+    std::memcpy(data.data() + offset, &value, sizeof(value));
+    return SceneSnapshot::Validate(data.data(), data.size());
+  };
+
+  // Magic number and version
+  EXPECT_FALSE(corrupt(0, 0x12345678));
+  EXPECT_FALSE(corrupt(4, SceneSnapshot::Version + 1));
+  // Count of meshes and length of the id of the first mesh, beyond the data
+  EXPECT_FALSE(corrupt(16, std::numeric_limits<uint32_t>::max()));
+  EXPECT_FALSE(corrupt(24, std::numeric_limits<uint32_t>::max()));
+
+  // Kind of the material of a mesh out of range, which is the last byte of
+  // a mesh without material nor physics body
+  Uint8Array data;
+  auto snapshot = SceneSnapshot::Writer(data);
+  snapshot.write(SnapshotHeader());
+  snapshot.writeCount(1);
+  snapshot.write(SnapshotMesh());
+  for (size_t i = 0; i < 5; ++i) {
+    snapshot.writeCount(0);
+  }
+  EXPECT_TRUE(SceneSnapshot::Validate(data.data(), data.size()));
+  data[data.size() - 5 * sizeof(uint32_t) - 1] = 3;
+  EXPECT_FALSE(SceneSnapshot::Validate(data.data(), data.size()));
+}
@@ -0,0 +1,285 @@
+#include <gtest/gtest.h>
+
+#include <babylon/tools/dds.h>
+#include <babylon/tools/texture_compressor.h>
+
+namespace {
+
+// Reference decoders of the compressed blocks, one RGBA pixel per texel
+
+void decodeBC1(const uint8_t* block, uint8_t* rgba)
+{
+  const uint16_t c0 = static_cast<uint16_t>(block[0] | (block[1] << 8));
+  const uint16_t c1 = static_cast<uint16_t>(block[2] | (block[3] << 8));
+  int palette[4][4];
+  for (int i = 0; i < 2; ++i) {
+    const uint16_t c = i == 0 ? c0 : c1;
+    const int r = (c >> 11) & 31, g = (c >> 5) & 63, b = c & 31;
+    palette[i][0] = (r << 3) | (r >> 2);
+    palette[i][1] = (g << 2) | (g >> 4);
+    palette[i][2] = (b << 3) | (b >> 2);
+    palette[i][3] = 255;
+  }
+  for (int ch = 0; ch < 4; ++ch) {
+    if (c0 > c1) {
+      palette[2][ch] = (2 * palette[0][ch] + palette[1][ch]) / 3;
+      palette[3][ch] = (palette[0][ch] + 2 * palette[1][ch]) / 3;
+    }
+    else {
+      palette[2][ch] = (palette[0][ch] + palette[1][ch]) / 2;
+      palette[3][ch] = 0;
+    }
+  }
+  const uint32_t indices = static_cast<uint32_t>(
+    block[4] | (block[5] << 8) | (block[6] << 16) | (block[7] << 24));
+  for (int i = 0; i < 16; ++i) {
+    const auto index = (indices >> (2 * i)) & 3;
+    for (int ch = 0; ch < 4; ++ch) {
+      rgba[i * 4 + ch] = static_cast<uint8_t>(palette[index][ch]);
+    }
+  }
+}
+
+void decodeBC4(const uint8_t* block, uint8_t* values, int stride)
+{
+  const int a0 = block[0], a1 = block[1];
+  int palette[8] = {a0, a1};
+  for (int i = 1; i < 7; ++i) {
+    palette[i + 1] = (a0 > a1) ? ((7 - i) * a0 + i * a1) / 7 :
+                                 ((5 - i) * a0 + i * a1) / 5;
+  }
+  if (a0 <= a1) {
+    palette[6] = 0;
+    palette[7] = 255;
+  }
+  uint64_t indices = 0;
+  for (int i = 0; i < 6; ++i) {
+    indices |= static_cast<uint64_t>(block[2 + i]) << (8 * i);
+  }
+  for (int i = 0; i < 16; ++i) {
+    const auto index   = (indices >> (3 * i)) & 7;
+    values[i * stride] = static_cast<uint8_t>(palette[index]);
+  }
+}
+
+uint32_t readBits(const uint8_t* block, size_t& pos, int count)
+{
+  uint32_t value = 0;
+  for (int i = 0; i < count; ++i, ++pos) {
+    value |= static_cast<uint32_t>((block[pos >> 3] >> (pos & 7)) & 1) << i;
+  }
+  return value;
+}
+
+// Decodes mode 6 blocks only
+bool decodeBC7(const uint8_t* block, uint8_t* rgba)
+{
+  static const int weights[16]
+    = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+  size_t pos = 0;
+  if (readBits(block, pos, 7) != (1 << 6)) {
+    return false;
+  }
+  int e[2][4];
+  for (int ch = 0; ch < 4; ++ch) {
+    e[0][ch] = static_cast<int>(readBits(block, pos, 7)) << 1;
+    e[1][ch] = static_cast<int>(readBits(block, pos, 7)) << 1;
+  }
+  const auto p0 = static_cast<int>(readBits(block, pos, 1));
+  const auto p1 = static_cast<int>(readBits(block, pos, 1));
+  for (int ch = 0; ch < 4; ++ch) {
+    e[0][ch] |= p0;
+    e[1][ch] |= p1;
+  }
+  for (int i = 0; i < 16; ++i) {
+    const int w = weights[readBits(block, pos, i == 0 ? 3 : 4)];
+    for (int ch = 0; ch < 4; ++ch) {
+      rgba[i * 4 + ch]
+        = static_cast<uint8_t>(((64 - w) * e[0][ch] + w * e[1][ch] + 32) >> 6);
+    }
+  }
+  return true;
+}
+
+// Mean squared error over the given channels
+float meanSquaredError(const uint8_t* a, const uint8_t* b, int channelCount)
+{
+  float error = 0.f;
+  for (int i = 0; i < 16; ++i) {
+    for (int ch = 0; ch < channelCount; ++ch) {
+      const float d = static_cast<float>(a[i * 4 + ch]) - b[i * 4 + ch];
+      error += d * d;
+    }
+  }
+  return error / (16 * channelCount);
+}
+
+void fillGradient(uint8_t* rgba)
+{
+  for (int i = 0; i < 16; ++i) {
+    rgba[i * 4 + 0] = static_cast<uint8_t>(40 + i * 3);
+    rgba[i * 4 + 1] = static_cast<uint8_t>(200 - i * 2);
+    rgba[i * 4 + 2] = static_cast<uint8_t>(90 + i);
+    rgba[i * 4 + 3] = static_cast<uint8_t>(255 - i * 10);
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestTextureCompressor, BC1)
+{
+  using namespace BABYLON;
+
+  // A color exactly representable in RGB565 is preserved
+  uint8_t rgba[64], decoded[64], block[8];
+  for (int i = 0; i < 16; ++i) {
+    rgba[i * 4 + 0] = 255;
+    rgba[i * 4 + 1] = 0;
+    rgba[i * 4 + 2] = 132;
+    rgba[i * 4 + 3] = 255;
+  }
+  TextureCompressor::CompressBlock(rgba, BlockCompressionFormat::BC1, block);
+  decodeBC1(block, decoded);
+  EXPECT_EQ(meanSquaredError(rgba, decoded, 4), 0.f);
+
+  fillGradient(rgba);
+  for (int i = 0; i < 16; ++i) {
+    rgba[i * 4 + 3] = 255;
+  }
+  TextureCompressor::CompressBlock(rgba, BlockCompressionFormat::BC1, block);
+  decodeBC1(block, decoded);
+  EXPECT_LT(meanSquaredError(rgba, decoded, 3), 12.f);
+
+  // Transparent pixels use the punch through alpha
+  rgba[3]  = 0;
+  rgba[63] = 0;
+  TextureCompressor::CompressBlock(rgba, BlockCompressionFormat::BC1, block);
+  decodeBC1(block, decoded);
+  EXPECT_EQ(decoded[3], 0);
+  EXPECT_EQ(decoded[63], 0);
+  EXPECT_EQ(decoded[31], 255);
+}
+
+TEST(TestTextureCompressor, BC3AndBC5)
+{
+  using namespace BABYLON;
+
+  uint8_t rgba[64], decoded[64], block[16];
+  fillGradient(rgba);
+  TextureCompressor::CompressBlock(rgba, BlockCompressionFormat::BC3, block);
+  decodeBC1(block + 8, decoded);
+  decodeBC4(block, decoded + 3, 4);
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_NEAR(decoded[i * 4 + 3], rgba[i * 4 + 3], 12);
+  }
+  EXPECT_LT(meanSquaredError(rgba, decoded, 3), 12.f);
+
+  TextureCompressor::CompressBlock(rgba, BlockCompressionFormat::BC5, block);
+  decodeBC4(block, decoded, 4);
+  decodeBC4(block + 8, decoded + 1, 4);
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_NEAR(decoded[i * 4 + 0], rgba[i * 4 + 0], 4);
+    EXPECT_NEAR(decoded[i * 4 + 1], rgba[i * 4 + 1], 3);
+  }
+}
+
+TEST(TestTextureCompressor, BC7)
+{
+  using namespace BABYLON;
+
+  uint8_t rgba[64], decoded[64], block[16];
+  fillGradient(rgba);
+  TextureCompressor::CompressBlock(rgba, BlockCompressionFormat::BC7, block);
+  ASSERT_TRUE(decodeBC7(block, decoded));
+  EXPECT_LT(meanSquaredError(rgba, decoded, 4), 1.f);
+
+  // The first index is stored with 3 bits, whichever end the pixel is close to
+  for (int i = 0; i < 32; ++i) {
+    std::swap(rgba[i], rgba[63 - i]);
+  }
+  TextureCompressor::CompressBlock(rgba, BlockCompressionFormat::BC7, block);
+  ASSERT_TRUE(decodeBC7(block, decoded));
+  EXPECT_LT(meanSquaredError(rgba, decoded, 4), 1.f);
+}
+
+TEST(TestTextureCompressor, Compress)
+{
+  using namespace BABYLON;
+
+  // 10x6 image, the border blocks are padded
+  Image image;
+  image.width  = 10;
+  image.height = 6;
+  image.depth  = 4;
+  image.data.resize(10 * 6 * 4, 128);
+
+  TextureCompressor compressor(2);
+  EXPECT_EQ(compressor.workerCount(), 2);
+  const auto texture = compressor.compress(image, BlockCompressionFormat::BC1);
+  ASSERT_EQ(texture.levels.size(), 4);
+  EXPECT_EQ(texture.levels[0].size(), 3 * 2 * 8);
+  EXPECT_EQ(texture.levels[0], TextureCompressor::CompressImage(
+                                 image, BlockCompressionFormat::BC1));
+  EXPECT_EQ(texture.levels[3].size(), 8);
+
+  // The DDS file is read back with the same levels
+  const auto dds = TextureCompressor::ToDDS(texture);
+  Internals::DDSInfo info;
+  ASSERT_TRUE(Internals::DDSTools::GetDDSInfo(dds, info));
+  EXPECT_EQ(info.width, 10);
+  EXPECT_EQ(info.height, 6);
+  EXPECT_EQ(info.mipmapCount, 4);
+  EXPECT_EQ(info.internalFormat,
+            TextureCompressor::GetInternalFormat(BlockCompressionFormat::BC1));
+  EXPECT_EQ(dds.size(), info.dataOffset + (6 + 2 + 1 + 1) * 8);
+
+  const auto bc7 = TextureCompressor::ToDDS(
+    compressor.compress(image, BlockCompressionFormat::BC7, false));
+  ASSERT_TRUE(Internals::DDSTools::GetDDSInfo(bc7, info));
+  EXPECT_EQ(info.mipmapCount, 1);
+  EXPECT_EQ(info.internalFormat,
+            TextureCompressor::GetInternalFormat(BlockCompressionFormat::BC7));
+}
+
+TEST(TestTextureCompressor, CompressFileAsync)
+{
+  using namespace BABYLON;
+
+  // 8x8 binary PPM image
+  const std::string path = "texture_compressor_test.ppm";
+  {
+    std::ofstream file(path, std::ios::binary);
+    file << "P6\n8 8\n255\n";
+    const std::vector<char> pixels(8 * 8 * 3, 64);
+    file.write(pixels.data(), static_cast<std::streamsize>(pixels.size()));
+  }
+
+  // The image is compressed once by the worker pool, compressFile() waits for
+  // it, then the file is read from the cache
+  TextureCompressor compressor(2);
+  compressor.cacheDirectory = "texture_compressor_test_cache";
+  EXPECT_TRUE(compressor.compressFileAsync(path).empty());
+  EXPECT_LE(compressor.pendingCount(), 1u);
+  const auto ddsPath = compressor.compressFile(path);
+  ASSERT_FALSE(ddsPath.empty());
+  EXPECT_EQ(compressor.pendingCount(), 0u);
+  EXPECT_EQ(compressor.compressFileAsync(path), ddsPath);
+
+  std::ifstream dds(ddsPath, std::ios::binary);
+  const Uint8Array data((std::istreambuf_iterator<char>(dds)),
+                        std::istreambuf_iterator<char>());
+  Internals::DDSInfo info;
+  ASSERT_TRUE(Internals::DDSTools::GetDDSInfo(data, info));
+  EXPECT_EQ(info.width, 8);
+  EXPECT_EQ(info.mipmapCount, 4);
+  EXPECT_EQ(info.internalFormat,
+            TextureCompressor::GetInternalFormat(BlockCompressionFormat::BC1));
+
+  EXPECT_TRUE(compressor.compressFileAsync("missing_image.png").empty());
+  EXPECT_EQ(compressor.pendingCount(), 0u);
+
+  dds.close();
+  std::remove(ddsPath.c_str());
+  std::remove(compressor.cacheDirectory.c_str());
+  std::remove(path.c_str());
+}
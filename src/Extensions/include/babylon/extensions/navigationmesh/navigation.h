@@ -2,6 +2,8 @@
 #define BABYLON_EXTENSIONS_NAVIGATION_MESH_NAVIGATION_H
 
 #include <babylon/babylon_global.h>
+#include <babylon/core/span.h>
+#include <babylon/extensions/navigationmesh/navigation_grid.h>
 #include <babylon/extensions/navigationmesh/navigation_structs.h>
 
 namespace BABYLON {
@@ -22,38 +24,74 @@ public:
   Navigation();
   ~Navigation();
 
+  /**
+   * @brief Builds the nodes of a navigation mesh from its geometry, which is
+   * left unchanged. The nodes of large meshes are cached by the derived asset
+   * cache of the process.
+   */
   GroupedNavigationMesh buildNodes(Mesh* mesh);
+
+  /**
+   * @brief Builds the nodes of a navigation mesh from its positions and its
+   * indices, merging its vertices.
+   */
+  GroupedNavigationMesh buildNodes(const Float32Array& positions,
+                                   const IndicesArray& indices);
+
+  /**
+   * @brief Builds the nodes of a navigation mesh from its positions and its
+   * indices, or loads them from the cache when the input is large enough to be
+   * cached.
+   */
+  GroupedNavigationMesh buildNodes(const Float32Array& positions,
+                                   const IndicesArray& indices,
+                                   DerivedAssetCache& cache);
+
+  /**
+   * @brief Sets the nodes of a zone, and indexes their centroids for the
+   * closest node lookups.
+   */
   void setZoneData(const std::string& zone, const GroupedNavigationMesh& data);
+
+  /**
+   * @brief Returns the group of the node of the zone whose centroid is the
+   * closest to the position, -1 when the zone has no node.
+   */
   int getGroup(const std::string& zone, const Vector3& position);
   std::vector<Vector3> findPath(const Vector3& startPosition,
                                 const Vector3& targetPosition,
                                 const std::string& zone, std::size_t group);
 
+private:
+  /**
+   * @brief Closest node lookups of a zone, among all its nodes and among the
+   * nodes of each group.
+   */
+  struct ZoneGrids {
+    NavigationGrid nodes;
+    Uint32Array nodeGroups;
+    std::vector<NavigationGrid> groups;
+  }; // end of struct ZoneGrids
+
 private:
   bool _isPointInPoly(const std::vector<Vector3>& poly,
                       const Vector3& pt) const;
   bool _isVectorInPolygon(const Vector3& vector, const NavigationGroup& polyon,
                           const Float32Array& vertices);
-  void _computeCentroids(Geometry* geometry);
   float _roundNumber(float number, unsigned int decimals);
   void _setPolygonCentroid(NavigationPolygon& polygon,
                            const NavigationMesh& navigationMesh);
-  Vector3 getVectorFrom(const Float32Array& vertices, unsigned int id);
-  std::vector<std::vector<NavigationPolygon>>
-  _buildPolygonGroups(NavigationMesh& navigationMesh);
-  Uint32Array _array_intersect(const Uint32Array& array1,
-                               const Uint32Array& array2);
-  void _buildPolygonNeighbours(NavigationPolygon& polygon,
-                               NavigationMesh& navigationMesh);
-  NavigationMesh _buildPolygonsFromGeometry(Geometry* geometry);
-  NavigationMesh _buildNavigationMesh(Geometry* geometry);
-  size_t _mergeVertices(Geometry* geometry);
-  Uint32Array _getSharedVerticesInOrder(NavigationPolygon& a,
-                                        NavigationPolygon& b);
+  Vector3 getVectorFrom(span<const float> vertices, unsigned int id);
+  std::vector<Uint32Array> _buildPolygonGroups(NavigationMesh& navigationMesh);
+  void _buildPolygonNeighbours(NavigationMesh& navigationMesh);
+  NavigationMesh _buildPolygons(const Float32Array& vertices,
+                                const IndicesArray& indices);
+  size_t _mergeVertices(Float32Array& vertices, IndicesArray& indices);
   GroupedNavigationMesh _groupNavMesh(NavigationMesh& navigationMesh);
 
 private:
   std::unordered_map<std::string, GroupedNavigationMesh> _zoneNodes;
+  std::unordered_map<std::string, ZoneGrids> _zoneGrids;
 
 }; // end of class Navigation
 
@@ -0,0 +1,55 @@
+#ifndef BABYLON_EXTENSIONS_NAVIGATION_MESH_NAVIGATION_GRID_H
+#define BABYLON_EXTENSIONS_NAVIGATION_MESH_NAVIGATION_GRID_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+/**
+ * @brief Uniform grid of points, finding the closest point to a position by
+ * visiting the cells around it, from the nearest to the farthest ones.
+ *
+ * The cells are cubes sized for about one point per cell. They span the two
+ * largest extents of the points only when the points are mostly flat, as the
+ * centroids of the nodes of a navigation mesh often are.
+ */
+class BABYLON_SHARED_EXPORT NavigationGrid {
+
+public:
+  NavigationGrid();
+  ~NavigationGrid();
+
+  /**
+   * @brief Builds the grid of the given points.
+   */
+  void build(const std::vector<Vector3>& points);
+
+  /**
+   * @brief Returns the index of the point closest to the given position, the
+   * first one when several are as close, -1 when there is no point.
+   */
+  int closest(const Vector3& position) const;
+
+  size_t size() const;
+
+private:
+  size_t _cellIndex(size_t x, size_t y, size_t z) const;
+
+private:
+  std::vector<Vector3> _points;
+  Vector3 _minimum;
+  float _cellSize;
+  std::array<size_t, 3> _resolution;
+  // Points of each cell, in the points of the cells from the offset of the
+  // cell to the offset of the next one
+  Uint32Array _cellOffsets;
+  Uint32Array _cellPoints;
+
+}; // end of class NavigationGrid
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_NAVIGATION_MESH_NAVIGATION_GRID_H
@@ -12,7 +12,9 @@ struct BABYLON_SHARED_EXPORT NavigationPolygon {
   IndicesArray vertexIds;
   Vector3 centroid;
   Vector3 normal;
-  std::vector<NavigationPolygon> neighbours;
+  // Indices of the neighbours in the polygons of the navigation mesh, and the
+  // edge shared with each of them, in the order of the polygon
+  Uint32Array neighbours;
   std::vector<Uint32Array> portals;
   bool hasGroup;
   size_t group;
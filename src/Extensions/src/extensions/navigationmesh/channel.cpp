@@ -41,9 +41,9 @@ std::vector<Vector3>& Channel::stringPull()
   // Init scan state
   size_t apexIndex = 0, leftIndex = 0, rightIndex = 0;
 
-  auto& portalApex  = portals[0].left;
-  auto& portalLeft  = portals[0].left;
-  auto& portalRight = portals[0].right;
+  auto portalApex  = portals[0].left;
+  auto portalLeft  = portals[0].left;
+  auto portalRight = portals[0].right;
 
   // Add start point.
   pts.emplace_back(portalApex);
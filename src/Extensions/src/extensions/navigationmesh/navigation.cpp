@@ -1,18 +1,122 @@
 #include <babylon/extensions/navigationmesh/navigation.h>
 
 #include <babylon/babylon_stl_util.h>
+#include <babylon/core/hash.h>
 #include <babylon/extensions/navigationmesh/channel.h>
 #include <babylon/math/plane.h>
 #include <babylon/math/vector3.h>
 #include <babylon/mesh/geometry.h>
 #include <babylon/mesh/mesh.h>
 #include <babylon/mesh/vertex_buffer.h>
+#include <babylon/tools/derived_asset_cache.h>
 
 #include <babylon/extensions/pathfinding/a_star_search.h>
 
 namespace BABYLON {
 namespace Extensions {
 
+namespace {
+
+const DerivedAssetCache::Step NavigationNodesStep{"navigationnodes", 3};
+
+// Position quantized to a number of decimals
+using QuantizedPosition = std::array<int64_t, 3>;
+
+struct QuantizedPositionHash {
+  size_t operator()(const QuantizedPosition& position) const
+  {
+    return static_cast<size_t>(Hash64(position.data(), sizeof(position)));
+  }
+}; // end of struct QuantizedPositionHash
+
+// Edge of a polygon, starting at a vertex of the polygon
+struct PolygonEdge {
+  uint64_t key;
+  uint32_t polygon;
+  uint32_t start;
+}; // end of struct PolygonEdge
+
+/**
+ * @brief Returns the key of an edge, the same in both directions.
+ */
+uint64_t edgeKey(uint32_t a, uint32_t b)
+{
+  return (a < b) ? (static_cast<uint64_t>(a) << 32) | b :
+                   (static_cast<uint64_t>(b) << 32) | a;
+}
+
+void appendNavigationMesh(Uint8Array& blob,
+                          const GroupedNavigationMesh& navigationMesh)
+{
+  DerivedAssetCache::Append(blob, navigationMesh.vertices, 3);
+  const auto graphCount = navigationMesh.groups.size();
+  DerivedAssetCache::Append(blob, static_cast<uint64_t>(graphCount));
+  for (const auto& graph : navigationMesh.groups) {
+    DerivedAssetCache::Append(blob, static_cast<uint64_t>(graph.size()));
+    for (const auto& group : graph) {
+      DerivedAssetCache::Append(blob, static_cast<uint64_t>(group.id));
+      DerivedAssetCache::Append(blob, group.neighbours);
+      DerivedAssetCache::Append(blob, group.vertexIds);
+      DerivedAssetCache::Append(blob, group.centroid.x);
+      DerivedAssetCache::Append(blob, group.centroid.y);
+      DerivedAssetCache::Append(blob, group.centroid.z);
+      DerivedAssetCache::Append(blob,
+                                static_cast<uint64_t>(group.portals.size()));
+      for (const auto& portal : group.portals) {
+        DerivedAssetCache::Append(blob, portal);
+      }
+      DerivedAssetCache::Append(blob, group.cost);
+    }
+  }
+}
+
+bool readNavigationMesh(const Uint8Array& blob,
+                        GroupedNavigationMesh& navigationMesh)
+{
+  size_t offset       = 0;
+  uint64_t graphCount = 0;
+  if (!DerivedAssetCache::Read(blob, offset, navigationMesh.vertices)
+      || !DerivedAssetCache::Read(blob, offset, graphCount)
+      || graphCount > blob.size()) {
+    return false;
+  }
+  navigationMesh.groups.resize(static_cast<size_t>(graphCount));
+  for (auto& graph : navigationMesh.groups) {
+    uint64_t groupCount = 0;
+    if (!DerivedAssetCache::Read(blob, offset, groupCount)
+        || groupCount > blob.size()) {
+      return false;
+    }
+    graph.groups.resize(static_cast<size_t>(groupCount));
+    for (auto& group : graph) {
+      uint64_t id = 0, portalCount = 0;
+      if (!DerivedAssetCache::Read(blob, offset, id)
+          || !DerivedAssetCache::Read(blob, offset, group.neighbours)
+          || !DerivedAssetCache::Read(blob, offset, group.vertexIds)
+          || !DerivedAssetCache::Read(blob, offset, group.centroid.x)
+          || !DerivedAssetCache::Read(blob, offset, group.centroid.y)
+          || !DerivedAssetCache::Read(blob, offset, group.centroid.z)
+          || !DerivedAssetCache::Read(blob, offset, portalCount)
+          || portalCount > blob.size()) {
+        return false;
+      }
+      group.id = static_cast<size_t>(id);
+      group.portals.resize(static_cast<size_t>(portalCount));
+      for (auto& portal : group.portals) {
+        if (!DerivedAssetCache::Read(blob, offset, portal)) {
+          return false;
+        }
+      }
+      if (!DerivedAssetCache::Read(blob, offset, group.cost)) {
+        return false;
+      }
+    }
+  }
+  return offset == blob.size();
+}
+
+} // end of anonymous namespace
+
 Navigation::Navigation()
 {
 }
@@ -23,35 +127,86 @@ Navigation::~Navigation()
 
 GroupedNavigationMesh Navigation::buildNodes(Mesh* mesh)
 {
-  auto navigationMesh = _buildNavigationMesh(mesh->geometry());
+  // The vertices are merged in copies of the data of the geometry, so that
+  // the geometry is the same whether the nodes are built or loaded
+  auto geometry = mesh->geometry();
+  return buildNodes(geometry->getVerticesData(VertexBuffer::PositionKind),
+                    geometry->getIndices(), DerivedAssetCache::Instance());
+}
+
+GroupedNavigationMesh Navigation::buildNodes(const Float32Array& positions,
+                                             const IndicesArray& indices)
+{
+  auto vertices    = positions;
+  auto faceIndices = indices;
+  _mergeVertices(vertices, faceIndices);
+
+  auto navigationMesh = _buildPolygons(vertices, faceIndices);
   return _groupNavMesh(navigationMesh);
 }
 
+GroupedNavigationMesh Navigation::buildNodes(const Float32Array& positions,
+                                             const IndicesArray& indices,
+                                             DerivedAssetCache& cache)
+{
+  // The nodes of large navigation meshes are cached
+  const auto inputSize
+    = positions.size() * sizeof(float) + indices.size() * sizeof(uint32_t);
+  if (!cache.caches(inputSize)) {
+    return buildNodes(positions, indices);
+  }
+
+  const auto inputHash
+    = Hash64(indices.data(), indices.size() * sizeof(uint32_t),
+             Hash64(positions.data(), positions.size() * sizeof(float)));
+  Uint8Array blob;
+  GroupedNavigationMesh nodes;
+  if (cache.load(NavigationNodesStep, inputHash, blob)
+      && readNavigationMesh(blob, nodes)) {
+    return nodes;
+  }
+
+  nodes = buildNodes(positions, indices);
+  blob.clear();
+  appendNavigationMesh(blob, nodes);
+  cache.store(NavigationNodesStep, inputHash, blob);
+  return nodes;
+}
+
 void Navigation::setZoneData(const std::string& zone,
                              const GroupedNavigationMesh& data)
 {
   _zoneNodes[zone] = data;
+
+  auto& zoneGrids = _zoneGrids[zone];
+  std::vector<Vector3> centroids, groupCentroids;
+  zoneGrids.nodeGroups.clear();
+  zoneGrids.groups.resize(data.groups.size());
+  for (size_t index = 0; index < data.groups.size(); ++index) {
+    groupCentroids.clear();
+    for (const auto& node : data.groups[index]) {
+      groupCentroids.emplace_back(node.centroid);
+      zoneGrids.nodeGroups.emplace_back(static_cast<uint32_t>(index));
+    }
+    centroids.insert(centroids.end(), groupCentroids.begin(),
+                     groupCentroids.end());
+    zoneGrids.groups[index].build(groupCentroids);
+  }
+  zoneGrids.nodes.build(centroids);
 }
 
 int Navigation::getGroup(const std::string& zone, const Vector3& position)
 {
-  int closestNodeGroup = -1;
-  if (!stl_util::contains(_zoneNodes, zone)) {
-    return closestNodeGroup;
+  if (!stl_util::contains(_zoneGrids, zone)) {
+    return -1;
   }
 
-  float measuredDistance = 0.f;
-  float distance         = std::numeric_limits<float>::infinity();
-  for (size_t index = 0; index < _zoneNodes[zone].groups.size(); ++index) {
-    for (auto& node : _zoneNodes[zone].groups[index]) {
-      measuredDistance = Vector3::DistanceSquared(node.centroid, position);
-      if (measuredDistance < distance) {
-        closestNodeGroup = static_cast<int>(index);
-        distance         = measuredDistance;
-      }
-    }
+  const auto& zoneGrids = _zoneGrids[zone];
+  const auto node       = zoneGrids.nodes.closest(position);
+  if (node == -1) {
+    return -1;
   }
-  return closestNodeGroup;
+  return static_cast<int>(zoneGrids.nodeGroups[static_cast<size_t>(node)]);
 }
 
 std::vector<Vector3> Navigation::findPath(const Vector3& startPosition,
@@ -59,28 +214,18 @@ std::vector<Vector3> Navigation::findPath(const Vector3& startPosition,
                                           const std::string& zone,
                                           std::size_t group)
 {
-  auto& allNodes = _zoneNodes[zone].groups[group];
-  auto& vertices = _zoneNodes[zone].vertices;
-
-  const auto getNodeIndex = [&allNodes](const Vector3& position) {
-    int nodeIndex          = -1;
-    float distance         = std::numeric_limits<float>::infinity();
-    int index              = 0;
-    float measuredDistance = 0.f;
-    for (auto& node : allNodes) {
-      measuredDistance = Vector3::DistanceSquared(node.centroid, position);
-      if (measuredDistance < distance) {
-        nodeIndex = index;
-        distance  = measuredDistance;
-      }
-      ++index;
-    }
-    return nodeIndex;
-  };
+  if (!stl_util::contains(_zoneNodes, zone)
+      || group >= _zoneNodes[zone].groups.size()) {
+    return std::vector<Vector3>();
+  }
+
+  auto& allNodes   = _zoneNodes[zone].groups[group];
+  auto& vertices   = _zoneNodes[zone].vertices;
+  const auto& grid = _zoneGrids[zone].groups[group];
 
   // If we can't find any node, just go straight to the target
-  auto closestNodeIndex  = getNodeIndex(startPosition);
-  auto farthestNodeIndex = getNodeIndex(targetPosition);
+  auto closestNodeIndex  = grid.closest(startPosition);
+  auto farthestNodeIndex = grid.closest(targetPosition);
   if ((closestNodeIndex == -1) || (farthestNodeIndex == -1)) {
     return std::vector<Vector3>();
   }
@@ -88,6 +233,9 @@ std::vector<Vector3> Navigation::findPath(const Vector3& startPosition,
   auto& closestNode  = allNodes[static_cast<std::size_t>(closestNodeIndex)];
   auto& farthestNode = allNodes[static_cast<std::size_t>(farthestNodeIndex)];
   auto pathIds       = AStarSearch(allNodes, closestNode, farthestNode);
+  if (pathIds.empty()) {
+    return std::vector<Vector3>();
+  }
 
   const auto getPortalFromTo
     = [](const NavigationGroup& a, const NavigationGroup& b) -> Uint32Array {
@@ -164,32 +312,6 @@ bool Navigation::_isVectorInPolygon(const Vector3& vector,
   return false;
 }
 
-void Navigation::_computeCentroids(Geometry* geometry)
-{
-  size_t f, fl;
-  std::vector<Vector3> centroids;
-  auto indices  = geometry->getIndices();
-  auto vertices = geometry->getVerticesData(VertexBuffer::PositionKind);
-  auto c        = Vector3::Zero();
-
-  for (f = 0, fl = indices.size(); f < fl; f += 3) {
-    auto p1 = getVectorFrom(vertices, indices[f]);
-    auto p2 = getVectorFrom(vertices, indices[f + 1]);
-    auto p3 = getVectorFrom(vertices, indices[f + 2]);
-
-    c.copyFromFloats(0, 0, 0);
-
-    c.addInPlace(p1);
-    c.addInPlace(p2);
-    c.addInPlace(p3);
-
-    c.scaleInPlace(1.f / 3.f);
-
-    centroids.emplace_back(c.copy());
-  }
-  geometry->centroids = centroids;
-}
-
 float Navigation::_roundNumber(float number, unsigned int decimals)
 {
   float f = std::pow(10.f, static_cast<float>(decimals));
@@ -214,101 +336,104 @@ void Navigation::_setPolygonCentroid(NavigationPolygon& polygon,
   polygon.centroid.copyFrom(sum);
 }
 
-Vector3 Navigation::getVectorFrom(const Float32Array& vertices, unsigned int id)
+Vector3 Navigation::getVectorFrom(span<const float> vertices, unsigned int id)
 {
   return Vector3(vertices[id * 3], vertices[id * 3 + 1], vertices[id * 3 + 2]);
 }
 
-std::vector<std::vector<NavigationPolygon>>
+std::vector<Uint32Array>
 Navigation::_buildPolygonGroups(NavigationMesh& navigationMesh)
 {
   auto& polygons = navigationMesh.polygons;
 
-  std::vector<std::vector<NavigationPolygon>> polygonGroups;
-  size_t groupCount = 0;
+  std::vector<Uint32Array> polygonGroups;
+  Uint32Array spreading;
 
-  std::function<void(NavigationPolygon & polygon)> spreadGroupId
-    = [&](NavigationPolygon& polygon) {
-        for (auto& neighbour : polygon.neighbours) {
+  for (size_t index = 0; index < polygons.size(); ++index) {
+    auto& polygon = polygons[index];
+    if (!polygon.hasGroup) {
+      polygon.group    = polygonGroups.size();
+      polygon.hasGroup = true;
+      polygonGroups.emplace_back();
+      // Spread it
+      spreading.emplace_back(static_cast<uint32_t>(index));
+      while (!spreading.empty()) {
+        const auto& current = polygons[spreading.back()];
+        spreading.pop_back();
+        for (auto neighbourIndex : current.neighbours) {
+          auto& neighbour = polygons[neighbourIndex];
           if (!neighbour.hasGroup) {
             neighbour.group    = polygon.group;
             neighbour.hasGroup = true;
-            spreadGroupId(neighbour);
+            spreading.emplace_back(neighbourIndex);
           }
         }
-      };
-
-  for (auto& polygon : polygons) {
-    if (!polygon.hasGroup) {
-      polygon.group    = groupCount++;
-      polygon.hasGroup = true;
-      // Spread it
-      spreadGroupId(polygon);
-    }
-
-    if (polygon.group >= polygonGroups.size()) {
-      polygonGroups.resize(polygon.group + 1);
+      }
     }
 
-    polygonGroups[polygon.group].emplace_back(polygon);
+    polygonGroups[polygon.group].emplace_back(static_cast<uint32_t>(index));
   }
 
   return polygonGroups;
 }
 
-Uint32Array Navigation::_array_intersect(const Uint32Array& a,
-                                         const Uint32Array& b)
+void Navigation::_buildPolygonNeighbours(NavigationMesh& navigationMesh)
 {
-  Uint32Array aList, bList;
-  aList.assign(a.begin(), a.end());
-  bList.assign(b.begin(), b.end());
-
-  Uint32Array intersection;
-  std::sort(aList.begin(), aList.end());
-  std::sort(bList.begin(), bList.end());
-  std::set_intersection(aList.begin(), aList.end(), bList.begin(), bList.end(),
-                        std::back_inserter(intersection));
-
-  return intersection;
-}
-
-void Navigation::_buildPolygonNeighbours(NavigationPolygon& polygon,
-                                         NavigationMesh& navigationMesh)
-{
-  polygon.neighbours.clear();
+  auto& polygons = navigationMesh.polygons;
 
-  // All other nodes that contain at least two of our vertices are our
-  // neighbours
-  for (auto& navMeshPolygon : navigationMesh.polygons) {
-    if (polygon.id == navMeshPolygon.id) {
-      continue;
+  // The polygons sharing an edge are neighbours, the edges being sorted to
+  // find the polygons sharing them
+  std::vector<PolygonEdge> edges;
+  edges.reserve(polygons.size() * 3);
+  for (size_t index = 0; index < polygons.size(); ++index) {
+    const auto& vertexIds = polygons[index].vertexIds;
+    for (size_t i = 0; i < vertexIds.size(); ++i) {
+      const auto next = vertexIds[(i + 1) % vertexIds.size()];
+      edges.emplace_back(PolygonEdge{
+        edgeKey(vertexIds[i], next),  // key
+        static_cast<uint32_t>(index), // polygon
+        static_cast<uint32_t>(i)      // start
+      });
     }
-
-    // Don't check polygons that are too far, since the intersection tests take
-    // a long time
-    if (Vector3::DistanceSquared(polygon.centroid, navMeshPolygon.centroid)
-        > 100 * 100) {
-      continue;
+  }
+  std::sort(edges.begin(), edges.end(),
+            [](const PolygonEdge& a, const PolygonEdge& b) {
+              return std::tie(a.key, a.polygon, a.start)
+                     < std::tie(b.key, b.polygon, b.start);
+            });
+
+  for (size_t first = 0, last = 0; first < edges.size(); first = last) {
+    while (last < edges.size() && edges[last].key == edges[first].key) {
+      ++last;
     }
-
-    auto matches
-      = _array_intersect(polygon.vertexIds, navMeshPolygon.vertexIds);
-
-    if (matches.size() >= 2) {
-      polygon.neighbours.emplace_back(navMeshPolygon);
+    for (size_t i = first; i < last; ++i) {
+      auto& polygon         = polygons[edges[i].polygon];
+      const auto& vertexIds = polygon.vertexIds;
+      for (size_t j = first; j < last; ++j) {
+        const auto neighbour = edges[j].polygon;
+        if (neighbour == edges[i].polygon
+            || stl_util::contains(polygon.neighbours, neighbour)) {
+          continue;
+        }
+        const auto start = edges[i].start;
+        polygon.neighbours.emplace_back(neighbour);
+        polygon.portals.emplace_back(Uint32Array{
+          vertexIds[start], vertexIds[(start + 1) % vertexIds.size()]});
+      }
     }
   }
 }
 
-NavigationMesh Navigation::_buildPolygonsFromGeometry(Geometry* geometry)
+NavigationMesh Navigation::_buildPolygons(const Float32Array& vertices,
+                                          const IndicesArray& indices)
 {
-  std::vector<NavigationPolygon> polygons;
-  auto vertices  = geometry->getVerticesData(VertexBuffer::PositionKind);
-  auto indices   = geometry->getIndices();
+  NavigationMesh navigationMesh{{}, vertices};
+  auto& polygons = navigationMesh.polygons;
+  polygons.reserve(indices.size() / 3);
   auto polygonId = 1u;
 
   // Convert the faces into a custom format that supports more than 3 vertices
-  for (size_t i = 0; i < indices.size(); i += 3) {
+  for (size_t i = 0; i + 2 < indices.size(); i += 3) {
 
     auto a      = getVectorFrom(vertices, indices[i]);
     auto b      = getVectorFrom(vertices, indices[i + 1]);
@@ -318,137 +443,72 @@ NavigationMesh Navigation::_buildPolygonsFromGeometry(Geometry* geometry)
     polygons.emplace_back(NavigationPolygon{
       polygonId++,                                  // id
       {indices[i], indices[i + 1], indices[i + 2]}, // vertexIds
-      geometry->centroids[i / 3],                   // centroid
+      Vector3::Zero(),                              // centroid
       normal,                                       // normal
       {},                                           // neighbours
       {},                                           // portals
       false,                                        // hasGroup
       0                                             // group
     });
+    _setPolygonCentroid(polygons.back(), navigationMesh);
   }
 
-  NavigationMesh navigationMesh{polygons, vertices};
-
   // Build a list of adjacent polygons
-  for (auto& polygon : polygons) {
-    _buildPolygonNeighbours(polygon, navigationMesh);
-  }
+  _buildPolygonNeighbours(navigationMesh);
 
   return navigationMesh;
 }
 
-NavigationMesh Navigation::_buildNavigationMesh(Geometry* geometry)
+size_t Navigation::_mergeVertices(Float32Array& vertices,
+                                  IndicesArray& indices)
 {
-  // Prepare geometry
-  _computeCentroids(geometry);
-  _mergeVertices(geometry);
-
-  return _buildPolygonsFromGeometry(geometry);
-}
-
-size_t Navigation::_mergeVertices(Geometry* geometry)
-{
-  // Hashmap for looking up vertices by position coordinates (and making sure
-  // they are unique)
-  std::unordered_map<std::string, size_t> verticesMap;
-  std::vector<Vector3> unique;
-  Uint32Array changes;
-
-  // number of decimal points, e.g. 4 for epsilon of 0.0001
-  auto precisionPoints = 4u;
-  auto precision       = static_cast<float>(std::pow(10, precisionPoints));
-  auto ind             = geometry->getIndices();
-  auto vert            = geometry->getVerticesData(VertexBuffer::PositionKind);
-
-  for (size_t i = 0, il = vert.size(); i < il; i += 3) {
-
-    Vector3 v(vert[i], vert[i + 1], vert[i + 2]);
-
-    std::stringstream ss;
-    ss << std::fixed;
-    ss.precision(precisionPoints);
-    ss << std::round(v.x * precision) << "_" << std::round(v.y * precision)
-       << "_" << std::round(v.z * precision);
-    std::string key = ss.str();
-
-    if (!stl_util::contains(verticesMap, key)) {
-      verticesMap[key] = i / 3;
-      unique.emplace_back(v);
-      changes[i / 3] = static_cast<std::uint32_t>(unique.size()) - 1;
-    }
-    else {
-      changes[i / 3] = changes[verticesMap[key]];
+  // Hashmap for looking up vertices by position coordinates quantized to 4
+  // decimals (and making sure they are unique)
+  const float precision    = 10000.f;
+  const size_t vertexCount = vertices.size() / 3;
+  std::unordered_map<QuantizedPosition, uint32_t, QuantizedPositionHash>
+    verticesMap;
+  verticesMap.reserve(vertexCount);
+  Float32Array unique;
+  unique.reserve(vertices.size());
+  Uint32Array changes(vertexCount);
+
+  for (size_t i = 0; i < vertexCount; ++i) {
+    const QuantizedPosition key{
+      {std::llround(vertices[i * 3] * precision),
+       std::llround(vertices[i * 3 + 1] * precision),
+       std::llround(vertices[i * 3 + 2] * precision)}};
+    const auto vertex = verticesMap.emplace(
+      key, static_cast<uint32_t>(unique.size() / 3));
+    if (vertex.second) {
+      unique.insert(unique.end(), vertices.begin() + i * 3,
+                    vertices.begin() + i * 3 + 3);
     }
+    changes[i] = vertex.first->second;
   }
 
   // if faces are completely degenerate after merging vertices, we
   // have to remove them from the geometry.
-  std::vector<size_t> faceIndicesToRemove;
-
-  for (size_t i = 0, il = ind.size(); i < il; i += 3) {
-
-    ind[i]     = changes[ind[i]];
-    ind[i + 1] = changes[ind[i + 1]];
-    ind[i + 2] = changes[ind[i + 2]];
-
-    Uint32Array indices{ind[i], ind[i + 1], ind[i + 2]};
-
-    // if any duplicate vertices are found in a Face3
-    // we have to remove the face as nothing can be saved
-    for (unsigned int n = 0; n < 3; ++n) {
-      if (indices[n] == indices[(n + 1) % 3]) {
-        faceIndicesToRemove.emplace_back(i);
-        break;
-      }
+  size_t indexCount = 0;
+  for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+    const auto a = changes[indices[i]];
+    const auto b = changes[indices[i + 1]];
+    const auto c = changes[indices[i + 2]];
+    if (a != b && b != c && c != a) {
+      indices[indexCount++] = a;
+      indices[indexCount++] = b;
+      indices[indexCount++] = c;
     }
   }
-
-  for (size_t i = faceIndicesToRemove.size(); i-- > 0;) {
-    stl_util::splice(ind, faceIndicesToRemove[i], 3);
-  }
+  indices.resize(indexCount);
 
   // Use unique set of vertices
-  size_t diff = vert.size() / 3 - unique.size();
-  vert.clear();
-  for (auto& vec : unique) {
-    stl_util::concat(vert, {vec.x, vec.y, vec.z});
-  }
-
-  geometry->setIndices(ind);
-  geometry->setVerticesData(VertexBuffer::PositionKind, vert);
+  size_t diff = vertexCount - unique.size() / 3;
+  vertices.swap(unique);
 
   return diff;
 }
 
-Uint32Array Navigation::_getSharedVerticesInOrder(NavigationPolygon& a,
-                                                  NavigationPolygon& b)
-{
-  auto& aList = a.vertexIds;
-  auto& bList = b.vertexIds;
-
-  auto sharedVertices = _array_intersect(aList, bList);
-
-  if (sharedVertices.size() < 2) {
-    return Uint32Array();
-  }
-
-  if (stl_util::contains(sharedVertices, aList[0])
-      && stl_util::contains(sharedVertices, aList.back())) {
-    // Vertices on both edges are bad, so shift them once to the left
-    std::vector<Uint32Array::value_type>(aList.begin() + 1, aList.end())
-      .swap(aList);
-  }
-
-  if (stl_util::contains(sharedVertices, bList[0])
-      && stl_util::contains(sharedVertices, bList.back())) {
-    // Vertices on both edges are bad, so shift them once to the left
-    std::vector<Uint32Array::value_type>(bList.begin() + 1, bList.end())
-      .swap(bList);
-  }
-
-  return _array_intersect(aList, bList);
-}
-
 GroupedNavigationMesh Navigation::_groupNavMesh(NavigationMesh& navigationMesh)
 {
   GroupedNavigationMesh groupedNavMesh;
@@ -460,48 +520,45 @@ GroupedNavigationMesh Navigation::_groupNavMesh(NavigationMesh& navigationMesh)
 
   groupedNavMesh.vertices = navigationMesh.vertices;
 
-  auto groups = _buildPolygonGroups(navigationMesh);
+  auto& polygons = navigationMesh.polygons;
+  auto groups    = _buildPolygonGroups(navigationMesh);
 
   groupedNavMesh.groups.clear();
 
-  const auto findPolygonIndex = [](const std::vector<NavigationPolygon>& group,
-                                   const NavigationPolygon& p) -> int {
-    return stl_util::index_of(group, p);
-  };
+  // Index of each polygon in its group
+  Uint32Array groupIndices(polygons.size());
+  for (auto& group : groups) {
+    for (size_t i = 0; i < group.size(); ++i) {
+      groupIndices[group[i]] = static_cast<uint32_t>(i);
+    }
+  }
 
   for (auto& group : groups) {
     NavigationGroupGraph newGroup;
+    newGroup.groups.reserve(group.size());
 
-    for (auto& p : group) {
+    for (auto index : group) {
+      auto& p = polygons[index];
       Uint32Array neighbours;
-      for (auto& n : p.neighbours) {
-        neighbours.emplace_back(findPolygonIndex(group, n));
-      }
-
-      // Build a portal list to each neighbour
-      std::vector<Uint32Array> portals;
-      for (auto& n : p.neighbours) {
-        portals.emplace_back(_getSharedVerticesInOrder(p, n));
+      for (auto n : p.neighbours) {
+        neighbours.emplace_back(groupIndices[n]);
       }
 
       p.centroid.x = _roundNumber(p.centroid.x, 2);
       p.centroid.y = _roundNumber(p.centroid.y, 2);
       p.centroid.z = _roundNumber(p.centroid.z, 2);
 
-      const auto polygonIndex = findPolygonIndex(group, p);
-      if (polygonIndex >= 0) {
-        newGroup.push(NavigationGroup{
-          static_cast<std::size_t>(polygonIndex), // id
-          neighbours,                             // neighbours
-          p.vertexIds,                            // vertexIds
-          p.centroid,                             // centroid
-          portals,                                // portals
-          1.f                                     // cost
-        });
-      }
+      newGroup.push(NavigationGroup{
+        groupIndices[index], // id
+        neighbours,          // neighbours
+        p.vertexIds,         // vertexIds
+        p.centroid,          // centroid
+        p.portals,           // portals
+        1.f                  // cost
+      });
     }
 
-    groupedNavMesh.groups.emplace_back(newGroup);
+    groupedNavMesh.groups.emplace_back(std::move(newGroup));
   }
 
   return groupedNavMesh;
@@ -0,0 +1,166 @@
+#include <babylon/extensions/navigationmesh/navigation_grid.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+NavigationGrid::NavigationGrid() : _cellSize{1.f}, _resolution{{1, 1, 1}}
+{
+}
+
+NavigationGrid::~NavigationGrid()
+{
+}
+
+void NavigationGrid::build(const std::vector<Vector3>& points)
+{
+  _points     = points;
+  _cellSize   = 1.f;
+  _resolution = {{1, 1, 1}};
+  _cellOffsets.clear();
+  _cellPoints.clear();
+  if (_points.empty()) {
+    return;
+  }
+
+  _minimum     = _points[0];
+  auto maximum = _points[0];
+  for (const auto& point : _points) {
+    _minimum.minimizeInPlace(point);
+    maximum.maximizeInPlace(point);
+  }
+
+  // Cubes of about one point each in the volume of the points, or in their
+  // area or along their length when they are flat or aligned
+  const auto extent = maximum.subtract(_minimum);
+  std::array<float, 3> extents{{extent.x, extent.y, extent.z}};
+  std::sort(extents.begin(), extents.end(), std::greater<float>());
+  const auto count = static_cast<float>(_points.size());
+  const auto cubic = std::cbrt(extents[0] * extents[1] * extents[2] / count);
+  const auto square = std::sqrt(extents[0] * extents[1] / count);
+  const auto linear = extents[0] / count;
+  if (cubic > 0.f && cubic <= extents[2]) {
+    _cellSize = cubic;
+  }
+  else if (square > 0.f && square <= extents[1]) {
+    _cellSize = square;
+  }
+  else if (linear > 0.f) {
+    _cellSize = linear;
+  }
+
+  const std::array<float, 3> axisExtents{{extent.x, extent.y, extent.z}};
+  for (size_t axis = 0; axis < 3; ++axis) {
+    _resolution[axis]
+      = static_cast<size_t>(std::floor(axisExtents[axis] / _cellSize)) + 1;
+  }
+
+  // Points sorted by cell
+  const auto cellOf = [this](const Vector3& point) {
+    const std::array<float, 3> offsets{{point.x - _minimum.x,
+                                        point.y - _minimum.y,
+                                        point.z - _minimum.z}};
+    std::array<size_t, 3> cell;
+    for (size_t axis = 0; axis < 3; ++axis) {
+      cell[axis] = std::min(static_cast<size_t>(offsets[axis] / _cellSize),
+                            _resolution[axis] - 1);
+    }
+    return _cellIndex(cell[0], cell[1], cell[2]);
+  };
+  _cellOffsets.assign(_resolution[0] * _resolution[1] * _resolution[2] + 1,
+                      0);
+  for (const auto& point : _points) {
+    ++_cellOffsets[cellOf(point) + 1];
+  }
+  for (size_t i = 1; i < _cellOffsets.size(); ++i) {
+    _cellOffsets[i] += _cellOffsets[i - 1];
+  }
+  auto cursors = _cellOffsets;
+  _cellPoints.resize(_points.size());
+  for (size_t i = 0; i < _points.size(); ++i) {
+    _cellPoints[cursors[cellOf(_points[i])]++] = static_cast<uint32_t>(i);
+  }
+}
+
+int NavigationGrid::closest(const Vector3& position) const
+{
+  if (_points.empty()) {
+    return -1;
+  }
+
+  // Cell of the position, clamped to the grid
+  const std::array<float, 3> offsets{{position.x - _minimum.x,
+                                      position.y - _minimum.y,
+                                      position.z - _minimum.z}};
+  std::array<int64_t, 3> cell, resolution;
+  int64_t lastRing = 0;
+  for (size_t axis = 0; axis < 3; ++axis) {
+    resolution[axis] = static_cast<int64_t>(_resolution[axis]);
+    cell[axis]       = std::max(
+      std::min(static_cast<int64_t>(std::floor(offsets[axis] / _cellSize)),
+               resolution[axis] - 1),
+      static_cast<int64_t>(0));
+    lastRing = std::max(
+      lastRing, std::max(cell[axis], resolution[axis] - 1 - cell[axis]));
+  }
+
+  // Rings of cells around the cell of the position, the points of a ring
+  // being farther than the ring minus one cell
+  int closestPoint      = -1;
+  float closestDistance = std::numeric_limits<float>::infinity();
+  for (int64_t ring = 0; ring <= lastRing; ++ring) {
+    const auto minimumDistance = static_cast<float>(ring - 1) * _cellSize;
+    if (ring > 1 && closestDistance < minimumDistance * minimumDistance) {
+      break;
+    }
+    for (int64_t dz = -ring; dz <= ring; ++dz) {
+      const auto z = cell[2] + dz;
+      if (z < 0 || z >= resolution[2]) {
+        continue;
+      }
+      for (int64_t dy = -ring; dy <= ring; ++dy) {
+        const auto y = cell[1] + dy;
+        if (y < 0 || y >= resolution[1]) {
+          continue;
+        }
+        // The inner cells belong to the previous rings
+        const bool onSide = (std::abs(dz) == ring || std::abs(dy) == ring);
+        const auto step   = (onSide || ring == 0) ? 1 : 2 * ring;
+        for (int64_t dx = -ring; dx <= ring; dx += step) {
+          const auto x = cell[0] + dx;
+          if (x < 0 || x >= resolution[0]) {
+            continue;
+          }
+          const auto index = _cellIndex(static_cast<size_t>(x),
+                                        static_cast<size_t>(y),
+                                        static_cast<size_t>(z));
+          for (auto i = _cellOffsets[index]; i < _cellOffsets[index + 1];
+               ++i) {
+            const auto point = static_cast<int>(_cellPoints[i]);
+            const auto distance
+              = Vector3::DistanceSquared(_points[_cellPoints[i]], position);
+            if (distance < closestDistance
+                || (distance == closestDistance && point < closestPoint)) {
+              closestPoint    = point;
+              closestDistance = distance;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return closestPoint;
+}
+
+size_t NavigationGrid::size() const
+{
+  return _points.size();
+}
+
+size_t NavigationGrid::_cellIndex(size_t x, size_t y, size_t z) const
+{
+  return (z * _resolution[1] + y) * _resolution[0] + x;
+}
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
@@ -0,0 +1,181 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/core/filesystem.h>
+#include <babylon/extensions/navigationmesh/navigation.h>
+#include <babylon/extensions/navigationmesh/navigation_grid.h>
+#include <babylon/mesh/vertex_data.h>
+#include <babylon/mesh/vertex_data_options.h>
+#include <babylon/tools/derived_asset_cache.h>
+
+namespace {
+
+/**
+ * @brief Returns a 10 x 10 ground of 1 x 1 cells whose faces have their own
+ * vertices, offset along the x axis.
+ */
+void appendGround(BABYLON::Float32Array& positions,
+                  BABYLON::IndicesArray& indices, float offset)
+{
+  using namespace BABYLON;
+  GroundOptions options(10);
+  options.width  = 10.f;
+  options.height = 10.f;
+  auto ground    = VertexData::CreateGround(options);
+  for (auto index : ground->indices) {
+    indices.emplace_back(static_cast<uint32_t>(positions.size() / 3));
+    positions.insert(positions.end(),
+                     {ground->positions[index * 3] + offset,
+                      ground->positions[index * 3 + 1],
+                      ground->positions[index * 3 + 2]});
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestNavigation, NavigationGrid)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  // Points in a volume, and flat points, looked up from inside and from
+  // outside of the grid
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> coordinate(-10.f, 10.f);
+  for (bool flat : {false, true}) {
+    std::vector<Vector3> points;
+    for (size_t i = 0; i < 1000; ++i) {
+      points.emplace_back(coordinate(generator),
+                          flat ? 0.f : coordinate(generator),
+                          coordinate(generator));
+    }
+    NavigationGrid grid;
+    grid.build(points);
+    EXPECT_EQ(grid.size(), points.size());
+    for (size_t i = 0; i < 200; ++i) {
+      const Vector3 position(coordinate(generator) * 1.5f,
+                             coordinate(generator) * 1.5f,
+                             coordinate(generator) * 1.5f);
+      int expected   = -1;
+      float distance = std::numeric_limits<float>::infinity();
+      for (size_t j = 0; j < points.size(); ++j) {
+        if (Vector3::DistanceSquared(points[j], position) < distance) {
+          expected = static_cast<int>(j);
+          distance = Vector3::DistanceSquared(points[j], position);
+        }
+      }
+      EXPECT_EQ(grid.closest(position), expected);
+    }
+  }
+
+  NavigationGrid empty;
+  empty.build({});
+  EXPECT_EQ(empty.closest(Vector3::Zero()), -1);
+}
+
+TEST(TestNavigation, BuildNodes)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+  Float32Array positions;
+  IndicesArray indices;
+  appendGround(positions, indices, 0.f);
+  // A degenerate face is removed
+  indices.insert(indices.end(), {0, 0, 1});
+
+  Navigation navigation;
+  const auto nodes = navigation.buildNodes(positions, indices);
+  EXPECT_EQ(nodes.vertices.size(), 11u * 11u * 3u);
+  ASSERT_EQ(nodes.groups.size(), 1u);
+  const auto& group = nodes.groups[0];
+  ASSERT_EQ(group.size(), 200u);
+
+  // 280 inner edges, each portal being an edge of both nodes
+  size_t neighbourCount = 0;
+  for (size_t i = 0; i < group.size(); ++i) {
+    const auto& node = group[i];
+    EXPECT_EQ(node.id, i);
+    ASSERT_EQ(node.portals.size(), node.neighbours.size());
+    for (size_t j = 0; j < node.neighbours.size(); ++j) {
+      const auto& neighbour = group[node.neighbours[j]];
+      ASSERT_EQ(node.portals[j].size(), 2u);
+      for (auto vertex : node.portals[j]) {
+        EXPECT_THAT(node.vertexIds, ::testing::Contains(vertex));
+        EXPECT_THAT(neighbour.vertexIds, ::testing::Contains(vertex));
+      }
+      EXPECT_THAT(neighbour.neighbours, ::testing::Contains(i));
+    }
+    neighbourCount += node.neighbours.size();
+  }
+  EXPECT_EQ(neighbourCount, 2u * 280u);
+}
+
+TEST(TestNavigation, BuildCachedNodes)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+  Float32Array positions;
+  IndicesArray indices;
+  appendGround(positions, indices, 0.f);
+  const auto sourcePositions = positions;
+  const auto sourceIndices   = indices;
+
+  // The cache directory is new to each run, so that no blob of a previous
+  // run is loaded
+  std::ostringstream directory;
+  directory << "navigation_cache_"
+            << std::chrono::system_clock::now().time_since_epoch().count();
+  DerivedAssetCache cache;
+  cache.setDirectory(
+    Filesystem::joinPath(::testing::TempDir(), directory.str()));
+  cache.setMinimumInputSize(0);
+
+  // The nodes built by a cold call and loaded by a warm call are the same,
+  // and the source geometry is left unchanged by both
+  Navigation navigation;
+  const auto expected = navigation.buildNodes(positions, indices);
+  const auto cold     = navigation.buildNodes(positions, indices, cache);
+  EXPECT_EQ(cache.misses(), 1u);
+  EXPECT_EQ(positions, sourcePositions);
+  EXPECT_EQ(indices, sourceIndices);
+  const auto warm = navigation.buildNodes(positions, indices, cache);
+  EXPECT_EQ(cache.hits(), 1u);
+  EXPECT_EQ(positions, sourcePositions);
+  EXPECT_EQ(indices, sourceIndices);
+
+  for (const auto& nodes : {cold, warm}) {
+    EXPECT_EQ(nodes.vertices, expected.vertices);
+    ASSERT_EQ(nodes.groups.size(), expected.groups.size());
+    for (size_t i = 0; i < nodes.groups.size(); ++i) {
+      EXPECT_EQ(nodes.groups[i].groups, expected.groups[i].groups);
+    }
+  }
+}
+
+TEST(TestNavigation, FindPath)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+  Float32Array positions;
+  IndicesArray indices;
+  appendGround(positions, indices, 0.f);
+  appendGround(positions, indices, 20.f);
+
+  Navigation navigation;
+  const auto nodes = navigation.buildNodes(positions, indices);
+  ASSERT_EQ(nodes.groups.size(), 2u);
+  navigation.setZoneData("level", nodes);
+  EXPECT_EQ(navigation.getGroup("level", Vector3(-4.f, 0.f, 3.f)), 0);
+  EXPECT_EQ(navigation.getGroup("level", Vector3(24.f, 1.f, -3.f)), 1);
+  EXPECT_EQ(navigation.getGroup("unknown", Vector3::Zero()), -1);
+
+  // The path follows the diagonal of the ground to the target
+  const Vector3 start(-4.5f, 0.f, -4.5f), target(4.5f, 0.f, 4.5f);
+  const auto path = navigation.findPath(start, target, "level", 0);
+  ASSERT_FALSE(path.empty());
+  EXPECT_TRUE(path.back().equals(target));
+  for (const auto& point : path) {
+    EXPECT_FLOAT_EQ(point.x, point.z);
+  }
+  EXPECT_TRUE(navigation.findPath(start, target, "level", 2).empty());
+}
@@ -2,222 +2,113 @@
 #define BABYLON_LOADING_PLUGINS_GLTF_GLTF_FILE_LOADER_H
 
 #include <babylon/babylon_global.h>
-#include <babylon/loading/iscene_loader_plugin_async.h>
-#include <babylon/loading/plugins/gltf/gltf_file_loader_enums.h>
+#include <babylon/core/span.h>
+#include <babylon/core/structs.h>
+#include <babylon/loading/iscene_loader_plugin.h>
 #include <babylon/loading/plugins/gltf/gltf_file_loader_interfaces.h>
 
 namespace BABYLON {
 
-class Tokenizer;
+class WorkerPool;
 
 /**
- * @brief glTF File Loader Plugin.
+ * @brief glTF 2.0 File Loader Plugin, loads .gltf files and binary .glb files.
+ *
+ * The buffers are memory mapped (or point into the binary chunk of a .glb
+ * file) and the tightly packed float accessors are read in place. The other
+ * accessors, which need a conversion, and the embedded images are decoded on
+ * the shared worker pool before the scene objects are created.
  */
-class BABYLON_SHARED_EXPORT GLTFFileLoader : public ISceneLoaderPluginAsync {
+class BABYLON_SHARED_EXPORT GLTFFileLoader : public ISceneLoaderPlugin {
 
 public:
   /**
-   * Static members
+   * @brief Constructor.
+   * @param workerCount The number of worker threads of a pool of its own
+   * decoding the accessors and the images, 0 uses the shared worker pool.
    */
-  static const bool MakeYUP;
-  static const bool HomogeneousCoordinates;
-
-  static const std::vector<std::string> glTFTransforms;
-  static const std::vector<std::string> babylonTransforms;
-
-  static const std::vector<std::string> glTFAnimationPaths;
-  static const std::vector<std::string> babylonAnimationPaths;
-
-public:
-  GLTFFileLoader();
+  GLTFFileLoader(size_t workerCount = 0);
   virtual ~GLTFFileLoader();
 
-  /**
-   * Import meshes
-   */
-  bool importMeshAsync(
-    const std::vector<std::string>& meshesNames, Scene* scene,
-    const std::string& data, const std::string& rootUrl,
-    const std::function<void(std::vector<AbstractMesh*>& meshes,
-                             std::vector<ParticleSystem*>& particleSystems,
-                             std::vector<Skeleton*>& skeletons)>& onSuccess,
-    const std::function<void()>& onError) override;
-  bool loadAsync(Scene* scene, const std::string& data,
-                 const std::string& rootUrl,
-                 const std::function<void()>& onsuccess,
-                 const std::function<void()>& onerror) override;
-
-  /**
-   * Parse
-   */
-  static void parseBuffers(const Json::object& parsedBuffers,
-                           IGLTFRuntime& gltfRuntime);
-  static void parseShaders(const Json::object& parsedShaders,
-                           IGLTFRuntime& gltfRuntime);
-  static void parseObject(const Json::object& parsedObjects,
-                          const std::string& runtimeProperty,
-                          IGLTFRuntime& gltfRuntime);
-
-  /**
-   * Utils
-   */
-  void normalizeUVs(Float32Array& buffer) const;
-  std::string replaceInString(const std::string& str,
-                              const std::string& searchValue,
-                              const std::string& replaceValue) const;
-  std::string
-  getAttribute(const IGLTFTechniqueParameter& attributeParameter) const;
-
-  /**
-   * Returns the animation path (glTF -> Babylon)
-   */
-  std::string getAnimationPath(const std::string& path) const;
-
-  /**
-   * Loads and creates animations
-   */
-  void loadAnimations(const IGLTFRuntime& gltfRuntime) const;
-
-  /**
-   * Returns the bones transformation matrix
-   */
-  Matrix configureBoneTransformation(const IGLTFNode& node) const;
-
-  /**
-   * Returns the parent bone
-   */
-  Bone* getParentBone(const IGLTFRuntime& gltfRuntime, const IGLTFSkins& skins,
-                      const std::string& jointName,
-                      Skeleton* newSkeleton) const;
-
-  /**
-   * Returns the appropriate root node
-   */
-  Bone* getNodeToRoot(const std::vector<INodeToRoot> nodesToRoot,
-                      const std::string& id) const;
-
-  /**
-   * Returns the node with the joint name
-   */
-  IJointNode getJointNode(const IGLTFRuntime& gltfRuntime,
-                          const std::string& jointName) const;
-
-  /**
-   * Checks if a nodes is in joints
-   */
-  bool nodeIsInJoints(const IGLTFSkins& skins, const std::string& id) const;
-
-  /**
-   * Fills the nodes to root for bones and builds hierarchy
-   */
-  void getNodesToRoot(const IGLTFRuntime& gltfRuntime, Skeleton* newSkeleton,
-                      const IGLTFSkins& skins,
-                      std::vector<INodeToRoot>& nodesToRoot) const;
-
-  void printMat(const Float32Array& m) const;
-
-  /**
-   * Imports a skeleton
-   */
-  Skeleton* importSkeleton(const IGLTFRuntime& gltfRuntime,
-                           const IGLTFSkins& skins, Mesh* mesh,
-                           Skeleton* newSkeleton) const;
-
-  /**
-   * Imports a mesh and its geometries
-   */
-  Mesh* importMesh(const IGLTFRuntime& gltfRuntime, const IGLTFNode& node,
-                   std::vector<std::string> meshes, const std::string& id,
-                   Mesh* newMesh) const;
+  GLTFFileLoader(const GLTFFileLoader&) = delete;
+  GLTFFileLoader& operator=(const GLTFFileLoader&) = delete;
 
   /**
-   * Configure node transformation from position, rotation and scaling
+   * @brief Imports the nodes named in meshesNames with their children, all the
+   * nodes of the scene when meshesNames is empty.
    */
-  void configureNode(Mesh* newNode, const Vector3& position,
-                     const Quaternion& rotation, const Vector3& scaling) const;
+  bool importMesh(const std::vector<std::string>& meshesNames, Scene* scene,
+                  const std::string& data, const std::string& rootUrl,
+                  std::vector<AbstractMesh*>& meshes,
+                  std::vector<ParticleSystem*>& particleSystems,
+                  std::vector<Skeleton*>& skeletons) override;
+  bool load(Scene* scene, const std::string& data,
+            const std::string& rootUrl) override;
 
-  /**
-   * Configures node from transformation matrix
-   */
-  void configureNodeFromMatrix(Mesh* newNode, const IGLTFNode& node,
-                               Node* parent) const;
+  size_t workerCount() const;
 
   /**
-   * Imports a node
+   * Frames per second of the created animations
    */
-  Node* importNode(const IGLTFRuntime& gltfRuntime, const IGLTFNode& node,
-                   const std::string& id) const;
-
-  /**
-   * Traverses nodes and creates them
-   */
-  void traverseNodes(const IGLTFRuntime& gltfRuntime, const std::string& id,
-                     Node* parent, bool meshIncluded = false) const;
+  static constexpr float AnimationFPS = 60.f;
 
+private:
   /**
-   * do stuff after buffers, shaders are loaded (e.g. hook up materials, load
-   * animations, etc.)
+   * @brief Parses the asset and loads its buffers.
+   * @returns The error message, empty on success.
    */
-  void postLoad(const IGLTFRuntime& gltfRuntime) const;
+  std::string _parse(const std::string& data, IGLTFRuntime& gltfRuntime);
 
   /**
-   * onBind shaderrs callback to set uniforms and matrices
+   * @brief Decodes, on the worker threads, the accessors used by the nodes to
+   * import and the embedded images.
+   * @returns The error message, empty on success.
    */
-  void onBindShaderMaterial(Mesh* mesh, const IGLTFRuntime& gltfRuntime,
-                            const std::string& unTreatedUniforms,
-                            ShaderMaterial* shaderMaterial,
-                            const IGLTFTechnique& technique,
-                            const IGLTFMaterial& material) const;
+  std::string _decode(const IGLTFRuntime& gltfRuntime,
+                      const std::vector<int>& nodes);
 
   /**
-   * Prepare uniforms to send the only one time
-   * Loads the appropriate textures
+   * @brief Creates the scene objects of the decoded asset.
    */
-  void prepareShaderMaterialUniforms(
-    const IGLTFRuntime& gltfRuntime, ShaderMaterial* shaderMaterial,
-    const IGLTFTechnique& technique, const IGLTFMaterial& material,
-    const std::string& unTreatedUniforms) const;
+  void _createScene(IGLTFRuntime& gltfRuntime, const std::vector<int>& nodes,
+                    std::vector<AbstractMesh*>& meshes,
+                    std::vector<Skeleton*>& skeletons);
 
-  /**
-   * Shader compilation failed
-   */
-  void onShaderCompileError(const IGLTFProgram& program,
-                            ShaderMaterial* shaderMaterial) const;
+  void _clear();
 
-  /**
-   * Shader compilation success
-   */
-  void onShaderCompileSuccess(const IGLTFRuntime& gltfRuntime,
-                              ShaderMaterial* shaderMaterial,
-                              const IGLTFTechnique& technique,
-                              const IGLTFMaterial& material,
-                              const std::string& unTreatedUniforms) const;
+  span<const float> _getAccessor(int accessor) const;
+  Matrix _getNodeMatrix(const IGLTFNode& node) const;
+  const Matrix& _getWorldMatrix(const IGLTFRuntime& gltfRuntime, int node);
 
-  /**
-   * Returns the appropriate uniform if already handled by babylon
-   */
-  std::string parseShaderUniforms(const Tokenizer& tokenizer,
-                                  const IGLTFTechnique& technique,
-                                  const std::string& unTreatedUniforms) const;
-
-  /**
-   * All shaders loaded. Create materials one by one
-   */
-  void importMaterials(const IGLTFRuntime& gltfRuntime);
+  Mesh* _loadNode(IGLTFRuntime& gltfRuntime, int nodeIndex, Mesh* parent,
+                  std::vector<AbstractMesh*>& meshes);
+  void _loadPrimitive(IGLTFRuntime& gltfRuntime, const IGLTFNode& node,
+                      const IGLTFMeshPrimitive& primitive, Mesh* babylonMesh);
+  void _loadMorphTargets(const IGLTFNode& node, const IGLTFMesh& mesh,
+                         const IGLTFMeshPrimitive& primitive,
+                         Mesh* babylonMesh);
+  Material* _loadMaterial(IGLTFRuntime& gltfRuntime, int material);
+  BaseTexture* _loadTexture(IGLTFRuntime& gltfRuntime,
+                            const IGLTFTextureInfo& textureInfo);
+  Skeleton* _loadSkin(IGLTFRuntime& gltfRuntime, int skin);
+  Bone* _loadBone(IGLTFRuntime& gltfRuntime, IGLTFSkin& skin, int joint,
+                  const std::vector<Matrix>& bindMatrices,
+                  std::vector<Bone*>& bones);
+  void _loadAnimations(IGLTFRuntime& gltfRuntime);
 
 private:
-  void _loadShadersAsync(const IGLTFRuntime& gltfRuntime,
-                         const std::function<void()>& onload);
-  void _loadBuffersAsync(const IGLTFRuntime& gltfRuntime,
-                         const std::function<void()>& onload);
-  // Creates nodes before loading buffers and shaders
-  void _createNodes(const IGLTFRuntime& gltfRuntime) const;
-
-public:
-  /**
-   * Public members
-   */
-  std::string extensions = ".gltf";
+  std::shared_ptr<WorkerPool> _pool;
+  // Per load state, accessor index -> elements
+  std::vector<span<const float>> _accessors;
+  std::vector<Float32Array> _decodedAccessors;
+  std::vector<IndicesArray> _indices;
+  // Image index -> decoded embedded image
+  std::vector<Image> _images;
+  // Node index -> world matrix, relative to the root of the asset
+  std::vector<Matrix> _worldMatrices;
+  std::vector<bool> _worldMatricesComputed;
+  Mesh* _rootMesh;
+  Material* _defaultMaterial;
 
 }; // end of class GLTFFileLoader
 
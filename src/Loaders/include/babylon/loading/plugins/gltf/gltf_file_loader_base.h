@@ -7,38 +7,86 @@
 namespace BABYLON {
 
 /**
- * @brief Implementation of the base glTF spec.
+ * @brief Implementation of the base glTF 2.0 spec: parsing of the JSON and
+ * binary (.glb) containers, loading of the buffers and reading of the
+ * accessors. These functions do not touch the scene, the accessors can be read
+ * from any thread once the buffers are loaded.
  */
 struct BABYLON_SHARED_EXPORT GLTFFileLoaderBase {
 
-  static IGLTFRuntime CreateRuntime(const picojson::value& parsedData,
-                                    Scene* scene, const std::string& rootUrl);
-
-  static void LoadBufferAsync(
-    const IGLTFRuntime& gltfRuntime, const std::string& id,
-    const std::function<void(const std::string& buffer)>& onSuccess,
-    std::function<void()>& onError);
-
-  static void LoadTextureBufferAsync(
-    const IGLTFRuntime& gltfRuntime, const std::string& id,
-    const std::function<void(const std::string& buffer)>& onSuccess,
-    const std::function<void()>& onError);
-
-  static void
-  CreateTextureAsync(const IGLTFRuntime& gltfRuntime, const std::string& id,
-                     const std::string& buffer,
-                     const std::function<void(Texture* texture)>& onSuccess,
-                     std::function<void()>& onError);
-
-  static void LoadShaderStringAsync(
-    const IGLTFRuntime& gltfRuntime, const std::string& id,
-    const std::function<void(const std::string& shaderString)>& onSuccess,
-    const std::function<void()>& onError);
-
-  static void
-  LoadMaterialAsync(const IGLTFRuntime& gltfRuntime, const std::string& id,
-                    const std::function<void(Material* material)>& onSuccess,
-                    const std::function<void()>& onError);
+  /**
+   * @brief Magic number ("glTF") and chunk types of a binary glTF file.
+   */
+  static constexpr uint32_t BinaryMagic     = 0x46546C67;
+  static constexpr uint32_t BinaryChunkJSON = 0x4E4F534A;
+  static constexpr uint32_t BinaryChunkBIN  = 0x004E4942;
+
+  /**
+   * @brief Returns whether the data starts with the binary glTF magic number.
+   */
+  static bool IsBinary(const uint8_t* data, size_t size);
+
+  /**
+   * @brief Reads the header and the chunks of a binary glTF file, the chunks
+   * point into the data.
+   * @returns Whether the file is valid, error is set otherwise.
+   */
+  static bool ParseBinary(const uint8_t* data, size_t size, const char*& json,
+                          size_t& jsonLength, const uint8_t*& binaryChunk,
+                          size_t& binaryChunkLength, std::string& error);
+
+  /**
+   * @brief Parses the glTF objects of the asset into the runtime.
+   * @returns Whether the asset is a valid glTF 2.0 asset, error is set
+   * otherwise.
+   */
+  static bool CreateRuntime(const Json::value& parsedData,
+                            IGLTFRuntime& gltfRuntime, std::string& error);
+
+  /**
+   * @brief Loads the data of the buffers: external files are memory mapped,
+   * base64 uris are decoded and the buffer without uri of a binary file uses
+   * its binary chunk.
+   * @returns Whether all the buffers could be loaded, error is set otherwise.
+   */
+  static bool LoadBuffers(IGLTFRuntime& gltfRuntime, std::string& error);
+
+  /**
+   * @brief Returns the data of a buffer view, nullptr if it is not loaded or
+   * out of the bounds of its buffer.
+   */
+  static const uint8_t* GetBufferViewData(const IGLTFRuntime& gltfRuntime,
+                                          int bufferView);
+
+  /**
+   * @brief Returns the elements of an accessor, in place in the buffer.
+   * @returns Whether the elements are in the bounds of the buffer view, false
+   * for accessors without buffer view.
+   */
+  static bool GetAccessorView(const IGLTFRuntime& gltfRuntime,
+                              const IGLTFAccessor& accessor,
+                              IGLTFAccessorView& view);
+
+  /**
+   * @brief Returns whether the elements of the view can be copied as they
+   * are into a vertex buffer: tightly packed floats.
+   */
+  static bool IsPackedFloat(const IGLTFAccessorView& view);
+
+  /**
+   * @brief Reads the elements of an accessor as floats, normalized integers
+   * are converted to [0, 1] or [-1, 1] and the sparse values are applied.
+   * @returns Whether the accessor could be read.
+   */
+  static bool ReadAccessor(const IGLTFRuntime& gltfRuntime,
+                           const IGLTFAccessor& accessor, Float32Array& data);
+
+  /**
+   * @brief Reads the elements of a scalar unsigned integer accessor.
+   * @returns Whether the accessor could be read.
+   */
+  static bool ReadIndices(const IGLTFRuntime& gltfRuntime,
+                          const IGLTFAccessor& accessor, IndicesArray& indices);
 
 }; // end of struct GLTFFileLoaderBase
 
@@ -2,290 +2,225 @@
 #define BABYLON_LOADING_PLUGINS_GLTF_GLTF_FILE_LOADER_INTERFACES_H
 
 #include <babylon/babylon_global.h>
+#include <babylon/core/mapped_file.h>
 #include <babylon/loading/plugins/gltf/gltf_file_loader_enums.h>
+#include <babylon/math/matrix.h>
 
 namespace BABYLON {
 
 /**
- * Interfaces
+ * Interfaces, indices into the runtime arrays are -1 when not defined
  */
 struct IGLTFChildRootProperty {
   std::string name;
 };
 
+struct IGLTFAccessorSparseIndices {
+  int bufferView               = -1;
+  size_t byteOffset            = 0;
+  EComponentType componentType = EComponentType::UNSIGNED_INT;
+};
+
+struct IGLTFAccessorSparseValues {
+  int bufferView    = -1;
+  size_t byteOffset = 0;
+};
+
+struct IGLTFAccessorSparse {
+  size_t count = 0;
+  IGLTFAccessorSparseIndices indices;
+  IGLTFAccessorSparseValues values;
+};
+
 struct IGLTFAccessor : IGLTFChildRootProperty {
-  std::string bufferView;
-  unsigned int byteOffset;
-  unsigned int byteStride;
-  size_t count;
+  int bufferView               = -1;
+  size_t byteOffset            = 0;
+  EComponentType componentType = EComponentType::FLOAT;
+  bool normalized              = false;
+  size_t count                 = 0;
   std::string type;
-  std::string componentType;
   Float32Array max;
   Float32Array min;
-  std::string name;
+  IGLTFAccessorSparse sparse;
 };
 
 struct IGLTFBufferView : IGLTFChildRootProperty {
-  std::string buffer;
-  unsigned int byteOffset;
-  unsigned int byteLength;
-  unsigned int target;
+  int buffer        = -1;
+  size_t byteOffset = 0;
+  size_t byteLength = 0;
+  // 0 when the elements are tightly packed
+  size_t byteStride = 0;
 };
 
 struct IGLTFBuffer : IGLTFChildRootProperty {
   std::string uri;
-  size_t byteLength;
-  std::string type;
-};
-
-struct IGLTFShader : IGLTFChildRootProperty {
-  std::string uri;
-  unsigned int type;
-};
-
-struct IGLTFProgram : IGLTFChildRootProperty {
-  std::vector<std::string> attributes;
-  std::string fragmentShader;
-  std::string vertexShader;
-};
-
-struct IGLTFTechniqueParameter {
-  EParameterType type;
-  size_t count;
-  std::string semantic;
-  std::string node;
-  std::string value;
-  std::string source;
-  std::string babylonValue;
-};
-
-struct IGLTFTechniqueCommonProfile {
-  std::string lightingModel;
-  std::string texcoordBindings;
-  std::vector<std::string> parameters;
-};
-
-struct IGLTFTechniqueStatesFunctions {
-  Float32Array blendColor;
-  Float32Array blendEquationSeparate;
-  Float32Array blendFuncSeparate;
-  std::vector<bool> colorMask;
-  Float32Array cullFace;
+  size_t byteLength = 0;
+  // Babylon.js values (optimize)
+  MappedFile mappedFile;
+  Uint8Array decodedData;
+  const uint8_t* data = nullptr;
 };
 
-struct IGLTFTechniqueStates {
-  Uint32Array enable;
-  IGLTFTechniqueStatesFunctions functions;
+struct IGLTFTextureInfo {
+  int index             = -1;
+  unsigned int texCoord = 0;
+  // Normal textures only
+  float scale = 1.f;
+  // Occlusion textures only
+  float strength = 1.f;
 };
 
-struct IGLTFTechnique : IGLTFChildRootProperty {
-  std::string parameters;
-  std::string program;
-  std::string attributes;
-  std::string uniforms;
-  IGLTFTechniqueStates states;
+struct IGLTFMaterialPbrMetallicRoughness {
+  Float32Array baseColorFactor{1.f, 1.f, 1.f, 1.f};
+  IGLTFTextureInfo baseColorTexture;
+  float metallicFactor  = 1.f;
+  float roughnessFactor = 1.f;
+  IGLTFTextureInfo metallicRoughnessTexture;
 };
 
 struct IGLTFMaterial : IGLTFChildRootProperty {
-  std::string technique;
-  std::vector<std::string> values;
+  IGLTFMaterialPbrMetallicRoughness pbrMetallicRoughness;
+  IGLTFTextureInfo normalTexture;
+  IGLTFTextureInfo occlusionTexture;
+  IGLTFTextureInfo emissiveTexture;
+  Float32Array emissiveFactor{0.f, 0.f, 0.f};
+  EMaterialAlphaMode alphaMode = EMaterialAlphaMode::OPAQUE;
+  float alphaCutoff            = 0.5f;
+  bool doubleSided             = false;
+  // Babylon.js values (optimize)
+  Material* babylonMaterial = nullptr;
 };
 
 struct IGLTFMeshPrimitive {
-  std::vector<std::string> attributes;
-  std::string indices;
-  std::string material;
-  unsigned int mode;
+  // Semantic -> accessor
+  std::unordered_map<std::string, int> attributes;
+  int indices             = -1;
+  int material            = -1;
+  EMeshPrimitiveMode mode = EMeshPrimitiveMode::TRIANGLES;
+  std::vector<std::unordered_map<std::string, int>> targets;
 };
 
 struct IGLTFMesh : IGLTFChildRootProperty {
   std::vector<IGLTFMeshPrimitive> primitives;
+  Float32Array weights;
 };
 
 struct IGLTFImage : IGLTFChildRootProperty {
   std::string uri;
+  int bufferView = -1;
+  std::string mimeType;
 };
 
 struct IGLTFSampler : IGLTFChildRootProperty {
-  unsigned int magFilter;
-  unsigned int minFilter;
-  unsigned int wrapS;
-  unsigned int wrapT;
+  ETextureFilterType magFilter = ETextureFilterType::LINEAR;
+  ETextureFilterType minFilter = ETextureFilterType::LINEAR_MIPMAP_LINEAR;
+  ETextureWrapMode wrapS       = ETextureWrapMode::REPEAT;
+  ETextureWrapMode wrapT       = ETextureWrapMode::REPEAT;
 };
 
 struct IGLTFTexture : IGLTFChildRootProperty {
-  std::string sampler;
-  std::string source;
-  unsigned int format;
-  unsigned int internalFormat;
-  unsigned int target;
-  unsigned int type;
+  int sampler = -1;
+  int source  = -1;
   // Babylon.js values (optimize)
-  Texture* babylonTexture;
-};
-
-struct IGLTFAmbienLight {
-  Float32Array color;
-};
-
-struct IGLTFDirectionalLight {
-  Float32Array color;
-};
-
-struct IGLTFPointLight {
-  Float32Array color;
-  float constantAttenuation;
-  float linearAttenuation;
-  float quadraticAttenuation;
-};
-
-struct IGLTFSpotLight {
-  Float32Array color;
-  float constantAttenuation;
-  float fallOfAngle;
-  float fallOffExponent;
-  float linearAttenuation;
-  float quadraticAttenuation;
-};
-
-struct IGLTFLight : IGLTFChildRootProperty {
-  std::string type;
-};
-
-struct IGLTFCameraOrthographic {
-  float xmag;
-  float ymag;
-  float zfar;
-  float znear;
-};
-
-struct IGLTFCameraPerspective {
-  float aspectRatio;
-  float yfov;
-  float zfar;
-  float znear;
-};
-
-struct IGLTFCamera : IGLTFChildRootProperty {
-  std::string type;
+  BaseTexture* babylonTexture = nullptr;
 };
 
 struct IGLTFAnimationChannelTarget {
-  std::string id;
+  int node = -1;
   std::string path;
 };
 
 struct IGLTFAnimationChannel {
-  std::string sampler;
+  int sampler = -1;
   IGLTFAnimationChannelTarget target;
 };
 
 struct IGLTFAnimationSampler {
-  std::string input;
-  std::string output;
-  std::string interpolation;
+  int input                             = -1;
+  int output                            = -1;
+  EAnimationInterpolation interpolation = EAnimationInterpolation::LINEAR;
 };
 
 struct IGLTFAnimation : IGLTFChildRootProperty {
   std::vector<IGLTFAnimationChannel> channels;
-  std::string parameters;
-  std::string samplers;
+  std::vector<IGLTFAnimationSampler> samplers;
 };
 
-struct IGLTFNodeInstanceSkin {
-  std::vector<std::string> skeletons;
-  std::string skin;
-  std::vector<std::string> meshes;
+struct IGLTFSkin : IGLTFChildRootProperty {
+  int inverseBindMatrices = -1;
+  int skeleton            = -1;
+  std::vector<int> joints;
+  // Babylon.js values (optimize)
+  Skeleton* babylonSkeleton = nullptr;
+  // Joint index -> index of the bone in the skeleton
+  std::vector<size_t> babylonBoneIndices;
 };
 
-struct IGLTFSkins : IGLTFChildRootProperty {
-  Float32Array bindShapeMatrix;
-  std::string inverseBindMatrices;
-  std::vector<std::string> jointNames;
-  Skeleton* babylonSkeleton;
+struct IGLTFJointBone {
+  Bone* bone;
+  // Transforms the local matrix of the joint node into the space of the
+  // parent bone, identity when the parent node is the parent joint
+  Matrix offset;
 };
 
 struct IGLTFNode : IGLTFChildRootProperty {
-  std::string camera;
-  std::vector<std::string> children;
-  std::string skin;
-  std::string jointName;
-  std::string light;
+  int camera = -1;
+  std::vector<int> children;
+  int skin = -1;
   Float32Array matrix;
-  std::string mesh;
-  std::vector<std::string> meshes;
+  int mesh = -1;
   Float32Array rotation;
   Float32Array scale;
   Float32Array translation;
+  Float32Array weights;
+  int parent = -1;
   // Babylon.js values (optimize)
-  Node* babylonNode;
+  Mesh* babylonMesh = nullptr;
+  std::vector<IGLTFJointBone> babylonBones;
 };
 
 struct IGLTFScene : IGLTFChildRootProperty {
-  std::vector<std::string> nodes;
+  std::vector<int> nodes;
 };
 
 /**
  * Runtime
  */
 struct IGLTFRuntime {
-  std::unordered_map<std::string, picojson::object> objects;
-  std::unordered_map<std::string, picojson::object> accessors;
-  std::unordered_map<std::string, picojson::object> buffers;
-  std::unordered_map<std::string, picojson::object> bufferViews;
-  std::unordered_map<std::string, picojson::object> meshes;
-  std::unordered_map<std::string, picojson::object> lights;
-  std::unordered_map<std::string, picojson::object> cameras;
-  std::unordered_map<std::string, IGLTFNode> nodes;
-  std::unordered_map<std::string, picojson::object> images;
-  std::unordered_map<std::string, picojson::object> textures;
-  std::unordered_map<std::string, picojson::object> shaders;
-  std::unordered_map<std::string, picojson::object> programs;
-  std::unordered_map<std::string, picojson::object> samplers;
-  std::unordered_map<std::string, picojson::object> techniques;
-  std::unordered_map<std::string, picojson::object> materials;
-  std::unordered_map<std::string, picojson::object> animations;
-  std::unordered_map<std::string, picojson::object> skins;
-  std::string currentScene;
-  size_t buffersCount;
-  size_t shaderscount;
-  Scene* scene;
+  std::vector<IGLTFAccessor> accessors;
+  std::vector<IGLTFAnimation> animations;
+  std::vector<IGLTFBuffer> buffers;
+  std::vector<IGLTFBufferView> bufferViews;
+  std::vector<IGLTFImage> images;
+  std::vector<IGLTFMaterial> materials;
+  std::vector<IGLTFMesh> meshes;
+  std::vector<IGLTFNode> nodes;
+  std::vector<IGLTFSampler> samplers;
+  std::vector<IGLTFScene> scenes;
+  std::vector<IGLTFSkin> skins;
+  std::vector<IGLTFTexture> textures;
+  int scene           = -1;
+  Scene* babylonScene = nullptr;
   std::string rootUrl;
-  size_t loadedBuffers;
-  size_t loadedShaders;
-  std::string arrayBuffers;
-  bool importOnlyMeshes;
+  // Binary chunk of a .glb file, backing the buffer without uri
+  const uint8_t* binaryChunk = nullptr;
+  size_t binaryChunkLength   = 0;
+  bool importOnlyMeshes      = false;
   std::vector<std::string> importMeshesNames;
-  std::vector<Node*> dummyNodes;
 };
 
 /**
- * Bones
+ * Elements of an accessor, read in place from its buffer
  */
-struct INodeToRoot {
-  INodeToRoot(Bone* /*bone*/, const IGLTFNode& /*node*/,
-              const std::string& /*id*/)
-  {
-  }
-
-  Bone* bone;
-  IGLTFNode node;
-  std::string id;
-}; // end of struct INodeToRoot
-
-struct IJointNode {
-  IJointNode()
-  {
-  }
-
-  IJointNode(const IGLTFNode& /*node*/, const std::string& /*id*/)
-  {
-  }
-
-  IGLTFNode node;
-  std::string id;
-  bool isNull;
-}; // end of struct IJointNode
+struct IGLTFAccessorView {
+  const uint8_t* data          = nullptr;
+  size_t count                 = 0;
+  size_t numComponents         = 0;
+  EComponentType componentType = EComponentType::FLOAT;
+  bool normalized              = false;
+  // Bytes between the starts of two consecutive elements
+  size_t byteStride = 0;
+};
 
 } // end of namespace BABYLON
 
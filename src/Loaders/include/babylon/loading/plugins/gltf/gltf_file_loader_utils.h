@@ -2,7 +2,6 @@
 #define BABYLON_LOADING_PLUGINS_GLTF_GLTF_FILE_LOADER_UTILS_H
 
 #include <babylon/babylon_global.h>
-#include <babylon/core/any.h>
 #include <babylon/loading/plugins/gltf/gltf_file_loader_interfaces.h>
 
 namespace BABYLON {
@@ -13,33 +12,24 @@ namespace BABYLON {
 struct BABYLON_SHARED_EXPORT GLTFUtils {
 
   /**
-   * @brief Sets the given "parameter" matrix
-   * @param scene: the {BABYLON.Scene} object
-   * @param source: the source node where to pick the matrix
-   * @param parameter: the GLTF technique parameter
-   * @param uniformName: the name of the shader's uniform
-   * @param shaderMaterial: the shader material
+   * If the uri is a base64 string
+   * @param uri: the uri to test
    */
-  static void SetMatrix(Scene* scene, Node* source,
-                        const IGLTFTechniqueParameter& parameter,
-                        const std::string& uniformName,
-                        ShaderMaterial* shaderMaterial);
+  static bool IsBase64(const std::string& uri);
+
   /**
-   * Sets the given "parameter" matrix
-   * @param shaderMaterial: the shader material
-   * @param uniform: the name of the shader's uniform
-   * @param value: the value of the uniform
-   * @param type: the uniform's type (EParameterType FLOAT, VEC2, VEC3 or VEC4)
+   * Decodes the data of a base64 uri ("data:[<mime type>];base64,<data>")
+   * @param uri: the uri to decode
+   * @param data: the decoded bytes
+   * @returns Whether the uri could be decoded
    */
-  static bool SetUniform(ShaderMaterial* shaderMaterial,
-                         const std::string& uniform, any value,
-                         EParameterType type);
+  static bool DecodeBase64(const std::string& uri, Uint8Array& data);
 
   /**
-   * If the uri is a base64 string
-   * @param uri: the uri to test
+   * Decodes the percent-encoded characters of a relative uri ("%20", ...)
+   * @param uri: the uri to decode
    */
-  static bool IsBase64(const std::string& uri);
+  static std::string DecodeUri(const std::string& uri);
 
   /**
    * Returns the wrap mode of the texture
@@ -48,16 +38,23 @@ struct BABYLON_SHARED_EXPORT GLTFUtils {
   static unsigned int GetWrapMode(ETextureWrapMode mode);
 
   /**
-   * Returns the byte stride giving an accessor
-   * @param accessor: the GLTF accessor objet
+   * Returns the number of components of an accessor element, 0 if the type is
+   * not valid
+   * @param type: the type of the GLTF accessor ("SCALAR", "VEC2", ...)
+   */
+  static size_t GetNumComponents(const std::string& type);
+
+  /**
+   * Returns the size in bytes of a component type
+   * @param componentType: the component type
    */
-  static unsigned int GetByteStrideFromType(const IGLTFAccessor& accessor);
+  static size_t GetComponentSize(EComponentType componentType);
 
   /**
-   * Returns the texture filter mode giving a mode value
-   * @param mode: the filter mode value
+   * Returns the texture sampling mode giving a sampler
+   * @param sampler: the GLTF sampler
    */
-  static unsigned int GetTextureFilterMode(ETextureFilterType mode);
+  static unsigned int GetTextureSamplingMode(const IGLTFSampler& sampler);
 
 }; // end of struct GLTFUtils
 
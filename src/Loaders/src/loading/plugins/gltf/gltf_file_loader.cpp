@@ -1,403 +1,1260 @@
 #include <babylon/loading/plugins/gltf/gltf_file_loader.h>
 
+#include <babylon/animations/animation.h>
+#include <babylon/babylon_stl_util.h>
 #include <babylon/bones/bone.h>
 #include <babylon/bones/skeleton.h>
+#include <babylon/core/json.h>
 #include <babylon/core/logging.h>
-#include <babylon/core/string.h>
-#include <babylon/engine/node.h>
+#include <babylon/core/worker_pool.h>
+#include <babylon/engine/engine_constants.h>
 #include <babylon/engine/scene.h>
-#include <babylon/materials/shader_material.h>
+#include <babylon/loading/plugins/gltf/gltf_file_loader_base.h>
+#include <babylon/loading/plugins/gltf/gltf_file_loader_utils.h>
+#include <babylon/materials/pbr_material.h>
+#include <babylon/materials/textures/raw_texture.h>
 #include <babylon/materials/textures/texture.h>
-#include <babylon/math/matrix.h>
+#include <babylon/math/scalar.h>
 #include <babylon/mesh/mesh.h>
-#include <babylon/utils/picojson.h>
+#include <babylon/mesh/vertex_buffer.h>
+#include <babylon/mesh/vertex_data.h>
+#include <babylon/morph/morph_target.h>
+#include <babylon/morph/morph_target_manager.h>
+#include <babylon/tools/async_image_loader.h>
 
 namespace BABYLON {
 
-const bool GLTFFileLoader::MakeYUP                = false;
-const bool GLTFFileLoader::HomogeneousCoordinates = false;
+namespace {
 
-const std::vector<std::string> GLTFFileLoader::glTFTransforms{
-  "MODEL",      "VIEW", "PROJECTION", "MODELVIEW", "MODELVIEWPROJECTION",
-  "JOINTMATRIX"};
-const std::vector<std::string> GLTFFileLoader::babylonTransforms{
-  "world", "view", "projection", "worldView", "worldViewProjection", "mBones"};
-
-const std::vector<std::string> GLTFFileLoader::glTFAnimationPaths{
-  "translation", "rotation", "scale"};
-const std::vector<std::string> GLTFFileLoader::babylonAnimationPaths{
-  "position", "rotationQuaternion", "scaling"};
-
-GLTFFileLoader::GLTFFileLoader()
+Matrix multiply(Matrix left, const Matrix& right)
 {
+  Matrix result;
+  left.multiplyToRef(right, result);
+  return result;
 }
 
-GLTFFileLoader::~GLTFFileLoader()
+Matrix inverse(Matrix matrix)
 {
+  return matrix.invert();
 }
 
-bool GLTFFileLoader::importMeshAsync(
-  const std::vector<std::string>& meshesNames, Scene* scene,
-  const std::string& data, const std::string& rootUrl,
-  const std::function<void(std::vector<AbstractMesh*>& meshes,
-                           std::vector<ParticleSystem*>& particleSystems,
-                           std::vector<Skeleton*>& skeletons)>& onSuccess,
-  const std::function<void()>& onError)
+std::string getNodeName(const IGLTFNode& node, int index)
 {
+  return node.name.empty() ? "node" + std::to_string(index) : node.name;
 }
 
-bool GLTFFileLoader::loadAsync(Scene* scene, const std::string& data,
-                               const std::string& rootUrl,
-                               const std::function<void()>& onsuccess,
-                               const std::function<void()>& onerror)
+bool isEmbedded(const IGLTFImage& image)
 {
+  return image.bufferView >= 0 || GLTFUtils::IsBase64(image.uri);
 }
 
-void GLTFFileLoader::parseBuffers(const Json::object& parsedBuffers,
-                                  IGLTFRuntime& gltfRuntime)
+// Returns the vertex buffer kind and number of components of an attribute
+// semantic, 0 for the semantics without vertex buffer
+unsigned int getVertexKind(const std::string& semantic,
+                           size_t& numComponents)
 {
-  for (auto& buf : parsedBuffers) {
-    gltfRuntime.buffers[buf.first] = buf.second.get<Json::object>();
-    ++gltfRuntime.buffersCount;
+  static const std::unordered_map<std::string, std::pair<unsigned int, size_t>>
+    kinds{{"POSITION", {VertexBuffer::PositionKind, 3}},
+          {"NORMAL", {VertexBuffer::NormalKind, 3}},
+          {"TANGENT", {VertexBuffer::TangentKind, 4}},
+          {"TEXCOORD_0", {VertexBuffer::UVKind, 2}},
+          {"TEXCOORD_1", {VertexBuffer::UV2Kind, 2}},
+          {"COLOR_0", {VertexBuffer::ColorKind, 4}},
+          {"JOINTS_0", {VertexBuffer::MatricesIndicesKind, 4}},
+          {"WEIGHTS_0", {VertexBuffer::MatricesWeightsKind, 4}},
+          {"JOINTS_1", {VertexBuffer::MatricesIndicesExtraKind, 4}},
+          {"WEIGHTS_1", {VertexBuffer::MatricesWeightsExtraKind, 4}}};
+  auto it = kinds.find(semantic);
+  if (it == kinds.end()) {
+    return 0;
   }
+  numComponents = it->second.second;
+  return it->second.first;
 }
 
-void GLTFFileLoader::parseShaders(const Json::object& parsedShaders,
-                                  IGLTFRuntime& gltfRuntime)
+// Converts the indices of triangle strips and fans to triangle lists
+IndicesArray toTriangleList(const IndicesArray& indices,
+                            EMeshPrimitiveMode mode)
 {
-  for (auto& sha : parsedShaders) {
-    gltfRuntime.buffers[sha.first] = sha.second.get<Json::object>();
-    ++gltfRuntime.shaderscount;
+  IndicesArray triangles;
+  if (indices.size() < 3) {
+    return triangles;
   }
+  triangles.reserve((indices.size() - 2) * 3);
+  for (size_t i = 2; i < indices.size(); ++i) {
+    if (mode == EMeshPrimitiveMode::TRIANGLE_FAN) {
+      triangles.insert(triangles.end(),
+                       {indices[0], indices[i - 1], indices[i]});
+    }
+    else if (i % 2 == 0) {
+      triangles.insert(triangles.end(),
+                       {indices[i - 2], indices[i - 1], indices[i]});
+    }
+    else {
+      triangles.insert(triangles.end(),
+                       {indices[i - 1], indices[i - 2], indices[i]});
+    }
+  }
+  return triangles;
 }
 
-void GLTFFileLoader::parseObject(const Json::object& parsedObjects,
-                                 const std::string& runtimeProperty,
-                                 IGLTFRuntime& gltfRuntime)
-{
-}
-
-void GLTFFileLoader::normalizeUVs(Float32Array& buffer) const
+// Returns the nodes of the scene to load, the root nodes of the default scene
+std::vector<int> getSceneNodes(const IGLTFRuntime& gltfRuntime)
 {
-  if (buffer.empty()) {
-    return;
+  if (!gltfRuntime.scenes.empty()) {
+    const auto scene = std::max(gltfRuntime.scene, 0);
+    return gltfRuntime.scenes[static_cast<size_t>(scene)].nodes;
   }
 
-  for (size_t i = 0; i < buffer.size() / 2; ++i) {
-    buffer[i * 2 + 1] = 1.f - buffer[i * 2 + 1];
+  std::vector<int> nodes;
+  for (size_t i = 0; i < gltfRuntime.nodes.size(); ++i) {
+    if (gltfRuntime.nodes[i].parent == -1) {
+      nodes.emplace_back(static_cast<int>(i));
+    }
   }
+  return nodes;
 }
 
-std::string
-GLTFFileLoader::replaceInString(const std::string& str,
-                                const std::string& searchValue,
-                                const std::string& replaceValue) const
+// Returns the nodes named in names, searched in the hierarchies of the nodes
+void findNamedNodes(const IGLTFRuntime& gltfRuntime,
+                    const std::vector<int>& nodes,
+                    const std::vector<std::string>& names,
+                    std::vector<int>& namedNodes)
 {
-  std::string source = str;
-  String::replaceInPlace(source, searchValue, replaceValue);
-  return source;
+  for (auto node : nodes) {
+    const auto& gltfNode = gltfRuntime.nodes[static_cast<size_t>(node)];
+    if (std::find(names.begin(), names.end(), gltfNode.name) != names.end()) {
+      namedNodes.emplace_back(node);
+    }
+    else {
+      findNamedNodes(gltfRuntime, gltfNode.children, names, namedNodes);
+    }
+  }
 }
 
-std::string GLTFFileLoader::getAttribute(
-  const IGLTFTechniqueParameter& attributeParameter) const
-{
-  if (attributeParameter.semantic == "NORMAL") {
-    return "normal";
+/**
+ * Animation sampling
+ */
+struct AnimationSampler {
+  span<const float> input;
+  span<const float> output;
+  size_t numComponents;
+  EAnimationInterpolation interpolation;
+
+  bool cubic() const
+  {
+    return interpolation == EAnimationInterpolation::CUBICSPLINE;
   }
-  else if (attributeParameter.semantic == "POSITION") {
-    return "position";
+
+  // Returns the components of the value of a key
+  const float* value(size_t key) const
+  {
+    return output.data() + (cubic() ? 3 * key + 1 : key) * numComponents;
   }
-  else if (attributeParameter.semantic == "JOINT") {
-    return "matricesIndices";
+
+  // Returns the components of the in or out tangent of a cubic spline key
+  const float* tangent(size_t key, bool out) const
+  {
+    return output.data() + (3 * key + (out ? 2 : 0)) * numComponents;
   }
-  else if (attributeParameter.semantic == "WEIGHT") {
-    return "matricesWeights";
+
+  // Evaluates the sampler at the given time
+  void evaluate(float time, float* result) const
+  {
+    const size_t count = input.size();
+    size_t next        = 0;
+    while (next < count && input[next] <= time) {
+      ++next;
+    }
+
+    if (next == 0 || next == count) {
+      std::copy_n(value(next == 0 ? 0 : count - 1), numComponents, result);
+      return;
+    }
+
+    const size_t previous = next - 1;
+    const float duration  = input[next] - input[previous];
+    const float gradient
+      = (duration > 0.f) ? (time - input[previous]) / duration : 0.f;
+    const float* start = value(previous);
+    const float* end   = value(next);
+    if (interpolation == EAnimationInterpolation::STEP) {
+      std::copy_n(start, numComponents, result);
+    }
+    else if (cubic()) {
+      const float* outTangent = tangent(previous, true);
+      const float* inTangent  = tangent(next, false);
+      for (size_t c = 0; c < numComponents; ++c) {
+        result[c] = Scalar::Hermite(start[c], outTangent[c] * duration, end[c],
+                                    inTangent[c] * duration, gradient);
+      }
+    }
+    else if (numComponents == 4) {
+      const auto rotation
+        = Quaternion::Slerp(Quaternion(start[0], start[1], start[2], start[3]),
+                            Quaternion(end[0], end[1], end[2], end[3]),
+                            gradient);
+      result[0] = rotation.x;
+      result[1] = rotation.y;
+      result[2] = rotation.z;
+      result[3] = rotation.w;
+    }
+    else {
+      for (size_t c = 0; c < numComponents; ++c) {
+        result[c] = Scalar::Lerp(start[c], end[c], gradient);
+      }
+    }
   }
-  else if (attributeParameter.semantic == "COLOR") {
-    return "color";
+
+}; // end of struct AnimationSampler
+
+AnimationValue toAnimationValue(const float* components, size_t numComponents)
+{
+  if (numComponents == 4) {
+    return AnimationValue(Quaternion(components[0], components[1],
+                                     components[2], components[3]));
   }
-  else if (attributeParameter.semantic.find("TEXCOORD_") != std::string::npos) {
-    auto splitString = String::split(attributeParameter.semantic, '_');
-    if (splitString.size() > 1) {
-      int channel = std::stoi(splitString[1]);
-      return "uv" + (channel == 0 ? "" : std::to_string(channel + 1));
+  return AnimationValue(
+    Vector3(components[0], components[1], components[2]));
+}
+
+/**
+ * Keys of an animated property, over all the animations of the asset
+ */
+struct AnimatedProperty {
+  // Animations of the target
+  std::vector<Animation*>* animations;
+  std::string name;
+  std::string property;
+  unsigned int dataType;
+  AnimationValue restValue;
+  std::vector<AnimationKey> keys;
+  // Index of the last animation which animated the property
+  size_t lastAnimation;
+
+  // Adds a key, a key at the frame of the last key replaces it
+  void addKey(AnimationKey key)
+  {
+    if (!keys.empty() && keys.back().frame >= key.frame) {
+      keys.back() = std::move(key);
+    }
+    else {
+      keys.emplace_back(std::move(key));
     }
   }
 
-  return "";
-}
+  // Holds the rest value over a frame range
+  void addRestKeys(int from, int to)
+  {
+    addKey(AnimationKey(from, restValue));
+    addKey(AnimationKey(to, restValue));
+  }
+
+}; // end of struct AnimatedProperty
+
+} // end of anonymous namespace
 
-std::string GLTFFileLoader::getAnimationPath(const std::string& path) const
+constexpr float GLTFFileLoader::AnimationFPS;
+
+GLTFFileLoader::GLTFFileLoader(size_t workerCount)
+    : _pool{WorkerPool::Create(workerCount)}
+    , _rootMesh{nullptr}
+    , _defaultMaterial{nullptr}
 {
-  auto it
-    = std::find(glTFAnimationPaths.begin(), glTFAnimationPaths.end(), path);
-  if (it != glTFAnimationPaths.end()) {
-    size_t index = static_cast<size_t>(it - glTFAnimationPaths.begin());
-    return babylonAnimationPaths[index];
-  }
+  extensions.mapping.clear();
+  extensions.mapping.emplace(std::make_pair(".gltf", false));
+  extensions.mapping.emplace(std::make_pair(".glb", true));
+}
 
-  return path;
+GLTFFileLoader::~GLTFFileLoader()
+{
 }
 
-void GLTFFileLoader::loadAnimations(const IGLTFRuntime& gltfRuntime) const
+size_t GLTFFileLoader::workerCount() const
 {
+  return _pool->workerCount();
 }
 
-Matrix GLTFFileLoader::configureBoneTransformation(const IGLTFNode& node) const
+bool GLTFFileLoader::importMesh(
+  const std::vector<std::string>& meshesNames, Scene* scene,
+  const std::string& data, const std::string& rootUrl,
+  std::vector<AbstractMesh*>& meshes,
+  std::vector<ParticleSystem*>& /*particleSystems*/,
+  std::vector<Skeleton*>& skeletons)
 {
-  Matrix mat;
-  if (!node.translation.empty() && !node.rotation.empty()
-      && !node.scale.empty()) {
-    auto scale    = Vector3::FromArray(node.scale);
-    auto rotation = Quaternion::FromArray(node.rotation);
-    auto position = Vector3::FromArray(node.translation);
+  IGLTFRuntime gltfRuntime;
+  gltfRuntime.babylonScene      = scene;
+  gltfRuntime.rootUrl           = rootUrl;
+  gltfRuntime.importOnlyMeshes  = !meshesNames.empty();
+  gltfRuntime.importMeshesNames = meshesNames;
 
-    // Y is Up
-    if (GLTFFileLoader::MakeYUP) {
-      rotation = rotation.multiply(Quaternion(-0.707107f, 0.f, 0.f, 0.707107f));
+  std::vector<int> nodes;
+  auto error = _parse(data, gltfRuntime);
+  if (error.empty()) {
+    nodes = getSceneNodes(gltfRuntime);
+    if (gltfRuntime.importOnlyMeshes) {
+      std::vector<int> namedNodes;
+      findNamedNodes(gltfRuntime, nodes, meshesNames, namedNodes);
+      nodes = std::move(namedNodes);
     }
-
-    mat = Matrix::Compose(scale, rotation, position);
+    error = _decode(gltfRuntime, nodes);
   }
-  else {
-    mat = Matrix::FromArray(node.matrix);
+
+  if (!error.empty()) {
+    BABYLON_LOG_ERROR("GLTFFileLoader", "importMesh has failed: ", error);
+    _clear();
+    return false;
   }
 
-  return mat;
+  _createScene(gltfRuntime, nodes, meshes, skeletons);
+  _clear();
+  return true;
 }
 
-Bone* GLTFFileLoader::getParentBone(const IGLTFRuntime& gltfRuntime,
-                                    const IGLTFSkins& skins,
-                                    const std::string& jointName,
-                                    Skeleton* newSkeleton) const
+bool GLTFFileLoader::load(Scene* scene, const std::string& data,
+                          const std::string& rootUrl)
 {
-// Try to find
-#if 0
-  auto it = std::find_if(
-    newSkeleton->bones.begin(), newSkeleton->bones.end(),
-    [&jointName](const Bone* bone) { return bone->id == jointName; });
-  if (it != newSkeleton->bones.end()) {
-    return nullptr;
-  }
-#endif
+  std::vector<AbstractMesh*> meshes;
+  std::vector<ParticleSystem*> particleSystems;
+  std::vector<Skeleton*> skeletons;
+  return importMesh({}, scene, data, rootUrl, meshes, particleSystems,
+                    skeletons);
+}
 
-  // Not found, search in gltf nodes
-  for (auto& nde : gltfRuntime.nodes) {
-    const IGLTFNode& node = nde.second;
-    if (node.jointName.empty()) {
-      continue;
-    }
+std::string GLTFFileLoader::_parse(const std::string& data,
+                                   IGLTFRuntime& gltfRuntime)
+{
+  const auto bytes    = reinterpret_cast<const uint8_t*>(data.data());
+  const char* json    = data.data();
+  size_t jsonLength   = data.size();
+  std::string error;
+  if (GLTFFileLoaderBase::IsBinary(bytes, data.size())
+      && !GLTFFileLoaderBase::ParseBinary(
+           bytes, data.size(), json, jsonLength, gltfRuntime.binaryChunk,
+           gltfRuntime.binaryChunkLength, error)) {
+    return error;
+  }
 
-    for (auto& childId : node.children) {
-      const IGLTFNode& child = gltfRuntime.nodes.at(childId);
-      if (child.jointName.empty()) {
-        continue;
-      }
+  Json::value parsedData;
+  error = Json::Parse(parsedData, json, jsonLength);
+  if (!error.empty()) {
+    return error;
+  }
 
-      if (child.jointName == jointName) {
-        return nullptr;
-      }
-    }
+  if (!GLTFFileLoaderBase::CreateRuntime(parsedData, gltfRuntime, error)
+      || !GLTFFileLoaderBase::LoadBuffers(gltfRuntime, error)) {
+    return error;
   }
 
-  return nullptr;
+  return "";
 }
 
-Bone* GLTFFileLoader::getNodeToRoot(const std::vector<INodeToRoot> nodesToRoot,
-                                    const std::string& id) const
+std::string GLTFFileLoader::_decode(const IGLTFRuntime& gltfRuntime,
+                                    const std::vector<int>& nodes)
 {
-  for (auto& nodeToRoot : nodesToRoot) {
-    for (auto& child : nodeToRoot.node.children) {
-      if (child == id) {
-        return nodeToRoot.bone;
+  const auto& rt           = gltfRuntime;
+  const auto accessorCount = rt.accessors.size();
+  _accessors.assign(accessorCount, span<const float>());
+  _decodedAccessors.assign(accessorCount, Float32Array());
+  _indices.assign(accessorCount, IndicesArray());
+  _images.assign(rt.images.size(), Image());
+
+  // Accessors used by the nodes to load and by the animations
+  std::vector<bool> usedAccessors(accessorCount, false);
+  std::vector<bool> usedIndices(accessorCount, false);
+  std::function<void(int)> useNode = [&](int nodeIndex) {
+    const auto& node = rt.nodes[static_cast<size_t>(nodeIndex)];
+    if (node.mesh >= 0) {
+      const auto& mesh = rt.meshes[static_cast<size_t>(node.mesh)];
+      for (auto& primitive : mesh.primitives) {
+        for (auto& attribute : primitive.attributes) {
+          usedAccessors[static_cast<size_t>(attribute.second)] = true;
+        }
+        for (auto& target : primitive.targets) {
+          for (auto& attribute : target) {
+            usedAccessors[static_cast<size_t>(attribute.second)] = true;
+          }
+        }
+        if (primitive.indices >= 0) {
+          usedIndices[static_cast<size_t>(primitive.indices)] = true;
+        }
       }
     }
+    if (node.skin >= 0) {
+      const auto& skin = rt.skins[static_cast<size_t>(node.skin)];
+      if (skin.inverseBindMatrices >= 0) {
+        usedAccessors[static_cast<size_t>(skin.inverseBindMatrices)] = true;
+      }
+    }
+    for (auto child : node.children) {
+      useNode(child);
+    }
+  };
+  for (auto node : nodes) {
+    useNode(node);
   }
-  return nullptr;
-}
-
-IJointNode GLTFFileLoader::getJointNode(const IGLTFRuntime& gltfRuntime,
-                                        const std::string& jointName) const
-{
-  if (std_util::contains(gltfRuntime.nodes, jointName)) {
-    return IJointNode(gltfRuntime.nodes.at(jointName), jointName);
+  for (auto& animation : rt.animations) {
+    for (auto& sampler : animation.samplers) {
+      usedAccessors[static_cast<size_t>(sampler.input)]  = true;
+      usedAccessors[static_cast<size_t>(sampler.output)] = true;
+    }
   }
 
-  for (auto& nde : gltfRuntime.nodes) {
-    const IGLTFNode& node = nde.second;
-    if (node.jointName == jointName) {
-      return IJointNode(node, nde.first);
+  // Tightly packed float accessors are read in place, the others are decoded
+  // by the jobs
+  std::vector<std::function<void()>> jobs;
+  std::vector<std::string> errors(accessorCount * 2 + rt.images.size());
+  for (size_t i = 0; i < accessorCount; ++i) {
+    const auto& accessor = rt.accessors[i];
+    if (usedAccessors[i]) {
+      IGLTFAccessorView view;
+      const auto numComponents = GLTFUtils::GetNumComponents(accessor.type);
+      if (accessor.sparse.count == 0
+          && GLTFFileLoaderBase::GetAccessorView(rt, accessor, view)
+          && GLTFFileLoaderBase::IsPackedFloat(view)
+          && reinterpret_cast<uintptr_t>(view.data) % alignof(float) == 0) {
+        _accessors[i]
+          = span<const float>(reinterpret_cast<const float*>(view.data),
+                              view.count * numComponents, numComponents);
+      }
+      else {
+        jobs.emplace_back([this, &rt, &errors, i]() {
+          if (!GLTFFileLoaderBase::ReadAccessor(rt, rt.accessors[i],
+                                                _decodedAccessors[i])) {
+            errors[i] = "invalid accessor " + std::to_string(i);
+          }
+        });
+      }
+    }
+    if (usedIndices[i]) {
+      jobs.emplace_back([this, &rt, &errors, i, accessorCount]() {
+        if (!GLTFFileLoaderBase::ReadIndices(rt, rt.accessors[i],
+                                             _indices[i])) {
+          errors[accessorCount + i]
+            = "invalid indices accessor " + std::to_string(i);
+        }
+      });
     }
   }
 
-  return IJointNode();
-}
-
-bool GLTFFileLoader::nodeIsInJoints(const IGLTFSkins& skins,
-                                    const std::string& id) const
-{
-  return (std::find(skins.jointNames.begin(), skins.jointNames.end(), id)
-          != skins.jointNames.end());
-}
+  // Embedded images, the external images are loaded by the textures
+  for (size_t i = 0; i < rt.images.size(); ++i) {
+    if (!isEmbedded(rt.images[i])) {
+      continue;
+    }
+    jobs.emplace_back([this, &rt, &errors, i, accessorCount]() {
+      const auto& image = rt.images[i];
+      auto& error       = errors[accessorCount * 2 + i];
+      Uint8Array decodedData;
+      const uint8_t* data = nullptr;
+      size_t size         = 0;
+      if (image.bufferView >= 0) {
+        data = GLTFFileLoaderBase::GetBufferViewData(rt, image.bufferView);
+        size = rt.bufferViews[static_cast<size_t>(image.bufferView)].byteLength;
+      }
+      else if (GLTFUtils::DecodeBase64(image.uri, decodedData)) {
+        data = decodedData.data();
+        size = decodedData.size();
+      }
+      if (!data) {
+        error = "invalid data of image " + std::to_string(i);
+      }
+      else if (!AsyncImageLoader::DecodeImage(data, size, _images[i], error)) {
+        error += " of image " + std::to_string(i);
+      }
+    });
+  }
 
-void GLTFFileLoader::getNodesToRoot(const IGLTFRuntime& gltfRuntime,
-                                    Skeleton* newSkeleton,
-                                    const IGLTFSkins& skins,
-                                    std::vector<INodeToRoot>& nodesToRoot) const
-{
-  // Creates nodes for root
-  for (auto& nde : gltfRuntime.nodes) {
-    const std::string& id = nde.first;
-    const IGLTFNode& node = nde.second;
+  _pool->run(jobs);
 
-    if (node.jointName.empty() || nodeIsInJoints(skins, node.jointName)) {
-      continue;
+  // The images which could not be decoded are skipped
+  for (size_t i = 0; i < rt.images.size(); ++i) {
+    const auto& error = errors[accessorCount * 2 + i];
+    if (!error.empty()) {
+      BABYLON_LOG_WARN("GLTFFileLoader", error);
     }
+  }
 
-    // Create node to root bone
-    // Matrix mat = configureBoneTransformation(node);
-    Bone* bone = nullptr;
-    bone->id   = id;
-    nodesToRoot.emplace_back(INodeToRoot(bone, node, id));
+  for (size_t i = 0; i < accessorCount * 2; ++i) {
+    if (!errors[i].empty()) {
+      return errors[i];
+    }
   }
 
-  // Parenting
-  for (auto& nodeToRoot : nodesToRoot) {
-    for (auto& child : nodeToRoot.node.children) {
-      for (auto& _nodeToRoot : nodesToRoot) {
-        if (_nodeToRoot.id == child) {
-          _nodeToRoot.bone->setParent(nodeToRoot.bone);
-          nodeToRoot.bone->children.emplace_back(_nodeToRoot.bone);
-          break;
-        }
-      }
+  for (size_t i = 0; i < accessorCount; ++i) {
+    if (usedAccessors[i] && _accessors[i].empty()) {
+      const auto numComponents
+        = GLTFUtils::GetNumComponents(rt.accessors[i].type);
+      _accessors[i] = span<const float>(_decodedAccessors[i].data(),
+                                        _decodedAccessors[i].size(),
+                                        numComponents);
     }
   }
+
+  return "";
 }
 
-void GLTFFileLoader::printMat(const Float32Array& m) const
+void GLTFFileLoader::_clear()
 {
-  std::ostringstream oss;
-  oss << m[0] << "\t" << m[1] << "\t" << m[2] << "\t" << m[3] << "\n";
-  oss << m[4] << "\t" << m[5] << "\t" << m[6] << "\t" << m[7] << "\n";
-  oss << m[8] << "\t" << m[9] << "\t" << m[10] << "\t" << m[11] << "\n";
-  oss << m[12] << "\t" << m[13] << "\t" << m[14] << "\t" << m[15] << "\n";
-  BABYLON_LOG_INFO("GLTFFileLoader", oss.str());
+  _accessors.clear();
+  _decodedAccessors.clear();
+  _indices.clear();
+  _images.clear();
+  _worldMatrices.clear();
+  _worldMatricesComputed.clear();
+  _rootMesh        = nullptr;
+  _defaultMaterial = nullptr;
 }
 
-Skeleton* GLTFFileLoader::importSkeleton(const IGLTFRuntime& gltfRuntime,
-                                         const IGLTFSkins& skins, Mesh* mesh,
-                                         Skeleton* newSkeleton) const
+span<const float> GLTFFileLoader::_getAccessor(int accessor) const
 {
-  return nullptr;
+  return (accessor >= 0) ? _accessors[static_cast<size_t>(accessor)] :
+                           span<const float>();
 }
 
-Mesh* GLTFFileLoader::importMesh(const IGLTFRuntime& gltfRuntime,
-                                 const IGLTFNode& node,
-                                 std::vector<std::string> meshes,
-                                 const std::string& id, Mesh* newMesh) const
+Matrix GLTFFileLoader::_getNodeMatrix(const IGLTFNode& node) const
 {
-  return nullptr;
+  if (!node.matrix.empty()) {
+    return Matrix::FromArray(node.matrix);
+  }
+
+  auto scaling  = node.scale.empty() ? Vector3(1.f, 1.f, 1.f) :
+                                      Vector3::FromArray(node.scale);
+  auto rotation = node.rotation.empty() ? Quaternion() :
+                                          Quaternion::FromArray(node.rotation);
+  auto position = node.translation.empty() ?
+                    Vector3::Zero() :
+                    Vector3::FromArray(node.translation);
+  return Matrix::Compose(scaling, rotation, position);
 }
 
-void GLTFFileLoader::configureNode(Mesh* newNode, const Vector3& position,
-                                   const Quaternion& rotation,
-                                   const Vector3& scaling) const
+const Matrix& GLTFFileLoader::_getWorldMatrix(const IGLTFRuntime& gltfRuntime,
+                                              int nodeIndex)
 {
-  newNode->setPosition(position);
-  newNode->setRotationQuaternion(rotation);
-  newNode->setScaling(scaling);
+  const auto index = static_cast<size_t>(nodeIndex);
+  if (!_worldMatricesComputed[index]) {
+    const auto& node = gltfRuntime.nodes[index];
+    auto world       = _getNodeMatrix(node);
+    if (node.parent != -1) {
+      world = multiply(world, _getWorldMatrix(gltfRuntime, node.parent));
+    }
+    _worldMatrices[index]         = world;
+    _worldMatricesComputed[index] = true;
+  }
+
+  return _worldMatrices[index];
 }
 
-void GLTFFileLoader::configureNodeFromMatrix(Mesh* newNode,
-                                             const IGLTFNode& node,
-                                             Node* /*parent*/) const
+void GLTFFileLoader::_createScene(IGLTFRuntime& gltfRuntime,
+                                  const std::vector<int>& nodes,
+                                  std::vector<AbstractMesh*>& meshes,
+                                  std::vector<Skeleton*>& skeletons)
 {
-  if (!node.matrix.empty()) {
-    Vector3 position(0.f, 0.f, 0.f);
-    Quaternion rotation;
-    Vector3 scaling(0.f, 0.f, 0.f);
-    auto mat = Matrix::FromArray(node.matrix);
-    mat.decompose(scaling, rotation, position);
+  auto scene = gltfRuntime.babylonScene;
+  _worldMatrices.assign(gltfRuntime.nodes.size(), Matrix::Identity());
+  _worldMatricesComputed.assign(gltfRuntime.nodes.size(), false);
 
-    configureNode(newNode, position, rotation, scaling);
-    newNode->computeWorldMatrix(true);
+  // glTF is right handed, the root converts the asset to the left handed
+  // system of the scene
+  if (!scene->useRightHandedSystem()) {
+    _rootMesh = Mesh::New("__root__", scene);
+    _rootMesh->setRotationQuaternion(Quaternion(0.f, 1.f, 0.f, 0.f));
+    _rootMesh->setScaling(Vector3(1.f, 1.f, -1.f));
+    meshes.emplace_back(_rootMesh);
   }
-  else {
-    configureNode(newNode, Vector3::FromArray(node.translation),
-                  Quaternion::FromArray(node.rotation),
-                  Vector3::FromArray(node.scale));
+
+  for (auto node : nodes) {
+    _loadNode(gltfRuntime, node, _rootMesh, meshes);
   }
-}
 
-Node* GLTFFileLoader::importNode(const IGLTFRuntime& gltfRuntime,
-                                 const IGLTFNode& node,
-                                 const std::string& id) const
-{
-}
+  _loadAnimations(gltfRuntime);
 
-void GLTFFileLoader::traverseNodes(const IGLTFRuntime& gltfRuntime,
-                                   const std::string& id, Node* parent,
-                                   bool meshIncluded) const
-{
+  for (auto& skin : gltfRuntime.skins) {
+    if (skin.babylonSkeleton) {
+      skeletons.emplace_back(skin.babylonSkeleton);
+    }
+  }
 }
 
-void GLTFFileLoader::postLoad(const IGLTFRuntime& gltfRuntime) const
+Mesh* GLTFFileLoader::_loadNode(IGLTFRuntime& gltfRuntime, int nodeIndex,
+                                Mesh* parent,
+                                std::vector<AbstractMesh*>& meshes)
 {
-}
+  auto scene       = gltfRuntime.babylonScene;
+  auto& node       = gltfRuntime.nodes[static_cast<size_t>(nodeIndex)];
+  auto babylonMesh = Mesh::New(getNodeName(node, nodeIndex), scene);
+  node.babylonMesh = babylonMesh;
+  meshes.emplace_back(babylonMesh);
+  if (parent) {
+    babylonMesh->setParent(parent);
+  }
 
-void GLTFFileLoader::onBindShaderMaterial(Mesh* mesh,
-                                          const IGLTFRuntime& gltfRuntime,
-                                          const std::string& unTreatedUniforms,
-                                          ShaderMaterial* shaderMaterial,
-                                          const IGLTFTechnique& technique,
-                                          const IGLTFMaterial& material) const
-{
-}
+  Vector3 scaling(1.f, 1.f, 1.f), position;
+  Quaternion rotation;
+  if (!node.matrix.empty()) {
+    Matrix::FromArray(node.matrix).decompose(scaling, rotation, position);
+  }
+  else {
+    if (!node.translation.empty()) {
+      position = Vector3::FromArray(node.translation);
+    }
+    if (!node.rotation.empty()) {
+      rotation = Quaternion::FromArray(node.rotation);
+    }
+    if (!node.scale.empty()) {
+      scaling = Vector3::FromArray(node.scale);
+    }
+  }
+  babylonMesh->setPosition(position);
+  babylonMesh->setRotationQuaternion(rotation);
+  babylonMesh->setScaling(scaling);
 
-void GLTFFileLoader::prepareShaderMaterialUniforms(
-  const IGLTFRuntime& gltfRuntime, ShaderMaterial* shaderMaterial,
-  const IGLTFTechnique& technique, const IGLTFMaterial& material,
-  const std::string& unTreatedUniforms) const
-{
+  if (node.mesh >= 0) {
+    const auto& mesh = gltfRuntime.meshes[static_cast<size_t>(node.mesh)];
+    auto skeleton    = (node.skin >= 0) ? _loadSkin(gltfRuntime, node.skin) :
+                                       nullptr;
+    for (size_t i = 0; i < mesh.primitives.size(); ++i) {
+      // The vertices of skinned meshes are placed by the joints, they ignore
+      // the transform of their node
+      auto primitiveMesh = babylonMesh;
+      if (mesh.primitives.size() > 1 || skeleton) {
+        primitiveMesh = Mesh::New(
+          babylonMesh->name + "_primitive" + std::to_string(i), scene);
+        meshes.emplace_back(primitiveMesh);
+        if (!skeleton) {
+          primitiveMesh->setParent(babylonMesh);
+        }
+        else if (_rootMesh) {
+          primitiveMesh->setParent(_rootMesh);
+        }
+      }
+      if (skeleton) {
+        primitiveMesh->setSkeleton(skeleton);
+      }
+      _loadPrimitive(gltfRuntime, node, mesh.primitives[i], primitiveMesh);
+      _loadMorphTargets(node, mesh, mesh.primitives[i], primitiveMesh);
+    }
+  }
+
+  for (auto child : node.children) {
+    _loadNode(gltfRuntime, child, babylonMesh, meshes);
+  }
+
+  return babylonMesh;
 }
 
-void GLTFFileLoader::onShaderCompileError(const IGLTFProgram& program,
-                                          ShaderMaterial* shaderMaterial) const
+void GLTFFileLoader::_loadPrimitive(IGLTFRuntime& gltfRuntime,
+                                    const IGLTFNode& node,
+                                    const IGLTFMeshPrimitive& primitive,
+                                    Mesh* babylonMesh)
 {
+  const auto mode = primitive.mode;
+  if (mode != EMeshPrimitiveMode::TRIANGLES
+      && mode != EMeshPrimitiveMode::TRIANGLE_STRIP
+      && mode != EMeshPrimitiveMode::TRIANGLE_FAN) {
+    BABYLON_LOG_WARN("GLTFFileLoader", "Skipping primitive of mesh ",
+                     babylonMesh->name, ": points and lines are not supported");
+    return;
+  }
+
+  if (!stl_util::contains(primitive.attributes, "POSITION")) {
+    BABYLON_LOG_WARN("GLTFFileLoader", "Skipping primitive of mesh ",
+                     babylonMesh->name, ": missing positions");
+    return;
+  }
+  const auto positions   = _getAccessor(primitive.attributes.at("POSITION"));
+  const auto vertexCount = positions.size() / 3;
+
+  IndicesArray indices;
+  if (primitive.indices >= 0) {
+    indices = _indices[static_cast<size_t>(primitive.indices)];
+  }
+  else {
+    indices.resize(vertexCount);
+    std::iota(indices.begin(), indices.end(), 0);
+  }
+  if (mode != EMeshPrimitiveMode::TRIANGLES) {
+    indices = toTriangleList(indices, mode);
+  }
+  if (std::any_of(indices.begin(), indices.end(),
+                  [vertexCount](uint32_t index) {
+                    return index >= vertexCount;
+                  })) {
+    BABYLON_LOG_WARN("GLTFFileLoader", "Skipping primitive of mesh ",
+                     babylonMesh->name, ": indices out of range");
+    return;
+  }
+
+  const IGLTFSkin* skin
+    = (node.skin >= 0) ? &gltfRuntime.skins[static_cast<size_t>(node.skin)] :
+                         nullptr;
+  for (auto& attribute : primitive.attributes) {
+    size_t numComponents = 0;
+    const auto kind      = getVertexKind(attribute.first, numComponents);
+    const auto data      = _getAccessor(attribute.second);
+    const auto accessorComponents
+      = (vertexCount > 0) ? data.size() / vertexCount : 0;
+    if (kind == 0 || data.size() != vertexCount * accessorComponents
+        || (accessorComponents != numComponents
+            && !(kind == VertexBuffer::ColorKind && accessorComponents == 3))) {
+      BABYLON_LOG_WARN("GLTFFileLoader", "Ignoring attribute ",
+                       attribute.first, " of mesh ", babylonMesh->name);
+      continue;
+    }
+
+    Float32Array values;
+    if (kind == VertexBuffer::ColorKind && accessorComponents == 3) {
+      // RGB colors are expanded to RGBA
+      values.reserve(vertexCount * 4);
+      for (size_t i = 0; i < vertexCount; ++i) {
+        values.insert(values.end(), {data[i * 3], data[i * 3 + 1],
+                                     data[i * 3 + 2], 1.f});
+      }
+    }
+    else if (kind == VertexBuffer::MatricesIndicesKind
+             || kind == VertexBuffer::MatricesIndicesExtraKind) {
+      // Joint indices -> indices of the bones in the skeleton
+      if (!skin) {
+        continue;
+      }
+      values.reserve(data.size());
+      for (auto joint : data) {
+        const auto jointIndex = static_cast<size_t>(joint);
+        values.emplace_back(
+          (jointIndex < skin->babylonBoneIndices.size()) ?
+            static_cast<float>(skin->babylonBoneIndices[jointIndex]) :
+            0.f);
+      }
+    }
+    else {
+      values.assign(data.begin(), data.end());
+    }
+
+    babylonMesh->setVerticesData(kind, values, false);
+    if (kind == VertexBuffer::MatricesIndicesExtraKind) {
+      babylonMesh->setNumBoneInfluencers(8);
+    }
+  }
+
+  // Flat shading is not supported, the missing normals are smoothed
+  if (!stl_util::contains(primitive.attributes, "NORMAL")) {
+    Float32Array normals(positions.size(), 0.f);
+    VertexData::ComputeNormals(positions.toVector(), indices, normals);
+    babylonMesh->setVerticesData(VertexBuffer::NormalKind, normals, false);
+  }
+
+  babylonMesh->setIndices(indices, vertexCount);
+  babylonMesh->setMaterial(_loadMaterial(gltfRuntime, primitive.material));
 }
 
-void GLTFFileLoader::onShaderCompileSuccess(
-  const IGLTFRuntime& gltfRuntime, ShaderMaterial* shaderMaterial,
-  const IGLTFTechnique& technique, const IGLTFMaterial& material,
-  const std::string& unTreatedUniforms) const
+void GLTFFileLoader::_loadMorphTargets(const IGLTFNode& node,
+                                       const IGLTFMesh& mesh,
+                                       const IGLTFMeshPrimitive& primitive,
+                                       Mesh* babylonMesh)
 {
+  if (primitive.targets.empty()
+      || !stl_util::contains(primitive.attributes, "POSITION")) {
+    return;
+  }
+
+  const auto& weights = node.weights.empty() ? mesh.weights : node.weights;
+  auto manager        = MorphTargetManager::New(babylonMesh->getScene());
+  for (size_t i = 0; i < primitive.targets.size(); ++i) {
+    const auto& target = primitive.targets[i];
+    auto morphTarget   = std::make_unique<MorphTarget>(
+      babylonMesh->name + "_target" + std::to_string(i),
+      (i < weights.size()) ? weights[i] : 0.f);
+
+    // The targets of glTF are displacements, the morph targets are absolute
+    for (auto& semantic : {"POSITION", "NORMAL"}) {
+      if (!stl_util::contains(target, semantic)
+          || !stl_util::contains(primitive.attributes, semantic)) {
+        continue;
+      }
+      const auto base  = _getAccessor(primitive.attributes.at(semantic));
+      const auto delta = _getAccessor(target.at(semantic));
+      if (base.size() != delta.size()) {
+        continue;
+      }
+      Float32Array data(base.size());
+      for (size_t j = 0; j < data.size(); ++j) {
+        data[j] = base[j] + delta[j];
+      }
+      if (std::string(semantic) == "POSITION") {
+        morphTarget->setPositions(data);
+      }
+      else {
+        morphTarget->setNormals(data);
+      }
+    }
+
+    manager->addTarget(std::move(morphTarget));
+  }
+
+  babylonMesh->setMorphTargetManager(manager);
 }
 
-std::string
-GLTFFileLoader::parseShaderUniforms(const Tokenizer& tokenizer,
-                                    const IGLTFTechnique& technique,
-                                    const std::string& unTreatedUniforms) const
+Material* GLTFFileLoader::_loadMaterial(IGLTFRuntime& gltfRuntime,
+                                        int materialIndex)
 {
-  return "";
+  if (materialIndex < 0 && _defaultMaterial) {
+    return _defaultMaterial;
+  }
+  else if (materialIndex >= 0) {
+    const auto& material
+      = gltfRuntime.materials[static_cast<size_t>(materialIndex)];
+    if (material.babylonMaterial) {
+      return material.babylonMaterial;
+    }
+  }
+
+  // Primitives without material use the default material of glTF
+  IGLTFMaterial defaultMaterial;
+  auto& material
+    = (materialIndex >= 0) ?
+        gltfRuntime.materials[static_cast<size_t>(materialIndex)] :
+        defaultMaterial;
+  std::string name = material.name;
+  if (name.empty()) {
+    name = (materialIndex >= 0) ? "material" + std::to_string(materialIndex) :
+                                  "__gltf_default__";
+  }
+
+  const bool rightHanded = gltfRuntime.babylonScene->useRightHandedSystem();
+  const auto& pbr        = material.pbrMetallicRoughness;
+  auto babylonMaterial   = PBRMaterial::New(name, gltfRuntime.babylonScene);
+  babylonMaterial->sideOrientation = Material::CounterClockWiseSideOrientation;
+
+  // Metallic roughness
+  babylonMaterial->albedoColor = Color3(
+    pbr.baseColorFactor[0], pbr.baseColorFactor[1], pbr.baseColorFactor[2]);
+  babylonMaterial->alpha     = pbr.baseColorFactor[3];
+  babylonMaterial->metallic  = pbr.metallicFactor;
+  babylonMaterial->roughness = pbr.roughnessFactor;
+  babylonMaterial->albedoTexture
+    = _loadTexture(gltfRuntime, pbr.baseColorTexture);
+  babylonMaterial->metallicTexture
+    = _loadTexture(gltfRuntime, pbr.metallicRoughnessTexture);
+  if (babylonMaterial->metallicTexture) {
+    babylonMaterial->useMetallnessFromMetallicTextureBlue = true;
+    babylonMaterial->useRoughnessFromMetallicTextureGreen = true;
+    babylonMaterial->useRoughnessFromMetallicTextureAlpha = false;
+  }
+
+  // Normal, occlusion and emissive
+  babylonMaterial->bumpTexture
+    = _loadTexture(gltfRuntime, material.normalTexture);
+  if (babylonMaterial->bumpTexture) {
+    babylonMaterial->bumpTexture->level = material.normalTexture.scale;
+    babylonMaterial->invertNormalMapX   = !rightHanded;
+    babylonMaterial->invertNormalMapY   = rightHanded;
+  }
+  babylonMaterial->ambientTexture
+    = _loadTexture(gltfRuntime, material.occlusionTexture);
+  if (babylonMaterial->ambientTexture) {
+    babylonMaterial->useAmbientInGrayScale = true;
+    babylonMaterial->ambientTextureStrength
+      = material.occlusionTexture.strength;
+  }
+  babylonMaterial->emissiveTexture
+    = _loadTexture(gltfRuntime, material.emissiveTexture);
+  babylonMaterial->emissiveColor
+    = Color3(material.emissiveFactor[0], material.emissiveFactor[1],
+             material.emissiveFactor[2]);
+
+  // Alpha, the cutoff of the masked materials is fixed by the shader
+  switch (material.alphaMode) {
+    case EMaterialAlphaMode::OPAQUE:
+      break;
+    case EMaterialAlphaMode::MASK:
+      if (babylonMaterial->albedoTexture) {
+        babylonMaterial->albedoTexture->setHasAlpha(true);
+      }
+      break;
+    case EMaterialAlphaMode::BLEND:
+      if (babylonMaterial->albedoTexture) {
+        babylonMaterial->albedoTexture->setHasAlpha(true);
+        babylonMaterial->useAlphaFromAlbedoTexture = true;
+      }
+      babylonMaterial->alphaMode = EngineConstants::ALPHA_COMBINE;
+      break;
+  }
+
+  if (material.doubleSided) {
+    babylonMaterial->setBackFaceCulling(false);
+    babylonMaterial->twoSidedLighting = true;
+  }
+
+  if (materialIndex >= 0) {
+    material.babylonMaterial = babylonMaterial;
+  }
+  else {
+    _defaultMaterial = babylonMaterial;
+  }
+  return babylonMaterial;
 }
 
-void GLTFFileLoader::importMaterials(const IGLTFRuntime& gltfRuntime)
+BaseTexture* GLTFFileLoader::_loadTexture(IGLTFRuntime& gltfRuntime,
+                                          const IGLTFTextureInfo& textureInfo)
 {
+  if (textureInfo.index < 0) {
+    return nullptr;
+  }
+
+  auto& texture = gltfRuntime.textures[static_cast<size_t>(textureInfo.index)];
+  if (!texture.babylonTexture && texture.source >= 0) {
+    const auto scene = gltfRuntime.babylonScene;
+    const auto& image = gltfRuntime.images[static_cast<size_t>(texture.source)];
+    const auto sampler
+      = (texture.sampler >= 0) ?
+          gltfRuntime.samplers[static_cast<size_t>(texture.sampler)] :
+          IGLTFSampler();
+    const auto samplingMode = GLTFUtils::GetTextureSamplingMode(sampler);
+
+    // The images are not flipped, the texture coordinates of glTF start at the
+    // top left corner
+    BaseTexture* babylonTexture = nullptr;
+    if (isEmbedded(image)) {
+      const auto& decodedImage = _images[static_cast<size_t>(texture.source)];
+      if (!decodedImage.valid()) {
+        return nullptr;
+      }
+      auto rawTexture = RawTexture::CreateRGBATexture(
+        decodedImage.data, decodedImage.width, decodedImage.height, scene,
+        true, false, samplingMode);
+      babylonTexture = rawTexture.get();
+      babylonTexture->addToScene(std::move(rawTexture));
+    }
+    else {
+      babylonTexture
+        = Texture::New(gltfRuntime.rootUrl + GLTFUtils::DecodeUri(image.uri),
+                       scene, false, false, samplingMode);
+    }
+    babylonTexture->wrapU  = GLTFUtils::GetWrapMode(sampler.wrapS);
+    babylonTexture->wrapV  = GLTFUtils::GetWrapMode(sampler.wrapT);
+    texture.babylonTexture = babylonTexture;
+  }
+
+  if (texture.babylonTexture) {
+    texture.babylonTexture->coordinatesIndex = textureInfo.texCoord;
+  }
+  return texture.babylonTexture;
 }
 
-void GLTFFileLoader::_loadShadersAsync(const IGLTFRuntime& gltfRuntime,
-                                       const std::function<void()>& onload)
+Skeleton* GLTFFileLoader::_loadSkin(IGLTFRuntime& gltfRuntime, int skinIndex)
 {
+  auto& skin = gltfRuntime.skins[static_cast<size_t>(skinIndex)];
+  if (skin.babylonSkeleton) {
+    return skin.babylonSkeleton;
+  }
+
+  const auto id = "skeleton" + std::to_string(skinIndex);
+  skin.babylonSkeleton = new Skeleton(skin.name.empty() ? id : skin.name, id,
+                                      gltfRuntime.babylonScene);
+
+  // The bind matrices are the world matrices of the joints at bind time
+  const auto jointCount = skin.joints.size();
+  std::vector<Matrix> bindMatrices;
+  bindMatrices.reserve(jointCount);
+  const auto inverseBindMatrices
+    = _getAccessor(skin.inverseBindMatrices).toVector();
+  for (size_t i = 0; i < jointCount; ++i) {
+    if (inverseBindMatrices.size() >= (i + 1) * 16) {
+      bindMatrices.emplace_back(inverse(
+        Matrix::FromArray(inverseBindMatrices, static_cast<unsigned>(i * 16))));
+    }
+    else {
+      bindMatrices.emplace_back(_getWorldMatrix(gltfRuntime, skin.joints[i]));
+    }
+  }
+
+  skin.babylonBoneIndices.assign(jointCount, 0);
+  std::vector<Bone*> bones(jointCount, nullptr);
+  for (size_t i = 0; i < jointCount; ++i) {
+    _loadBone(gltfRuntime, skin, static_cast<int>(i), bindMatrices, bones);
+  }
+
+  return skin.babylonSkeleton;
 }
 
-void GLTFFileLoader::_loadBuffersAsync(const IGLTFRuntime& gltfRuntime,
-                                       const std::function<void()>& onload)
+Bone* GLTFFileLoader::_loadBone(IGLTFRuntime& gltfRuntime, IGLTFSkin& skin,
+                                int joint,
+                                const std::vector<Matrix>& bindMatrices,
+                                std::vector<Bone*>& bones)
 {
+  const auto jointIndex = static_cast<size_t>(joint);
+  if (bones[jointIndex]) {
+    return bones[jointIndex];
+  }
+
+  // The parent bone is the bone of the nearest ancestor joint
+  const auto nodeIndex = skin.joints[jointIndex];
+  auto& node           = gltfRuntime.nodes[static_cast<size_t>(nodeIndex)];
+  int parentJoint      = -1;
+  for (int parent = node.parent; parent != -1 && parentJoint == -1;
+       parent     = gltfRuntime.nodes[static_cast<size_t>(parent)].parent) {
+    auto it = std::find(skin.joints.begin(), skin.joints.end(), parent);
+    if (it != skin.joints.end()) {
+      parentJoint = static_cast<int>(it - skin.joints.begin());
+    }
+  }
+
+  // The offset brings the node matrix into the space of the parent bone, over
+  // the nodes between the joint and its parent joint
+  Bone* parentBone  = nullptr;
+  Matrix bindMatrix = bindMatrices[jointIndex];
+  Matrix offset     = (node.parent != -1) ?
+                    _getWorldMatrix(gltfRuntime, node.parent) :
+                    Matrix::Identity();
+  if (parentJoint != -1) {
+    const auto parentIndex = static_cast<size_t>(parentJoint);
+    parentBone
+      = _loadBone(gltfRuntime, skin, parentJoint, bindMatrices, bones);
+    bindMatrix = multiply(bindMatrix, inverse(bindMatrices[parentIndex]));
+    offset = multiply(offset, inverse(_getWorldMatrix(
+                                gltfRuntime, skin.joints[parentIndex])));
+  }
+
+  auto skeleton                       = skin.babylonSkeleton;
+  skin.babylonBoneIndices[jointIndex] = skeleton->bones.size();
+  auto bone = Bone::New(getNodeName(node, nodeIndex), skeleton, parentBone,
+                        bindMatrix);
+
+  // The bones start in the pose of the nodes
+  bone->updateMatrix(multiply(_getNodeMatrix(node), offset), false);
+  node.babylonBones.emplace_back(IGLTFJointBone{bone, offset});
+  bones[jointIndex] = bone;
+  return bone;
 }
 
-void GLTFFileLoader::_createNodes(const IGLTFRuntime& gltfRuntime) const
+void GLTFFileLoader::_loadAnimations(IGLTFRuntime& gltfRuntime)
 {
+  // The animations are laid out one after the other, each in its own range
+  std::vector<AnimatedProperty> properties;
+  std::map<std::pair<std::vector<Animation*>*, std::string>, size_t>
+    propertyIndices;
+  std::vector<std::pair<int, int>> ranges;
+  const auto animationCount = gltfRuntime.animations.size();
+
+  // Returns the animated property, holding its rest value over the previous
+  // animations when it was not animated yet
+  const auto getProperty
+    = [&](std::vector<Animation*>& animations, const std::string& name,
+          const std::string& property, unsigned int dataType,
+          const AnimationValue& restValue) -> AnimatedProperty& {
+    const auto key = std::make_pair(&animations, property);
+    auto it        = propertyIndices.find(key);
+    if (it == propertyIndices.end()) {
+      it = propertyIndices.emplace(key, properties.size()).first;
+      properties.emplace_back(AnimatedProperty{&animations, name, property,
+                                               dataType, restValue, {},
+                                               animationCount});
+      for (auto& range : ranges) {
+        properties.back().addRestKeys(range.first, range.second);
+      }
+    }
+    return properties[it->second];
+  };
+
+  const auto toFrame = [](float time) {
+    return static_cast<int>(std::round(time * AnimationFPS));
+  };
+
+  int frameOffset = 0;
+  for (size_t a = 0; a < animationCount; ++a) {
+    const auto& animation = gltfRuntime.animations[a];
+    int lastFrame         = frameOffset;
+
+    // Channels of the joint nodes, sampled into bone matrices below
+    std::map<int, std::vector<std::pair<std::string, AnimationSampler>>>
+      jointChannels;
+
+    for (auto& channel : animation.channels) {
+      if (channel.target.node < 0) {
+        continue;
+      }
+      const auto& path = channel.target.path;
+      const auto& node
+        = gltfRuntime.nodes[static_cast<size_t>(channel.target.node)];
+      const auto& gltfSampler
+        = animation.samplers[static_cast<size_t>(channel.sampler)];
+      AnimationSampler sampler{_getAccessor(gltfSampler.input),
+                               _getAccessor(gltfSampler.output),
+                               (path == "rotation") ? 4u : 3u,
+                               gltfSampler.interpolation};
+      const auto valueCount = sampler.input.size() * sampler.numComponents
+                              * (sampler.cubic() ? 3 : 1);
+      if (path == "weights") {
+        BABYLON_LOG_WARN("GLTFFileLoader",
+                         "Morph target weights animations are not supported");
+        continue;
+      }
+      if ((path != "translation" && path != "rotation" && path != "scale")
+          || sampler.input.empty() || sampler.output.size() != valueCount) {
+        BABYLON_LOG_WARN("GLTFFileLoader", "Skipping invalid channel of ",
+                         "animation ", animation.name);
+        continue;
+      }
+
+      lastFrame = std::max(lastFrame, frameOffset + toFrame(sampler.input[
+                                        sampler.input.size() - 1]));
+      if (!node.babylonBones.empty()) {
+        jointChannels[channel.target.node].emplace_back(path, sampler);
+      }
+      if (!node.babylonMesh) {
+        continue;
+      }
+
+      // Node property keys
+      auto mesh = node.babylonMesh;
+      auto& animatedProperty
+        = (path == "translation") ?
+            getProperty(mesh->animations, mesh->name, "position",
+                        Animation::ANIMATIONTYPE_VECTOR3,
+                        AnimationValue(mesh->position())) :
+            (path == "rotation") ?
+            getProperty(mesh->animations, mesh->name, "rotationQuaternion",
+                        Animation::ANIMATIONTYPE_QUATERNION,
+                        AnimationValue(mesh->rotationQuaternion())) :
+            getProperty(mesh->animations, mesh->name, "scaling",
+                        Animation::ANIMATIONTYPE_VECTOR3,
+                        AnimationValue(mesh->scaling()));
+      animatedProperty.lastAnimation = a;
+      const auto n = sampler.numComponents;
+      for (size_t k = 0; k < sampler.input.size(); ++k) {
+        const auto frame = frameOffset + toFrame(sampler.input[k]);
+        if (sampler.interpolation == EAnimationInterpolation::STEP && k > 0) {
+          // The value holds until the next key
+          animatedProperty.addKey(
+            AnimationKey(frame - 1, toAnimationValue(sampler.value(k - 1), n)));
+        }
+        AnimationKey key(frame, toAnimationValue(sampler.value(k), n));
+        if (sampler.cubic()) {
+          // The tangents of glTF are per second, the tangents of the keys are
+          // per frame
+          std::array<float, 4> inTangent, outTangent;
+          for (size_t c = 0; c < n; ++c) {
+            inTangent[c]  = sampler.tangent(k, false)[c] / AnimationFPS;
+            outTangent[c] = sampler.tangent(k, true)[c] / AnimationFPS;
+          }
+          key.inTangent  = toAnimationValue(inTangent.data(), n);
+          key.outTangent = toAnimationValue(outTangent.data(), n);
+        }
+        animatedProperty.addKey(std::move(key));
+      }
+    }
+
+    // Bone keys, the local matrices of the joint nodes sampled at the union
+    // of the key times of their channels
+    for (auto& item : jointChannels) {
+      const auto& node = gltfRuntime.nodes[static_cast<size_t>(item.first)];
+      std::vector<float> times;
+      for (auto& channel : item.second) {
+        times.insert(times.end(), channel.second.input.begin(),
+                     channel.second.input.end());
+      }
+      std::sort(times.begin(), times.end());
+
+      Vector3 restScaling(1.f, 1.f, 1.f), restPosition;
+      Quaternion restRotation;
+      _getNodeMatrix(node).decompose(restScaling, restRotation, restPosition);
+      for (auto& jointBone : node.babylonBones) {
+        auto bone              = jointBone.bone;
+        auto& animatedProperty = getProperty(
+          bone->animations, bone->name, "_matrix",
+          Animation::ANIMATIONTYPE_MATRIX,
+          AnimationValue(bone->getLocalMatrix()));
+        animatedProperty.lastAnimation = a;
+        for (auto time : times) {
+          auto scaling  = restScaling;
+          auto rotation = restRotation;
+          auto position = restPosition;
+          for (auto& channel : item.second) {
+            std::array<float, 4> value;
+            channel.second.evaluate(time, value.data());
+            if (channel.first == "translation") {
+              position.copyFromFloats(value[0], value[1], value[2]);
+            }
+            else if (channel.first == "rotation") {
+              rotation.copyFromFloats(value[0], value[1], value[2], value[3]);
+              rotation.normalize();
+            }
+            else {
+              scaling.copyFromFloats(value[0], value[1], value[2]);
+            }
+          }
+          auto local = Matrix::Compose(scaling, rotation, position);
+          animatedProperty.addKey(
+            AnimationKey(frameOffset + toFrame(time),
+                         AnimationValue(multiply(local, jointBone.offset))));
+        }
+      }
+    }
+
+    // The properties not animated by this animation hold their rest value
+    for (auto& animatedProperty : properties) {
+      if (animatedProperty.lastAnimation != a) {
+        animatedProperty.addRestKeys(frameOffset, lastFrame);
+      }
+    }
+
+    ranges.emplace_back(frameOffset, lastFrame);
+    frameOffset = lastFrame + 1;
+  }
+
+  // Animation objects
+  std::vector<IAnimatable*> targets;
+  std::vector<Mesh*> animatedMeshes;
+  std::vector<Skeleton*> animatedSkeletons;
+  for (auto& animatedProperty : properties) {
+    auto babylonAnimation = new Animation(
+      animatedProperty.name + "_" + animatedProperty.property,
+      animatedProperty.property, static_cast<size_t>(AnimationFPS),
+      static_cast<int>(animatedProperty.dataType),
+      Animation::ANIMATIONLOOPMODE_CYCLE);
+    babylonAnimation->allowMatricesInterpolation
+      = (animatedProperty.dataType == Animation::ANIMATIONTYPE_MATRIX);
+    babylonAnimation->setKeys(animatedProperty.keys);
+    animatedProperty.animations->emplace_back(babylonAnimation);
+  }
+  for (auto& node : gltfRuntime.nodes) {
+    if (node.babylonMesh && !node.babylonMesh->animations.empty()) {
+      animatedMeshes.emplace_back(node.babylonMesh);
+      targets.emplace_back(node.babylonMesh);
+    }
+  }
+  for (auto& skin : gltfRuntime.skins) {
+    auto skeleton = skin.babylonSkeleton;
+    if (skeleton
+        && std::any_of(skeleton->bones.begin(), skeleton->bones.end(),
+                       [](const std::unique_ptr<Bone>& bone) {
+                         return !bone->animations.empty();
+                       })) {
+      animatedSkeletons.emplace_back(skeleton);
+      targets.emplace_back(skeleton);
+    }
+  }
+
+  // Named ranges, the first animation is started
+  for (size_t a = 0; a < ranges.size(); ++a) {
+    const auto& name = gltfRuntime.animations[a].name;
+    const auto rangeName
+      = name.empty() ? "animation" + std::to_string(a) : name;
+    for (auto mesh : animatedMeshes) {
+      mesh->createAnimationRange(rangeName, ranges[a].first, ranges[a].second);
+    }
+    for (auto skeleton : animatedSkeletons) {
+      skeleton->createAnimationRange(rangeName, ranges[a].first,
+                                     ranges[a].second);
+    }
+  }
+  if (!ranges.empty()) {
+    for (auto target : targets) {
+      gltfRuntime.babylonScene->beginAnimation(
+        target, static_cast<float>(ranges[0].first),
+        static_cast<float>(ranges[0].second), true);
+    }
+  }
 }
 
 } // end of namespace BABYLON
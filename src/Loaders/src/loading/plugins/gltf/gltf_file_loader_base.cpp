@@ -1,178 +1,818 @@
 #include <babylon/loading/plugins/gltf/gltf_file_loader_base.h>
 
 #include <babylon/core/json.h>
-#include <babylon/loading/plugins/gltf/gltf_file_loader.h>
+#include <babylon/loading/plugins/gltf/gltf_file_loader_utils.h>
 
 namespace BABYLON {
 
-IGLTFRuntime CreateRuntime(const Json::value& parsedData, Scene* scene,
-                           const std::string& rootUrl)
+namespace {
+
+uint32_t readUint32(const uint8_t* data)
 {
-  IGLTFRuntime gltfRuntime;
-  gltfRuntime.buffersCount     = 0;
-  gltfRuntime.shaderscount     = 0;
-  gltfRuntime.scene            = scene;
-  gltfRuntime.loadedBuffers    = 0;
-  gltfRuntime.loadedShaders    = 0;
-  gltfRuntime.rootUrl          = rootUrl;
-  gltfRuntime.importOnlyMeshes = false;
+  uint32_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+int getIndex(const Json::value& parsedObject, const std::string& key)
+{
+  return Json::GetNumber(parsedObject, key, -1);
+}
+
+std::vector<int> getIndices(const Json::value& parsedObject,
+                            const std::string& key)
+{
+  return Json::ToArray<int>(parsedObject, key);
+}
+
+std::unordered_map<std::string, int>
+parseAttributes(const Json::value& parsedAttributes)
+{
+  std::unordered_map<std::string, int> attributes;
+  for (auto& item : parsedAttributes.get<Json::object>()) {
+    attributes[item.first] = static_cast<int>(item.second.get<double>());
+  }
+  return attributes;
+}
+
+IGLTFTextureInfo parseTextureInfo(const Json::value& parsedObject,
+                                  const std::string& key)
+{
+  IGLTFTextureInfo textureInfo;
+  if (parsedObject.contains(key)) {
+    const auto& parsedTextureInfo = parsedObject.get(key);
+    textureInfo.index             = getIndex(parsedTextureInfo, "index");
+    textureInfo.texCoord = Json::GetNumber(parsedTextureInfo, "texCoord", 0u);
+    textureInfo.scale    = Json::GetNumber(parsedTextureInfo, "scale", 1.f);
+    textureInfo.strength = Json::GetNumber(parsedTextureInfo, "strength", 1.f);
+  }
+  return textureInfo;
+}
+
+IGLTFAccessor parseAccessor(const Json::value& parsedAccessor)
+{
+  IGLTFAccessor accessor;
+  accessor.name          = Json::GetString(parsedAccessor, "name");
+  accessor.bufferView    = getIndex(parsedAccessor, "bufferView");
+  accessor.byteOffset    = Json::GetNumber(parsedAccessor, "byteOffset", 0ull);
+  accessor.componentType = static_cast<EComponentType>(
+    Json::GetNumber(parsedAccessor, "componentType", 0));
+  accessor.normalized = Json::GetBool(parsedAccessor, "normalized");
+  accessor.count      = Json::GetNumber(parsedAccessor, "count", 0ull);
+  accessor.type       = Json::GetString(parsedAccessor, "type");
+  accessor.max        = Json::ToArray<float>(parsedAccessor, "max");
+  accessor.min        = Json::ToArray<float>(parsedAccessor, "min");
+  if (parsedAccessor.contains("sparse")) {
+    const auto& parsedSparse = parsedAccessor.get("sparse");
+    const auto& parsedIndices = parsedSparse.get("indices");
+    const auto& parsedValues  = parsedSparse.get("values");
+    auto& sparse              = accessor.sparse;
+    sparse.count = Json::GetNumber(parsedSparse, "count", 0ull);
+    sparse.indices.bufferView = getIndex(parsedIndices, "bufferView");
+    sparse.indices.byteOffset
+      = Json::GetNumber(parsedIndices, "byteOffset", 0ull);
+    sparse.indices.componentType = static_cast<EComponentType>(
+      Json::GetNumber(parsedIndices, "componentType", 0));
+    sparse.values.bufferView = getIndex(parsedValues, "bufferView");
+    sparse.values.byteOffset
+      = Json::GetNumber(parsedValues, "byteOffset", 0ull);
+  }
+  return accessor;
+}
+
+IGLTFAnimation parseAnimation(const Json::value& parsedAnimation)
+{
+  IGLTFAnimation animation;
+  animation.name = Json::GetString(parsedAnimation, "name");
+  for (auto& parsedChannel : Json::GetArray(parsedAnimation, "channels")) {
+    IGLTFAnimationChannel channel;
+    channel.sampler = getIndex(parsedChannel, "sampler");
+    if (parsedChannel.contains("target")) {
+      const auto& parsedTarget = parsedChannel.get("target");
+      channel.target.node      = getIndex(parsedTarget, "node");
+      channel.target.path      = Json::GetString(parsedTarget, "path");
+    }
+    animation.channels.emplace_back(channel);
+  }
+  for (auto& parsedSampler : Json::GetArray(parsedAnimation, "samplers")) {
+    IGLTFAnimationSampler sampler;
+    sampler.input  = getIndex(parsedSampler, "input");
+    sampler.output = getIndex(parsedSampler, "output");
+    const auto interpolation
+      = Json::GetString(parsedSampler, "interpolation", "LINEAR");
+    if (interpolation == "STEP") {
+      sampler.interpolation = EAnimationInterpolation::STEP;
+    }
+    else if (interpolation == "CUBICSPLINE") {
+      sampler.interpolation = EAnimationInterpolation::CUBICSPLINE;
+    }
+    animation.samplers.emplace_back(sampler);
+  }
+  return animation;
+}
+
+IGLTFMaterial parseMaterial(const Json::value& parsedMaterial)
+{
+  IGLTFMaterial material;
+  material.name = Json::GetString(parsedMaterial, "name");
+  if (parsedMaterial.contains("pbrMetallicRoughness")) {
+    const auto& parsedPbr = parsedMaterial.get("pbrMetallicRoughness");
+    auto& pbr             = material.pbrMetallicRoughness;
+    if (parsedPbr.contains("baseColorFactor")) {
+      pbr.baseColorFactor = Json::ToArray<float>(parsedPbr, "baseColorFactor");
+    }
+    pbr.baseColorTexture = parseTextureInfo(parsedPbr, "baseColorTexture");
+    pbr.metallicFactor   = Json::GetNumber(parsedPbr, "metallicFactor", 1.f);
+    pbr.roughnessFactor  = Json::GetNumber(parsedPbr, "roughnessFactor", 1.f);
+    pbr.metallicRoughnessTexture
+      = parseTextureInfo(parsedPbr, "metallicRoughnessTexture");
+  }
+  material.normalTexture = parseTextureInfo(parsedMaterial, "normalTexture");
+  material.occlusionTexture
+    = parseTextureInfo(parsedMaterial, "occlusionTexture");
+  material.emissiveTexture
+    = parseTextureInfo(parsedMaterial, "emissiveTexture");
+  if (parsedMaterial.contains("emissiveFactor")) {
+    material.emissiveFactor
+      = Json::ToArray<float>(parsedMaterial, "emissiveFactor");
+  }
+  const auto alphaMode = Json::GetString(parsedMaterial, "alphaMode", "OPAQUE");
+  if (alphaMode == "MASK") {
+    material.alphaMode = EMaterialAlphaMode::MASK;
+  }
+  else if (alphaMode == "BLEND") {
+    material.alphaMode = EMaterialAlphaMode::BLEND;
+  }
+  material.alphaCutoff = Json::GetNumber(parsedMaterial, "alphaCutoff", 0.5f);
+  material.doubleSided = Json::GetBool(parsedMaterial, "doubleSided");
+  return material;
+}
+
+IGLTFMesh parseMesh(const Json::value& parsedMesh)
+{
+  IGLTFMesh mesh;
+  mesh.name    = Json::GetString(parsedMesh, "name");
+  mesh.weights = Json::ToArray<float>(parsedMesh, "weights");
+  for (auto& parsedPrimitive : Json::GetArray(parsedMesh, "primitives")) {
+    IGLTFMeshPrimitive primitive;
+    primitive.attributes = parseAttributes(parsedPrimitive.get("attributes"));
+    primitive.indices    = getIndex(parsedPrimitive, "indices");
+    primitive.material   = getIndex(parsedPrimitive, "material");
+    primitive.mode       = static_cast<EMeshPrimitiveMode>(
+      Json::GetNumber(parsedPrimitive, "mode", 4));
+    for (auto& parsedTarget : Json::GetArray(parsedPrimitive, "targets")) {
+      primitive.targets.emplace_back(parseAttributes(parsedTarget));
+    }
+    mesh.primitives.emplace_back(primitive);
+  }
+  return mesh;
+}
+
+IGLTFNode parseNode(const Json::value& parsedNode)
+{
+  IGLTFNode node;
+  node.name        = Json::GetString(parsedNode, "name");
+  node.camera      = getIndex(parsedNode, "camera");
+  node.children    = getIndices(parsedNode, "children");
+  node.skin        = getIndex(parsedNode, "skin");
+  node.matrix      = Json::ToArray<float>(parsedNode, "matrix");
+  node.mesh        = getIndex(parsedNode, "mesh");
+  node.rotation    = Json::ToArray<float>(parsedNode, "rotation");
+  node.scale       = Json::ToArray<float>(parsedNode, "scale");
+  node.translation = Json::ToArray<float>(parsedNode, "translation");
+  node.weights     = Json::ToArray<float>(parsedNode, "weights");
+  return node;
+}
+
+IGLTFSampler parseSampler(const Json::value& parsedSampler)
+{
+  IGLTFSampler sampler;
+  sampler.name      = Json::GetString(parsedSampler, "name");
+  sampler.magFilter = static_cast<ETextureFilterType>(
+    Json::GetNumber(parsedSampler, "magFilter", 9729));
+  sampler.minFilter = static_cast<ETextureFilterType>(
+    Json::GetNumber(parsedSampler, "minFilter", 9987));
+  sampler.wrapS = static_cast<ETextureWrapMode>(
+    Json::GetNumber(parsedSampler, "wrapS", 10497));
+  sampler.wrapT = static_cast<ETextureWrapMode>(
+    Json::GetNumber(parsedSampler, "wrapT", 10497));
+  return sampler;
+}
+
+template <typename T, typename F>
+void parseArray(const Json::value& parsedData, const std::string& key,
+                std::vector<T>& objects, F&& parse)
+{
+  const auto& parsedObjects = Json::GetArray(parsedData, key);
+  objects.clear();
+  objects.reserve(parsedObjects.size());
+  for (auto& parsedObject : parsedObjects) {
+    objects.emplace_back(parse(parsedObject));
+  }
+}
+
+bool isValid(int index, size_t size)
+{
+  return index >= 0 && static_cast<size_t>(index) < size;
+}
+
+bool isValidOrUndefined(int index, size_t size)
+{
+  return index == -1 || isValid(index, size);
+}
+
+bool isValidTexture(const IGLTFTextureInfo& textureInfo, size_t size)
+{
+  return isValidOrUndefined(textureInfo.index, size);
+}
+
+// Checks the references between the objects of the runtime, so that they can
+// be followed without bounds checking
+std::string validate(IGLTFRuntime& gltfRuntime)
+{
+  const auto& rt = gltfRuntime;
+
+  for (auto& accessor : rt.accessors) {
+    const auto& sparse = accessor.sparse;
+    if (!isValidOrUndefined(accessor.bufferView, rt.bufferViews.size())
+        || GLTFUtils::GetNumComponents(accessor.type) == 0
+        || GLTFUtils::GetComponentSize(accessor.componentType) == 0
+        || (sparse.count > 0
+            && (!isValid(sparse.indices.bufferView, rt.bufferViews.size())
+                || !isValid(sparse.values.bufferView, rt.bufferViews.size())
+                || sparse.indices.componentType == EComponentType::FLOAT
+                || GLTFUtils::GetComponentSize(sparse.indices.componentType)
+                     == 0))) {
+      return "invalid accessor " + accessor.name;
+    }
+  }
+
+  for (auto& animation : rt.animations) {
+    for (auto& channel : animation.channels) {
+      if (!isValid(channel.sampler, animation.samplers.size())
+          || !isValidOrUndefined(channel.target.node, rt.nodes.size())) {
+        return "invalid animation channel in " + animation.name;
+      }
+    }
+    for (auto& sampler : animation.samplers) {
+      if (!isValid(sampler.input, rt.accessors.size())
+          || !isValid(sampler.output, rt.accessors.size())) {
+        return "invalid animation sampler in " + animation.name;
+      }
+    }
+  }
+
+  for (auto& bufferView : rt.bufferViews) {
+    if (!isValid(bufferView.buffer, rt.buffers.size())) {
+      return "invalid buffer view " + bufferView.name;
+    }
+  }
+
+  for (auto& image : rt.images) {
+    if (!isValidOrUndefined(image.bufferView, rt.bufferViews.size())) {
+      return "invalid image " + image.name;
+    }
+  }
 
-  // Parse
-  // 1. Parse buffers
-  if (parsedData.contains("buffers")
-      && parsedData.get("buffers").is<Json::object>()) {
-    GLTFFileLoader::parseBuffers(parsedData.get("buffers").get<Json::object>(),
-                                 gltfRuntime);
+  const auto textureCount = rt.textures.size();
+  for (auto& material : rt.materials) {
+    const auto& pbr = material.pbrMetallicRoughness;
+    if (pbr.baseColorFactor.size() != 4 || material.emissiveFactor.size() != 3
+        || !isValidTexture(pbr.baseColorTexture, textureCount)
+        || !isValidTexture(pbr.metallicRoughnessTexture, textureCount)
+        || !isValidTexture(material.normalTexture, textureCount)
+        || !isValidTexture(material.occlusionTexture, textureCount)
+        || !isValidTexture(material.emissiveTexture, textureCount)) {
+      return "invalid material " + material.name;
+    }
   }
 
-  // 2. Parse bufferViews
-  if (parsedData.contains("bufferViews")
-      && parsedData.get("bufferViews").is<Json::object>()) {
-    GLTFFileLoader::parseObject(
-      parsedData.get("bufferViews").get<Json::object>(), "bufferViews",
-      gltfRuntime);
+  for (auto& mesh : rt.meshes) {
+    for (auto& primitive : mesh.primitives) {
+      bool valid
+        = isValidOrUndefined(primitive.indices, rt.accessors.size())
+          && isValidOrUndefined(primitive.material, rt.materials.size());
+      for (auto& attribute : primitive.attributes) {
+        valid = valid && isValid(attribute.second, rt.accessors.size());
+      }
+      for (auto& target : primitive.targets) {
+        for (auto& attribute : target) {
+          valid = valid && isValid(attribute.second, rt.accessors.size());
+        }
+      }
+      if (!valid) {
+        return "invalid primitive in mesh " + mesh.name;
+      }
+    }
   }
 
-  // 3. Parse accessors
-  if (parsedData.contains("accessors")
-      && parsedData.get("accessors").is<Json::object>()) {
-    GLTFFileLoader::parseObject(parsedData.get("accessors").get<Json::object>(),
-                                "accessors", gltfRuntime);
+  // Parents, each node has at most one parent
+  auto& nodes = gltfRuntime.nodes;
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    auto& node = nodes[i];
+    if (!isValidOrUndefined(node.mesh, rt.meshes.size())
+        || !isValidOrUndefined(node.skin, rt.skins.size())
+        || (!node.matrix.empty() && node.matrix.size() != 16)
+        || (!node.rotation.empty() && node.rotation.size() != 4)
+        || (!node.scale.empty() && node.scale.size() != 3)
+        || (!node.translation.empty() && node.translation.size() != 3)) {
+      return "invalid node " + node.name;
+    }
+    for (auto child : node.children) {
+      if (!isValid(child, nodes.size()) || nodes[child].parent != -1) {
+        return "invalid children of node " + node.name;
+      }
+      nodes[child].parent = static_cast<int>(i);
+    }
   }
 
-  // 4. Parse meshes
-  if (parsedData.contains("meshes")
-      && parsedData.get("meshes").is<Json::object>()) {
-    GLTFFileLoader::parseObject(parsedData.get("meshes").get<Json::object>(),
-                                "meshes", gltfRuntime);
+  // No cycles, the hierarchies end with root nodes
+  for (auto& node : nodes) {
+    size_t depth = 0;
+    for (int parent = node.parent; parent != -1;
+         parent     = nodes[parent].parent) {
+      if (++depth > nodes.size()) {
+        return "cycle in the hierarchy of node " + node.name;
+      }
+    }
   }
 
-  // 5. Parse lights
-  if (parsedData.contains("lights")
-      && parsedData.get("lights").is<Json::object>()) {
-    GLTFFileLoader::parseObject(parsedData.get("lights").get<Json::object>(),
-                                "lights", gltfRuntime);
+  for (auto& scene : rt.scenes) {
+    for (auto node : scene.nodes) {
+      if (!isValid(node, nodes.size())) {
+        return "invalid scene " + scene.name;
+      }
+    }
   }
 
-  // 6. Parse cameras
-  if (parsedData.contains("cameras")
-      && parsedData.get("cameras").is<Json::object>()) {
-    GLTFFileLoader::parseObject(parsedData.get("cameras").get<Json::object>(),
-                                "cameras", gltfRuntime);
+  for (auto& skin : rt.skins) {
+    bool valid
+      = isValidOrUndefined(skin.inverseBindMatrices, rt.accessors.size())
+        && isValidOrUndefined(skin.skeleton, nodes.size());
+    for (auto joint : skin.joints) {
+      valid = valid && isValid(joint, nodes.size());
+    }
+    if (!valid) {
+      return "invalid skin " + skin.name;
+    }
   }
 
-  // 6. Parse nodes
-  if (parsedData.contains("nodes")
-      && parsedData.get("nodes").is<Json::object>()) {
-    GLTFFileLoader::parseObject(parsedData.get("nodes").get<Json::object>(),
-                                "nodes", gltfRuntime);
+  for (auto& texture : rt.textures) {
+    if (!isValidOrUndefined(texture.sampler, rt.samplers.size())
+        || !isValidOrUndefined(texture.source, rt.images.size())) {
+      return "invalid texture " + texture.name;
+    }
   }
 
-  // 7. Parse images
-  if (parsedData.contains("images")
-      && parsedData.get("images").is<Json::object>()) {
-    GLTFFileLoader::parseObject(parsedData.get("images").get<Json::object>(),
-                                "images", gltfRuntime);
+  if (!isValidOrUndefined(rt.scene, rt.scenes.size())) {
+    return "invalid default scene";
   }
 
-  // 8. Parse textures
-  if (parsedData.contains("textures")
-      && parsedData.get("textures").is<Json::object>()) {
-    GLTFFileLoader::parseObject(parsedData.get("textures").get<Json::object>(),
-                                "textures", gltfRuntime);
+  return "";
+}
+
+// Returns the elements of a buffer view range, viewed as count elements of
+// the given layout
+bool getView(const IGLTFRuntime& gltfRuntime, int bufferViewIndex,
+             size_t byteOffset, size_t count, size_t numComponents,
+             EComponentType componentType, bool normalized,
+             size_t byteStride, IGLTFAccessorView& view)
+{
+  const auto data
+    = GLTFFileLoaderBase::GetBufferViewData(gltfRuntime, bufferViewIndex);
+  if (!data) {
+    return false;
   }
 
-  // 9. Parse shaders
-  if (parsedData.contains("shaders")
-      && parsedData.get("shaders").is<Json::object>()) {
-    GLTFFileLoader::parseObject(parsedData.get("shaders").get<Json::object>(),
-                                "shaders", gltfRuntime);
+  const auto& bufferView = gltfRuntime.bufferViews[bufferViewIndex];
+  const auto elementSize
+    = numComponents * GLTFUtils::GetComponentSize(componentType);
+  const auto stride = (byteStride > 0) ? byteStride : elementSize;
+  if (count > 0
+      && (byteOffset > bufferView.byteLength
+          || elementSize > bufferView.byteLength - byteOffset
+          || (count - 1) > (bufferView.byteLength - byteOffset - elementSize)
+                             / stride)) {
+    return false;
   }
 
-  // 10. Parse programs
-  if (parsedData.contains("programs")
-      && parsedData.get("programs").is<Json::object>()) {
-    GLTFFileLoader::parseObject(parsedData.get("programs").get<Json::object>(),
-                                "programs", gltfRuntime);
+  view.data          = data + byteOffset;
+  view.count         = count;
+  view.numComponents = numComponents;
+  view.componentType = componentType;
+  view.normalized    = normalized;
+  view.byteStride    = stride;
+  return true;
+}
+
+template <typename T>
+void readComponents(const IGLTFAccessorView& view, float* data)
+{
+  // Normalized integers map their range to [0, 1] or [-1, 1]
+  float scale   = 1.f;
+  float minimum = std::numeric_limits<float>::lowest();
+  if (view.normalized) {
+    scale = 1.f / static_cast<float>(std::numeric_limits<T>::max());
+    if (std::is_signed<T>::value) {
+      minimum = -1.f;
+    }
+  }
+  for (size_t i = 0; i < view.count; ++i) {
+    const auto element = view.data + i * view.byteStride;
+    for (size_t c = 0; c < view.numComponents; ++c) {
+      T value;
+      std::memcpy(&value, element + c * sizeof(T), sizeof(T));
+      *data++ = std::max(static_cast<float>(value) * scale, minimum);
+    }
   }
+}
 
-  // 11. Parse samplers
-  if (parsedData.contains("samplers")
-      && parsedData.get("samplers").is<Json::object>()) {
-    GLTFFileLoader::parseObject(parsedData.get("samplers").get<Json::object>(),
-                                "samplers", gltfRuntime);
+void readElements(const IGLTFAccessorView& view, float* data)
+{
+  switch (view.componentType) {
+    case EComponentType::BYTE:
+      readComponents<int8_t>(view, data);
+      break;
+    case EComponentType::UNSIGNED_BYTE:
+      readComponents<uint8_t>(view, data);
+      break;
+    case EComponentType::SHORT:
+      readComponents<int16_t>(view, data);
+      break;
+    case EComponentType::UNSIGNED_SHORT:
+      readComponents<uint16_t>(view, data);
+      break;
+    case EComponentType::UNSIGNED_INT:
+      readComponents<uint32_t>(view, data);
+      break;
+    case EComponentType::FLOAT:
+      if (GLTFFileLoaderBase::IsPackedFloat(view)) {
+        std::memcpy(data, view.data, view.count * view.byteStride);
+      }
+      else {
+        readComponents<float>(view, data);
+      }
+      break;
   }
+}
+
+template <typename T>
+void readIndexComponents(const IGLTFAccessorView& view, uint32_t* indices)
+{
+  for (size_t i = 0; i < view.count; ++i) {
+    T value;
+    std::memcpy(&value, view.data + i * view.byteStride, sizeof(T));
+    indices[i] = value;
+  }
+}
 
-  // 12. Parse techniques
-  if (parsedData.contains("techniques")
-      && parsedData.get("techniques").is<Json::object>()) {
-    GLTFFileLoader::parseObject(
-      parsedData.get("techniques").get<Json::object>(), "techniques",
-      gltfRuntime);
+bool readIndexElements(const IGLTFAccessorView& view, uint32_t* indices)
+{
+  switch (view.componentType) {
+    case EComponentType::UNSIGNED_BYTE:
+      readIndexComponents<uint8_t>(view, indices);
+      return true;
+    case EComponentType::UNSIGNED_SHORT:
+      readIndexComponents<uint16_t>(view, indices);
+      return true;
+    case EComponentType::UNSIGNED_INT:
+      if (view.byteStride == sizeof(uint32_t)) {
+        std::memcpy(indices, view.data, view.count * sizeof(uint32_t));
+      }
+      else {
+        readIndexComponents<uint32_t>(view, indices);
+      }
+      return true;
+    default:
+      return false;
   }
+}
 
-  // 14. Parse materials
-  if (parsedData.contains("materials")
-      && parsedData.get("materials").is<Json::object>()) {
-    GLTFFileLoader::parseObject(parsedData.get("materials").get<Json::object>(),
-                                "materials", gltfRuntime);
+// Substitutes the sparse values of an accessor into its elements
+template <typename T, typename F>
+bool applySparse(const IGLTFRuntime& gltfRuntime, const IGLTFAccessor& accessor,
+                 size_t numComponents, std::vector<T>& data, F&& read)
+{
+  const auto& sparse = accessor.sparse;
+  if (sparse.count == 0) {
+    return true;
   }
 
-  // 15. Parse animations
-  if (parsedData.contains("animations")
-      && parsedData.get("animations").is<Json::object>()) {
-    GLTFFileLoader::parseObject(
-      parsedData.get("animations").get<Json::object>(), "animations",
-      gltfRuntime);
+  IGLTFAccessorView indicesView, valuesView;
+  if (!getView(gltfRuntime, sparse.indices.bufferView,
+               sparse.indices.byteOffset, sparse.count, 1,
+               sparse.indices.componentType, false, 0, indicesView)
+      || !getView(gltfRuntime, sparse.values.bufferView,
+                  sparse.values.byteOffset, sparse.count, numComponents,
+                  accessor.componentType, accessor.normalized, 0,
+                  valuesView)) {
+    return false;
   }
 
-  // 16. Parse skins
-  if (parsedData.contains("skins")
-      && parsedData.get("skins").is<Json::object>()) {
-    GLTFFileLoader::parseObject(parsedData.get("skins").get<Json::object>(),
-                                "skins", gltfRuntime);
+  Uint32Array indices(sparse.count);
+  std::vector<T> values(sparse.count * numComponents);
+  if (!readIndexElements(indicesView, indices.data())
+      || !read(valuesView, values.data())) {
+    return false;
   }
 
-  // 17. Parse scene
-  if (parsedData.contains("scene") && parsedData.contains("scenes")) {
-    // gltfRuntime.currentScene = parsedData.scenes[parsedData.scene];
+  for (size_t i = 0; i < sparse.count; ++i) {
+    if (indices[i] >= accessor.count) {
+      return false;
+    }
+    std::copy_n(values.begin() + static_cast<std::ptrdiff_t>(i * numComponents),
+                numComponents, data.begin() + indices[i] * numComponents);
   }
 
-  return gltfRuntime;
+  return true;
 }
 
-void LoadBufferAsync(
-  const IGLTFRuntime& gltfRuntime, const std::string& id,
-  const std::function<void(const std::string& buffer)>& onSuccess,
-  std::function<void()>& onError)
+} // end of anonymous namespace
+
+constexpr uint32_t GLTFFileLoaderBase::BinaryMagic;
+constexpr uint32_t GLTFFileLoaderBase::BinaryChunkJSON;
+constexpr uint32_t GLTFFileLoaderBase::BinaryChunkBIN;
+
+bool GLTFFileLoaderBase::IsBinary(const uint8_t* data, size_t size)
 {
+  return size >= 4 && readUint32(data) == BinaryMagic;
 }
 
-void LoadTextureBufferAsync(
-  const IGLTFRuntime& gltfRuntime, const std::string& id,
-  const std::function<void(const std::string& buffer)>& onSuccess,
-  const std::function<void()>& onError)
+bool GLTFFileLoaderBase::ParseBinary(const uint8_t* data, size_t size,
+                                     const char*& json, size_t& jsonLength,
+                                     const uint8_t*& binaryChunk,
+                                     size_t& binaryChunkLength,
+                                     std::string& error)
 {
+  // Header: magic, version and length, followed by the chunks
+  const size_t headerLength = 12, chunkHeaderLength = 8;
+  if (size < headerLength || !IsBinary(data, size)) {
+    error = "invalid binary glTF header";
+    return false;
+  }
+
+  const auto version = readUint32(data + 4);
+  const auto length  = readUint32(data + 8);
+  if (version != 2) {
+    error = "unsupported binary glTF version " + std::to_string(version);
+    return false;
+  }
+  if (length > size) {
+    error = "truncated binary glTF file";
+    return false;
+  }
+
+  json              = nullptr;
+  jsonLength        = 0;
+  binaryChunk       = nullptr;
+  binaryChunkLength = 0;
+
+  size_t offset = headerLength;
+  while (offset + chunkHeaderLength <= length) {
+    const auto chunkLength = readUint32(data + offset);
+    const auto chunkType   = readUint32(data + offset + 4);
+    offset += chunkHeaderLength;
+    if (chunkLength > length - offset) {
+      error = "truncated binary glTF chunk";
+      return false;
+    }
+
+    // The first chunk is the JSON chunk, unknown chunks are skipped
+    if (!json && chunkType != BinaryChunkJSON) {
+      error = "the first chunk of a binary glTF file is not JSON";
+      return false;
+    }
+    else if (!json) {
+      json       = reinterpret_cast<const char*>(data + offset);
+      jsonLength = chunkLength;
+    }
+    else if (chunkType == BinaryChunkBIN && !binaryChunk) {
+      binaryChunk       = data + offset;
+      binaryChunkLength = chunkLength;
+    }
+
+    offset += chunkLength;
+  }
+
+  if (!json) {
+    error = "missing binary glTF JSON chunk";
+    return false;
+  }
+
+  return true;
 }
 
-void CreateTextureAsync(const IGLTFRuntime& gltfRuntime, const std::string& id,
-                        const std::string& buffer,
-                        const std::function<void(Texture* texture)>& onSuccess,
-                        std::function<void()>& onError)
+bool GLTFFileLoaderBase::CreateRuntime(const Json::value& parsedData,
+                                       IGLTFRuntime& gltfRuntime,
+                                       std::string& error)
 {
+  auto& rt = gltfRuntime;
+
+  // The reading of a value of unexpected type throws
+  try {
+    if (!parsedData.contains("asset")) {
+      error = "missing asset";
+      return false;
+    }
+    const auto version = Json::GetString(parsedData.get("asset"), "version");
+    if (version.empty() || version[0] != '2') {
+      error = "unsupported glTF version " + version;
+      return false;
+    }
+
+    parseArray(parsedData, "accessors", rt.accessors, parseAccessor);
+    parseArray(parsedData, "animations", rt.animations, parseAnimation);
+    parseArray(parsedData, "buffers", rt.buffers,
+               [](const Json::value& parsedBuffer) {
+                 IGLTFBuffer buffer;
+                 buffer.name = Json::GetString(parsedBuffer, "name");
+                 buffer.uri  = Json::GetString(parsedBuffer, "uri");
+                 buffer.byteLength
+                   = Json::GetNumber(parsedBuffer, "byteLength", 0ull);
+                 return buffer;
+               });
+    parseArray(parsedData, "bufferViews", rt.bufferViews,
+               [](const Json::value& parsedBufferView) {
+                 IGLTFBufferView bufferView;
+                 bufferView.name = Json::GetString(parsedBufferView, "name");
+                 bufferView.buffer = getIndex(parsedBufferView, "buffer");
+                 bufferView.byteOffset
+                   = Json::GetNumber(parsedBufferView, "byteOffset", 0ull);
+                 bufferView.byteLength
+                   = Json::GetNumber(parsedBufferView, "byteLength", 0ull);
+                 bufferView.byteStride
+                   = Json::GetNumber(parsedBufferView, "byteStride", 0ull);
+                 return bufferView;
+               });
+    parseArray(parsedData, "images", rt.images,
+               [](const Json::value& parsedImage) {
+                 IGLTFImage image;
+                 image.name       = Json::GetString(parsedImage, "name");
+                 image.uri        = Json::GetString(parsedImage, "uri");
+                 image.bufferView = getIndex(parsedImage, "bufferView");
+                 image.mimeType   = Json::GetString(parsedImage, "mimeType");
+                 return image;
+               });
+    parseArray(parsedData, "materials", rt.materials, parseMaterial);
+    parseArray(parsedData, "meshes", rt.meshes, parseMesh);
+    parseArray(parsedData, "nodes", rt.nodes, parseNode);
+    parseArray(parsedData, "samplers", rt.samplers, parseSampler);
+    parseArray(parsedData, "scenes", rt.scenes,
+               [](const Json::value& parsedScene) {
+                 IGLTFScene scene;
+                 scene.name  = Json::GetString(parsedScene, "name");
+                 scene.nodes = getIndices(parsedScene, "nodes");
+                 return scene;
+               });
+    parseArray(parsedData, "skins", rt.skins,
+               [](const Json::value& parsedSkin) {
+                 IGLTFSkin skin;
+                 skin.name = Json::GetString(parsedSkin, "name");
+                 skin.inverseBindMatrices
+                   = getIndex(parsedSkin, "inverseBindMatrices");
+                 skin.skeleton = getIndex(parsedSkin, "skeleton");
+                 skin.joints   = getIndices(parsedSkin, "joints");
+                 return skin;
+               });
+    parseArray(parsedData, "textures", rt.textures,
+               [](const Json::value& parsedTexture) {
+                 IGLTFTexture texture;
+                 texture.name    = Json::GetString(parsedTexture, "name");
+                 texture.sampler = getIndex(parsedTexture, "sampler");
+                 texture.source  = getIndex(parsedTexture, "source");
+                 return texture;
+               });
+    rt.scene = getIndex(parsedData, "scene");
+  }
+  catch (const std::exception& e) {
+    error = std::string("invalid glTF: ") + e.what();
+    return false;
+  }
+
+  error = validate(rt);
+  return error.empty();
+}
+
+bool GLTFFileLoaderBase::LoadBuffers(IGLTFRuntime& gltfRuntime,
+                                     std::string& error)
+{
+  for (size_t i = 0; i < gltfRuntime.buffers.size(); ++i) {
+    auto& buffer = gltfRuntime.buffers[i];
+    size_t size  = 0;
+    if (buffer.uri.empty()) {
+      // Binary chunk of a .glb file
+      buffer.data = gltfRuntime.binaryChunk;
+      size        = gltfRuntime.binaryChunkLength;
+    }
+    else if (GLTFUtils::IsBase64(buffer.uri)) {
+      if (!GLTFUtils::DecodeBase64(buffer.uri, buffer.decodedData)) {
+        error = "invalid data uri of buffer " + std::to_string(i);
+        return false;
+      }
+      buffer.data = buffer.decodedData.data();
+      size        = buffer.decodedData.size();
+    }
+    else {
+      const auto url = gltfRuntime.rootUrl + GLTFUtils::DecodeUri(buffer.uri);
+      if (!buffer.mappedFile.open(url)) {
+        error = "unable to open buffer file " + url;
+        return false;
+      }
+      buffer.data = buffer.mappedFile.data();
+      size        = buffer.mappedFile.size();
+    }
+
+    if (size < buffer.byteLength || (!buffer.data && buffer.byteLength > 0)) {
+      error = "buffer " + std::to_string(i) + " is shorter than its length";
+      return false;
+    }
+  }
+
+  return true;
+}
+
+const uint8_t*
+GLTFFileLoaderBase::GetBufferViewData(const IGLTFRuntime& gltfRuntime,
+                                      int bufferViewIndex)
+{
+  if (bufferViewIndex < 0
+      || static_cast<size_t>(bufferViewIndex)
+           >= gltfRuntime.bufferViews.size()) {
+    return nullptr;
+  }
+
+  const auto& bufferView = gltfRuntime.bufferViews[bufferViewIndex];
+  const auto& buffer     = gltfRuntime.buffers[bufferView.buffer];
+  if (!buffer.data || bufferView.byteOffset > buffer.byteLength
+      || bufferView.byteLength > buffer.byteLength - bufferView.byteOffset) {
+    return nullptr;
+  }
+
+  return buffer.data + bufferView.byteOffset;
 }
 
-void LoadShaderStringAsync(
-  const IGLTFRuntime& gltfRuntime, const std::string& id,
-  const std::function<void(const std::string& shaderString)>& onSuccess,
-  const std::function<void()>& onError)
+bool GLTFFileLoaderBase::GetAccessorView(const IGLTFRuntime& gltfRuntime,
+                                         const IGLTFAccessor& accessor,
+                                         IGLTFAccessorView& view)
 {
+  if (accessor.bufferView < 0) {
+    return false;
+  }
+
+  const auto& bufferView = gltfRuntime.bufferViews[accessor.bufferView];
+  return getView(gltfRuntime, accessor.bufferView, accessor.byteOffset,
+                 accessor.count, GLTFUtils::GetNumComponents(accessor.type),
+                 accessor.componentType, accessor.normalized,
+                 bufferView.byteStride, view);
+}
+
+bool GLTFFileLoaderBase::IsPackedFloat(const IGLTFAccessorView& view)
+{
+  return view.componentType == EComponentType::FLOAT
+         && view.byteStride == view.numComponents * sizeof(float);
+}
+
+bool GLTFFileLoaderBase::ReadAccessor(const IGLTFRuntime& gltfRuntime,
+                                      const IGLTFAccessor& accessor,
+                                      Float32Array& data)
+{
+  const auto numComponents = GLTFUtils::GetNumComponents(accessor.type);
+  IGLTFAccessorView view;
+  if (accessor.bufferView >= 0
+      && !GetAccessorView(gltfRuntime, accessor, view)) {
+    return false;
+  }
+
+  // Accessors without buffer view are initialized with zeros
+  data.assign(accessor.count * numComponents, 0.f);
+  if (accessor.bufferView >= 0) {
+    readElements(view, data.data());
+  }
+
+  return applySparse(gltfRuntime, accessor, numComponents, data,
+                     [](const IGLTFAccessorView& values, float* output) {
+                       readElements(values, output);
+                       return true;
+                     });
 }
 
-void LoadMaterialAsync(const IGLTFRuntime& gltfRuntime, const std::string& id,
-                       const std::function<void(Material* material)>& onSuccess,
-                       const std::function<void()>& onError)
+bool GLTFFileLoaderBase::ReadIndices(const IGLTFRuntime& gltfRuntime,
+                                     const IGLTFAccessor& accessor,
+                                     IndicesArray& indices)
 {
+  IGLTFAccessorView view;
+  if (accessor.type != "SCALAR"
+      || (accessor.bufferView >= 0
+          && !GetAccessorView(gltfRuntime, accessor, view))) {
+    return false;
+  }
+
+  indices.assign(accessor.count, 0);
+  if (accessor.bufferView >= 0 && !readIndexElements(view, indices.data())) {
+    return false;
+  }
+
+  return applySparse(gltfRuntime, accessor, 1, indices, readIndexElements);
 }
 
 } // end of namespace BABYLON
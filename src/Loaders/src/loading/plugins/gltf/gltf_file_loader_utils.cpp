@@ -1,125 +1,101 @@
 #include <babylon/loading/plugins/gltf/gltf_file_loader_utils.h>
 
-#include <babylon/engine/node.h>
-#include <babylon/engine/scene.h>
-#include <babylon/materials/shader_material.h>
-#include <babylon/materials/textures/texture.h>
-#include <babylon/math/matrix.h>
+#include <babylon/materials/textures/texture_constants.h>
 
 namespace BABYLON {
 
-void GLTFUtils::SetMatrix(Scene* scene, Node* source,
-                          const IGLTFTechniqueParameter& parameter,
-                          const std::string& uniformName,
-                          ShaderMaterial* shaderMaterial)
+bool GLTFUtils::IsBase64(const std::string& uri)
 {
-  Matrix mat;
+  return uri.size() < 5 ? false : uri.substr(0, 5) == "data:";
+}
 
-  if (parameter.semantic == "MODEL") {
-    mat = *source->getWorldMatrix();
-  }
-  else if (parameter.semantic == "PROJECTION") {
-    mat = scene->getProjectionMatrix();
-  }
-  else if (parameter.semantic == "VIEW") {
-    mat = scene->getViewMatrix();
-  }
-  else if (parameter.semantic == "MODELVIEWINVERSETRANSPOSE") {
-    mat = Matrix::Transpose(
-      source->getWorldMatrix()->multiply(scene->getViewMatrix()).invert());
-  }
-  else if (parameter.semantic == "MODELVIEW") {
-    mat = source->getWorldMatrix()->multiply(scene->getViewMatrix());
-  }
-  else if (parameter.semantic == "MODELVIEWPROJECTION") {
-    mat = source->getWorldMatrix()->multiply(scene->getTransformMatrix());
-  }
-  else if (parameter.semantic == "MODELINVERSE") {
-    mat = source->getWorldMatrix()->invert();
-  }
-  else if (parameter.semantic == "VIEWINVERSE") {
-    mat = scene->getViewMatrix().invert();
-  }
-  else if (parameter.semantic == "PROJECTIONINVERSE") {
-    mat = scene->getProjectionMatrix().invert();
-  }
-  else if (parameter.semantic == "MODELVIEWINVERSE") {
-    mat = source->getWorldMatrix()->multiply(scene->getViewMatrix()).invert();
-  }
-  else if (parameter.semantic == "MODELVIEWPROJECTIONINVERSE") {
-    mat = source->getWorldMatrix()
-            ->multiply(scene->getTransformMatrix())
-            .invert();
-  }
-  else if (parameter.semantic == "MODELINVERSETRANSPOSE") {
-    mat = Matrix::Transpose(source->getWorldMatrix()->invert());
+bool GLTFUtils::DecodeBase64(const std::string& uri, Uint8Array& data)
+{
+  const std::string marker = ";base64,";
+  const auto start         = uri.find(marker);
+  if (!IsBase64(uri) || start == std::string::npos) {
+    return false;
   }
 
-  switch (parameter.type) {
-    case EParameterType::FLOAT_MAT2:
-      shaderMaterial->setMatrix2x2(uniformName, Matrix::GetAsMatrix2x2(mat));
-      break;
-    case EParameterType::FLOAT_MAT3:
-      shaderMaterial->setMatrix3x3(uniformName, Matrix::GetAsMatrix3x3(mat));
-      break;
-    case EParameterType::FLOAT_MAT4:
-      shaderMaterial->setMatrix(uniformName, mat);
-      break;
-    default:
-      break;
-  }
-}
+  data.clear();
+  data.reserve((uri.size() - start) / 4 * 3);
 
-bool GLTFUtils::SetUniform(ShaderMaterial* shaderMaterial,
-                           const std::string& uniform, any value,
-                           EParameterType type)
-{
-  switch (type) {
-    case EParameterType::FLOAT:
-      shaderMaterial->setFloat(uniform, value._<float>());
-      return true;
-    case EParameterType::FLOAT_VEC2:
-      shaderMaterial->setVector2(uniform,
-                                 Vector2::FromArray(value._<Float32Array>()));
-      return true;
-    case EParameterType::FLOAT_VEC3:
-      shaderMaterial->setVector3(uniform,
-                                 Vector3::FromArray(value._<Float32Array>()));
-      return true;
-    case EParameterType::FLOAT_VEC4:
-      shaderMaterial->setVector4(uniform,
-                                 Vector4::FromArray(value._<Float32Array>()));
-      return true;
-    default:
+  uint32_t bits = 0;
+  int bitCount  = 0;
+  for (size_t i = start + marker.size(); i < uri.size(); ++i) {
+    const char c = uri[i];
+    int value    = 0;
+    if (c >= 'A' && c <= 'Z') {
+      value = c - 'A';
+    }
+    else if (c >= 'a' && c <= 'z') {
+      value = c - 'a' + 26;
+    }
+    else if (c >= '0' && c <= '9') {
+      value = c - '0' + 52;
+    }
+    else if (c == '+') {
+      value = 62;
+    }
+    else if (c == '/') {
+      value = 63;
+    }
+    else if (c == '=') {
+      break;
+    }
+    else {
       return false;
+    }
+
+    bits = (bits << 6) | static_cast<uint32_t>(value);
+    bitCount += 6;
+    if (bitCount >= 8) {
+      bitCount -= 8;
+      data.emplace_back(static_cast<uint8_t>((bits >> bitCount) & 0xff));
+    }
   }
+
+  return true;
 }
 
-bool GLTFUtils::IsBase64(const std::string& uri)
+std::string GLTFUtils::DecodeUri(const std::string& uri)
 {
-  return uri.size() < 5 ? false : uri.substr(0, 5) == "data:";
+  std::string decoded;
+  decoded.reserve(uri.size());
+  for (size_t i = 0; i < uri.size(); ++i) {
+    if (uri[i] == '%' && i + 2 < uri.size()
+        && std::isxdigit(static_cast<unsigned char>(uri[i + 1]))
+        && std::isxdigit(static_cast<unsigned char>(uri[i + 2]))) {
+      decoded += static_cast<char>(std::stoi(uri.substr(i + 1, 2), 0, 16));
+      i += 2;
+    }
+    else {
+      decoded += uri[i];
+    }
+  }
+  return decoded;
 }
 
 unsigned int GLTFUtils::GetWrapMode(ETextureWrapMode mode)
 {
   switch (mode) {
     case ETextureWrapMode::CLAMP_TO_EDGE:
-      return Texture::CLAMP_ADDRESSMODE;
+      return TextureConstants::CLAMP_ADDRESSMODE;
     case ETextureWrapMode::MIRRORED_REPEAT:
-      return Texture::MIRROR_ADDRESSMODE;
+      return TextureConstants::MIRROR_ADDRESSMODE;
     case ETextureWrapMode::REPEAT:
-      return Texture::WRAP_ADDRESSMODE;
+      return TextureConstants::WRAP_ADDRESSMODE;
     default:
-      return Texture::WRAP_ADDRESSMODE;
+      return TextureConstants::WRAP_ADDRESSMODE;
   }
 }
 
-unsigned int GLTFUtils::GetByteStrideFromType(const IGLTFAccessor& accessor)
+size_t GLTFUtils::GetNumComponents(const std::string& type)
 {
-  // Needs this function since "byteStride" isn't requiered in glTF format
-  const auto& type = accessor.type;
-
-  if (type == "VEC2") {
+  if (type == "SCALAR") {
+    return 1;
+  }
+  else if (type == "VEC2") {
     return 2;
   }
   else if (type == "VEC3") {
@@ -138,21 +114,41 @@ unsigned int GLTFUtils::GetByteStrideFromType(const IGLTFAccessor& accessor)
     return 16;
   }
   else {
-    return 1;
+    return 0;
   }
 }
 
-unsigned int GLTFUtils::GetTextureFilterMode(ETextureFilterType mode)
+size_t GLTFUtils::GetComponentSize(EComponentType componentType)
 {
-  switch (mode) {
+  switch (componentType) {
+    case EComponentType::BYTE:
+    case EComponentType::UNSIGNED_BYTE:
+      return 1;
+    case EComponentType::SHORT:
+    case EComponentType::UNSIGNED_SHORT:
+      return 2;
+    case EComponentType::UNSIGNED_INT:
+    case EComponentType::FLOAT:
+      return 4;
+    default:
+      return 0;
+  }
+}
+
+unsigned int GLTFUtils::GetTextureSamplingMode(const IGLTFSampler& sampler)
+{
+  if (sampler.magFilter == ETextureFilterType::NEAREST) {
+    return TextureConstants::NEAREST_SAMPLINGMODE;
+  }
+
+  switch (sampler.minFilter) {
+    case ETextureFilterType::NEAREST:
     case ETextureFilterType::LINEAR:
-    case ETextureFilterType::LINEAR_MIPMAP_NEAREST:
-    case ETextureFilterType::LINEAR_MIPMAP_LINEAR:
-      return Texture::TRILINEAR_SAMPLINGMODE;
     case ETextureFilterType::NEAREST_MIPMAP_NEAREST:
-      return Texture::NEAREST_SAMPLINGMODE;
+    case ETextureFilterType::LINEAR_MIPMAP_NEAREST:
+      return TextureConstants::BILINEAR_SAMPLINGMODE;
     default:
-      return Texture::BILINEAR_SAMPLINGMODE;
+      return TextureConstants::TRILINEAR_SAMPLINGMODE;
   }
 }
 
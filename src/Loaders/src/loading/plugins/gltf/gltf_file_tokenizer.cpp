@@ -2,8 +2,21 @@
 
 namespace BABYLON {
 
+namespace {
+
+bool isIdentifierCharacter(char c)
+{
+  return c == '_' || std::isalnum(static_cast<unsigned char>(c));
+}
+
+} // end of anonymous namespace
+
 Tokenizer::Tokenizer(const std::string& toParse)
-    : _toParse{toParse}, _maxPos{toParse.size()}
+    : currentToken{ETokenType::UNKNOWN}
+    , currentString{' '}
+    , _toParse{toParse}
+    , _pos{0}
+    , _maxPos{toParse.size()}
 {
 }
 
@@ -20,15 +33,18 @@ ETokenType Tokenizer::getNextToken()
   currentString = read();
   currentToken  = ETokenType::UNKNOWN;
 
-  if (currentString == '_' || std::isalnum(currentString)) {
+  if (isIdentifierCharacter(currentString)) {
     currentToken      = ETokenType::IDENTIFIER;
     currentIdentifier = currentString;
     while (!isEnd()) {
       currentString = peek();
-      if (std::isalnum(currentString) || currentString == '_') {
+      if (isIdentifierCharacter(currentString)) {
         currentIdentifier += currentString;
         forward();
       }
+      else {
+        break;
+      }
     }
   }
 
@@ -37,7 +53,7 @@ ETokenType Tokenizer::getNextToken()
 
 char Tokenizer::peek() const
 {
-  if (!isEnd()) {
+  if (isEnd()) {
     return ' ';
   }
 
@@ -0,0 +1,256 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/core/json.h>
+#include <babylon/loading/plugins/gltf/gltf_file_loader_base.h>
+#include <babylon/loading/plugins/gltf/gltf_file_loader_utils.h>
+
+namespace {
+
+template <typename T>
+void append(BABYLON::Uint8Array& data, const std::vector<T>& values)
+{
+  const auto bytes = reinterpret_cast<const uint8_t*>(values.data());
+  data.insert(data.end(), bytes, bytes + values.size() * sizeof(T));
+}
+
+void appendUint32(std::string& data, uint32_t value)
+{
+  data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+std::string encodeBase64(const BABYLON::Uint8Array& data)
+{
+  static const char* chars
+    = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string encoded;
+  for (size_t i = 0; i < data.size(); i += 3) {
+    uint32_t bits = static_cast<uint32_t>(data[i]) << 16;
+    bits |= (i + 1 < data.size()) ? static_cast<uint32_t>(data[i + 1]) << 8 : 0;
+    bits |= (i + 2 < data.size()) ? data[i + 2] : 0;
+    encoded += chars[(bits >> 18) & 63];
+    encoded += chars[(bits >> 12) & 63];
+    encoded += (i + 1 < data.size()) ? chars[(bits >> 6) & 63] : '=';
+    encoded += (i + 2 < data.size()) ? chars[bits & 63] : '=';
+  }
+  return encoded;
+}
+
+/**
+ * Buffer of the test asset:
+ * - 0: 3 positions (floats)
+ * - 36: 2 normalized short vec2, with a stride of 8 bytes
+ * - 52: 3 unsigned short indices and 2 bytes of padding
+ * - 60: sparse index (unsigned byte) and 3 bytes of padding
+ * - 64: sparse value (float vec3)
+ */
+BABYLON::Uint8Array createBuffer()
+{
+  BABYLON::Uint8Array data;
+  append<float>(data, {0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f});
+  append<int16_t>(data, {32767, -32768, 0, 0, -16384, 16384, 0, 0});
+  append<uint16_t>(data, {0, 2, 1, 0});
+  append<uint8_t>(data, {1, 0, 0, 0});
+  append<float>(data, {9.f, 9.f, 9.f});
+  return data;
+}
+
+std::string createJson(const std::string& bufferUri, size_t byteLength)
+{
+  const auto uri = bufferUri.empty() ? "" : "\"uri\": \"" + bufferUri + "\", ";
+  return R"({
+    "asset": {"version": "2.0"},
+    "buffers": [{)" + uri + "\"byteLength\": " + std::to_string(byteLength)
+         + R"(}],
+    "bufferViews": [
+      {"buffer": 0, "byteOffset": 0, "byteLength": 36},
+      {"buffer": 0, "byteOffset": 36, "byteLength": 16, "byteStride": 8},
+      {"buffer": 0, "byteOffset": 52, "byteLength": 6},
+      {"buffer": 0, "byteOffset": 60, "byteLength": 1},
+      {"buffer": 0, "byteOffset": 64, "byteLength": 12}
+    ],
+    "accessors": [
+      {"bufferView": 0, "componentType": 5126, "count": 3, "type": "VEC3"},
+      {"bufferView": 1, "componentType": 5122, "normalized": true,
+       "count": 2, "type": "VEC2"},
+      {"bufferView": 2, "componentType": 5123, "count": 3, "type": "SCALAR"},
+      {"bufferView": 0, "componentType": 5126, "count": 3, "type": "VEC3",
+       "sparse": {"count": 1,
+                  "indices": {"bufferView": 3, "componentType": 5121},
+                  "values": {"bufferView": 4}}}
+    ],
+    "nodes": [{"name": "root", "children": [1]}, {"name": "child"}],
+    "scenes": [{"nodes": [0]}],
+    "scene": 0
+  })";
+}
+
+bool createRuntime(const std::string& json, BABYLON::IGLTFRuntime& gltfRuntime,
+                   std::string& error)
+{
+  BABYLON::Json::value parsedData;
+  error = BABYLON::Json::Parse(parsedData, json.c_str(), json.size());
+  return error.empty()
+         && BABYLON::GLTFFileLoaderBase::CreateRuntime(parsedData, gltfRuntime,
+                                                       error);
+}
+
+} // end of anonymous namespace
+
+TEST(TestGLTFFileLoaderBase, CreateRuntime)
+{
+  using namespace BABYLON;
+
+  IGLTFRuntime gltfRuntime;
+  std::string error;
+  EXPECT_TRUE(createRuntime(createJson("data.bin", 76), gltfRuntime, error));
+  EXPECT_EQ(error, "");
+  EXPECT_EQ(gltfRuntime.accessors.size(), 4ull);
+  EXPECT_EQ(gltfRuntime.bufferViews[1].byteStride, 8ull);
+  EXPECT_TRUE(gltfRuntime.accessors[1].normalized);
+  EXPECT_EQ(gltfRuntime.accessors[3].sparse.count, 1ull);
+  EXPECT_EQ(gltfRuntime.nodes[1].parent, 0);
+  EXPECT_EQ(gltfRuntime.scene, 0);
+
+  // Invalid references and unsupported versions
+  IGLTFRuntime invalidRuntime;
+  auto json = createJson("data.bin", 76);
+  json.replace(json.find("\"bufferView\": 2"), 15, "\"bufferView\": 7");
+  EXPECT_FALSE(createRuntime(json, invalidRuntime, error));
+  EXPECT_FALSE(error.empty());
+  IGLTFRuntime cyclicRuntime;
+  json = createJson("data.bin", 76);
+  json.replace(json.find("{\"name\": \"child\"}"), 17,
+               "{\"name\": \"child\", \"children\": [0]}");
+  EXPECT_FALSE(createRuntime(json, cyclicRuntime, error));
+  IGLTFRuntime versionRuntime;
+  json = createJson("data.bin", 76);
+  json.replace(json.find("2.0"), 3, "1.0");
+  EXPECT_FALSE(createRuntime(json, versionRuntime, error));
+}
+
+TEST(TestGLTFFileLoaderBase, ReadAccessors)
+{
+  using namespace BABYLON;
+
+  const auto buffer = createBuffer();
+  const auto uri
+    = "data:application/octet-stream;base64," + encodeBase64(buffer);
+  IGLTFRuntime gltfRuntime;
+  std::string error;
+  ASSERT_TRUE(
+    createRuntime(createJson(uri, buffer.size()), gltfRuntime, error));
+  ASSERT_TRUE(GLTFFileLoaderBase::LoadBuffers(gltfRuntime, error));
+  EXPECT_EQ(gltfRuntime.buffers[0].decodedData, buffer);
+
+  // Tightly packed floats, read in place
+  IGLTFAccessorView view;
+  ASSERT_TRUE(GLTFFileLoaderBase::GetAccessorView(
+    gltfRuntime, gltfRuntime.accessors[0], view));
+  EXPECT_TRUE(GLTFFileLoaderBase::IsPackedFloat(view));
+  EXPECT_EQ(view.data, gltfRuntime.buffers[0].data);
+  Float32Array positions;
+  ASSERT_TRUE(GLTFFileLoaderBase::ReadAccessor(
+    gltfRuntime, gltfRuntime.accessors[0], positions));
+  EXPECT_THAT(positions, ::testing::ElementsAre(0.f, 0.f, 0.f, 1.f, 0.f, 0.f,
+                                                0.f, 1.f, 0.f));
+
+  // Normalized shorts, with a stride
+  ASSERT_TRUE(GLTFFileLoaderBase::GetAccessorView(
+    gltfRuntime, gltfRuntime.accessors[1], view));
+  EXPECT_FALSE(GLTFFileLoaderBase::IsPackedFloat(view));
+  EXPECT_EQ(view.byteStride, 8ull);
+  Float32Array uvs;
+  ASSERT_TRUE(GLTFFileLoaderBase::ReadAccessor(
+    gltfRuntime, gltfRuntime.accessors[1], uvs));
+  ASSERT_EQ(uvs.size(), 4ull);
+  EXPECT_FLOAT_EQ(uvs[0], 1.f);
+  EXPECT_FLOAT_EQ(uvs[1], -1.f);
+  EXPECT_NEAR(uvs[2], -0.5f, 1e-4f);
+  EXPECT_NEAR(uvs[3], 0.5f, 1e-4f);
+
+  // Indices
+  IndicesArray indices;
+  ASSERT_TRUE(GLTFFileLoaderBase::ReadIndices(
+    gltfRuntime, gltfRuntime.accessors[2], indices));
+  EXPECT_THAT(indices, ::testing::ElementsAre(0u, 2u, 1u));
+  EXPECT_FALSE(GLTFFileLoaderBase::ReadIndices(
+    gltfRuntime, gltfRuntime.accessors[0], indices));
+
+  // Sparse values replace the elements of the buffer view
+  Float32Array sparse;
+  ASSERT_TRUE(GLTFFileLoaderBase::ReadAccessor(
+    gltfRuntime, gltfRuntime.accessors[3], sparse));
+  EXPECT_THAT(sparse, ::testing::ElementsAre(0.f, 0.f, 0.f, 9.f, 9.f, 9.f,
+                                             0.f, 1.f, 0.f));
+
+  // Out of the bounds of the buffer view
+  auto accessor  = gltfRuntime.accessors[0];
+  accessor.count = 4;
+  EXPECT_FALSE(
+    GLTFFileLoaderBase::GetAccessorView(gltfRuntime, accessor, view));
+  EXPECT_FALSE(
+    GLTFFileLoaderBase::ReadAccessor(gltfRuntime, accessor, positions));
+}
+
+TEST(TestGLTFFileLoaderBase, ParseBinary)
+{
+  using namespace BABYLON;
+
+  const auto buffer = createBuffer();
+  auto json         = createJson("", buffer.size());
+  json.resize((json.size() + 3) / 4 * 4, ' ');
+
+  std::string glb;
+  appendUint32(glb, GLTFFileLoaderBase::BinaryMagic);
+  appendUint32(glb, 2);
+  appendUint32(glb, static_cast<uint32_t>(12 + 8 + json.size() + 8
+                                          + buffer.size()));
+  appendUint32(glb, static_cast<uint32_t>(json.size()));
+  appendUint32(glb, GLTFFileLoaderBase::BinaryChunkJSON);
+  glb += json;
+  appendUint32(glb, static_cast<uint32_t>(buffer.size()));
+  appendUint32(glb, GLTFFileLoaderBase::BinaryChunkBIN);
+  glb.append(buffer.begin(), buffer.end());
+
+  const auto data = reinterpret_cast<const uint8_t*>(glb.data());
+  EXPECT_TRUE(GLTFFileLoaderBase::IsBinary(data, glb.size()));
+  EXPECT_FALSE(GLTFFileLoaderBase::IsBinary(
+    reinterpret_cast<const uint8_t*>(json.data()), json.size()));
+
+  const char* jsonChunk = nullptr;
+  size_t jsonLength     = 0;
+  IGLTFRuntime gltfRuntime;
+  std::string error;
+  ASSERT_TRUE(GLTFFileLoaderBase::ParseBinary(
+    data, glb.size(), jsonChunk, jsonLength, gltfRuntime.binaryChunk,
+    gltfRuntime.binaryChunkLength, error));
+  EXPECT_EQ(std::string(jsonChunk, jsonLength), json);
+  EXPECT_EQ(gltfRuntime.binaryChunkLength, buffer.size());
+
+  // The buffer without uri is the binary chunk
+  ASSERT_TRUE(createRuntime(std::string(jsonChunk, jsonLength), gltfRuntime,
+                            error));
+  ASSERT_TRUE(GLTFFileLoaderBase::LoadBuffers(gltfRuntime, error));
+  EXPECT_EQ(gltfRuntime.buffers[0].data, gltfRuntime.binaryChunk);
+
+  // Truncated file
+  EXPECT_FALSE(GLTFFileLoaderBase::ParseBinary(data, glb.size() - 1,
+                                               jsonChunk, jsonLength,
+                                               gltfRuntime.binaryChunk,
+                                               gltfRuntime.binaryChunkLength,
+                                               error));
+}
+
+TEST(TestGLTFFileLoaderBase, Utils)
+{
+  using namespace BABYLON;
+
+  Uint8Array data;
+  EXPECT_TRUE(GLTFUtils::DecodeBase64("data:;base64,AQID", data));
+  EXPECT_THAT(data, ::testing::ElementsAre(1, 2, 3));
+  EXPECT_FALSE(GLTFUtils::DecodeBase64("data.bin", data));
+  EXPECT_EQ(GLTFUtils::DecodeUri("my%20file.bin"), "my file.bin");
+  EXPECT_EQ(GLTFUtils::GetNumComponents("MAT4"), 16ull);
+  EXPECT_EQ(GLTFUtils::GetNumComponents("VEC5"), 0ull);
+}